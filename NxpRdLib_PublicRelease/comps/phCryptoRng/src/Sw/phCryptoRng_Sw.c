@@ -0,0 +1,84 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Random Number Generator Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phCryptoRng.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_CRYPTORNG_SW
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "phCryptoRng_Sw.h"
+
+phStatus_t phCryptoRng_Sw_Init(
+                               phCryptoRng_Sw_DataParams_t * pDataParams,
+                               uint16_t wSizeOfDataParams
+                               )
+{
+    if (sizeof(phCryptoRng_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTORNG);
+    }
+    PH_ASSERT_NULL (pDataParams);
+
+    /* init private data */
+    pDataParams->wId = PH_COMP_CRYPTORNG | PH_CRYPTORNG_SW_ID;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTORNG);
+}
+
+phStatus_t phCryptoRng_Sw_Rnd(
+                              phCryptoRng_Sw_DataParams_t * pDataParams,
+                              uint16_t wNoOfRndBytes,
+                              uint8_t * pRnd
+                              )
+{
+    long        PH_MEMLOC_REM lLength;
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+
+    /* satisfy compiler */
+    if (pDataParams);
+
+    /* the syscall also works with a C library older than getrandom() itself */
+    while (wOffset < wNoOfRndBytes)
+    {
+        lLength = syscall(SYS_getrandom, &pRnd[wOffset], (size_t)(wNoOfRndBytes - wOffset), 0);
+        if (lLength < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_CRYPTORNG);
+        }
+        wOffset = (uint16_t)(wOffset + lLength);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTORNG);
+}
+
+#endif /* NXPBUILD__PH_CRYPTORNG_SW */
@@ -0,0 +1,353 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Symmetric Cryptography Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+#include <phKeyStore.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+#include <string.h>
+#include "phCryptoSym_Sw.h"
+#include "phCryptoSym_Sw_Des.h"
+
+static phStatus_t phCryptoSym_Sw_CheckCipher(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint16_t wOption,
+    uint16_t wBufferLength
+    );
+
+static void phCryptoSym_Sw_CipherBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock,
+    uint8_t bDecrypt
+    );
+
+phStatus_t phCryptoSym_Sw_Init(
+                               phCryptoSym_Sw_DataParams_t * pDataParams,
+                               uint16_t wSizeOfDataParams,
+                               void * pKeyStoreDataParams
+                               )
+{
+    if (sizeof(phCryptoSym_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+    PH_ASSERT_NULL (pDataParams);
+
+    /* init private data */
+    pDataParams->wId                    = PH_COMP_CRYPTOSYM | PH_CRYPTOSYM_SW_ID;
+    pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
+    pDataParams->bConstantTime          = PH_OFF;
+
+    return phCryptoSym_Sw_InvalidateKey(pDataParams);
+}
+
+phStatus_t phCryptoSym_Sw_LoadKey(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wKeyNo,
+                                  uint16_t wKeyVersion,
+                                  uint16_t wKeyType
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM aKey[3 * PH_CRYPTOSYM_DES_KEY_SIZE];
+    uint16_t    PH_MEMLOC_REM wStoredKeyType;
+
+    if (pDataParams->pKeyStoreDataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_CRYPTOSYM);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNo,
+        wKeyVersion,
+        sizeof(aKey),
+        aKey,
+        &wStoredKeyType));
+
+    if (wStoredKeyType != wKeyType)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_CRYPTOSYM);
+    }
+    else
+    {
+        status = phCryptoSym_Sw_LoadKeyDirect(pDataParams, aKey, wKeyType);
+    }
+
+    /* do not leave the key on the stack */
+    memset(aKey, 0x00, sizeof(aKey));  /* PRQA S 3200 */
+
+    return status;
+}
+
+phStatus_t phCryptoSym_Sw_LoadKeyDirect(
+                                        phCryptoSym_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pKey,
+                                        uint16_t wKeyType
+                                        )
+{
+    uint8_t * PH_MEMLOC_REM pKeys[3];
+    uint8_t   PH_MEMLOC_COUNT bIndex;
+
+    switch (wKeyType)
+    {
+    case PH_CRYPTOSYM_KEY_TYPE_DES:
+        pKeys[0] = pKey;
+        pKeys[1] = pKey;
+        pKeys[2] = pKey;
+        break;
+    case PH_CRYPTOSYM_KEY_TYPE_2K3DES:
+        pKeys[0] = pKey;
+        pKeys[1] = &pKey[PH_CRYPTOSYM_DES_KEY_SIZE];
+        pKeys[2] = pKey;
+        break;
+    case PH_CRYPTOSYM_KEY_TYPE_3K3DES:
+        pKeys[0] = pKey;
+        pKeys[1] = &pKey[PH_CRYPTOSYM_DES_KEY_SIZE];
+        pKeys[2] = &pKey[2 * PH_CRYPTOSYM_DES_KEY_SIZE];
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    /* expand once here, so the blocks only run the rounds */
+    for (bIndex = 0; bIndex < 3; ++bIndex)
+    {
+        phCryptoSym_Sw_Des_KeySchedule(pKeys[bIndex], PH_OFF, pDataParams->aEncKeys[bIndex]);
+        phCryptoSym_Sw_Des_KeySchedule(pKeys[bIndex], PH_ON, pDataParams->aDecKeys[bIndex]);
+    }
+    pDataParams->wKeyType = wKeyType;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_LoadIv(
+                                 phCryptoSym_Sw_DataParams_t * pDataParams,
+                                 uint8_t * pIV,
+                                 uint8_t bIVLength
+                                 )
+{
+    if (bIVLength != PH_CRYPTOSYM_DES_BLOCK_SIZE)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    memcpy(pDataParams->pIV, pIV, PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_Encrypt(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pPlainBuffer,
+                                  uint16_t wBufferLength,
+                                  uint8_t * pEncryptedBuffer
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    uint16_t    PH_MEMLOC_COUNT wOffset;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_CheckCipher(pDataParams, wOption, wBufferLength));
+
+    for (wOffset = 0; wOffset < wBufferLength; wOffset += PH_CRYPTOSYM_DES_BLOCK_SIZE)
+    {
+        for (bIndex = 0; bIndex < PH_CRYPTOSYM_DES_BLOCK_SIZE; ++bIndex)
+        {
+            pEncryptedBuffer[wOffset + bIndex] = pPlainBuffer[wOffset + bIndex];
+            if (wOption == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+            {
+                pEncryptedBuffer[wOffset + bIndex] ^= pDataParams->pIV[bIndex];
+            }
+        }
+
+        phCryptoSym_Sw_CipherBlock(pDataParams, &pEncryptedBuffer[wOffset], PH_OFF);
+
+        if (wOption == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+        {
+            memcpy(pDataParams->pIV, &pEncryptedBuffer[wOffset], PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_Decrypt(
+                                  phCryptoSym_Sw_DataParams_t * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pEncryptedBuffer,
+                                  uint16_t wBufferLength,
+                                  uint8_t * pPlainBuffer
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aCipher[PH_CRYPTOSYM_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    uint16_t    PH_MEMLOC_COUNT wOffset;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Sw_CheckCipher(pDataParams, wOption, wBufferLength));
+
+    for (wOffset = 0; wOffset < wBufferLength; wOffset += PH_CRYPTOSYM_DES_BLOCK_SIZE)
+    {
+        /* keep the cipher block for the chain, the buffers may be the same */
+        memcpy(aCipher, &pEncryptedBuffer[wOffset], PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+        memcpy(&pPlainBuffer[wOffset], aCipher, PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+
+        phCryptoSym_Sw_CipherBlock(pDataParams, &pPlainBuffer[wOffset], PH_ON);
+
+        if (wOption == PH_CRYPTOSYM_CIPHER_MODE_CBC)
+        {
+            for (bIndex = 0; bIndex < PH_CRYPTOSYM_DES_BLOCK_SIZE; ++bIndex)
+            {
+                pPlainBuffer[wOffset + bIndex] ^= pDataParams->pIV[bIndex];
+            }
+            memcpy(pDataParams->pIV, aCipher, PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_InvalidateKey(
+                                        phCryptoSym_Sw_DataParams_t * pDataParams
+                                        )
+{
+    memset(pDataParams->aEncKeys, 0x00, sizeof(pDataParams->aEncKeys));  /* PRQA S 3200 */
+    memset(pDataParams->aDecKeys, 0x00, sizeof(pDataParams->aDecKeys));  /* PRQA S 3200 */
+    memset(pDataParams->pIV, 0x00, PH_CRYPTOSYM_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+    pDataParams->wKeyType = PH_CRYPTOSYM_KEY_TYPE_INVALID;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_SetConfig(
+                                    phCryptoSym_Sw_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t wValue
+                                    )
+{
+    switch (wConfig)
+    {
+    case PH_CRYPTOSYM_CONFIG_CONSTANT_TIME:
+        if ((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+        }
+        pDataParams->bConstantTime = (uint8_t)wValue;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Sw_GetConfig(
+                                    phCryptoSym_Sw_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t * pValue
+                                    )
+{
+    switch (wConfig)
+    {
+    case PH_CRYPTOSYM_CONFIG_KEY_TYPE:
+        *pValue = pDataParams->wKeyType;
+        break;
+    case PH_CRYPTOSYM_CONFIG_BLOCK_SIZE:
+        *pValue = (pDataParams->wKeyType == PH_CRYPTOSYM_KEY_TYPE_INVALID) ? 0 : PH_CRYPTOSYM_DES_BLOCK_SIZE;
+        break;
+    case PH_CRYPTOSYM_CONFIG_CONSTANT_TIME:
+        *pValue = (uint16_t)pDataParams->bConstantTime;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+static phStatus_t phCryptoSym_Sw_CheckCipher(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint16_t wOption,
+    uint16_t wBufferLength
+    )
+{
+    if (pDataParams->wKeyType == PH_CRYPTOSYM_KEY_TYPE_INVALID)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_CRYPTOSYM);
+    }
+
+    if (((wOption != PH_CRYPTOSYM_CIPHER_MODE_ECB) && (wOption != PH_CRYPTOSYM_CIPHER_MODE_CBC)) ||
+        ((wBufferLength % PH_CRYPTOSYM_DES_BLOCK_SIZE) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_CRYPTOSYM);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_CRYPTOSYM);
+}
+
+static void phCryptoSym_Sw_CipherBlock(
+    phCryptoSym_Sw_DataParams_t * pDataParams,
+    uint8_t * pBlock,
+    uint8_t bDecrypt
+    )
+{
+    uint32_t    PH_MEMLOC_REM aBlock[2];
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    aBlock[0] = ((uint32_t)pBlock[0] << 24) | ((uint32_t)pBlock[1] << 16) | ((uint32_t)pBlock[2] << 8) | (uint32_t)pBlock[3];
+    aBlock[1] = ((uint32_t)pBlock[4] << 24) | ((uint32_t)pBlock[5] << 16) | ((uint32_t)pBlock[6] << 8) | (uint32_t)pBlock[7];
+
+    if (pDataParams->wKeyType == PH_CRYPTOSYM_KEY_TYPE_DES)
+    {
+        phCryptoSym_Sw_Des_Block(aBlock, (bDecrypt != PH_OFF) ? pDataParams->aDecKeys[0] : pDataParams->aEncKeys[0], pDataParams->bConstantTime);
+    }
+    else if (bDecrypt == PH_OFF)
+    {
+        /* encrypt, decrypt, encrypt */
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aEncKeys[0], pDataParams->bConstantTime);
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aDecKeys[1], pDataParams->bConstantTime);
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aEncKeys[2], pDataParams->bConstantTime);
+    }
+    else
+    {
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aDecKeys[2], pDataParams->bConstantTime);
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aEncKeys[1], pDataParams->bConstantTime);
+        phCryptoSym_Sw_Des_Block(aBlock, pDataParams->aDecKeys[0], pDataParams->bConstantTime);
+    }
+
+    for (bIndex = 0; bIndex < 4; ++bIndex)
+    {
+        pBlock[bIndex] = (uint8_t)(aBlock[0] >> (24 - (bIndex << 3)));
+        pBlock[bIndex + 4] = (uint8_t)(aBlock[1] >> (24 - (bIndex << 3)));
+    }
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
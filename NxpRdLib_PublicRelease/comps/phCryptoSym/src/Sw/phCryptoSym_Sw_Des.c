@@ -0,0 +1,388 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software DES primitive of the Symmetric Cryptography Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+#include "phCryptoSym_Sw_Des.h"
+
+/* Permuted choice 1, bit numbers of the key starting at 0 for the MSB of byte 0 */
+static const uint8_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_PC1[56] =
+{
+    56, 48, 40, 32, 24, 16,  8,  0, 57, 49, 41, 33, 25, 17,
+     9,  1, 58, 50, 42, 34, 26, 18, 10,  2, 59, 51, 43, 35,
+    62, 54, 46, 38, 30, 22, 14,  6, 61, 53, 45, 37, 29, 21,
+    13,  5, 60, 52, 44, 36, 28, 20, 12,  4, 27, 19, 11,  3
+};
+
+/* Permuted choice 2 */
+static const uint8_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_PC2[48] =
+{
+    13, 16, 10, 23,  0,  4,  2, 27, 14,  5, 20,  9,
+    22, 18, 11,  3, 25,  7, 15,  6, 26, 19, 12,  1,
+    40, 51, 30, 36, 46, 54, 29, 39, 50, 44, 32, 47,
+    43, 48, 38, 55, 33, 52, 45, 41, 49, 35, 28, 31
+};
+
+/* Accumulated left rotations of the key halves per round */
+static const uint8_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_Rotations[16] =
+{
+    1, 2, 4, 6, 8, 10, 12, 14, 15, 17, 19, 21, 23, 25, 27, 28
+};
+
+/* S-boxes combined with the P permutation, the result is rotated left by one bit like the halves of the block */
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP1[64] =
+{
+    0x01010400U, 0x00000000U, 0x00010000U, 0x01010404U,
+    0x01010004U, 0x00010404U, 0x00000004U, 0x00010000U,
+    0x00000400U, 0x01010400U, 0x01010404U, 0x00000400U,
+    0x01000404U, 0x01010004U, 0x01000000U, 0x00000004U,
+    0x00000404U, 0x01000400U, 0x01000400U, 0x00010400U,
+    0x00010400U, 0x01010000U, 0x01010000U, 0x01000404U,
+    0x00010004U, 0x01000004U, 0x01000004U, 0x00010004U,
+    0x00000000U, 0x00000404U, 0x00010404U, 0x01000000U,
+    0x00010000U, 0x01010404U, 0x00000004U, 0x01010000U,
+    0x01010400U, 0x01000000U, 0x01000000U, 0x00000400U,
+    0x01010004U, 0x00010000U, 0x00010400U, 0x01000004U,
+    0x00000400U, 0x00000004U, 0x01000404U, 0x00010404U,
+    0x01010404U, 0x00010004U, 0x01010000U, 0x01000404U,
+    0x01000004U, 0x00000404U, 0x00010404U, 0x01010400U,
+    0x00000404U, 0x01000400U, 0x01000400U, 0x00000000U,
+    0x00010004U, 0x00010400U, 0x00000000U, 0x01010004U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP2[64] =
+{
+    0x80108020U, 0x80008000U, 0x00008000U, 0x00108020U,
+    0x00100000U, 0x00000020U, 0x80100020U, 0x80008020U,
+    0x80000020U, 0x80108020U, 0x80108000U, 0x80000000U,
+    0x80008000U, 0x00100000U, 0x00000020U, 0x80100020U,
+    0x00108000U, 0x00100020U, 0x80008020U, 0x00000000U,
+    0x80000000U, 0x00008000U, 0x00108020U, 0x80100000U,
+    0x00100020U, 0x80000020U, 0x00000000U, 0x00108000U,
+    0x00008020U, 0x80108000U, 0x80100000U, 0x00008020U,
+    0x00000000U, 0x00108020U, 0x80100020U, 0x00100000U,
+    0x80008020U, 0x80100000U, 0x80108000U, 0x00008000U,
+    0x80100000U, 0x80008000U, 0x00000020U, 0x80108020U,
+    0x00108020U, 0x00000020U, 0x00008000U, 0x80000000U,
+    0x00008020U, 0x80108000U, 0x00100000U, 0x80000020U,
+    0x00100020U, 0x80008020U, 0x80000020U, 0x00100020U,
+    0x00108000U, 0x00000000U, 0x80008000U, 0x00008020U,
+    0x80000000U, 0x80100020U, 0x80108020U, 0x00108000U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP3[64] =
+{
+    0x00000208U, 0x08020200U, 0x00000000U, 0x08020008U,
+    0x08000200U, 0x00000000U, 0x00020208U, 0x08000200U,
+    0x00020008U, 0x08000008U, 0x08000008U, 0x00020000U,
+    0x08020208U, 0x00020008U, 0x08020000U, 0x00000208U,
+    0x08000000U, 0x00000008U, 0x08020200U, 0x00000200U,
+    0x00020200U, 0x08020000U, 0x08020008U, 0x00020208U,
+    0x08000208U, 0x00020200U, 0x00020000U, 0x08000208U,
+    0x00000008U, 0x08020208U, 0x00000200U, 0x08000000U,
+    0x08020200U, 0x08000000U, 0x00020008U, 0x00000208U,
+    0x00020000U, 0x08020200U, 0x08000200U, 0x00000000U,
+    0x00000200U, 0x00020008U, 0x08020208U, 0x08000200U,
+    0x08000008U, 0x00000200U, 0x00000000U, 0x08020008U,
+    0x08000208U, 0x00020000U, 0x08000000U, 0x08020208U,
+    0x00000008U, 0x00020208U, 0x00020200U, 0x08000008U,
+    0x08020000U, 0x08000208U, 0x00000208U, 0x08020000U,
+    0x00020208U, 0x00000008U, 0x08020008U, 0x00020200U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP4[64] =
+{
+    0x00802001U, 0x00002081U, 0x00002081U, 0x00000080U,
+    0x00802080U, 0x00800081U, 0x00800001U, 0x00002001U,
+    0x00000000U, 0x00802000U, 0x00802000U, 0x00802081U,
+    0x00000081U, 0x00000000U, 0x00800080U, 0x00800001U,
+    0x00000001U, 0x00002000U, 0x00800000U, 0x00802001U,
+    0x00000080U, 0x00800000U, 0x00002001U, 0x00002080U,
+    0x00800081U, 0x00000001U, 0x00002080U, 0x00800080U,
+    0x00002000U, 0x00802080U, 0x00802081U, 0x00000081U,
+    0x00800080U, 0x00800001U, 0x00802000U, 0x00802081U,
+    0x00000081U, 0x00000000U, 0x00000000U, 0x00802000U,
+    0x00002080U, 0x00800080U, 0x00800081U, 0x00000001U,
+    0x00802001U, 0x00002081U, 0x00002081U, 0x00000080U,
+    0x00802081U, 0x00000081U, 0x00000001U, 0x00002000U,
+    0x00800001U, 0x00002001U, 0x00802080U, 0x00800081U,
+    0x00002001U, 0x00002080U, 0x00800000U, 0x00802001U,
+    0x00000080U, 0x00800000U, 0x00002000U, 0x00802080U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP5[64] =
+{
+    0x00000100U, 0x02080100U, 0x02080000U, 0x42000100U,
+    0x00080000U, 0x00000100U, 0x40000000U, 0x02080000U,
+    0x40080100U, 0x00080000U, 0x02000100U, 0x40080100U,
+    0x42000100U, 0x42080000U, 0x00080100U, 0x40000000U,
+    0x02000000U, 0x40080000U, 0x40080000U, 0x00000000U,
+    0x40000100U, 0x42080100U, 0x42080100U, 0x02000100U,
+    0x42080000U, 0x40000100U, 0x00000000U, 0x42000000U,
+    0x02080100U, 0x02000000U, 0x42000000U, 0x00080100U,
+    0x00080000U, 0x42000100U, 0x00000100U, 0x02000000U,
+    0x40000000U, 0x02080000U, 0x42000100U, 0x40080100U,
+    0x02000100U, 0x40000000U, 0x42080000U, 0x02080100U,
+    0x40080100U, 0x00000100U, 0x02000000U, 0x42080000U,
+    0x42080100U, 0x00080100U, 0x42000000U, 0x42080100U,
+    0x02080000U, 0x00000000U, 0x40080000U, 0x42000000U,
+    0x00080100U, 0x02000100U, 0x40000100U, 0x00080000U,
+    0x00000000U, 0x40080000U, 0x02080100U, 0x40000100U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP6[64] =
+{
+    0x20000010U, 0x20400000U, 0x00004000U, 0x20404010U,
+    0x20400000U, 0x00000010U, 0x20404010U, 0x00400000U,
+    0x20004000U, 0x00404010U, 0x00400000U, 0x20000010U,
+    0x00400010U, 0x20004000U, 0x20000000U, 0x00004010U,
+    0x00000000U, 0x00400010U, 0x20004010U, 0x00004000U,
+    0x00404000U, 0x20004010U, 0x00000010U, 0x20400010U,
+    0x20400010U, 0x00000000U, 0x00404010U, 0x20404000U,
+    0x00004010U, 0x00404000U, 0x20404000U, 0x20000000U,
+    0x20004000U, 0x00000010U, 0x20400010U, 0x00404000U,
+    0x20404010U, 0x00400000U, 0x00004010U, 0x20000010U,
+    0x00400000U, 0x20004000U, 0x20000000U, 0x00004010U,
+    0x20000010U, 0x20404010U, 0x00404000U, 0x20400000U,
+    0x00404010U, 0x20404000U, 0x00000000U, 0x20400010U,
+    0x00000010U, 0x00004000U, 0x20400000U, 0x00404010U,
+    0x00004000U, 0x00400010U, 0x20004010U, 0x00000000U,
+    0x20404000U, 0x20000000U, 0x00400010U, 0x20004010U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP7[64] =
+{
+    0x00200000U, 0x04200002U, 0x04000802U, 0x00000000U,
+    0x00000800U, 0x04000802U, 0x00200802U, 0x04200800U,
+    0x04200802U, 0x00200000U, 0x00000000U, 0x04000002U,
+    0x00000002U, 0x04000000U, 0x04200002U, 0x00000802U,
+    0x04000800U, 0x00200802U, 0x00200002U, 0x04000800U,
+    0x04000002U, 0x04200000U, 0x04200800U, 0x00200002U,
+    0x04200000U, 0x00000800U, 0x00000802U, 0x04200802U,
+    0x00200800U, 0x00000002U, 0x04000000U, 0x00200800U,
+    0x04000000U, 0x00200800U, 0x00200000U, 0x04000802U,
+    0x04000802U, 0x04200002U, 0x04200002U, 0x00000002U,
+    0x00200002U, 0x04000000U, 0x04000800U, 0x00200000U,
+    0x04200800U, 0x00000802U, 0x00200802U, 0x04200800U,
+    0x00000802U, 0x04000002U, 0x04200802U, 0x04200000U,
+    0x00200800U, 0x00000000U, 0x00000002U, 0x04200802U,
+    0x00000000U, 0x00200802U, 0x04200000U, 0x00000800U,
+    0x04000002U, 0x04000800U, 0x00000800U, 0x00200002U
+};
+
+static const uint32_t PH_MEMLOC_CONST_ROM phCryptoSym_Sw_Des_SP8[64] =
+{
+    0x10001040U, 0x00001000U, 0x00040000U, 0x10041040U,
+    0x10000000U, 0x10001040U, 0x00000040U, 0x10000000U,
+    0x00040040U, 0x10040000U, 0x10041040U, 0x00041000U,
+    0x10041000U, 0x00041040U, 0x00001000U, 0x00000040U,
+    0x10040000U, 0x10000040U, 0x10001000U, 0x00001040U,
+    0x00041000U, 0x00040040U, 0x10040040U, 0x10041000U,
+    0x00001040U, 0x00000000U, 0x00000000U, 0x10040040U,
+    0x10000040U, 0x10001000U, 0x00041040U, 0x00040000U,
+    0x00041040U, 0x00040000U, 0x10041000U, 0x00001000U,
+    0x00000040U, 0x10040040U, 0x00001000U, 0x00041040U,
+    0x10001000U, 0x00000040U, 0x10000040U, 0x10040000U,
+    0x10040040U, 0x10000000U, 0x00040000U, 0x10001040U,
+    0x00000000U, 0x10041040U, 0x00040040U, 0x10000040U,
+    0x10040000U, 0x10001000U, 0x10001040U, 0x00000000U,
+    0x10041040U, 0x00041000U, 0x00041000U, 0x00001040U,
+    0x00001040U, 0x00040040U, 0x10000000U, 0x10041000U
+};
+
+static uint32_t phCryptoSym_Sw_Des_Lookup(
+    const uint32_t * pTable,
+    uint32_t dwIndex
+    )
+{
+    uint32_t PH_MEMLOC_REM dwResult = 0;
+    uint32_t PH_MEMLOC_REM dwMask;
+    uint32_t PH_MEMLOC_COUNT dwEntry;
+
+    /* read every entry and keep the wanted one, so neither timing nor cache state depend on the index */
+    for (dwEntry = 0; dwEntry < 64; ++dwEntry)
+    {
+        dwMask = (uint32_t)0 - (((dwEntry ^ dwIndex) - 1U) >> 31);
+        dwResult |= pTable[dwEntry] & dwMask;
+    }
+
+    return dwResult;
+}
+
+static uint32_t phCryptoSym_Sw_Des_F(
+    uint32_t dwRight,
+    const uint32_t * pSubKeys,
+    uint8_t bConstantTime
+    )
+{
+    uint32_t PH_MEMLOC_REM dwWork1;
+    uint32_t PH_MEMLOC_REM dwWork2;
+
+    dwWork1 = ((dwRight << 28) | (dwRight >> 4)) ^ pSubKeys[0];
+    dwWork2 = dwRight ^ pSubKeys[1];
+
+    if (bConstantTime == PH_OFF)
+    {
+        return phCryptoSym_Sw_Des_SP7[dwWork1 & 0x3F] |
+            phCryptoSym_Sw_Des_SP5[(dwWork1 >> 8) & 0x3F] |
+            phCryptoSym_Sw_Des_SP3[(dwWork1 >> 16) & 0x3F] |
+            phCryptoSym_Sw_Des_SP1[(dwWork1 >> 24) & 0x3F] |
+            phCryptoSym_Sw_Des_SP8[dwWork2 & 0x3F] |
+            phCryptoSym_Sw_Des_SP6[(dwWork2 >> 8) & 0x3F] |
+            phCryptoSym_Sw_Des_SP4[(dwWork2 >> 16) & 0x3F] |
+            phCryptoSym_Sw_Des_SP2[(dwWork2 >> 24) & 0x3F];
+    }
+
+    return phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP7, dwWork1 & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP5, (dwWork1 >> 8) & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP3, (dwWork1 >> 16) & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP1, (dwWork1 >> 24) & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP8, dwWork2 & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP6, (dwWork2 >> 8) & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP4, (dwWork2 >> 16) & 0x3F) |
+        phCryptoSym_Sw_Des_Lookup(phCryptoSym_Sw_Des_SP2, (dwWork2 >> 24) & 0x3F);
+}
+
+void phCryptoSym_Sw_Des_KeySchedule(
+                                    const uint8_t * pKey,
+                                    uint8_t bDecrypt,
+                                    uint32_t * pSubKeys
+                                    )
+{
+    uint8_t     PH_MEMLOC_REM aPc1[56];
+    uint8_t     PH_MEMLOC_REM aRotated[56];
+    uint32_t    PH_MEMLOC_REM aRaw[2];
+    uint8_t     PH_MEMLOC_REM bBit;
+    uint8_t     PH_MEMLOC_REM bDst;
+    uint8_t     PH_MEMLOC_COUNT bRound;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    for (bIndex = 0; bIndex < 56; ++bIndex)
+    {
+        bBit = phCryptoSym_Sw_Des_PC1[bIndex];
+        aPc1[bIndex] = (uint8_t)((pKey[bBit >> 3] >> (7 - (bBit & 0x07))) & 0x01);
+    }
+
+    for (bRound = 0; bRound < 16; ++bRound)
+    {
+        /* rotate both 28 bit halves */
+        for (bIndex = 0; bIndex < 56; ++bIndex)
+        {
+            bBit = (uint8_t)(bIndex + phCryptoSym_Sw_Des_Rotations[bRound]);
+            if (bBit >= ((bIndex < 28) ? 28 : 56))
+            {
+                bBit -= 28;
+            }
+            aRotated[bIndex] = aPc1[bBit];
+        }
+
+        /* two words of four 6 bit groups each */
+        aRaw[0] = 0;
+        aRaw[1] = 0;
+        for (bIndex = 0; bIndex < 24; ++bIndex)
+        {
+            aRaw[0] |= (uint32_t)aRotated[phCryptoSym_Sw_Des_PC2[bIndex]] << (23 - bIndex);
+            aRaw[1] |= (uint32_t)aRotated[phCryptoSym_Sw_Des_PC2[bIndex + 24]] << (23 - bIndex);
+        }
+
+        /* arrange the groups in the order the round function uses them */
+        bDst = (uint8_t)(((bDecrypt != PH_OFF) ? (15 - bRound) : bRound) << 1);
+        pSubKeys[bDst] =
+            ((aRaw[0] & 0x00FC0000U) << 6) |
+            ((aRaw[0] & 0x00000FC0U) << 10) |
+            ((aRaw[1] & 0x00FC0000U) >> 10) |
+            ((aRaw[1] & 0x00000FC0U) >> 6);
+        pSubKeys[bDst + 1] =
+            ((aRaw[0] & 0x0003F000U) << 12) |
+            ((aRaw[0] & 0x0000003FU) << 16) |
+            ((aRaw[1] & 0x0003F000U) >> 4) |
+            (aRaw[1] & 0x0000003FU);
+    }
+}
+
+void phCryptoSym_Sw_Des_Block(
+                              uint32_t * pBlock,
+                              const uint32_t * pSubKeys,
+                              uint8_t bConstantTime
+                              )
+{
+    uint32_t    PH_MEMLOC_REM dwLeft = pBlock[0];
+    uint32_t    PH_MEMLOC_REM dwRight = pBlock[1];
+    uint32_t    PH_MEMLOC_REM dwWork;
+    uint8_t     PH_MEMLOC_COUNT bRound;
+
+    /* initial permutation */
+    dwWork = ((dwLeft >> 4) ^ dwRight) & 0x0F0F0F0FU;
+    dwRight ^= dwWork;
+    dwLeft ^= dwWork << 4;
+    dwWork = ((dwLeft >> 16) ^ dwRight) & 0x0000FFFFU;
+    dwRight ^= dwWork;
+    dwLeft ^= dwWork << 16;
+    dwWork = ((dwRight >> 2) ^ dwLeft) & 0x33333333U;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork << 2;
+    dwWork = ((dwRight >> 8) ^ dwLeft) & 0x00FF00FFU;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork << 8;
+    dwRight = (dwRight << 1) | (dwRight >> 31);
+    dwWork = (dwLeft ^ dwRight) & 0xAAAAAAAAU;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork;
+    dwLeft = (dwLeft << 1) | (dwLeft >> 31);
+
+    for (bRound = 0; bRound < 8; ++bRound)
+    {
+        dwLeft ^= phCryptoSym_Sw_Des_F(dwRight, &pSubKeys[bRound << 2], bConstantTime);
+        dwRight ^= phCryptoSym_Sw_Des_F(dwLeft, &pSubKeys[(bRound << 2) + 2], bConstantTime);
+    }
+
+    /* final permutation */
+    dwRight = (dwRight << 31) | (dwRight >> 1);
+    dwWork = (dwLeft ^ dwRight) & 0xAAAAAAAAU;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork;
+    dwLeft = (dwLeft << 31) | (dwLeft >> 1);
+    dwWork = ((dwLeft >> 8) ^ dwRight) & 0x00FF00FFU;
+    dwRight ^= dwWork;
+    dwLeft ^= dwWork << 8;
+    dwWork = ((dwLeft >> 2) ^ dwRight) & 0x33333333U;
+    dwRight ^= dwWork;
+    dwLeft ^= dwWork << 2;
+    dwWork = ((dwRight >> 16) ^ dwLeft) & 0x0000FFFFU;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork << 16;
+    dwWork = ((dwRight >> 4) ^ dwLeft) & 0x0F0F0F0FU;
+    dwLeft ^= dwWork;
+    dwRight ^= dwWork << 4;
+
+    pBlock[0] = dwRight;
+    pBlock[1] = dwLeft;
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
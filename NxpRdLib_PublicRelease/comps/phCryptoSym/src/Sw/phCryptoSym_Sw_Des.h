@@ -0,0 +1,50 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software DES primitive of the Symmetric Cryptography Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHCRYPTOSYM_SW_DES_H
+#define PHCRYPTOSYM_SW_DES_H
+
+#include <ph_Status.h>
+
+/**
+* Expand a single DES key into #PH_CRYPTOSYM_SW_SUBKEYS subkey words,
+* in reverse order for decryption if \c bDecrypt is set.
+*/
+void phCryptoSym_Sw_Des_KeySchedule(
+                                    const uint8_t * pKey,
+                                    uint8_t bDecrypt,
+                                    uint32_t * pSubKeys
+                                    );
+
+/**
+* Run the 16 DES rounds on one block given as two big endian words.
+*/
+void phCryptoSym_Sw_Des_Block(
+                              uint32_t * pBlock,
+                              const uint32_t * pSubKeys,
+                              uint8_t bConstantTime
+                              );
+
+#endif /* PHCRYPTOSYM_SW_DES_H */
@@ -0,0 +1,444 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Symmetric Cryptography Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phCryptoSym.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+#include "Sw/phCryptoSym_Sw.h"
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+phStatus_t phCryptoSym_LoadKey(
+                               void * pDataParams,
+                               uint16_t wKeyNo,
+                               uint16_t wKeyVersion,
+                               uint16_t wKeyType
+                               )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_LoadKey");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNo_log, &wKeyNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyType_log, &wKeyType);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_LoadKey((phCryptoSym_Sw_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, wKeyType);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_LoadKeyDirect(
+                                     void * pDataParams,
+                                     uint8_t * pKey,
+                                     uint16_t wKeyType
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_LoadKeyDirect");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pKey);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyType_log, &wKeyType);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pKey);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_LoadKeyDirect((phCryptoSym_Sw_DataParams_t *)pDataParams, pKey, wKeyType);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_LoadIv(
+                              void * pDataParams,
+                              uint8_t * pIV,
+                              uint8_t bIVLength
+                              )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_LoadIv");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pIV);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bIVLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pIV_log, pIV, bIVLength);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bIVLength_log, &bIVLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pIV);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_LoadIv((phCryptoSym_Sw_DataParams_t *)pDataParams, pIV, bIVLength);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_Encrypt(
+                               void * pDataParams,
+                               uint16_t wOption,
+                               uint8_t * pPlainBuffer,
+                               uint16_t wBufferLength,
+                               uint8_t * pEncryptedBuffer
+                               )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_Encrypt");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pPlainBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wBufferLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pEncryptedBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wOption_log, &wOption);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wBufferLength_log, &wBufferLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pPlainBuffer);
+	PH_ASSERT_NULL (pEncryptedBuffer);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_Encrypt((phCryptoSym_Sw_DataParams_t *)pDataParams, wOption, pPlainBuffer, wBufferLength, pEncryptedBuffer);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_Decrypt(
+                               void * pDataParams,
+                               uint16_t wOption,
+                               uint8_t * pEncryptedBuffer,
+                               uint16_t wBufferLength,
+                               uint8_t * pPlainBuffer
+                               )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_Decrypt");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pEncryptedBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wBufferLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pPlainBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wOption_log, &wOption);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wBufferLength_log, &wBufferLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pEncryptedBuffer);
+	PH_ASSERT_NULL (pPlainBuffer);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_Decrypt((phCryptoSym_Sw_DataParams_t *)pDataParams, wOption, pEncryptedBuffer, wBufferLength, pPlainBuffer);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_InvalidateKey(
+                                     void * pDataParams
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_InvalidateKey");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_InvalidateKey((phCryptoSym_Sw_DataParams_t *)pDataParams);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_SetConfig(
+                                 void * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_SetConfig");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wConfig);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wValue);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wConfig_log, &wConfig);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wValue_log, &wValue);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_SetConfig((phCryptoSym_Sw_DataParams_t *)pDataParams, wConfig, wValue);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phCryptoSym_GetConfig(
+                                 void * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phCryptoSym_GetConfig");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wConfig);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pValue);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wConfig_log, &wConfig);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pValue);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_CRYPTOSYM)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+    case PH_CRYPTOSYM_SW_ID:
+        status = phCryptoSym_Sw_GetConfig((phCryptoSym_Sw_DataParams_t *)pDataParams, wConfig, pValue);
+        break;
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_CRYPTOSYM);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pValue_log, pValue);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+#endif /* NXPBUILD__PH_CRYPTOSYM */
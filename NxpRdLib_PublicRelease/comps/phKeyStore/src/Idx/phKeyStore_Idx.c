@@ -0,0 +1,751 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Indexed Software Keystore Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phKeyStore.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+
+#include "phKeyStore_Idx.h"
+#include "phKeyStore_Idx_Int.h"
+#include "../phKeyStore_Int.h"
+
+static const uint8_t PH_MEMLOC_CONST_ROM phKeyStore_Idx_FileHeader[PH_KEYSTORE_IDX_FILE_HEADER_SIZE] = { 0x7F, 'K', 'S', '1' };
+
+phStatus_t phKeyStore_Idx_Init(
+                               phKeyStore_Idx_DataParams_t * pDataParams,
+                               uint16_t wSizeOfDataParams,
+                               phKeyStore_Idx_KeyEntry_t * pKeyEntries,
+                               uint16_t wNoOfKeyEntries,
+                               phKeyStore_Idx_KeyVersionPair_t * pKeyVersionPairs,
+                               uint16_t wNoOfVersionPairs,
+                               phKeyStore_Idx_KUCEntry_t * pKUCEntries,
+                               uint16_t wNoOfKUCEntries,
+                               uint16_t * pIndex,
+                               uint16_t wIndexSize
+                               )
+{
+    uint16_t i;
+    uint32_t dwNoOfPairs;
+
+    if (sizeof(phKeyStore_Idx_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_KEYSTORE);
+    }
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pKeyEntries);
+	PH_ASSERT_NULL (pKeyVersionPairs);
+	PH_ASSERT_NULL (pKUCEntries);
+	PH_ASSERT_NULL (pIndex);
+
+    /* every pair needs a slot and a number distinct from the empty slot */
+    dwNoOfPairs = (uint32_t)wNoOfKeyEntries * wNoOfVersionPairs;
+    if ((dwNoOfPairs >= wIndexSize) || (dwNoOfPairs >= PH_KEYSTORE_IDX_INDEX_EMPTY) || ((wIndexSize & (wIndexSize - 1)) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    /* Init private data */
+    pDataParams->wId = PH_COMP_KEYSTORE | PH_KEYSTORE_IDX_ID;
+    pDataParams->pKeyEntries = pKeyEntries;
+    pDataParams->pKeyVersionPairs = pKeyVersionPairs;
+    pDataParams->wNoOfKeyEntries = wNoOfKeyEntries;
+    pDataParams->wNoOfVersions = wNoOfVersionPairs;
+    pDataParams->pKUCEntries = pKUCEntries;
+    pDataParams->wNoOfKUCEntries = wNoOfKUCEntries;
+    pDataParams->pIndex = pIndex;
+    pDataParams->wIndexSize = wIndexSize;
+    pDataParams->dwSequence = 0;
+
+    for (i = 0; i < wIndexSize; i++)
+    {
+        pDataParams->pIndex[i] = PH_KEYSTORE_IDX_INDEX_EMPTY;
+    }
+
+    for (i = 0; i < dwNoOfPairs; i++)
+    {
+        pDataParams->pKeyVersionPairs[i].wVersion = PH_KEYSTORE_DEFAULT_ID;
+    }
+
+    for (i = 0; i < pDataParams->wNoOfKeyEntries; i++)
+    {
+        pDataParams->pKeyEntries[i].wKeyType = PH_KEYSTORE_INVALID_ID;
+        pDataParams->pKeyEntries[i].wRefNoKUC = PH_KEYSTORE_INVALID_ID;
+        phKeyStore_Idx_IndexAddKey(pDataParams, i);
+    }
+
+    for (i = 0; i < pDataParams->wNoOfKUCEntries; i++)
+    {
+        pDataParams->pKUCEntries[i].dwLimit = 0xFFFFFFFF;
+        pDataParams->pKUCEntries[i].dwCurVal = 0;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_FormatKeyEntry(
+                                         phKeyStore_Idx_DataParams_t * pDataParams,
+                                         uint16_t wKeyNo,
+                                         uint16_t wNewKeyType
+                                         )
+{
+    uint16_t i;
+    phKeyStore_Idx_KeyVersionPair_t * pKeyVersion;
+
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    if (phKeyStore_GetKeySize(wNewKeyType) == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    phKeyStore_Idx_WriteLock(pDataParams);
+    phKeyStore_Idx_IndexRemoveKey(pDataParams, wKeyNo);
+
+    pDataParams->pKeyEntries[wKeyNo].wKeyType = wNewKeyType;
+
+    /* Reset CEK to master Key */
+    pDataParams->pKeyEntries[wKeyNo].wRefNoKUC = PH_KEYSTORE_INVALID_ID;
+
+    /* Reset all keys to 0x00*/
+    for (i = 0; i < pDataParams->wNoOfVersions; ++i)
+    {
+        pKeyVersion = &pDataParams->pKeyVersionPairs[wKeyNo * pDataParams->wNoOfVersions + i];
+        pKeyVersion->wVersion = 0;
+        memset(pKeyVersion->pKey, 0x00, PH_KEYSTORE_IDX_MAX_KEY_SIZE); /* PRQA S 3200 */
+    }
+
+    phKeyStore_Idx_IndexAddKey(pDataParams, wKeyNo);
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_SetKey(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wKeyVersion,
+                                 uint16_t wKeyType,
+                                 uint8_t * pNewKey,
+                                 uint16_t wNewKeyVersion
+                                 )
+{
+    phStatus_t statusTmp;
+    uint16_t wPairNo;
+
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    phKeyStore_Idx_WriteLock(pDataParams);
+    statusTmp = phKeyStore_Idx_IndexFind(pDataParams, wKeyNo, wKeyVersion, &wPairNo);
+
+    /* Check that Key type matches with current Key Type format */
+    if (((statusTmp & PH_ERR_MASK) == PH_ERR_SUCCESS) && (pDataParams->pKeyEntries[wKeyNo].wKeyType != wKeyType))
+    {
+        statusTmp = PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    if ((statusTmp & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        /* copy the key and version */
+        phKeyStore_Idx_IndexRemoveKey(pDataParams, wKeyNo);
+        memcpy(pDataParams->pKeyVersionPairs[wPairNo].pKey, pNewKey, phKeyStore_GetKeySize(wKeyType)); /* PRQA S 3200 */
+        pDataParams->pKeyVersionPairs[wPairNo].wVersion = wNewKeyVersion;
+        phKeyStore_Idx_IndexAddKey(pDataParams, wKeyNo);
+    }
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    return statusTmp;
+}
+
+phStatus_t phKeyStore_Idx_SetKeyAtPos(
+                                      phKeyStore_Idx_DataParams_t * pDataParams,
+                                      uint16_t wKeyNo,
+                                      uint16_t wPos,
+                                      uint16_t wKeyType,
+                                      uint8_t * pNewKey,
+                                      uint16_t wNewKeyVersion
+                                      )
+{
+    uint16_t wPairNo;
+
+    /* Overflow checks */
+    if ((wKeyNo >= pDataParams->wNoOfKeyEntries) || (wPos >= pDataParams->wNoOfVersions))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    phKeyStore_Idx_WriteLock(pDataParams);
+
+    /* Check that Key type matches with current Key Type format */
+    if (pDataParams->pKeyEntries[wKeyNo].wKeyType != wKeyType)
+    {
+        phKeyStore_Idx_WriteUnlock(pDataParams);
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    /* copy the key and version */
+    wPairNo = wKeyNo * pDataParams->wNoOfVersions + wPos;
+    phKeyStore_Idx_IndexRemoveKey(pDataParams, wKeyNo);
+    memcpy(pDataParams->pKeyVersionPairs[wPairNo].pKey, pNewKey, phKeyStore_GetKeySize(wKeyType)); /* PRQA S 3200 */
+    pDataParams->pKeyVersionPairs[wPairNo].wVersion = wNewKeyVersion;
+    phKeyStore_Idx_IndexAddKey(pDataParams, wKeyNo);
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_SetKUC(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wRefNoKUC
+                                 )
+{
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    /* Check for a valid KUC entry */
+    if (wRefNoKUC >= pDataParams->wNoOfKUCEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    phKeyStore_Idx_WriteLock(pDataParams);
+    pDataParams->pKeyEntries[wKeyNo].wRefNoKUC = wRefNoKUC;
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_SetFullKeyEntry(
+    phKeyStore_Idx_DataParams_t * pDataParams,
+    uint16_t wNoOfKeys,
+    uint16_t wKeyNo,
+    uint16_t wNewRefNoKUC,
+    uint16_t wNewKeyType,
+    uint8_t * pNewKeys,
+    uint16_t * pNewKeyVersionList
+    )
+{
+    uint16_t i;
+    uint8_t bKeyLength;
+    phKeyStore_Idx_KeyVersionPair_t * pKeyVersion;
+
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    /* Check for a valid KUC entry */
+    if (wNewRefNoKUC >= pDataParams->wNoOfKUCEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    /* Overflow checks */
+    if (wNoOfKeys > pDataParams->wNoOfVersions)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    bKeyLength = (uint8_t)phKeyStore_GetKeySize(wNewKeyType);
+    if (bKeyLength == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    phKeyStore_Idx_WriteLock(pDataParams);
+    phKeyStore_Idx_IndexRemoveKey(pDataParams, wKeyNo);
+
+    pDataParams->pKeyEntries[wKeyNo].wKeyType = wNewKeyType;
+
+    /* Reset KUC to master Key */
+    pDataParams->pKeyEntries[wKeyNo].wRefNoKUC = wNewRefNoKUC;
+
+    for (i = 0; i < wNoOfKeys; i++)
+    {
+        pKeyVersion = &pDataParams->pKeyVersionPairs[wKeyNo * pDataParams->wNoOfVersions + i];
+        pKeyVersion->wVersion = pNewKeyVersionList[i];
+        memcpy(pKeyVersion->pKey, &pNewKeys[i * bKeyLength], bKeyLength); /* PRQA S 3200 */
+    }
+
+    phKeyStore_Idx_IndexAddKey(pDataParams, wKeyNo);
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_GetKeyEntry(
+                                      phKeyStore_Idx_DataParams_t * pDataParams,
+                                      uint16_t wKeyNo,
+                                      uint16_t wKeyVersionBufSize,
+                                      uint16_t * wKeyVersion,
+                                      uint16_t * wKeyVersionLength,
+                                      uint16_t * pKeyType
+                                      )
+{
+    uint16_t i;
+    uint32_t dwSequence;
+
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    if (wKeyVersionBufSize < (sizeof(uint16_t) * pDataParams->wNoOfVersions))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_KEYSTORE);
+    }
+
+    do
+    {
+        dwSequence = phKeyStore_Idx_ReadBegin(pDataParams);
+        for (i = 0; i < pDataParams->wNoOfVersions; i++)
+        {
+            wKeyVersion[i] = pDataParams->pKeyVersionPairs[wKeyNo * pDataParams->wNoOfVersions + i].wVersion;
+        }
+        *pKeyType = pDataParams->pKeyEntries[wKeyNo].wKeyType;
+    }
+    while (phKeyStore_Idx_ReadRetry(pDataParams, dwSequence));
+    *wKeyVersionLength = pDataParams->wNoOfVersions;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_GetKey(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wKeyVersion,
+                                 uint8_t bKeyBufSize,
+                                 uint8_t * pKey,
+                                 uint16_t * pKeyType
+                                 )
+{
+    phStatus_t status;
+    phStatus_t statusTmp;
+    uint16_t wPairNo;
+    uint16_t wKeyType;
+    uint16_t wRefNoKUC;
+    uint16_t wKeySize;
+    uint32_t dwSequence;
+    uint8_t aKey[PH_KEYSTORE_IDX_MAX_KEY_SIZE];
+
+    /* Overflow checks */
+    if (wKeyNo >= pDataParams->wNoOfKeyEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    /* take a consistent copy without blocking the other readers */
+    do
+    {
+        dwSequence = phKeyStore_Idx_ReadBegin(pDataParams);
+        status = phKeyStore_Idx_IndexFind(pDataParams, wKeyNo, wKeyVersion, &wPairNo);
+        wKeyType = pDataParams->pKeyEntries[wKeyNo].wKeyType;
+        wRefNoKUC = pDataParams->pKeyEntries[wKeyNo].wRefNoKUC;
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            memcpy(aKey, pDataParams->pKeyVersionPairs[wPairNo].pKey, PH_KEYSTORE_IDX_MAX_KEY_SIZE); /* PRQA S 3200 */
+        }
+    }
+    while (phKeyStore_Idx_ReadRetry(pDataParams, dwSequence));
+    PH_CHECK_SUCCESS(status);
+
+    /* Check for Counter overflow */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_Idx_CheckUpdateKUC(pDataParams, wRefNoKUC));
+
+    /* check buffer size */
+    wKeySize = phKeyStore_GetKeySize(wKeyType);
+    if (bKeyBufSize < wKeySize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_KEYSTORE);
+    }
+    /* copy the key */
+    memcpy(pKey, aKey, wKeySize); /* PRQA S 3200 */
+
+    *pKeyType = wKeyType;
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_SetConfig(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t wValue
+                                    )
+{
+    /* satisfy compiler */
+    if (pDataParams || wConfig || wValue);
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_SetConfigStr(
+                                       phKeyStore_Idx_DataParams_t * pDataParams,
+                                       uint16_t wConfig,
+                                       uint8_t *pBuffer,
+                                       uint16_t wBufferLength
+                                       )
+{
+    /* satisfy compiler */
+    if (pDataParams || wConfig || pBuffer || wBufferLength);
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_GetConfig(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t * pValue
+                                    )
+{
+    /* satisfy compiler */
+    if (pDataParams || wConfig || pValue);
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_GetConfigStr(
+                                       phKeyStore_Idx_DataParams_t * pDataParams,
+                                       uint16_t wConfig,
+                                       uint8_t ** ppBuffer,
+                                       uint16_t * pBufferLength
+                                       )
+{
+    /* satisfy compiler */
+    if (pDataParams || wConfig || ppBuffer || pBufferLength);
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_ChangeKUC(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wRefNoKUC,
+                                    uint32_t dwLimit
+                                    )
+{
+    /* Overflow checks */
+    if (wRefNoKUC >= pDataParams->wNoOfKUCEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+    PH_KEYSTORE_IDX_STORE(&pDataParams->pKUCEntries[wRefNoKUC].dwLimit, dwLimit);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_GetKUC(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wRefNoKUC,
+                                 uint32_t * pdwLimit,
+                                 uint32_t * pdwCurVal
+                                 )
+{
+    /* Overflow checks */
+    if (wRefNoKUC >= pDataParams->wNoOfKUCEntries)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    *pdwLimit = PH_KEYSTORE_IDX_LOAD(&pDataParams->pKUCEntries[wRefNoKUC].dwLimit);
+    *pdwCurVal = PH_KEYSTORE_IDX_LOAD(&pDataParams->pKUCEntries[wRefNoKUC].dwCurVal);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phKeyStore_Idx_ImportKeys(
+                                     phKeyStore_Idx_DataParams_t * pDataParams,
+                                     uint8_t * pData,
+                                     uint32_t dwDataLength,
+                                     uint16_t * pNoOfKeys
+                                     )
+{
+    uint32_t dwOffset;
+    uint16_t wNoOfKeys = 0;
+    uint16_t wKeyNo;
+    uint16_t wKeyVersion;
+    uint16_t wKeyType;
+    uint16_t wRefNoKUC;
+    uint16_t wKeySize;
+    uint16_t i;
+    uint8_t bPass;
+    phKeyStore_Idx_KeyVersionPair_t * pKeyVersion;
+
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pNoOfKeys);
+
+    *pNoOfKeys = 0;
+    if ((dwDataLength < PH_KEYSTORE_IDX_FILE_HEADER_SIZE) ||
+        (memcmp(pData, phKeyStore_Idx_FileHeader, PH_KEYSTORE_IDX_FILE_HEADER_SIZE) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+    }
+
+    /* the first pass only checks the records, the second one imports them at once */
+    for (bPass = 0; bPass < 2; bPass++)
+    {
+        if (bPass == 1)
+        {
+            phKeyStore_Idx_WriteLock(pDataParams);
+        }
+        for (dwOffset = PH_KEYSTORE_IDX_FILE_HEADER_SIZE; dwOffset < dwDataLength; dwOffset += PH_KEYSTORE_IDX_FILE_RECORD_SIZE + wKeySize)
+        {
+            if ((dwDataLength - dwOffset) < PH_KEYSTORE_IDX_FILE_RECORD_SIZE)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+            }
+            wKeyNo = (uint16_t)(pData[dwOffset] | (pData[dwOffset + 1] << 8));
+            wKeyVersion = (uint16_t)(pData[dwOffset + 2] | (pData[dwOffset + 3] << 8));
+            wKeyType = (uint16_t)(pData[dwOffset + 4] | (pData[dwOffset + 5] << 8));
+            wRefNoKUC = (uint16_t)(pData[dwOffset + 6] | (pData[dwOffset + 7] << 8));
+            wKeySize = phKeyStore_GetKeySize(wKeyType);
+
+            if (bPass == 0)
+            {
+                if ((wKeySize == 0) ||
+                    ((dwDataLength - dwOffset - PH_KEYSTORE_IDX_FILE_RECORD_SIZE) < wKeySize) ||
+                    (wKeyNo >= pDataParams->wNoOfKeyEntries) ||
+                    ((wRefNoKUC != PH_KEYSTORE_INVALID_ID) && (wRefNoKUC >= pDataParams->wNoOfKUCEntries)) ||
+                    (wNoOfKeys == 0xFFFFU))
+                {
+                    return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+                }
+                wNoOfKeys++;
+                continue;
+            }
+
+            phKeyStore_Idx_IndexRemoveKey(pDataParams, wKeyNo);
+            pDataParams->pKeyEntries[wKeyNo].wKeyType = wKeyType;
+            pDataParams->pKeyEntries[wKeyNo].wRefNoKUC = wRefNoKUC;
+            for (i = 0; i < pDataParams->wNoOfVersions; i++)
+            {
+                pKeyVersion = &pDataParams->pKeyVersionPairs[wKeyNo * pDataParams->wNoOfVersions + i];
+                memset(pKeyVersion->pKey, 0x00, PH_KEYSTORE_IDX_MAX_KEY_SIZE); /* PRQA S 3200 */
+                pKeyVersion->wVersion = 0;
+            }
+            pKeyVersion = &pDataParams->pKeyVersionPairs[wKeyNo * pDataParams->wNoOfVersions];
+            memcpy(pKeyVersion->pKey, &pData[dwOffset + PH_KEYSTORE_IDX_FILE_RECORD_SIZE], wKeySize); /* PRQA S 3200 */
+            pKeyVersion->wVersion = wKeyVersion;
+            phKeyStore_Idx_IndexAddKey(pDataParams, wKeyNo);
+        }
+    }
+    phKeyStore_Idx_WriteUnlock(pDataParams);
+
+    *pNoOfKeys = wNoOfKeys;
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+void phKeyStore_Idx_WriteLock(
+                              phKeyStore_Idx_DataParams_t * pDataParams
+                              )
+{
+    uint32_t dwSequence;
+
+    do
+    {
+        dwSequence = PH_KEYSTORE_IDX_LOAD_RELAXED(&pDataParams->dwSequence) & ~(uint32_t)1;
+    }
+    while (!PH_KEYSTORE_IDX_CAS(&pDataParams->dwSequence, &dwSequence, dwSequence + 1));
+
+    /* the odd sequence is visible before any modification */
+    PH_KEYSTORE_IDX_FENCE_RELEASE();
+}
+
+void phKeyStore_Idx_WriteUnlock(
+                                phKeyStore_Idx_DataParams_t * pDataParams
+                                )
+{
+    PH_KEYSTORE_IDX_STORE(&pDataParams->dwSequence, PH_KEYSTORE_IDX_LOAD_RELAXED(&pDataParams->dwSequence) + 1);
+}
+
+uint32_t phKeyStore_Idx_ReadBegin(
+                                  phKeyStore_Idx_DataParams_t * pDataParams
+                                  )
+{
+    uint32_t dwSequence;
+
+    do
+    {
+        dwSequence = PH_KEYSTORE_IDX_LOAD(&pDataParams->dwSequence);
+    }
+    while (dwSequence & 1);
+
+    return dwSequence;
+}
+
+uint8_t phKeyStore_Idx_ReadRetry(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint32_t dwSequence
+                                 )
+{
+    /* the data is read before the sequence is checked again */
+    PH_KEYSTORE_IDX_FENCE_ACQUIRE();
+    return (uint8_t)(PH_KEYSTORE_IDX_LOAD_RELAXED(&pDataParams->dwSequence) != dwSequence);
+}
+
+static uint16_t phKeyStore_Idx_IndexHash(
+                                         phKeyStore_Idx_DataParams_t * pDataParams,
+                                         uint16_t wKeyNumber,
+                                         uint16_t wKeyVersion
+                                         )
+{
+    uint32_t dwHash = (((uint32_t)wKeyNumber << 16) | wKeyVersion) * 0x9E3779B1U;
+    return (uint16_t)((dwHash >> 16) & (pDataParams->wIndexSize - 1));
+}
+
+phStatus_t phKeyStore_Idx_IndexFind(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wKeyNumber,
+                                    uint16_t wKeyVersion,
+                                    uint16_t * pPairNo
+                                    )
+{
+    uint16_t wSlot = phKeyStore_Idx_IndexHash(pDataParams, wKeyNumber, wKeyVersion);
+    uint16_t wPairNo;
+    uint16_t i;
+
+    /* bounded and checked, a reader may see the index while a writer modifies it */
+    for (i = 0; i < pDataParams->wIndexSize; i++)
+    {
+        wPairNo = pDataParams->pIndex[wSlot];
+        if (wPairNo >= (uint32_t)pDataParams->wNoOfKeyEntries * pDataParams->wNoOfVersions)
+        {
+            break;
+        }
+        if (((wPairNo / pDataParams->wNoOfVersions) == wKeyNumber) &&
+            (pDataParams->pKeyVersionPairs[wPairNo].wVersion == wKeyVersion))
+        {
+            *pPairNo = wPairNo;
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+        }
+        wSlot = (wSlot + 1) & (pDataParams->wIndexSize - 1);
+    }
+
+    /* No entry found */
+    return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+}
+
+void phKeyStore_Idx_IndexRemoveKey(
+                                   phKeyStore_Idx_DataParams_t * pDataParams,
+                                   uint16_t wKeyNumber
+                                   )
+{
+    uint16_t wMask = pDataParams->wIndexSize - 1;
+    uint16_t wPairNo;
+    uint16_t wSlot;
+    uint16_t wNext;
+    uint16_t wHome;
+    uint16_t i;
+
+    for (i = 0; i < pDataParams->wNoOfVersions; i++)
+    {
+        wPairNo = wKeyNumber * pDataParams->wNoOfVersions + i;
+        wSlot = phKeyStore_Idx_IndexHash(pDataParams, wKeyNumber, pDataParams->pKeyVersionPairs[wPairNo].wVersion);
+        while ((pDataParams->pIndex[wSlot] != wPairNo) && (pDataParams->pIndex[wSlot] != PH_KEYSTORE_IDX_INDEX_EMPTY))
+        {
+            wSlot = (wSlot + 1) & wMask;
+        }
+        /* not indexed, an earlier position holds the same version */
+        if (pDataParams->pIndex[wSlot] == PH_KEYSTORE_IDX_INDEX_EMPTY)
+        {
+            continue;
+        }
+
+        /* shift back the following entries which would not be found anymore */
+        pDataParams->pIndex[wSlot] = PH_KEYSTORE_IDX_INDEX_EMPTY;
+        for (wNext = (wSlot + 1) & wMask; pDataParams->pIndex[wNext] != PH_KEYSTORE_IDX_INDEX_EMPTY; wNext = (wNext + 1) & wMask)
+        {
+            wHome = phKeyStore_Idx_IndexHash(pDataParams,
+                pDataParams->pIndex[wNext] / pDataParams->wNoOfVersions,
+                pDataParams->pKeyVersionPairs[pDataParams->pIndex[wNext]].wVersion);
+            if (((wNext - wHome) & wMask) >= ((wNext - wSlot) & wMask))
+            {
+                pDataParams->pIndex[wSlot] = pDataParams->pIndex[wNext];
+                pDataParams->pIndex[wNext] = PH_KEYSTORE_IDX_INDEX_EMPTY;
+                wSlot = wNext;
+            }
+        }
+    }
+}
+
+void phKeyStore_Idx_IndexAddKey(
+                                phKeyStore_Idx_DataParams_t * pDataParams,
+                                uint16_t wKeyNumber
+                                )
+{
+    uint16_t wPairNo;
+    uint16_t wSlot;
+    uint16_t i;
+
+    for (i = 0; i < pDataParams->wNoOfVersions; i++)
+    {
+        wPairNo = wKeyNumber * pDataParams->wNoOfVersions + i;
+        if ((phKeyStore_Idx_IndexFind(pDataParams, wKeyNumber, pDataParams->pKeyVersionPairs[wPairNo].wVersion, &wSlot) & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            continue;
+        }
+        wSlot = phKeyStore_Idx_IndexHash(pDataParams, wKeyNumber, pDataParams->pKeyVersionPairs[wPairNo].wVersion);
+        while (pDataParams->pIndex[wSlot] != PH_KEYSTORE_IDX_INDEX_EMPTY)
+        {
+            wSlot = (wSlot + 1) & (pDataParams->wIndexSize - 1);
+        }
+        pDataParams->pIndex[wSlot] = wPairNo;
+    }
+}
+
+phStatus_t phKeyStore_Idx_CheckUpdateKUC(
+                                         phKeyStore_Idx_DataParams_t * pDataParams,
+                                         uint16_t wKeyUsageCtrNumber
+                                         )
+{
+    uint32_t dwCurVal;
+
+    if (wKeyUsageCtrNumber != PH_KEYSTORE_INVALID_ID)
+    {
+        /* Check for a valid KUC entry */
+        if (wKeyUsageCtrNumber >= pDataParams->wNoOfKUCEntries)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_KEYSTORE);
+        }
+
+        /* Now let's check the limit, concurrent users must not exceed it together */
+        dwCurVal = PH_KEYSTORE_IDX_LOAD(&pDataParams->pKUCEntries[wKeyUsageCtrNumber].dwCurVal);
+        do
+        {
+            if (dwCurVal >= PH_KEYSTORE_IDX_LOAD(&pDataParams->pKUCEntries[wKeyUsageCtrNumber].dwLimit))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_KEYSTORE);
+            }
+        }
+        while (!PH_KEYSTORE_IDX_CAS(&pDataParams->pKUCEntries[wKeyUsageCtrNumber].dwCurVal, &dwCurVal, dwCurVal + 1));
+    }
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_KEYSTORE);
+}
+
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
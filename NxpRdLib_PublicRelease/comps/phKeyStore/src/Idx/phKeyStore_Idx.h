@@ -0,0 +1,129 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Indexed Software Keystore functions of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHKEYSTORE_IDX_H
+#define PHKEYSTORE_IDX_H
+
+#include <ph_Status.h>
+#include <phKeyStore.h>
+
+phStatus_t phKeyStore_Idx_FormatKeyEntry(
+                                         phKeyStore_Idx_DataParams_t * pDataParams,
+                                         uint16_t wKeyNo,
+                                         uint16_t wNewKeyType
+                                         );
+
+phStatus_t phKeyStore_Idx_SetKey(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wKeyVersion,
+                                 uint16_t wKeyType,
+                                 uint8_t * pNewKey,
+                                 uint16_t wNewKeyVersion
+                                 );
+
+phStatus_t phKeyStore_Idx_SetKeyAtPos(
+                                      phKeyStore_Idx_DataParams_t * pDataParams,
+                                      uint16_t wKeyNo,
+                                      uint16_t wPos,
+                                      uint16_t wKeyType,
+                                      uint8_t * pNewKey,
+                                      uint16_t wNewKeyVersion
+                                      );
+
+phStatus_t phKeyStore_Idx_SetKUC(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wRefNoKUC
+                                 );
+
+phStatus_t phKeyStore_Idx_SetFullKeyEntry(
+                                          phKeyStore_Idx_DataParams_t * pDataParams,
+                                          uint16_t wNoOfKeys,
+                                          uint16_t wKeyNo,
+                                          uint16_t wNewRefNoKUC,
+                                          uint16_t wNewKeyType,
+                                          uint8_t * pNewKeys,
+                                          uint16_t * pNewKeyVersionList
+                                          );
+
+phStatus_t phKeyStore_Idx_GetKeyEntry(
+                                      phKeyStore_Idx_DataParams_t * pDataParams,
+                                      uint16_t wKeyNo,
+                                      uint16_t wKeyVersionBufSize,
+                                      uint16_t * wKeyVersion,
+                                      uint16_t * wKeyVersionLength,
+                                      uint16_t * pKeyType
+                                      );
+
+phStatus_t phKeyStore_Idx_GetKey(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wKeyNo,
+                                 uint16_t wKeyVersion,
+                                 uint8_t bKeyBufSize,
+                                 uint8_t * pKey,
+                                 uint16_t * pKeyType
+                                 );
+
+phStatus_t phKeyStore_Idx_SetConfig(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t wValue
+                                    );
+
+phStatus_t phKeyStore_Idx_SetConfigStr(
+                                       phKeyStore_Idx_DataParams_t * pDataParams,
+                                       uint16_t wConfig,
+                                       uint8_t *pBuffer,
+                                       uint16_t wBufferLength
+                                       );
+
+phStatus_t phKeyStore_Idx_GetConfig(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wConfig,
+                                    uint16_t * pValue
+                                    );
+
+phStatus_t phKeyStore_Idx_GetConfigStr(
+                                       phKeyStore_Idx_DataParams_t * pDataParams,
+                                       uint16_t wConfig,
+                                       uint8_t ** ppBuffer,
+                                       uint16_t * pBufferLength
+                                       );
+
+phStatus_t phKeyStore_Idx_ChangeKUC(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,
+                                    uint16_t wRefNoKUC,
+                                    uint32_t dwLimit
+                                    );
+
+phStatus_t phKeyStore_Idx_GetKUC(
+                                 phKeyStore_Idx_DataParams_t * pDataParams,
+                                 uint16_t wRefNoKUC,
+                                 uint32_t * pdwLimit,
+                                 uint32_t * pdwCurVal
+                                 );
+
+#endif /* PHKEYSTORE_IDX_H */
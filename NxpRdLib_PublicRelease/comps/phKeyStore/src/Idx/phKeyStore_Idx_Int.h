@@ -0,0 +1,126 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal definitions for the indexed Software Keystore Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHKEYSTORE_IDX_INT_H
+#define PHKEYSTORE_IDX_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+*  @{
+*/
+
+/**
+* \name Atomic operations
+*/
+/*@{*/
+#define PH_KEYSTORE_IDX_LOAD(pVar)                  __atomic_load_n((pVar), __ATOMIC_ACQUIRE)
+#define PH_KEYSTORE_IDX_LOAD_RELAXED(pVar)          __atomic_load_n((pVar), __ATOMIC_RELAXED)
+#define PH_KEYSTORE_IDX_STORE(pVar, dwValue)        __atomic_store_n((pVar), (dwValue), __ATOMIC_RELEASE)
+#define PH_KEYSTORE_IDX_CAS(pVar, pExpected, dwValue) \
+    __atomic_compare_exchange_n((pVar), (pExpected), (dwValue), 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED)
+#define PH_KEYSTORE_IDX_FENCE_ACQUIRE()             __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#define PH_KEYSTORE_IDX_FENCE_RELEASE()             __atomic_thread_fence(__ATOMIC_RELEASE)
+/*@}*/
+
+/**
+* \brief Wait for other writers and mark the keystore as being modified.
+*/
+void phKeyStore_Idx_WriteLock(
+                              phKeyStore_Idx_DataParams_t * pDataParams     /**< [In] Pointer to this layer's parameter structure. */
+                              );
+
+/**
+* \brief End the modification started by \ref phKeyStore_Idx_WriteLock.
+*/
+void phKeyStore_Idx_WriteUnlock(
+                                phKeyStore_Idx_DataParams_t * pDataParams   /**< [In] Pointer to this layer's parameter structure. */
+                                );
+
+/**
+* \brief Start a lock free read, waits while a writer is active.
+* \return Sequence number to pass to \ref phKeyStore_Idx_ReadRetry.
+*/
+uint32_t phKeyStore_Idx_ReadBegin(
+                                  phKeyStore_Idx_DataParams_t * pDataParams /**< [In] Pointer to this layer's parameter structure. */
+                                  );
+
+/**
+* \brief Check whether a writer ran since \ref phKeyStore_Idx_ReadBegin.
+* \return Non zero if what was read must be read again.
+*/
+uint8_t phKeyStore_Idx_ReadRetry(
+                                 phKeyStore_Idx_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                 uint32_t dwSequence                        /**< [In] Value returned by \ref phKeyStore_Idx_ReadBegin. */
+                                 );
+
+/**
+* \brief Find the position of a key version pair given a Key number and a KeyVersion.
+*
+* Only the first position holding a version is indexed, like the Software keystore returns it.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER No such key version.
+*/
+phStatus_t phKeyStore_Idx_IndexFind(
+                                    phKeyStore_Idx_DataParams_t * pDataParams,  /**< [In] Pointer to this layer's parameter structure. */
+                                    uint16_t wKeyNumber,                        /**< [In] desired key number.*/
+                                    uint16_t wKeyVersion,                       /**< [In] desired key version.*/
+                                    uint16_t * pPairNo                          /**< [Out] Number of the key version pair in pKeyVersionPairs.*/
+                                    );
+
+/**
+* \brief Remove the versions of a key entry from the index, before they are modified.
+*/
+void phKeyStore_Idx_IndexRemoveKey(
+                                   phKeyStore_Idx_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                   uint16_t wKeyNumber                          /**< [In] key number.*/
+                                   );
+
+/**
+* \brief Add the versions of a key entry to the index, after they have been modified.
+*/
+void phKeyStore_Idx_IndexAddKey(
+                                phKeyStore_Idx_DataParams_t * pDataParams,  /**< [In] Pointer to this layer's parameter structure. */
+                                uint16_t wKeyNumber                         /**< [In] key number.*/
+                                );
+
+/**
+* \brief Atomically check value of a counter and increment it accordingly.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_KEY Limit reached.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid KUC number.
+*/
+phStatus_t phKeyStore_Idx_CheckUpdateKUC(
+                                         phKeyStore_Idx_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                         uint16_t wKeyUsageCtrNumber                /**< [In] KUC Number.*/
+                                         );
+
+/** @}
+* end of ph_Private group
+*/
+
+#endif /* PHKEYSTORE_IDX_INT_H */
@@ -32,6 +32,10 @@
 #include "Sw/phKeyStore_Sw.h"
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+#include "Idx/phKeyStore_Idx.h"
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
 #include "Rc632/phKeyStore_Rc632.h"
 #endif /* NXPBUILD__PH_KEYSTORE_RC632 */
@@ -84,6 +88,12 @@ phStatus_t phKeyStore_FormatKeyEntry(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_FormatKeyEntry((phKeyStore_Idx_DataParams_t *)pDataParams,wKeyNo,wNewKeyType);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_FormatKeyEntry((phKeyStore_Rc632_DataParams_t *)pDataParams,wKeyNo,wNewKeyType);
@@ -162,6 +172,12 @@ phStatus_t phKeyStore_SetKey(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetKey((phKeyStore_Idx_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, wKeyType, pNewKey, wNewKeyVersion);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetKey((phKeyStore_Rc632_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, wKeyType, pNewKey, wNewKeyVersion);
@@ -239,6 +255,12 @@ phStatus_t phKeyStore_SetKeyAtPos(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetKeyAtPos((phKeyStore_Idx_DataParams_t *)pDataParams, wKeyNo, wPos, wKeyType, pNewKey, wNewKeyVersion);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetKeyAtPos((phKeyStore_Rc632_DataParams_t *)pDataParams, wKeyNo, wPos, wKeyType, pNewKey, wNewKeyVersion);
@@ -306,6 +328,12 @@ phStatus_t phKeyStore_SetKUC(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetKUC((phKeyStore_Idx_DataParams_t *)pDataParams, wKeyNo, wRefNoKUC);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetKUC((phKeyStore_Rc632_DataParams_t *)pDataParams, wKeyNo, wRefNoKUC);
@@ -388,6 +416,12 @@ phStatus_t phKeyStore_SetFullKeyEntry(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetFullKeyEntry((phKeyStore_Idx_DataParams_t *)pDataParams, wNoOfKeys, wKeyNo, wNewRefNoKUC, wNewKeyType, pNewKeys, pNewKeyVersionList);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetFullKeyEntry((phKeyStore_Rc632_DataParams_t *)pDataParams, wNoOfKeys, wKeyNo, wNewRefNoKUC, wNewKeyType, pNewKeys, pNewKeyVersionList);
@@ -463,6 +497,12 @@ phStatus_t phKeyStore_GetKeyEntry(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_GetKeyEntry((phKeyStore_Idx_DataParams_t *)pDataParams, wKeyNo, wKeyVersionBufSize, wKeyVersion, wKeyVersionLength, pKeyType);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_GetKeyEntry((phKeyStore_Rc632_DataParams_t *)pDataParams, wKeyNo, wKeyVersionBufSize, wKeyVersion, wKeyVersionLength, pKeyType);
@@ -546,6 +586,12 @@ phStatus_t phKeyStore_GetKey(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_GetKey((phKeyStore_Idx_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, bKeyBufSize, pKey, pKeyType);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_GetKey((phKeyStore_Rc632_DataParams_t *)pDataParams, wKeyNo, wKeyVersion, bKeyBufSize, pKey, pKeyType);
@@ -621,6 +667,12 @@ phStatus_t phKeyStore_SetConfig(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetConfig((phKeyStore_Idx_DataParams_t *)pDataParams,wConfig,wValue);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetConfig((phKeyStore_Rc632_DataParams_t *)pDataParams,wConfig,wValue);
@@ -693,6 +745,12 @@ phStatus_t phKeyStore_SetConfigStr(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_SetConfigStr((phKeyStore_Idx_DataParams_t *)pDataParams,wConfig,pBuffer,wBufferLength);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_SetConfigStr((phKeyStore_Rc632_DataParams_t *)pDataParams,wConfig,pBuffer,wBufferLength);
@@ -761,6 +819,12 @@ phStatus_t phKeyStore_GetConfig(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_GetConfig((phKeyStore_Idx_DataParams_t *)pDataParams,wConfig,pValue);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_GetConfig((phKeyStore_Rc632_DataParams_t *)pDataParams,wConfig,pValue);
@@ -837,6 +901,12 @@ phStatus_t phKeyStore_GetConfigStr(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_GetConfigStr((phKeyStore_Idx_DataParams_t *)pDataParams,wConfig,ppBuffer,pBufferLength);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_GetConfigStr((phKeyStore_Rc632_DataParams_t *)pDataParams,wConfig,ppBuffer,pBufferLength);
@@ -914,6 +984,12 @@ phStatus_t phKeyStore_ChangeKUC(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_ChangeKUC((phKeyStore_Idx_DataParams_t *)pDataParams, wRefNoKUC, dwLimit);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_ChangeKUC((phKeyStore_Rc632_DataParams_t *)pDataParams, wRefNoKUC, dwLimit);
@@ -984,6 +1060,12 @@ phStatus_t phKeyStore_GetKUC(
         break;
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+    case PH_KEYSTORE_IDX_ID:
+        status = phKeyStore_Idx_GetKUC((phKeyStore_Idx_DataParams_t *)pDataParams, wRefNoKUC, pdwLimit, pdwCurVal);
+        break;
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC632
     case PH_KEYSTORE_RC632_ID:
         status = phKeyStore_Rc632_GetKUC((phKeyStore_Rc632_DataParams_t *)pDataParams, wRefNoKUC, pdwLimit, pdwCurVal);
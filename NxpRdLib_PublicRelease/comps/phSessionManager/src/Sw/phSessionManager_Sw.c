@@ -0,0 +1,413 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Session Manager Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phhalHw.h>
+#include <phpalI14443p3a.h>
+#include <phpalI14443p4a.h>
+#include <phpalI14443p4.h>
+#include <phCidManager.h>
+#include <phSessionManager.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+
+#include "phSessionManager_Sw.h"
+#include "phSessionManager_Sw_Int.h"
+
+phStatus_t phSessionManager_Sw_Init(
+                                    phSessionManager_Sw_DataParams_t * pDataParams,
+                                    uint16_t wSizeOfDataParams,
+                                    void * pHalDataParams,
+                                    void * pPalI14443p3aDataParams,
+                                    void * pPalI14443p4aDataParams,
+                                    void * pCidManagerDataParams,
+                                    phSessionManager_Sw_Session_t * pSessions,
+                                    uint8_t bNoOfSessions
+                                    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    if (sizeof(phSessionManager_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pHalDataParams);
+    PH_ASSERT_NULL (pPalI14443p3aDataParams);
+    PH_ASSERT_NULL (pPalI14443p4aDataParams);
+    PH_ASSERT_NULL (pCidManagerDataParams);
+
+    /* More sessions than CIDs are useless */
+    if (bNoOfSessions > PH_SESSIONMANAGER_MAX_SESSIONS)
+    {
+        bNoOfSessions = PH_SESSIONMANAGER_MAX_SESSIONS;
+    }
+
+    /* Init private data */
+    pDataParams->wId                        = PH_COMP_SESSIONMANAGER | PH_SESSIONMANAGER_SW_ID;
+    pDataParams->pHalDataParams             = pHalDataParams;
+    pDataParams->pPalI14443p3aDataParams    = pPalI14443p3aDataParams;
+    pDataParams->pPalI14443p4aDataParams    = pPalI14443p4aDataParams;
+    pDataParams->pCidManagerDataParams      = pCidManagerDataParams;
+    pDataParams->pSessions                  = pSessions;
+    pDataParams->bNoOfSessions              = bNoOfSessions;
+    pDataParams->bCurrentSession            = PH_SESSIONMANAGER_NO_SESSION;
+
+    /* Every session keeps its own ISO14443-4 protocol state */
+    for (bIndex = 0; bIndex < bNoOfSessions; ++bIndex)
+    {
+        memset(&pSessions[bIndex], 0x00, sizeof(phSessionManager_Sw_Session_t));  /* PRQA S 3200 */
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_Sw_Init(
+            &pSessions[bIndex].sPalI14443p4,
+            sizeof(phpalI14443p4_Sw_DataParams_t),
+            pHalDataParams));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+phStatus_t phSessionManager_Sw_ActivateCards(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bFsdi,
+    uint8_t bDri,
+    uint8_t bDsi,
+    uint8_t * pNoOfSessions
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phSessionManager_Sw_Session_t * PH_MEMLOC_REM pSession;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    uint8_t     PH_MEMLOC_REM bCid;
+    uint8_t     PH_MEMLOC_REM aUid[10];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint8_t     PH_MEMLOC_REM bSak;
+    uint8_t     PH_MEMLOC_REM bMoreCardsAvailable;
+    uint8_t     PH_MEMLOC_REM aAts[255];
+    uint8_t     PH_MEMLOC_REM bCidEnabled;
+    uint8_t     PH_MEMLOC_REM bCidReturned;
+    uint8_t     PH_MEMLOC_REM bNadSupported;
+    uint8_t     PH_MEMLOC_REM bFwi;
+    uint8_t     PH_MEMLOC_REM bFsdiReturned;
+    uint8_t     PH_MEMLOC_REM bFsci;
+    uint16_t    PH_MEMLOC_REM wTxDatarate;
+    uint16_t    PH_MEMLOC_REM wRxDatarate;
+
+    /* Count the sessions which are still active */
+    *pNoOfSessions = 0;
+    for (bIndex = 0; bIndex < pDataParams->bNoOfSessions; ++bIndex)
+    {
+        if (pDataParams->pSessions[bIndex].bActive)
+        {
+            /* A card without CID support has to be the only active card */
+            if (pDataParams->pSessions[bIndex].bCid == 0)
+            {
+                *pNoOfSessions = 1;
+                return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+            }
+            ++(*pNoOfSessions);
+        }
+    }
+
+    /* Activation is always performed with 106 kBit/s */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_ResetDatarates(pDataParams));
+
+    while (1)
+    {
+        /* Search a free session */
+        for (bIndex = 0; bIndex < pDataParams->bNoOfSessions; ++bIndex)
+        {
+            if (!pDataParams->pSessions[bIndex].bActive)
+            {
+                break;
+            }
+        }
+        if (bIndex == pDataParams->bNoOfSessions)
+        {
+            break;
+        }
+        pSession = &pDataParams->pSessions[bIndex];
+
+        /* Retrieve a free CID */
+        status = phCidManager_GetFreeCid(pDataParams->pCidManagerDataParams, &bCid);
+        if ((status & PH_ERR_MASK) == PH_ERR_USE_CONDITION)
+        {
+            break;
+        }
+        PH_CHECK_SUCCESS(status);
+
+        /* Cards which are already active do not answer REQA anymore */
+        status = phpalI14443p3a_ActivateCard(
+            pDataParams->pPalI14443p3aDataParams,
+            NULL,
+            0,
+            aUid,
+            &bUidLength,
+            &bSak,
+            &bMoreCardsAvailable);
+
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phCidManager_FreeCid(pDataParams->pCidManagerDataParams, bCid));
+
+            /* No more cards in the field */
+            if ((status & PH_ERR_MASK) == PH_ERR_IO_TIMEOUT)
+            {
+                break;
+            }
+            return status;
+        }
+
+        /* Halt cards which do not support ISO14443-4 so that they do not answer again */
+        if (!(bSak & PH_SESSIONMANAGER_SW_SAK_ISO14443P4))
+        {
+            (void)phpalI14443p3a_HaltA(pDataParams->pPalI14443p3aDataParams);
+            PH_CHECK_SUCCESS_FCT(statusTmp, phCidManager_FreeCid(pDataParams->pCidManagerDataParams, bCid));
+            continue;
+        }
+
+        /* Perform RATS and PPS */
+        status = phpalI14443p4a_ActivateCard(pDataParams->pPalI14443p4aDataParams, bFsdi, bCid, bDri, bDsi, aAts);
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phCidManager_FreeCid(pDataParams->pCidManagerDataParams, bCid));
+            PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_ResetDatarates(pDataParams));
+            return status;
+        }
+
+        /* Retrieve the negotiated parameters */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_GetProtocolParams(
+            pDataParams->pPalI14443p4aDataParams,
+            &bCidEnabled,
+            &bCidReturned,
+            &bNadSupported,
+            &bFwi,
+            &bFsdiReturned,
+            &bFsci));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXDATARATE, &wTxDatarate));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXDATARATE, &wRxDatarate));
+
+        if (!bCidEnabled)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phCidManager_FreeCid(pDataParams->pCidManagerDataParams, bCid));
+            bCid = 0;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_SetProtocol(
+            &pSession->sPalI14443p4,
+            bCidEnabled,
+            bCid,
+            PH_OFF,
+            0,
+            bFwi,
+            bFsdiReturned,
+            bFsci));
+
+        /* A card without CID support cannot share the field with other active cards */
+        if ((!bCidEnabled) && (*pNoOfSessions > 0))
+        {
+            status = phpalI14443p4_Deselect(&pSession->sPalI14443p4);
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_ResetProtocol(&pSession->sPalI14443p4));
+            PH_CHECK_SUCCESS(status);
+            break;
+        }
+
+        /* Store the session */
+        pSession->bActive       = 1;
+        pSession->bCid          = bCid;
+        pSession->bSak          = bSak;
+        pSession->bUidLength    = bUidLength;
+        memcpy(pSession->aUid, aUid, bUidLength);  /* PRQA S 3200 */
+        pSession->bFwi          = bFwi;
+        pSession->wTxDatarate   = wTxDatarate;
+        pSession->wRxDatarate   = wRxDatarate;
+        ++(*pNoOfSessions);
+
+        /* The next card is activated with 106 kBit/s again */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_ResetDatarates(pDataParams));
+
+        /* No further card may be activated next to a card without CID support */
+        if (!bCidEnabled)
+        {
+            break;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+phStatus_t phSessionManager_Sw_SelectSession(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bSession,
+    void ** ppPalI14443p4DataParams
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phSessionManager_Sw_Session_t * PH_MEMLOC_REM pSession;
+    uint32_t    PH_MEMLOC_REM dwFwt;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_GetSession(pDataParams, bSession, &pSession));
+
+    /* Reconfigure the HAL only if the card changes */
+    if (pDataParams->bCurrentSession != bSession)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXDATARATE, pSession->wTxDatarate));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXDATARATE, pSession->wRxDatarate));
+
+        /* Calculate FWT timeout */
+        dwFwt = (uint32_t)(PH_SESSIONMANAGER_SW_FWT_MIN_US * (1 << pSession->bFwi));
+
+        /* Add extension time */
+        dwFwt = dwFwt + PH_SESSIONMANAGER_SW_EXT_TIME_US;
+
+        /* Set FWT timeout */
+        if (dwFwt > 0xFFFF)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(
+                pDataParams->pHalDataParams,
+                PHHAL_HW_CONFIG_TIMEOUT_VALUE_MS,
+                (uint16_t)(dwFwt / 1000)));
+        }
+        else
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(
+                pDataParams->pHalDataParams,
+                PHHAL_HW_CONFIG_TIMEOUT_VALUE_US,
+                (uint16_t)dwFwt));
+        }
+
+        pDataParams->bCurrentSession = bSession;
+    }
+
+    if (ppPalI14443p4DataParams != NULL)
+    {
+        *ppPalI14443p4DataParams = &pSession->sPalI14443p4;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+phStatus_t phSessionManager_Sw_Exchange(
+                                        phSessionManager_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSession,
+                                        uint16_t wOption,
+                                        uint8_t * pTxBuffer,
+                                        uint16_t wTxLength,
+                                        uint8_t ** ppRxBuffer,
+                                        uint16_t * pRxLength
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    void *      PH_MEMLOC_REM pPalI14443p4DataParams;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_SelectSession(pDataParams, bSession, &pPalI14443p4DataParams));
+
+    return phpalI14443p4_Exchange(pPalI14443p4DataParams, wOption, pTxBuffer, wTxLength, ppRxBuffer, pRxLength);
+}
+
+phStatus_t phSessionManager_Sw_Deselect(
+                                        phSessionManager_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSession
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phSessionManager_Sw_Session_t * PH_MEMLOC_REM pSession;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_SelectSession(pDataParams, bSession, NULL));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_GetSession(pDataParams, bSession, &pSession));
+
+    /* Send S(DESELECT) */
+    status = phpalI14443p4_Deselect(&pSession->sPalI14443p4);
+
+    /* Release the session regardless of the card's answer */
+    if (pSession->bCid)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phCidManager_FreeCid(pDataParams->pCidManagerDataParams, pSession->bCid));
+    }
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_ResetProtocol(&pSession->sPalI14443p4));
+    pSession->bActive = 0;
+    pSession->bCid = 0;
+
+    return status;
+}
+
+phStatus_t phSessionManager_Sw_GetSessionInfo(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bSession,
+    uint8_t * pUid,
+    uint8_t * pUidLength,
+    uint8_t * pSak,
+    uint8_t * pCid
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phSessionManager_Sw_Session_t * PH_MEMLOC_REM pSession;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phSessionManager_Sw_GetSession(pDataParams, bSession, &pSession));
+
+    memcpy(pUid, pSession->aUid, pSession->bUidLength);  /* PRQA S 3200 */
+    *pUidLength = pSession->bUidLength;
+    *pSak       = pSession->bSak;
+    *pCid       = pSession->bCid;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+phStatus_t phSessionManager_Sw_GetSession(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bSession,
+    phSessionManager_Sw_Session_t ** ppSession
+    )
+{
+    if ((bSession >= pDataParams->bNoOfSessions) || (!pDataParams->pSessions[bSession].bActive))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_SESSIONMANAGER);
+    }
+
+    *ppSession = &pDataParams->pSessions[bSession];
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+phStatus_t phSessionManager_Sw_ResetDatarates(
+    phSessionManager_Sw_DataParams_t * pDataParams
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXDATARATE, PHHAL_HW_RF_DATARATE_106));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXDATARATE, PHHAL_HW_RF_DATARATE_106));
+
+    /* The HAL has to be reconfigured for the next exchange */
+    pDataParams->bCurrentSession = PH_SESSIONMANAGER_NO_SESSION;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_SESSIONMANAGER);
+}
+
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
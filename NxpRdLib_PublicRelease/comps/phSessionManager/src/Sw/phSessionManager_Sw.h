@@ -0,0 +1,69 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Session Manager Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHSESSIONMANAGER_SW_H
+#define PHSESSIONMANAGER_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phSessionManager_Sw_ActivateCards(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bFsdi,
+    uint8_t bDri,
+    uint8_t bDsi,
+    uint8_t * pNoOfSessions
+    );
+
+phStatus_t phSessionManager_Sw_SelectSession(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bSession,
+    void ** ppPalI14443p4DataParams
+    );
+
+phStatus_t phSessionManager_Sw_Exchange(
+                                        phSessionManager_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSession,
+                                        uint16_t wOption,
+                                        uint8_t * pTxBuffer,
+                                        uint16_t wTxLength,
+                                        uint8_t ** ppRxBuffer,
+                                        uint16_t * pRxLength
+                                        );
+
+phStatus_t phSessionManager_Sw_Deselect(
+                                        phSessionManager_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSession
+                                        );
+
+phStatus_t phSessionManager_Sw_GetSessionInfo(
+    phSessionManager_Sw_DataParams_t * pDataParams,
+    uint8_t bSession,
+    uint8_t * pUid,
+    uint8_t * pUidLength,
+    uint8_t * pSak,
+    uint8_t * pCid
+    );
+
+#endif /* PHSESSIONMANAGER_SW_H */
@@ -0,0 +1,70 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal definitions for Software Session Manager Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHSESSIONMANAGER_SW_INT_H
+#define PHSESSIONMANAGER_SW_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+* @{
+*/
+
+/** Bit within SAK which signals ISO14443-4 compliance. */
+#define PH_SESSIONMANAGER_SW_SAK_ISO14443P4     0x20U
+
+/** FTW min in microseconds. */
+#define PH_SESSIONMANAGER_SW_FWT_MIN_US         303
+
+/** Time extension in microseconds for all commands.  */
+#define PH_SESSIONMANAGER_SW_EXT_TIME_US        60
+
+/**
+* \brief Retrieve an active session.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid or unused session handle.
+*/
+phStatus_t phSessionManager_Sw_GetSession(
+    phSessionManager_Sw_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bSession,                               /**< [In] Session handle. */
+    phSessionManager_Sw_Session_t ** ppSession      /**< [Out] Session. */
+    );
+
+/**
+* \brief Set the HAL data rates back to 106 kBit/s for the activation of further cards.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phSessionManager_Sw_ResetDatarates(
+    phSessionManager_Sw_DataParams_t * pDataParams  /**< [In] Pointer to this layer's parameter structure. */
+    );
+
+/** @}
+* end of ph_Private
+*/
+
+#endif /* PHSESSIONMANAGER_SW_INT_H */
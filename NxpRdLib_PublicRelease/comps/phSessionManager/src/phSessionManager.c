@@ -0,0 +1,329 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Session Manager Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phSessionManager.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+#include "Sw/phSessionManager_Sw.h"
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+#ifdef NXPBUILD__PH_SESSIONMANAGER
+
+phStatus_t phSessionManager_ActivateCards(
+                                          void * pDataParams,
+                                          uint8_t bFsdi,
+                                          uint8_t bDri,
+                                          uint8_t bDsi,
+                                          uint8_t * pNoOfSessions
+                                          )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phSessionManager_ActivateCards");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bFsdi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bDri);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bDsi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNoOfSessions);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bFsdi_log, &bFsdi);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bDri_log, &bDri);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bDsi_log, &bDsi);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pNoOfSessions);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_SESSIONMANAGER)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+    case PH_SESSIONMANAGER_SW_ID:
+        status = phSessionManager_Sw_ActivateCards((phSessionManager_Sw_DataParams_t *)pDataParams, bFsdi, bDri, bDsi, pNoOfSessions);
+        break;
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNoOfSessions_log, pNoOfSessions);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phSessionManager_SelectSession(
+                                          void * pDataParams,
+                                          uint8_t bSession,
+                                          void ** ppPalI14443p4DataParams
+                                          )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phSessionManager_SelectSession");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSession);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(ppPalI14443p4DataParams);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSession_log, &bSession);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_SESSIONMANAGER)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+    case PH_SESSIONMANAGER_SW_ID:
+        status = phSessionManager_Sw_SelectSession((phSessionManager_Sw_DataParams_t *)pDataParams, bSession, ppPalI14443p4DataParams);
+        break;
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phSessionManager_Exchange(
+                                     void * pDataParams,
+                                     uint8_t bSession,
+                                     uint16_t wOption,
+                                     uint8_t * pTxBuffer,
+                                     uint16_t wTxLength,
+                                     uint8_t ** ppRxBuffer,
+                                     uint16_t * pRxLength
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phSessionManager_Exchange");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSession);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pTxBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wTxLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(ppRxBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRxLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSession_log, &bSession);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wOption_log, &wOption);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pTxBuffer_log, pTxBuffer, wTxLength);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wTxLength_log, &wTxLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (ppRxBuffer);
+	PH_ASSERT_NULL (pRxLength);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_SESSIONMANAGER)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+    case PH_SESSIONMANAGER_SW_ID:
+        status = phSessionManager_Sw_Exchange((phSessionManager_Sw_DataParams_t *)pDataParams, bSession, wOption, pTxBuffer, wTxLength, ppRxBuffer, pRxLength);
+        break;
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pRxLength_log, pRxLength);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phSessionManager_Deselect(
+                                     void * pDataParams,
+                                     uint8_t bSession
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phSessionManager_Deselect");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSession);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSession_log, &bSession);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_SESSIONMANAGER)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+    case PH_SESSIONMANAGER_SW_ID:
+        status = phSessionManager_Sw_Deselect((phSessionManager_Sw_DataParams_t *)pDataParams, bSession);
+        break;
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phSessionManager_GetSessionInfo(
+                                           void * pDataParams,
+                                           uint8_t bSession,
+                                           uint8_t * pUid,
+                                           uint8_t * pUidLength,
+                                           uint8_t * pSak,
+                                           uint8_t * pCid
+                                           )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phSessionManager_GetSessionInfo");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSession);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pSak);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pCid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSession_log, &bSession);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pUidLength);
+	PH_ASSERT_NULL (pSak);
+	PH_ASSERT_NULL (pCid);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_SESSIONMANAGER)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+    case PH_SESSIONMANAGER_SW_ID:
+        status = phSessionManager_Sw_GetSessionInfo((phSessionManager_Sw_DataParams_t *)pDataParams, bSession, pUid, pUidLength, pSak, pCid);
+        break;
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_SESSIONMANAGER);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pUidLength_log, pUidLength);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pSak_log, pSak);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pCid_log, pCid);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+#endif /* NXPBUILD__PH_SESSIONMANAGER */
@@ -0,0 +1,375 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Felica Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalFelica.h>
+#include <phpalFelica.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_FELICA_SW
+
+#include <string.h>
+#include "phalFelica_Sw.h"
+#include "../phalFelica_Int.h"
+
+static uint8_t phalFelica_Sw_GetMaxBlocks(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    uint8_t bCmd,
+    uint8_t * pPMm
+    );
+
+static phStatus_t phalFelica_Sw_Transceive(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    uint8_t bCmd,
+    phalFelica_Block_t * pBlocks,
+    uint16_t wNumBlocks,
+    uint8_t * pData,
+    uint8_t * pStatusFlags
+    );
+
+phStatus_t phalFelica_Sw_Init(
+                              phalFelica_Sw_DataParams_t * pDataParams,
+                              uint16_t wSizeOfDataParams,
+                              void * pPalFelicaDataParams
+                              )
+{
+    if (sizeof(phalFelica_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pPalFelicaDataParams);
+
+    /* init private data */
+    pDataParams->wId                    = PH_COMP_AL_FELICA | PHAL_FELICA_SW_ID;
+    pDataParams->pPalFelicaDataParams   = pPalFelicaDataParams;
+    pDataParams->bMaxReadBlocks         = 0;
+    pDataParams->bMaxWriteBlocks        = 0;
+    pDataParams->bLearnedReadBlocks     = 0;
+    pDataParams->bLearnedWriteBlocks    = 0;
+    memset(pDataParams->aIDm, 0x00, PHPAL_FELICA_IDM_LENGTH);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_FELICA);
+}
+
+phStatus_t phalFelica_Sw_ReadWithoutEncryption(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    phalFelica_Block_t * pBlocks,
+    uint16_t wNumBlocks,
+    uint8_t * pData,
+    uint8_t * pStatusFlags
+    )
+{
+    return phalFelica_Sw_Transceive(pDataParams, PHAL_FELICA_CMD_READ, pBlocks, wNumBlocks, pData, pStatusFlags);
+}
+
+phStatus_t phalFelica_Sw_WriteWithoutEncryption(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    phalFelica_Block_t * pBlocks,
+    uint16_t wNumBlocks,
+    uint8_t * pData,
+    uint8_t * pStatusFlags
+    )
+{
+    return phalFelica_Sw_Transceive(pDataParams, PHAL_FELICA_CMD_WRITE, pBlocks, wNumBlocks, pData, pStatusFlags);
+}
+
+phStatus_t phalFelica_Sw_SetConfig(
+                                   phalFelica_Sw_DataParams_t * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t wValue
+                                   )
+{
+    if (wValue > PHAL_FELICA_MAX_BLOCKS)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_FELICA);
+    }
+
+    switch (wConfig)
+    {
+    case PHAL_FELICA_CONFIG_MAX_READ_BLOCKS:
+        pDataParams->bMaxReadBlocks = (uint8_t)wValue;
+        pDataParams->bLearnedReadBlocks = 0;
+        break;
+    case PHAL_FELICA_CONFIG_MAX_WRITE_BLOCKS:
+        pDataParams->bMaxWriteBlocks = (uint8_t)wValue;
+        pDataParams->bLearnedWriteBlocks = 0;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_FELICA);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_FELICA);
+}
+
+phStatus_t phalFelica_Sw_GetConfig(
+                                   phalFelica_Sw_DataParams_t * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t * pValue
+                                   )
+{
+    switch (wConfig)
+    {
+    case PHAL_FELICA_CONFIG_MAX_READ_BLOCKS:
+        *pValue = (uint16_t)pDataParams->bMaxReadBlocks;
+        break;
+    case PHAL_FELICA_CONFIG_MAX_WRITE_BLOCKS:
+        *pValue = (uint16_t)pDataParams->bMaxWriteBlocks;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_FELICA);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_FELICA);
+}
+
+static uint8_t phalFelica_Sw_GetMaxBlocks(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    uint8_t bCmd,
+    uint8_t * pPMm
+    )
+{
+    uint8_t PH_MEMLOC_REM bMaxBlocks;
+    uint8_t PH_MEMLOC_REM bLearnedBlocks;
+    uint8_t PH_MEMLOC_REM bLite;
+
+    bLite = ((pPMm[1] == PHAL_FELICA_IC_TYPE_LITE) || (pPMm[1] == PHAL_FELICA_IC_TYPE_LITE_S)) ? 1 : 0;
+
+    if (bCmd == PHAL_FELICA_CMD_READ)
+    {
+        bMaxBlocks = pDataParams->bMaxReadBlocks;
+        bLearnedBlocks = pDataParams->bLearnedReadBlocks;
+        if (bMaxBlocks == 0)
+        {
+            bMaxBlocks = (bLite) ? PHAL_FELICA_LITE_MAX_READ_BLOCKS : PHAL_FELICA_MAX_BLOCKS;
+        }
+    }
+    else
+    {
+        bMaxBlocks = pDataParams->bMaxWriteBlocks;
+        bLearnedBlocks = pDataParams->bLearnedWriteBlocks;
+        if (bMaxBlocks == 0)
+        {
+            bMaxBlocks = (bLite) ? PHAL_FELICA_LITE_MAX_WRITE_BLOCKS : PHAL_FELICA_MAX_BLOCKS;
+        }
+    }
+
+    /* A limit learned from the card itself takes precedence */
+    if ((bLearnedBlocks != 0) && (bLearnedBlocks < bMaxBlocks))
+    {
+        bMaxBlocks = bLearnedBlocks;
+    }
+
+    return bMaxBlocks;
+}
+
+static phStatus_t phalFelica_Sw_Transceive(
+    phalFelica_Sw_DataParams_t * pDataParams,
+    uint8_t bCmd,
+    phalFelica_Block_t * pBlocks,
+    uint16_t wNumBlocks,
+    uint8_t * pData,
+    uint8_t * pStatusFlags
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aIDmPMm[PHPAL_FELICA_IDM_LENGTH + PHPAL_FELICA_PMM_LENGTH];
+    uint8_t     PH_MEMLOC_REM bIDmPMmLength;
+    uint8_t     PH_MEMLOC_REM aCmd[1 + PHAL_FELICA_CMD_PARAMS_MAX];
+    uint16_t    PH_MEMLOC_REM aServices[PHAL_FELICA_MAX_SERVICES];
+    uint8_t     PH_MEMLOC_REM aBlockList[PHAL_FELICA_MAX_BLOCKS * 3];
+    uint8_t     PH_MEMLOC_REM bNumServices;
+    uint8_t     PH_MEMLOC_REM bNumBlocks;
+    uint8_t     PH_MEMLOC_REM bMaxBlocks;
+    uint8_t     PH_MEMLOC_REM bService;
+    uint8_t     PH_MEMLOC_REM bElementLength;
+    uint16_t    PH_MEMLOC_REM wBlockListLength;
+    uint16_t    PH_MEMLOC_REM wParamsLength;
+    uint16_t    PH_MEMLOC_REM wCmdLength;
+    uint16_t    PH_MEMLOC_REM wIndex;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    pStatusFlags[0] = 0x00;
+    pStatusFlags[1] = 0x00;
+
+    /* PMm of the current card determines the block limits and the response timeouts */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalFelica_GetSerialNo(pDataParams->pPalFelicaDataParams, aIDmPMm, &bIDmPMmLength));
+
+    /* Learned limits only apply to the card they have been learned from */
+    if (memcmp(pDataParams->aIDm, aIDmPMm, PHPAL_FELICA_IDM_LENGTH) != 0)
+    {
+        memcpy(pDataParams->aIDm, aIDmPMm, PHPAL_FELICA_IDM_LENGTH);  /* PRQA S 3200 */
+        pDataParams->bLearnedReadBlocks = 0;
+        pDataParams->bLearnedWriteBlocks = 0;
+    }
+
+    wIndex = 0;
+    while (wIndex < wNumBlocks)
+    {
+        bMaxBlocks = phalFelica_Sw_GetMaxBlocks(pDataParams, bCmd, &aIDmPMm[PHPAL_FELICA_IDM_LENGTH]);
+
+        /* Put as many blocks into this command as the limits allow */
+        bNumServices = 0;
+        bNumBlocks = 0;
+        wBlockListLength = 0;
+        while (((wIndex + bNumBlocks) < wNumBlocks) && (bNumBlocks < bMaxBlocks))
+        {
+            for (bService = 0; bService < bNumServices; ++bService)
+            {
+                if (aServices[bService] == pBlocks[wIndex + bNumBlocks].wServiceCode)
+                {
+                    break;
+                }
+            }
+            if (bService == PHAL_FELICA_MAX_SERVICES)
+            {
+                break;
+            }
+
+            bElementLength = (pBlocks[wIndex + bNumBlocks].wBlockNo > 0xFF) ? 3 : 2;
+
+            /* [number of services][service codes][number of blocks][block list][block data] */
+            wParamsLength = 1 + ((bNumServices + ((bService == bNumServices) ? 1 : 0)) << 1) + 1 + wBlockListLength + bElementLength;
+            if (bCmd == PHAL_FELICA_CMD_WRITE)
+            {
+                wParamsLength = wParamsLength + ((bNumBlocks + 1) * PHAL_FELICA_BLOCK_LENGTH);
+            }
+            if (wParamsLength > PHAL_FELICA_CMD_PARAMS_MAX)
+            {
+                break;
+            }
+
+            if (bService == bNumServices)
+            {
+                aServices[bNumServices++] = pBlocks[wIndex + bNumBlocks].wServiceCode;
+            }
+
+            if (bElementLength == 2)
+            {
+                aBlockList[wBlockListLength++] = PHAL_FELICA_BLOCKLIST_2BYTE | bService;
+                aBlockList[wBlockListLength++] = (uint8_t)pBlocks[wIndex + bNumBlocks].wBlockNo;
+            }
+            else
+            {
+                aBlockList[wBlockListLength++] = bService;
+                aBlockList[wBlockListLength++] = (uint8_t)(pBlocks[wIndex + bNumBlocks].wBlockNo);
+                aBlockList[wBlockListLength++] = (uint8_t)(pBlocks[wIndex + bNumBlocks].wBlockNo >> 8);
+            }
+            ++bNumBlocks;
+        }
+
+        /* Assemble the command, service codes are transmitted LSB first */
+        wCmdLength = 0;
+        aCmd[wCmdLength++] = bCmd;
+        aCmd[wCmdLength++] = bNumServices;
+        for (bService = 0; bService < bNumServices; ++bService)
+        {
+            aCmd[wCmdLength++] = (uint8_t)(aServices[bService]);
+            aCmd[wCmdLength++] = (uint8_t)(aServices[bService] >> 8);
+        }
+        aCmd[wCmdLength++] = bNumBlocks;
+        memcpy(&aCmd[wCmdLength], aBlockList, wBlockListLength);  /* PRQA S 3200 */
+        wCmdLength = wCmdLength + wBlockListLength;
+
+        /* The PAL derives the response timeout from PMm for bNumBlocks blocks */
+        if (bCmd == PHAL_FELICA_CMD_WRITE)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalFelica_Exchange(
+                pDataParams->pPalFelicaDataParams,
+                PH_EXCHANGE_BUFFER_FIRST,
+                bNumBlocks,
+                aCmd,
+                wCmdLength,
+                &pRxBuffer,
+                &wRxLength));
+
+            /* The block data is sent straight from the caller's buffer */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalFelica_Exchange(
+                pDataParams->pPalFelicaDataParams,
+                PH_EXCHANGE_BUFFER_LAST,
+                bNumBlocks,
+                &pData[wIndex * PHAL_FELICA_BLOCK_LENGTH],
+                (uint16_t)(bNumBlocks * PHAL_FELICA_BLOCK_LENGTH),
+                &pRxBuffer,
+                &wRxLength));
+        }
+        else
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalFelica_Exchange(
+                pDataParams->pPalFelicaDataParams,
+                PH_EXCHANGE_DEFAULT,
+                bNumBlocks,
+                aCmd,
+                wCmdLength,
+                &pRxBuffer,
+                &wRxLength));
+        }
+
+        /* [status flag 1][status flag 2] */
+        if (wRxLength < 2)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_FELICA);
+        }
+        pStatusFlags[0] = pRxBuffer[0];
+        pStatusFlags[1] = pRxBuffer[1];
+
+        if (pStatusFlags[0] != 0x00)
+        {
+            /* The card rejected the number of blocks; nothing has been read or written,
+            so remember a lower limit for this card and retry */
+            if ((pStatusFlags[1] == PHAL_FELICA_STATUS_NO_OF_BLOCKS) && (bNumBlocks > 1))
+            {
+                if (bCmd == PHAL_FELICA_CMD_READ)
+                {
+                    pDataParams->bLearnedReadBlocks = bNumBlocks - 1;
+                }
+                else
+                {
+                    pDataParams->bLearnedWriteBlocks = bNumBlocks - 1;
+                }
+                continue;
+            }
+
+            return PH_ADD_COMPCODE(PHAL_FELICA_ERR_FELICA, PH_COMP_AL_FELICA);
+        }
+
+        /* [status flag 1][status flag 2][number of blocks][block data] */
+        if (bCmd == PHAL_FELICA_CMD_READ)
+        {
+            if ((wRxLength != (3 + (bNumBlocks * PHAL_FELICA_BLOCK_LENGTH))) || (pRxBuffer[2] != bNumBlocks))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_FELICA);
+            }
+            memcpy(&pData[wIndex * PHAL_FELICA_BLOCK_LENGTH], &pRxBuffer[3], bNumBlocks * PHAL_FELICA_BLOCK_LENGTH);  /* PRQA S 3200 */
+        }
+
+        wIndex = wIndex + bNumBlocks;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_FELICA);
+}
+
+#endif /* NXPBUILD__PHAL_FELICA_SW */
@@ -0,0 +1,59 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Felica Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALFELICA_SW_H
+#define PHALFELICA_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phalFelica_Sw_ReadWithoutEncryption(
+                                               phalFelica_Sw_DataParams_t * pDataParams,
+                                               phalFelica_Block_t * pBlocks,
+                                               uint16_t wNumBlocks,
+                                               uint8_t * pData,
+                                               uint8_t * pStatusFlags
+                                               );
+
+phStatus_t phalFelica_Sw_WriteWithoutEncryption(
+                                                phalFelica_Sw_DataParams_t * pDataParams,
+                                                phalFelica_Block_t * pBlocks,
+                                                uint16_t wNumBlocks,
+                                                uint8_t * pData,
+                                                uint8_t * pStatusFlags
+                                                );
+
+phStatus_t phalFelica_Sw_SetConfig(
+                                   phalFelica_Sw_DataParams_t * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t wValue
+                                   );
+
+phStatus_t phalFelica_Sw_GetConfig(
+                                   phalFelica_Sw_DataParams_t * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t * pValue
+                                   );
+
+#endif /* PHALFELICA_SW_H */
@@ -0,0 +1,254 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Felica Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalFelica.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_FELICA_SW
+#include "Sw/phalFelica_Sw.h"
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+#ifdef NXPBUILD__PHAL_FELICA
+
+phStatus_t phalFelica_ReadWithoutEncryption(
+                                            void * pDataParams,
+                                            phalFelica_Block_t * pBlocks,
+                                            uint16_t wNumBlocks,
+                                            uint8_t * pData,
+                                            uint8_t * pStatusFlags
+                                            )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalFelica_ReadWithoutEncryption");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pStatusFlags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pBlocks);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pStatusFlags);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_FELICA)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_FELICA_SW
+    case PHAL_FELICA_SW_ID:
+        status = phalFelica_Sw_ReadWithoutEncryption((phalFelica_Sw_DataParams_t *)pDataParams, pBlocks, wNumBlocks, pData, pStatusFlags);
+        break;
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalFelica_WriteWithoutEncryption(
+                                             void * pDataParams,
+                                             phalFelica_Block_t * pBlocks,
+                                             uint16_t wNumBlocks,
+                                             uint8_t * pData,
+                                             uint8_t * pStatusFlags
+                                             )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalFelica_WriteWithoutEncryption");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pStatusFlags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pBlocks);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pStatusFlags);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_FELICA)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_FELICA_SW
+    case PHAL_FELICA_SW_ID:
+        status = phalFelica_Sw_WriteWithoutEncryption((phalFelica_Sw_DataParams_t *)pDataParams, pBlocks, wNumBlocks, pData, pStatusFlags);
+        break;
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalFelica_SetConfig(
+                                void * pDataParams,
+                                uint16_t wConfig,
+                                uint16_t wValue
+                                )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalFelica_SetConfig");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wConfig);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wValue);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wConfig_log, &wConfig);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wValue_log, &wValue);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_FELICA)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_FELICA_SW
+    case PHAL_FELICA_SW_ID:
+        status = phalFelica_Sw_SetConfig((phalFelica_Sw_DataParams_t *)pDataParams, wConfig, wValue);
+        break;
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalFelica_GetConfig(
+                                void * pDataParams,
+                                uint16_t wConfig,
+                                uint16_t * pValue
+                                )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalFelica_GetConfig");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wConfig);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pValue);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wConfig_log, &wConfig);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pValue);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_FELICA)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_FELICA_SW
+    case PHAL_FELICA_SW_ID:
+        status = phalFelica_Sw_GetConfig((phalFelica_Sw_DataParams_t *)pDataParams, wConfig, pValue);
+        break;
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_FELICA);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pValue_log, pValue);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+#endif /* NXPBUILD__PHAL_FELICA */
@@ -0,0 +1,58 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal definitions of the Felica Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALFELICA_INT_H
+#define PHALFELICA_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+* @{
+*/
+
+#define PHAL_FELICA_CMD_READ        0x06U   /**< Felica Read Without Encryption command byte */
+#define PHAL_FELICA_CMD_WRITE       0x08U   /**< Felica Write Without Encryption command byte */
+
+#define PHAL_FELICA_BLOCKLIST_2BYTE 0x80U   /**< Block list element flag for a one byte block number. */
+
+#define PHAL_FELICA_STATUS_NO_OF_BLOCKS 0xA2U   /**< Status flag 2: illegal number of blocks. */
+
+/**
+* Command parameters after the command byte; Felica frames are limited to
+* 254 bytes including the length byte, the command byte and the IDm.
+*/
+#define PHAL_FELICA_CMD_PARAMS_MAX  (PHPAL_FELICA_TXLENGTH_MAX - 2U - PHPAL_FELICA_IDM_LENGTH)
+
+/** PMm IC type (ROM type is PMm[0], IC type is PMm[1]) of Felica Lite. */
+#define PHAL_FELICA_IC_TYPE_LITE    0xF0U
+/** PMm IC type of Felica Lite-S. */
+#define PHAL_FELICA_IC_TYPE_LITE_S  0xF1U
+
+#define PHAL_FELICA_LITE_MAX_READ_BLOCKS    4U  /**< Read Without Encryption block limit of Felica Lite(-S). */
+#define PHAL_FELICA_LITE_MAX_WRITE_BLOCKS   1U  /**< Write Without Encryption block limit of Felica Lite(-S). */
+
+/** @} */
+
+#endif /* PHALFELICA_INT_H */
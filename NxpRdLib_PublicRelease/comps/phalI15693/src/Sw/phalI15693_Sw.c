@@ -0,0 +1,457 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software ISO15693 Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalI15693.h>
+#include <phpalSli15693.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_I15693_SW
+
+#include <string.h>
+#include "phalI15693_Sw.h"
+#include "../phalI15693_Int.h"
+
+static phStatus_t phalI15693_Sw_HarvestInventoryRead(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bFlags,
+    uint8_t bAfi,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    uint8_t * pArena,
+    uint8_t bMaxTags,
+    uint8_t * pNumTags,
+    uint8_t * pMoreTagsAvailable,
+    uint16_t * pMaxBlocks
+    );
+
+static phStatus_t phalI15693_Sw_HarvestReadRecord(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bFlags,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    uint8_t * pRecord,
+    uint16_t * pMaxBlocks
+    );
+
+phStatus_t phalI15693_Sw_Init(
+                              phalI15693_Sw_DataParams_t * pDataParams,
+                              uint16_t wSizeOfDataParams,
+                              void * pPalSli15693DataParams
+                              )
+{
+    if (sizeof(phalI15693_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pPalSli15693DataParams);
+
+    /* init private data */
+    pDataParams->wId                    = PH_COMP_AL_I15693 | PHAL_I15693_SW_ID;
+    pDataParams->pPalSli15693DataParams = pPalSli15693DataParams;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
+phStatus_t phalI15693_Sw_ReadMultipleBlocks(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    uint8_t * pData,
+    uint16_t * pDataLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aCmd[3];
+    uint8_t *   PH_MEMLOC_REM pResp;
+    uint16_t    PH_MEMLOC_REM wRespLength;
+
+    *pDataLength = 0;
+
+    if ((wNumBlocks == 0) || (((uint16_t)bBlockNo + wNumBlocks) > PHAL_I15693_MAX_BLOCKS))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+    }
+
+    /* The number of blocks is coded as count - 1 */
+    aCmd[0] = PHAL_I15693_CMD_READ_MULTIPLE_BLOCKS;
+    aCmd[1] = bBlockNo;
+    aCmd[2] = (uint8_t)(wNumBlocks - 1);
+
+    /* Set short timeout. */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_TIMEOUT_US,
+        PHPAL_SLI15693_TIMEOUT_SHORT_US));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_Exchange(
+        pDataParams->pPalSli15693DataParams,
+        PH_EXCHANGE_DEFAULT,
+        aCmd,
+        3,
+        &pResp,
+        &wRespLength));
+
+    if (wRespLength != (wNumBlocks * PHPAL_SLI15693_BLOCK_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_I15693);
+    }
+
+    memcpy(pData, pResp, wRespLength);  /* PRQA S 3200 */
+    *pDataLength = wRespLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
+phStatus_t phalI15693_Sw_Harvest(
+                                 phalI15693_Sw_DataParams_t * pDataParams,
+                                 uint8_t bOption,
+                                 uint8_t bFlags,
+                                 uint8_t bAfi,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t * pArena,
+                                 uint8_t bMaxTags,
+                                 uint8_t * pNumTags,
+                                 uint8_t * pMoreTagsAvailable
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aUids[PHAL_I15693_HARVEST_CHUNK_SIZE * PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM aDsfids[PHAL_I15693_HARVEST_CHUNK_SIZE];
+    uint8_t     PH_MEMLOC_REM bNumFound;
+    uint8_t     PH_MEMLOC_REM bNumRounds;
+    uint8_t     PH_MEMLOC_REM bMore;
+    uint8_t     PH_MEMLOC_REM bIndex;
+    uint8_t *   PH_MEMLOC_REM pRecord;
+    uint16_t    PH_MEMLOC_REM wRecordLength;
+    uint16_t    PH_MEMLOC_REM wMaxBlocks;
+
+    *pNumTags = 0;
+    *pMoreTagsAvailable = 0;
+
+    if ((bOption & (uint8_t)~(uint8_t)(PHAL_I15693_HARVEST_FAST | PHAL_I15693_HARVEST_READ_MULTIPLE_ONLY)) ||
+        (wNumBlocks == 0) ||
+        (((uint16_t)bBlockNo + wNumBlocks) > PHAL_I15693_MAX_BLOCKS))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_I15693);
+    }
+
+    /* Always use the high data rate */
+    bFlags &= (uint8_t)(PHPAL_SLI15693_FLAG_TWO_SUB_CARRIERS | PHPAL_SLI15693_FLAG_AFI);
+    bFlags |= PHPAL_SLI15693_FLAG_DATA_RATE;
+
+    wRecordLength = PHAL_I15693_HARVEST_RECORD_LENGTH(wNumBlocks);
+
+    /* Largest block count of Read Multiple Blocks, lowered as the HAL buffer overflows */
+    wMaxBlocks = wNumBlocks;
+
+    /* Collect UID and data in one go from all tags supporting InventoryRead */
+    if (!(bOption & PHAL_I15693_HARVEST_READ_MULTIPLE_ONLY) &&
+        ((wNumBlocks * PHPAL_SLI15693_BLOCK_LENGTH) <= (PHAL_I15693_HARVEST_BUFFER_SIZE - PHPAL_SLI15693_UID_LENGTH)))
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_Sw_HarvestInventoryRead(
+            pDataParams,
+            bOption,
+            bFlags,
+            bAfi,
+            bBlockNo,
+            wNumBlocks,
+            pArena,
+            bMaxTags,
+            pNumTags,
+            pMoreTagsAvailable,
+            &wMaxBlocks));
+    }
+
+    /* The remaining tags did not answer InventoryRead; all others are in quiet state by now */
+    bMore = 1;
+    while (bMore && (*pNumTags < bMaxTags))
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_InventoryAll(
+            pDataParams->pPalSli15693DataParams,
+            bFlags,
+            bAfi,
+            aUids,
+            aDsfids,
+            ((uint8_t)(bMaxTags - *pNumTags) < PHAL_I15693_HARVEST_CHUNK_SIZE) ? (uint8_t)(bMaxTags - *pNumTags) : PHAL_I15693_HARVEST_CHUNK_SIZE,
+            &bNumFound,
+            NULL,
+            0,
+            &bNumRounds,
+            &bMore));
+
+        for (bIndex = 0; bIndex < bNumFound; ++bIndex)
+        {
+            pRecord = &pArena[*pNumTags * wRecordLength];
+            memcpy(&pRecord[PHAL_I15693_HARVEST_UID_OFFSET], &aUids[bIndex * PHPAL_SLI15693_UID_LENGTH], PHPAL_SLI15693_UID_LENGTH);  /* PRQA S 3200 */
+            ++(*pNumTags);
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_Sw_HarvestReadRecord(pDataParams, bFlags, bBlockNo, wNumBlocks, pRecord, &wMaxBlocks));
+        }
+
+        /* Tags which could not be resolved would be found again and again */
+        if (bNumFound == 0)
+        {
+            break;
+        }
+    }
+
+    if (bMore)
+    {
+        *pMoreTagsAvailable = 1;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
+static phStatus_t phalI15693_Sw_HarvestInventoryRead(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bOption,
+    uint8_t bFlags,
+    uint8_t bAfi,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    uint8_t * pArena,
+    uint8_t bMaxTags,
+    uint8_t * pNumTags,
+    uint8_t * pMoreTagsAvailable,
+    uint16_t * pMaxBlocks
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phalI15693_HarvestNode_t PH_MEMLOC_REM aNodes[PHAL_I15693_HARVEST_STACK_SIZE];
+    phalI15693_HarvestNode_t PH_MEMLOC_REM sNode;
+    uint8_t     PH_MEMLOC_REM bNumNodes;
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint8_t     PH_MEMLOC_REM aData[PHAL_I15693_HARVEST_BUFFER_SIZE];
+    uint16_t    PH_MEMLOC_REM wDataLength;
+    uint8_t     PH_MEMLOC_REM bByte;
+    uint8_t     PH_MEMLOC_REM bBit;
+    uint8_t *   PH_MEMLOC_REM pRecord;
+    uint16_t    PH_MEMLOC_REM wRecordLength;
+
+    wRecordLength = PHAL_I15693_HARVEST_RECORD_LENGTH(wNumBlocks);
+
+    /* Every request uses 1 slot, so the option flag returns the UID bits beyond the mask */
+    bFlags |= PHPAL_SLI15693_FLAG_NBSLOTS | PHPAL_SLI15693_FLAG_OPTION;
+
+    memset(aNodes[0].aMask, 0, PHPAL_SLI15693_UID_LENGTH);  /* PRQA S 3200 */
+    aNodes[0].bMaskBitLength = 0;
+    bNumNodes = 1;
+
+    while (bNumNodes > 0)
+    {
+        if (*pNumTags == bMaxTags)
+        {
+            *pMoreTagsAvailable = 1;
+            break;
+        }
+
+        memcpy(&sNode, &aNodes[--bNumNodes], sizeof(phalI15693_HarvestNode_t));  /* PRQA S 3200 */
+
+        if (bOption & PHAL_I15693_HARVEST_FAST)
+        {
+            status = phpalSli15693_FastInventoryRead(
+                pDataParams->pPalSli15693DataParams,
+                bFlags,
+                bAfi,
+                sNode.aMask,
+                sNode.bMaskBitLength,
+                bBlockNo,
+                wNumBlocks,
+                aUid,
+                &bUidLength,
+                aData,
+                &wDataLength);
+        }
+        else
+        {
+            status = phpalSli15693_InventoryRead(
+                pDataParams->pPalSli15693DataParams,
+                bFlags,
+                bAfi,
+                sNode.aMask,
+                sNode.bMaskBitLength,
+                bBlockNo,
+                wNumBlocks,
+                aUid,
+                &bUidLength,
+                aData,
+                &wDataLength);
+        }
+
+        switch (status & PH_ERR_MASK)
+        {
+        case PH_ERR_SUCCESS:
+            pRecord = &pArena[*pNumTags * wRecordLength];
+            ++(*pNumTags);
+
+            /* The PAL merged mask and received UID bits */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_GetSerialNo(
+                pDataParams->pPalSli15693DataParams,
+                &pRecord[PHAL_I15693_HARVEST_UID_OFFSET],
+                &bUidLength));
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_StayQuiet(pDataParams->pPalSli15693DataParams));
+
+            if (wDataLength == (wNumBlocks * PHPAL_SLI15693_BLOCK_LENGTH))
+            {
+                pRecord[PHAL_I15693_HARVEST_SOURCE_OFFSET] = PHAL_I15693_HARVEST_SOURCE_INV_READ;
+                memcpy(&pRecord[PHAL_I15693_HARVEST_DATA_OFFSET], aData, wDataLength);  /* PRQA S 3200 */
+            }
+            else
+            {
+                PH_CHECK_SUCCESS_FCT(statusTmp, phalI15693_Sw_HarvestReadRecord(
+                    pDataParams,
+                    (uint8_t)(bFlags & (uint8_t)~(uint8_t)(PHPAL_SLI15693_FLAG_NBSLOTS | PHPAL_SLI15693_FLAG_OPTION)),
+                    bBlockNo,
+                    wNumBlocks,
+                    pRecord,
+                    pMaxBlocks));
+            }
+            break;
+
+        case PH_ERR_IO_TIMEOUT:
+            break;
+
+            /* A CRC error is a collision which could not be detected on bit level */
+        case PH_ERR_COLLISION_ERROR:
+        case PH_ERR_INTEGRITY_ERROR:
+            if (sNode.bMaskBitLength == (PHPAL_SLI15693_UID_LENGTH << 3))
+            {
+                break;
+            }
+
+            /* Split the node by the next mask bit, the '0' half is resolved first */
+            bByte = sNode.bMaskBitLength >> 3;
+            bBit = sNode.bMaskBitLength & 0x07;
+            ++sNode.bMaskBitLength;
+
+            sNode.aMask[bByte] |= (uint8_t)(1 << bBit);
+            memcpy(&aNodes[bNumNodes++], &sNode, sizeof(phalI15693_HarvestNode_t));  /* PRQA S 3200 */
+
+            sNode.aMask[bByte] &= (uint8_t)~(uint8_t)(1 << bBit);
+            memcpy(&aNodes[bNumNodes++], &sNode, sizeof(phalI15693_HarvestNode_t));  /* PRQA S 3200 */
+            break;
+
+            /* Tags rejecting the request are read later on */
+        case PHPAL_SLI15693_ERR_ISO15693:
+            break;
+
+        default:
+            return status;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
+static phStatus_t phalI15693_Sw_HarvestReadRecord(
+    phalI15693_Sw_DataParams_t * pDataParams,
+    uint8_t bFlags,
+    uint8_t bBlockNo,
+    uint16_t wNumBlocks,
+    uint8_t * pRecord,
+    uint16_t * pMaxBlocks
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wBlocksRead;
+    uint16_t    PH_MEMLOC_REM wChunk;
+    uint16_t    PH_MEMLOC_REM wTagMaxBlocks;
+    uint16_t    PH_MEMLOC_REM wDataLength;
+
+    pRecord[PHAL_I15693_HARVEST_SOURCE_OFFSET] = PHAL_I15693_HARVEST_SOURCE_NONE;
+
+    /* Address the tag of the record; tags in quiet state still answer addressed requests */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetSerialNo(
+        pDataParams->pPalSli15693DataParams,
+        &pRecord[PHAL_I15693_HARVEST_UID_OFFSET],
+        PHPAL_SLI15693_UID_LENGTH));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+        pDataParams->pPalSli15693DataParams,
+        PHPAL_SLI15693_CONFIG_FLAGS,
+        (uint16_t)((bFlags & (PHPAL_SLI15693_FLAG_TWO_SUB_CARRIERS | PHPAL_SLI15693_FLAG_DATA_RATE)) | PHPAL_SLI15693_FLAG_ADDRESSED)));
+
+    /* Error codes of the tag do not tell a too large block count from e.g. a locked block,
+       so only the limit of the HAL buffer is kept for the following tags */
+    wTagMaxBlocks = *pMaxBlocks;
+    wBlocksRead = 0;
+    while (wBlocksRead < wNumBlocks)
+    {
+        wChunk = ((wNumBlocks - wBlocksRead) < wTagMaxBlocks) ? (wNumBlocks - wBlocksRead) : wTagMaxBlocks;
+
+        status = phalI15693_Sw_ReadMultipleBlocks(
+            pDataParams,
+            (uint8_t)(bBlockNo + wBlocksRead),
+            wChunk,
+            &pRecord[PHAL_I15693_HARVEST_DATA_OFFSET + (wBlocksRead * PHPAL_SLI15693_BLOCK_LENGTH)],
+            &wDataLength);
+
+        switch (status & PH_ERR_MASK)
+        {
+        case PH_ERR_SUCCESS:
+            wBlocksRead = wBlocksRead + wChunk;
+            break;
+
+            /* Too many blocks for the tag or the HAL buffer: retry with half the count */
+        case PHPAL_SLI15693_ERR_ISO15693:
+        case PH_ERR_BUFFER_OVERFLOW:
+            if (wChunk == 1)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+            }
+            wTagMaxBlocks = wChunk >> 1;
+            if ((status & PH_ERR_MASK) == PH_ERR_BUFFER_OVERFLOW)
+            {
+                *pMaxBlocks = wTagMaxBlocks;
+            }
+            break;
+
+            /* The tag did not answer properly, leave the record without data */
+        case PH_ERR_IO_TIMEOUT:
+        case PH_ERR_INTEGRITY_ERROR:
+        case PH_ERR_COLLISION_ERROR:
+        case PH_ERR_PROTOCOL_ERROR:
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+
+        default:
+            return status;
+        }
+    }
+
+    pRecord[PHAL_I15693_HARVEST_SOURCE_OFFSET] = PHAL_I15693_HARVEST_SOURCE_READ_MULTIPLE;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_I15693);
+}
+
+#endif /* NXPBUILD__PHAL_I15693_SW */
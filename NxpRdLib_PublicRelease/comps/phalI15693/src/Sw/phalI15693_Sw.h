@@ -0,0 +1,52 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software ISO15693 Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALI15693_SW_H
+#define PHALI15693_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phalI15693_Sw_ReadMultipleBlocks(
+                                            phalI15693_Sw_DataParams_t * pDataParams,
+                                            uint8_t bBlockNo,
+                                            uint16_t wNumBlocks,
+                                            uint8_t * pData,
+                                            uint16_t * pDataLength
+                                            );
+
+phStatus_t phalI15693_Sw_Harvest(
+                                 phalI15693_Sw_DataParams_t * pDataParams,
+                                 uint8_t bOption,
+                                 uint8_t bFlags,
+                                 uint8_t bAfi,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t * pArena,
+                                 uint8_t bMaxTags,
+                                 uint8_t * pNumTags,
+                                 uint8_t * pMoreTagsAvailable
+                                 );
+
+#endif /* PHALI15693_SW_H */
@@ -0,0 +1,176 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic ISO15693 Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalI15693.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_I15693_SW
+#include "Sw/phalI15693_Sw.h"
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+#ifdef NXPBUILD__PHAL_I15693
+
+phStatus_t phalI15693_ReadMultipleBlocks(
+                                         void * pDataParams,
+                                         uint8_t bBlockNo,
+                                         uint16_t wNumBlocks,
+                                         uint8_t * pData,
+                                         uint16_t * pDataLength
+                                         )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalI15693_ReadMultipleBlocks");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pDataLength);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_I15693)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_I15693_SW
+    case PHAL_I15693_SW_ID:
+        status = phalI15693_Sw_ReadMultipleBlocks((phalI15693_Sw_DataParams_t *)pDataParams, bBlockNo, wNumBlocks, pData, pDataLength);
+        break;
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pDataLength_log, pDataLength);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalI15693_Harvest(
+                              void * pDataParams,
+                              uint8_t bOption,
+                              uint8_t bFlags,
+                              uint8_t bAfi,
+                              uint8_t bBlockNo,
+                              uint16_t wNumBlocks,
+                              uint8_t * pArena,
+                              uint8_t bMaxTags,
+                              uint8_t * pNumTags,
+                              uint8_t * pMoreTagsAvailable
+                              )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalI15693_Harvest");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bFlags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bAfi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pArena);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bMaxTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMoreTagsAvailable);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bOption_log, &bOption);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bFlags_log, &bFlags);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bAfi_log, &bAfi);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bMaxTags_log, &bMaxTags);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pArena);
+	PH_ASSERT_NULL (pNumTags);
+	PH_ASSERT_NULL (pMoreTagsAvailable);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_I15693)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_I15693_SW
+    case PHAL_I15693_SW_ID:
+        status = phalI15693_Sw_Harvest((phalI15693_Sw_DataParams_t *)pDataParams, bOption, bFlags, bAfi, bBlockNo, wNumBlocks, pArena, bMaxTags, pNumTags, pMoreTagsAvailable);
+        break;
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_I15693);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNumTags_log, pNumTags);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMoreTagsAvailable_log, pMoreTagsAvailable);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+#endif /* NXPBUILD__PHAL_I15693 */
@@ -0,0 +1,57 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal definitions of the ISO15693 Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALI15693_INT_H
+#define PHALI15693_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+* @{
+*/
+
+#define PHAL_I15693_CMD_READ_MULTIPLE_BLOCKS    0x23U   /**< ISO15693 Read Multiple Blocks command byte */
+
+/** Pending mask tree nodes of the harvest; a binary walk keeps at most one sibling per UID bit. */
+#define PHAL_I15693_HARVEST_STACK_SIZE          65U
+/** Number of tags retrieved per call of \ref phpalSli15693_InventoryAll. */
+#define PHAL_I15693_HARVEST_CHUNK_SIZE          8U
+/** Size of the receive buffer for InventoryRead responses (remaining UID and block data). */
+#define PHAL_I15693_HARVEST_BUFFER_SIZE         256U
+/** Maximum number of blocks in one command. */
+#define PHAL_I15693_MAX_BLOCKS                  256U
+
+/**
+* \brief Pending node of the harvest mask tree.
+*/
+typedef struct
+{
+    uint8_t aMask[PHPAL_SLI15693_UID_LENGTH];   /**< UID mask of the node. */
+    uint8_t bMaskBitLength;                     /**< Length of the UID mask in bits. */
+} phalI15693_HarvestNode_t;
+
+/** @} */
+
+#endif /* PHALI15693_INT_H */
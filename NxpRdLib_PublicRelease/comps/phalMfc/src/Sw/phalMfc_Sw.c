@@ -35,6 +35,33 @@
 #include "phalMfc_Sw.h"
 #include "../phalMfc_Int.h"
 
+static phStatus_t phalMfc_Sw_CheckAuthState(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    phStatus_t status
+    );
+
+static phStatus_t phalMfc_Sw_AuthenticateSector(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    uint8_t bBlockNo,
+    uint8_t bKeyType,
+    uint16_t wKeyNumber,
+    uint16_t wKeyVersion,
+    uint8_t * pUid,
+    uint8_t bUidLength
+    );
+
+static phStatus_t phalMfc_Sw_CheckValueOperation(
+    phalMfc_ValueOperation_t * pOperation
+    );
+
+static phStatus_t phalMfc_Sw_ExecuteValueOperation(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    uint8_t * pUid,
+    uint8_t bUidLength,
+    uint8_t bOption,
+    phalMfc_ValueOperation_t * pOperation
+    );
+
 phStatus_t phalMfc_Sw_Init(
                            phalMfc_Sw_DataParams_t * pDataParams,
                            uint16_t wSizeOfDataParams, 
@@ -53,6 +80,7 @@ phStatus_t phalMfc_Sw_Init(
     pDataParams->wId                    = PH_COMP_AL_MFC | PHAL_MFC_SW_ID;
     pDataParams->pPalMifareDataParams   = pPalMifareDataParams;
     pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
+    pDataParams->bAuthSector            = PHAL_MFC_NO_SECTOR;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
@@ -67,16 +95,20 @@ phStatus_t phalMfc_Sw_Authenticate(
                                    uint8_t bUidLength
                                    )
 {
+    phStatus_t  PH_MEMLOC_REM status;
     phStatus_t  PH_MEMLOC_REM statusTmp;
     uint8_t     PH_MEMLOC_REM aKey[PHHAL_HW_MFC_KEY_LENGTH * 2];
     uint8_t *   PH_MEMLOC_REM pKey;
     uint16_t    PH_MEMLOC_REM bKeystoreKeyType;
 
+    /* a new authentication ends the current one, also if it fails */
+    pDataParams->bAuthSector = PHAL_MFC_NO_SECTOR;
+
     /* check if software key store is available. */
     if (pDataParams->pKeyStoreDataParams == NULL)
     {
         /* There is no software keystore available. */
-        return phpalMifare_MfcAuthenticateKeyNo(
+        status = phpalMifare_MfcAuthenticateKeyNo(
             pDataParams->pPalMifareDataParams,
             bBlockNo,
             bKeyType,
@@ -125,13 +157,25 @@ phStatus_t phalMfc_Sw_Authenticate(
             return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_HAL);
         }
 
-        return phpalMifare_MfcAuthenticate(
+        status = phpalMifare_MfcAuthenticate(
             pDataParams->pPalMifareDataParams,
             bBlockNo,
             bKeyType,
             pKey,
             &pUid[bUidLength - 4]);
     }
+
+    /* remember the authentication, so sector accesses can skip it */
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        pDataParams->bAuthSector        = PHAL_MFC_GET_SECTOR(bBlockNo);
+        pDataParams->bAuthKeyType       = bKeyType;
+        pDataParams->wAuthKeyNo         = wKeyNo;
+        pDataParams->wAuthKeyVersion    = wKeyVersion;
+        memcpy(pDataParams->aAuthUid, &pUid[bUidLength - 4], sizeof(pDataParams->aAuthUid));  /* PRQA S 3200 */
+    }
+
+    return status;
 }
 
 phStatus_t phalMfc_Sw_Read(
@@ -150,19 +194,21 @@ phStatus_t phalMfc_Sw_Read(
     aCommand[1] = bBlockNo;
 
     /* transmit the command frame */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+    statusTmp = phpalMifare_ExchangeL3(
         pDataParams->pPalMifareDataParams,
         PH_EXCHANGE_DEFAULT,
         aCommand,
         2,
         &pRxBuffer,
         &wRxLength
-        ));
+        );
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_CheckAuthState(pDataParams, statusTmp));
 
     /* check received length */
     if (wRxLength != PHAL_MFC_DATA_BLOCK_LENGTH)
     {
-        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFC);
+        return phalMfc_Sw_CheckAuthState(pDataParams, PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFC));
     }
 
     /* copy received data block */
@@ -210,24 +256,29 @@ phStatus_t phalMfc_Sw_Write(
     aCommand[1] = bBlockNo;
 
     /* transmit the command frame (first part) */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+    statusTmp = phpalMifare_ExchangeL3(
         pDataParams->pPalMifareDataParams,
         PH_EXCHANGE_DEFAULT,
         aCommand,
         2,
         &pRxBuffer,
         &wRxLength
-        ));
+        );
 
     /* transmit the data (second part) */
-    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
-        pDataParams->pPalMifareDataParams,
-        PH_EXCHANGE_DEFAULT,
-        pBlockData,
-        PHAL_MFC_DATA_BLOCK_LENGTH,
-        &pRxBuffer,
-        &wRxLength
-        ));
+    if ((statusTmp & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        statusTmp = phpalMifare_ExchangeL3(
+            pDataParams->pPalMifareDataParams,
+            PH_EXCHANGE_DEFAULT,
+            pBlockData,
+            PHAL_MFC_DATA_BLOCK_LENGTH,
+            &pRxBuffer,
+            &wRxLength
+            );
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_CheckAuthState(pDataParams, statusTmp));
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
@@ -255,7 +306,7 @@ phStatus_t phalMfc_Sw_Increment(
                                 uint8_t * pValue
                                 )
 {
-    return phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_INCREMENT, bBlockNo, pValue);
+    return phalMfc_Sw_CheckAuthState(pDataParams, phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_INCREMENT, bBlockNo, pValue));
 }
 
 phStatus_t phalMfc_Sw_Decrement(
@@ -264,7 +315,7 @@ phStatus_t phalMfc_Sw_Decrement(
                                 uint8_t * pValue
                                 )
 {
-    return phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_DECREMENT, bBlockNo, pValue);
+    return phalMfc_Sw_CheckAuthState(pDataParams, phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_DECREMENT, bBlockNo, pValue));
 }
 
 phStatus_t phalMfc_Sw_Transfer(
@@ -273,10 +324,10 @@ phStatus_t phalMfc_Sw_Transfer(
                                )
 {
     /* transmit the command frame */
-    return phalMfc_Int_Transfer(
+    return phalMfc_Sw_CheckAuthState(pDataParams, phalMfc_Int_Transfer(
         pDataParams->pPalMifareDataParams,
         bBlockNo
-        );
+        ));
 }
 
 phStatus_t phalMfc_Sw_Restore(
@@ -289,7 +340,7 @@ phStatus_t phalMfc_Sw_Restore(
     /* restore needs four dummy bytes */
     memset(bBuffer, 0x00, PHAL_MFC_VALUE_BLOCK_LENGTH);  /* PRQA S 3200 */
 
-    return phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_RESTORE, bBlockNo, bBuffer);
+    return phalMfc_Sw_CheckAuthState(pDataParams, phalMfc_Int_Value(pDataParams->pPalMifareDataParams, PHAL_MFC_CMD_RESTORE, bBlockNo, bBuffer));
 }
 
 phStatus_t phalMfc_Sw_IncrementTransfer(
@@ -333,6 +384,439 @@ phStatus_t phalMfc_Sw_RestoreTransfer(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
 }
 
+phStatus_t phalMfc_Sw_ReadSector(
+                                 phalMfc_Sw_DataParams_t * pDataParams,
+                                 uint8_t bSectorNo,
+                                 uint8_t bKeyType,
+                                 uint16_t wKeyNumber,
+                                 uint16_t wKeyVersion,
+                                 uint8_t * pUid,
+                                 uint8_t bUidLength,
+                                 uint8_t * pData
+                                 )
+{
+    if (bSectorNo >= PHAL_MFC_MAX_SECTORS)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    return phalMfc_Sw_ReadRange(
+        pDataParams,
+        PHAL_MFC_GET_FIRST_BLOCK(bSectorNo),
+        PHAL_MFC_GET_SECTOR_BLOCKS(bSectorNo),
+        bKeyType,
+        wKeyNumber,
+        wKeyVersion,
+        pUid,
+        bUidLength,
+        pData);
+}
+
+phStatus_t phalMfc_Sw_ReadRange(
+                                phalMfc_Sw_DataParams_t * pDataParams,
+                                uint8_t bBlockNo,
+                                uint16_t wNumBlocks,
+                                uint8_t bKeyType,
+                                uint16_t wKeyNumber,
+                                uint16_t wKeyVersion,
+                                uint8_t * pUid,
+                                uint8_t bUidLength,
+                                uint8_t * pData
+                                )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_COUNT wIndex;
+
+    if (((uint16_t)bBlockNo + wNumBlocks) > 256U)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    for (wIndex = 0; wIndex < wNumBlocks; ++wIndex)
+    {
+        /* authenticates only when entering a new sector */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_AuthenticateSector(
+            pDataParams,
+            (uint8_t)(bBlockNo + wIndex),
+            bKeyType,
+            wKeyNumber,
+            wKeyVersion,
+            pUid,
+            bUidLength));
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Read(
+            pDataParams,
+            (uint8_t)(bBlockNo + wIndex),
+            &pData[wIndex * PHAL_MFC_DATA_BLOCK_LENGTH]));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_WriteRange(
+                                 phalMfc_Sw_DataParams_t * pDataParams,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t bKeyType,
+                                 uint16_t wKeyNumber,
+                                 uint16_t wKeyVersion,
+                                 uint8_t * pUid,
+                                 uint8_t bUidLength,
+                                 uint8_t * pData
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_COUNT wIndex;
+
+    if (((uint16_t)bBlockNo + wNumBlocks) > 256U)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    for (wIndex = 0; wIndex < wNumBlocks; ++wIndex)
+    {
+        /* authenticates only when entering a new sector */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_AuthenticateSector(
+            pDataParams,
+            (uint8_t)(bBlockNo + wIndex),
+            bKeyType,
+            wKeyNumber,
+            wKeyVersion,
+            pUid,
+            bUidLength));
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Write(
+            pDataParams,
+            (uint8_t)(bBlockNo + wIndex),
+            &pData[wIndex * PHAL_MFC_DATA_BLOCK_LENGTH]));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_DecodeAccessBits(
+                                       phalMfc_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pTrailer,
+                                       phalMfc_AccessConditions_t * pAccess
+                                       )
+{
+    /* satisfy compiler */
+    if (pDataParams);
+
+    return phalMfc_Int_DecodeAccessBits(pTrailer, pAccess);
+}
+
+phStatus_t phalMfc_Sw_ReadSectorPlanned(
+                                        phalMfc_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSectorNo,
+                                        uint8_t bKeyType,
+                                        uint16_t wKeyNumber,
+                                        uint16_t wKeyVersion,
+                                        uint8_t * pUid,
+                                        uint8_t bUidLength,
+                                        uint8_t * pData,
+                                        uint16_t * pReadMask,
+                                        uint16_t * pOtherKeyMask
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phalMfc_AccessConditions_t PH_MEMLOC_REM sAccess;
+    uint8_t     PH_MEMLOC_REM bFirstBlock;
+    uint8_t     PH_MEMLOC_REM bNumBlocks;
+    uint8_t     PH_MEMLOC_REM bKey;
+    uint8_t     PH_MEMLOC_REM bPermitted;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    *pReadMask = 0;
+    *pOtherKeyMask = 0;
+
+    if (bSectorNo >= PHAL_MFC_MAX_SECTORS)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    bFirstBlock = PHAL_MFC_GET_FIRST_BLOCK(bSectorNo);
+    bNumBlocks  = PHAL_MFC_GET_SECTOR_BLOCKS(bSectorNo);
+    bKey        = ((bKeyType & 0x7F) == PHAL_MFC_KEYA) ? (uint8_t)PHAL_MFC_ACCESS_KEYA : (uint8_t)PHAL_MFC_ACCESS_KEYB;
+
+    /* the access bits are readable with every key which authenticates */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_AuthenticateSector(
+        pDataParams,
+        bFirstBlock,
+        bKeyType,
+        wKeyNumber,
+        wKeyVersion,
+        pUid,
+        bUidLength));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Read(
+        pDataParams,
+        (uint8_t)(bFirstBlock + bNumBlocks - 1),
+        &pData[(bNumBlocks - 1) * PHAL_MFC_DATA_BLOCK_LENGTH]));
+    *pReadMask = (uint16_t)(1U << (bNumBlocks - 1));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Int_DecodeAccessBits(
+        &pData[(bNumBlocks - 1) * PHAL_MFC_DATA_BLOCK_LENGTH],
+        &sAccess));
+
+    for (bIndex = 0; bIndex < (bNumBlocks - 1); ++bIndex)
+    {
+        bPermitted = sAccess.aDataRead[PHAL_MFC_GET_ACCESS_GROUP(bSectorNo, bIndex)];
+
+        if (bPermitted & bKey)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Read(
+                pDataParams,
+                (uint8_t)(bFirstBlock + bIndex),
+                &pData[bIndex * PHAL_MFC_DATA_BLOCK_LENGTH]));
+            *pReadMask |= (uint16_t)(1U << bIndex);
+        }
+        else if (bPermitted != PHAL_MFC_ACCESS_NONE)
+        {
+            *pOtherKeyMask |= (uint16_t)(1U << bIndex);
+        }
+        else
+        {
+            /* never readable */
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_ValueTransaction(
+                                       phalMfc_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pUid,
+                                       uint8_t bUidLength,
+                                       uint8_t bOption,
+                                       phalMfc_ValueOperation_t * pOperations,
+                                       uint8_t bNumOperations
+                                       )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM aDone[32];
+    uint8_t     PH_MEMLOC_REM bSectorNo;
+    uint8_t     PH_MEMLOC_COUNT bFirst;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+    phalMfc_ValueOperation_t * PH_MEMLOC_REM pFirst;
+    phalMfc_ValueOperation_t * PH_MEMLOC_REM pOperation;
+
+    if (bOption > PHAL_MFC_VALUE_CHECK_FORMAT)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    /* check all operations before the first command is sent */
+    status = PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+    for (bIndex = 0; bIndex < bNumOperations; ++bIndex)
+    {
+        pOperations[bIndex].wStatus = phalMfc_Sw_CheckValueOperation(&pOperations[bIndex]);
+        if ((pOperations[bIndex].wStatus & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            status = pOperations[bIndex].wStatus;
+        }
+    }
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        return status;
+    }
+
+    memset(aDone, 0x00, sizeof(aDone));  /* PRQA S 3200 */
+
+    for (bFirst = 0; bFirst < bNumOperations; ++bFirst)
+    {
+        if (aDone[bFirst >> 3] & (1U << (bFirst & 0x07)))
+        {
+            continue;
+        }
+
+        /* the first pending operation opens the group of its sector and key */
+        pFirst = &pOperations[bFirst];
+        bSectorNo = PHAL_MFC_GET_SECTOR(pFirst->bDstBlockNo);
+
+        for (bIndex = bFirst; bIndex < bNumOperations; ++bIndex)
+        {
+            pOperation = &pOperations[bIndex];
+
+            if ((aDone[bIndex >> 3] & (1U << (bIndex & 0x07))) ||
+                (PHAL_MFC_GET_SECTOR(pOperation->bDstBlockNo) != bSectorNo) ||
+                (pOperation->bKeyType != pFirst->bKeyType) ||
+                (pOperation->wKeyNumber != pFirst->wKeyNumber) ||
+                (pOperation->wKeyVersion != pFirst->wKeyVersion))
+            {
+                continue;
+            }
+            aDone[bIndex >> 3] |= (uint8_t)(1U << (bIndex & 0x07));
+
+            if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+            {
+                pOperation->wStatus = PH_ADD_COMPCODE(PHAL_MFC_ERR_NOT_EXECUTED, PH_COMP_AL_MFC);
+                continue;
+            }
+
+            status = phalMfc_Sw_ExecuteValueOperation(pDataParams, pUid, bUidLength, bOption, pOperation);
+            pOperation->wStatus = status;
+        }
+    }
+
+    return status;
+}
+
+phStatus_t phalMfc_Sw_ReadMad(
+                              phalMfc_Sw_DataParams_t * pDataParams,
+                              uint8_t bKeyType,
+                              uint16_t wKeyNumber,
+                              uint16_t wKeyVersion,
+                              uint8_t * pUid,
+                              uint8_t bUidLength,
+                              uint8_t bNumSectors,
+                              uint16_t * pAids,
+                              uint8_t * pMadVersion
+                              )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aMad[3 * PHAL_MFC_DATA_BLOCK_LENGTH];
+    uint8_t     PH_MEMLOC_REM bVersion;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    if ((bNumSectors == 0) || (bNumSectors > PHAL_MFC_MAX_SECTORS))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    for (bIndex = 0; bIndex < bNumSectors; ++bIndex)
+    {
+        pAids[bIndex] = PHAL_MFC_MAD_AID_NOT_APPLICABLE;
+    }
+
+    /* MAD1 in blocks 1 and 2, the general purpose byte in the sector trailer */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_ReadRange(
+        pDataParams,
+        PHAL_MFC_GET_FIRST_BLOCK(PHAL_MFC_MAD_SECTOR) + 1,
+        3,
+        bKeyType,
+        wKeyNumber,
+        wKeyVersion,
+        pUid,
+        bUidLength,
+        aMad));
+
+    bVersion = aMad[(2 * PHAL_MFC_DATA_BLOCK_LENGTH) + 9] & PHAL_MFC_MAD_GPB_ADV_MASK;
+    if (((aMad[(2 * PHAL_MFC_DATA_BLOCK_LENGTH) + 9] & PHAL_MFC_MAD_GPB_DA) == 0) ||
+        ((bVersion != PHAL_MFC_MAD_VERSION_1) && (bVersion != PHAL_MFC_MAD_VERSION_2)))
+    {
+        return PH_ADD_COMPCODE(PHAL_MFC_ERR_NO_MAD, PH_COMP_AL_MFC);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Int_CheckMadCrc(aMad, 2 * PHAL_MFC_DATA_BLOCK_LENGTH));
+
+    /* byte 0 is the CRC, byte 1 the info byte, then one AID per sector (LSB first) */
+    for (bIndex = 1; (bIndex < PHAL_MFC_MAD2_SECTOR) && (bIndex < bNumSectors); ++bIndex)
+    {
+        pAids[bIndex] = (uint16_t)(aMad[2 * bIndex] | ((uint16_t)aMad[(2 * bIndex) + 1] << 8));
+    }
+
+    /* MAD2 in blocks 64 to 66 covers sectors 17 to 39 */
+    if ((bVersion == PHAL_MFC_MAD_VERSION_2) && (bNumSectors > PHAL_MFC_MAD2_SECTOR))
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_ReadRange(
+            pDataParams,
+            PHAL_MFC_GET_FIRST_BLOCK(PHAL_MFC_MAD2_SECTOR),
+            3,
+            bKeyType,
+            wKeyNumber,
+            wKeyVersion,
+            pUid,
+            bUidLength,
+            aMad));
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Int_CheckMadCrc(aMad, sizeof(aMad)));
+
+        for (bIndex = PHAL_MFC_MAD2_SECTOR + 1; bIndex < bNumSectors; ++bIndex)
+        {
+            pAids[bIndex] = (uint16_t)(aMad[2 * (bIndex - PHAL_MFC_MAD2_SECTOR)] |
+                ((uint16_t)aMad[(2 * (bIndex - PHAL_MFC_MAD2_SECTOR)) + 1] << 8));
+        }
+    }
+
+    *pMadVersion = bVersion;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_ReadApplication(
+                                      phalMfc_Sw_DataParams_t * pDataParams,
+                                      uint16_t wAid,
+                                      uint16_t * pAids,
+                                      uint8_t bNumSectors,
+                                      uint8_t bKeyType,
+                                      uint16_t wKeyNumber,
+                                      uint16_t wKeyVersion,
+                                      uint8_t * pUid,
+                                      uint8_t bUidLength,
+                                      uint16_t wBufferSize,
+                                      uint8_t * pData,
+                                      uint16_t * pDataLength
+                                      )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wLength;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    *pDataLength = 0;
+
+    if (bNumSectors > PHAL_MFC_MAX_SECTORS)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    /* the whole application has to fit before the first sector is read */
+    wLength = 0;
+    for (bIndex = 1; bIndex < bNumSectors; ++bIndex)
+    {
+        if ((pAids[bIndex] == wAid) && (bIndex != PHAL_MFC_MAD2_SECTOR))
+        {
+            wLength = (uint16_t)(wLength + ((PHAL_MFC_GET_SECTOR_BLOCKS(bIndex) - 1) * PHAL_MFC_DATA_BLOCK_LENGTH));
+        }
+    }
+    if (wLength > wBufferSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFC);
+    }
+
+    for (bIndex = 1; bIndex < bNumSectors; ++bIndex)
+    {
+        if ((pAids[bIndex] != wAid) || (bIndex == PHAL_MFC_MAD2_SECTOR))
+        {
+            continue;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_ReadRange(
+            pDataParams,
+            PHAL_MFC_GET_FIRST_BLOCK(bIndex),
+            (uint16_t)(PHAL_MFC_GET_SECTOR_BLOCKS(bIndex) - 1),
+            bKeyType,
+            wKeyNumber,
+            wKeyVersion,
+            pUid,
+            bUidLength,
+            &pData[*pDataLength]));
+
+        *pDataLength = (uint16_t)(*pDataLength + ((PHAL_MFC_GET_SECTOR_BLOCKS(bIndex) - 1) * PHAL_MFC_DATA_BLOCK_LENGTH));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Sw_ResetAuthentication(
+                                          phalMfc_Sw_DataParams_t * pDataParams
+                                          )
+{
+    pDataParams->bAuthSector = PHAL_MFC_NO_SECTOR;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
 phStatus_t phalMfc_Sw_PersonalizeUid(
                                      phalMfc_Sw_DataParams_t * pDataParams,
                                      uint8_t bUidType
@@ -357,4 +841,124 @@ phStatus_t phalMfc_Sw_PersonalizeUid(
         );
 }
 
+static phStatus_t phalMfc_Sw_CheckAuthState(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    phStatus_t status
+    )
+{
+    /* the card drops the authentication on any error */
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        pDataParams->bAuthSector = PHAL_MFC_NO_SECTOR;
+    }
+
+    return status;
+}
+
+static phStatus_t phalMfc_Sw_AuthenticateSector(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    uint8_t bBlockNo,
+    uint8_t bKeyType,
+    uint16_t wKeyNumber,
+    uint16_t wKeyVersion,
+    uint8_t * pUid,
+    uint8_t bUidLength
+    )
+{
+    /* the last four UID bytes are used for the authentication */
+    if (bUidLength < 4)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    /* still authenticated to the sector with the same key */
+    if ((pDataParams->bAuthSector == PHAL_MFC_GET_SECTOR(bBlockNo)) &&
+        (pDataParams->bAuthKeyType == bKeyType) &&
+        (pDataParams->wAuthKeyNo == wKeyNumber) &&
+        (pDataParams->wAuthKeyVersion == wKeyVersion) &&
+        (memcmp(pDataParams->aAuthUid, &pUid[bUidLength - 4], sizeof(pDataParams->aAuthUid)) == 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+    }
+
+    return phalMfc_Sw_Authenticate(pDataParams, bBlockNo, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength);
+}
+
+static phStatus_t phalMfc_Sw_CheckValueOperation(
+    phalMfc_ValueOperation_t * pOperation
+    )
+{
+    uint8_t PH_MEMLOC_REM bSectorNo;
+    uint8_t PH_MEMLOC_REM bTrailer;
+
+    bSectorNo = PHAL_MFC_GET_SECTOR(pOperation->bDstBlockNo);
+    bTrailer = (uint8_t)(PHAL_MFC_GET_FIRST_BLOCK(bSectorNo) + PHAL_MFC_GET_SECTOR_BLOCKS(bSectorNo) - 1);
+
+    if ((pOperation->bOperation > PHAL_MFC_VALUE_OP_WRITE) ||
+        (((pOperation->bKeyType & 0x7F) != PHAL_MFC_KEYA) && ((pOperation->bKeyType & 0x7F) != PHAL_MFC_KEYB)) ||
+        (pOperation->bDstBlockNo == 0) ||
+        (pOperation->bDstBlockNo == bTrailer))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    /* the transfer buffer only reaches blocks of the authenticated sector */
+    if ((pOperation->bOperation != PHAL_MFC_VALUE_OP_WRITE) &&
+        ((PHAL_MFC_GET_SECTOR(pOperation->bSrcBlockNo) != bSectorNo) ||
+         (pOperation->bSrcBlockNo == 0) ||
+         (pOperation->bSrcBlockNo == bTrailer)))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFC);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+static phStatus_t phalMfc_Sw_ExecuteValueOperation(
+    phalMfc_Sw_DataParams_t * pDataParams,
+    uint8_t * pUid,
+    uint8_t bUidLength,
+    uint8_t bOption,
+    phalMfc_ValueOperation_t * pOperation
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aBlock[PHAL_MFC_DATA_BLOCK_LENGTH];
+
+    /* authenticates only when entering a new sector or changing the key */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_AuthenticateSector(
+        pDataParams,
+        pOperation->bDstBlockNo,
+        pOperation->bKeyType,
+        pOperation->wKeyNumber,
+        pOperation->wKeyVersion,
+        pUid,
+        bUidLength));
+
+    if (pOperation->bOperation == PHAL_MFC_VALUE_OP_WRITE)
+    {
+        return phalMfc_Sw_WriteValue(pDataParams, pOperation->bDstBlockNo, pOperation->aValue, pOperation->bAddrData);
+    }
+
+    if (bOption == PHAL_MFC_VALUE_CHECK_FORMAT)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMfc_Sw_Read(pDataParams, pOperation->bSrcBlockNo, aBlock));
+        statusTmp = phalMfc_Int_CheckValueBlockFormat(aBlock);
+        if ((statusTmp & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFC);
+        }
+    }
+
+    switch (pOperation->bOperation)
+    {
+    case PHAL_MFC_VALUE_OP_INCREMENT:
+        return phalMfc_Sw_IncrementTransfer(pDataParams, pOperation->bSrcBlockNo, pOperation->bDstBlockNo, pOperation->aValue);
+    case PHAL_MFC_VALUE_OP_DECREMENT:
+        return phalMfc_Sw_DecrementTransfer(pDataParams, pOperation->bSrcBlockNo, pOperation->bDstBlockNo, pOperation->aValue);
+    default:
+        return phalMfc_Sw_RestoreTransfer(pDataParams, pOperation->bSrcBlockNo, pOperation->bDstBlockNo);
+    }
+}
+
 #endif /* NXPBUILD__PHAL_MFC_SW */
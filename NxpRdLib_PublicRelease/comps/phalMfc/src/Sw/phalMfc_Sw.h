@@ -107,6 +107,100 @@ phStatus_t phalMfc_Sw_RestoreTransfer(
                                       uint8_t bDstBlockNo
                                       );
 
+phStatus_t phalMfc_Sw_ReadSector(
+                                 phalMfc_Sw_DataParams_t * pDataParams,
+                                 uint8_t bSectorNo,
+                                 uint8_t bKeyType,
+                                 uint16_t wKeyNumber,
+                                 uint16_t wKeyVersion,
+                                 uint8_t * pUid,
+                                 uint8_t bUidLength,
+                                 uint8_t * pData
+                                 );
+
+phStatus_t phalMfc_Sw_ReadRange(
+                                phalMfc_Sw_DataParams_t * pDataParams,
+                                uint8_t bBlockNo,
+                                uint16_t wNumBlocks,
+                                uint8_t bKeyType,
+                                uint16_t wKeyNumber,
+                                uint16_t wKeyVersion,
+                                uint8_t * pUid,
+                                uint8_t bUidLength,
+                                uint8_t * pData
+                                );
+
+phStatus_t phalMfc_Sw_WriteRange(
+                                 phalMfc_Sw_DataParams_t * pDataParams,
+                                 uint8_t bBlockNo,
+                                 uint16_t wNumBlocks,
+                                 uint8_t bKeyType,
+                                 uint16_t wKeyNumber,
+                                 uint16_t wKeyVersion,
+                                 uint8_t * pUid,
+                                 uint8_t bUidLength,
+                                 uint8_t * pData
+                                 );
+
+phStatus_t phalMfc_Sw_DecodeAccessBits(
+                                       phalMfc_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pTrailer,
+                                       phalMfc_AccessConditions_t * pAccess
+                                       );
+
+phStatus_t phalMfc_Sw_ReadSectorPlanned(
+                                        phalMfc_Sw_DataParams_t * pDataParams,
+                                        uint8_t bSectorNo,
+                                        uint8_t bKeyType,
+                                        uint16_t wKeyNumber,
+                                        uint16_t wKeyVersion,
+                                        uint8_t * pUid,
+                                        uint8_t bUidLength,
+                                        uint8_t * pData,
+                                        uint16_t * pReadMask,
+                                        uint16_t * pOtherKeyMask
+                                        );
+
+phStatus_t phalMfc_Sw_ValueTransaction(
+                                       phalMfc_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pUid,
+                                       uint8_t bUidLength,
+                                       uint8_t bOption,
+                                       phalMfc_ValueOperation_t * pOperations,
+                                       uint8_t bNumOperations
+                                       );
+
+phStatus_t phalMfc_Sw_ReadMad(
+                              phalMfc_Sw_DataParams_t * pDataParams,
+                              uint8_t bKeyType,
+                              uint16_t wKeyNumber,
+                              uint16_t wKeyVersion,
+                              uint8_t * pUid,
+                              uint8_t bUidLength,
+                              uint8_t bNumSectors,
+                              uint16_t * pAids,
+                              uint8_t * pMadVersion
+                              );
+
+phStatus_t phalMfc_Sw_ReadApplication(
+                                      phalMfc_Sw_DataParams_t * pDataParams,
+                                      uint16_t wAid,
+                                      uint16_t * pAids,
+                                      uint8_t bNumSectors,
+                                      uint8_t bKeyType,
+                                      uint16_t wKeyNumber,
+                                      uint16_t wKeyVersion,
+                                      uint8_t * pUid,
+                                      uint8_t bUidLength,
+                                      uint16_t wBufferSize,
+                                      uint8_t * pData,
+                                      uint16_t * pDataLength
+                                      );
+
+phStatus_t phalMfc_Sw_ResetAuthentication(
+                                          phalMfc_Sw_DataParams_t * pDataParams
+                                          );
+
 phStatus_t phalMfc_Sw_PersonalizeUid(
                                      phalMfc_Sw_DataParams_t * pDataParams,
                                      uint8_t bUidType
@@ -660,6 +660,588 @@ phStatus_t phalMfc_RestoreTransfer(
     return status;
 }
 
+phStatus_t phalMfc_ReadSector(
+                              void * pDataParams,
+                              uint8_t bSectorNo,
+                              uint8_t bKeyType,
+                              uint16_t wKeyNumber,
+                              uint16_t wKeyVersion,
+                              uint8_t * pUid,
+                              uint8_t bUidLength,
+                              uint8_t * pData
+                              )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadSector");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSectorNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSectorNo_log, &bSectorNo);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadSector((phalMfc_Sw_DataParams_t *)pDataParams, bSectorNo, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ReadRange(
+                             void * pDataParams,
+                             uint8_t bBlockNo,
+                             uint16_t wNumBlocks,
+                             uint8_t bKeyType,
+                             uint16_t wKeyNumber,
+                             uint16_t wKeyVersion,
+                             uint8_t * pUid,
+                             uint8_t bUidLength,
+                             uint8_t * pData
+                             )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadRange");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadRange((phalMfc_Sw_DataParams_t *)pDataParams, bBlockNo, wNumBlocks, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_WriteRange(
+                              void * pDataParams,
+                              uint8_t bBlockNo,
+                              uint16_t wNumBlocks,
+                              uint8_t bKeyType,
+                              uint16_t wKeyNumber,
+                              uint16_t wKeyVersion,
+                              uint8_t * pUid,
+                              uint8_t bUidLength,
+                              uint8_t * pData
+                              )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_WriteRange");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bBlockNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wNumBlocks);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bBlockNo_log, &bBlockNo);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wNumBlocks_log, &wNumBlocks);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pData_log, pData, (uint16_t)(wNumBlocks * PHAL_MFC_DATA_BLOCK_LENGTH));
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pData);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_WriteRange((phalMfc_Sw_DataParams_t *)pDataParams, bBlockNo, wNumBlocks, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, pData);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_DecodeAccessBits(
+                                    void * pDataParams,
+                                    uint8_t * pTrailer,
+                                    phalMfc_AccessConditions_t * pAccess
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_DecodeAccessBits");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pTrailer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pAccess);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pTrailer_log, pTrailer, PHAL_MFC_DATA_BLOCK_LENGTH);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pTrailer);
+	PH_ASSERT_NULL (pAccess);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_DecodeAccessBits((phalMfc_Sw_DataParams_t *)pDataParams, pTrailer, pAccess);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ReadSectorPlanned(
+                                     void * pDataParams,
+                                     uint8_t bSectorNo,
+                                     uint8_t bKeyType,
+                                     uint16_t wKeyNumber,
+                                     uint16_t wKeyVersion,
+                                     uint8_t * pUid,
+                                     uint8_t bUidLength,
+                                     uint8_t * pData,
+                                     uint16_t * pReadMask,
+                                     uint16_t * pOtherKeyMask
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadSectorPlanned");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bSectorNo);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pReadMask);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pOtherKeyMask);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bSectorNo_log, &bSectorNo);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pReadMask);
+	PH_ASSERT_NULL (pOtherKeyMask);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadSectorPlanned((phalMfc_Sw_DataParams_t *)pDataParams, bSectorNo, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, pData, pReadMask, pOtherKeyMask);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pReadMask_log, pReadMask);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pOtherKeyMask_log, pOtherKeyMask);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ValueTransaction(
+                                    void * pDataParams,
+                                    uint8_t * pUid,
+                                    uint8_t bUidLength,
+                                    uint8_t bOption,
+                                    phalMfc_ValueOperation_t * pOperations,
+                                    uint8_t bNumOperations
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ValueTransaction");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bOption);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pOperations);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumOperations);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bOption_log, &bOption);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumOperations_log, &bNumOperations);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pOperations);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ValueTransaction((phalMfc_Sw_DataParams_t *)pDataParams, pUid, bUidLength, bOption, pOperations, bNumOperations);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ReadMad(
+                           void * pDataParams,
+                           uint8_t bKeyType,
+                           uint16_t wKeyNumber,
+                           uint16_t wKeyVersion,
+                           uint8_t * pUid,
+                           uint8_t bUidLength,
+                           uint8_t bNumSectors,
+                           uint16_t * pAids,
+                           uint8_t * pMadVersion
+                           )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadMad");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumSectors);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pAids);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMadVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumSectors_log, &bNumSectors);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pAids);
+	PH_ASSERT_NULL (pMadVersion);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadMad((phalMfc_Sw_DataParams_t *)pDataParams, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, bNumSectors, pAids, pMadVersion);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMadVersion_log, pMadVersion);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ReadApplication(
+                                   void * pDataParams,
+                                   uint16_t wAid,
+                                   uint16_t * pAids,
+                                   uint8_t bNumSectors,
+                                   uint8_t bKeyType,
+                                   uint16_t wKeyNumber,
+                                   uint16_t wKeyVersion,
+                                   uint8_t * pUid,
+                                   uint8_t bUidLength,
+                                   uint16_t wBufferSize,
+                                   uint8_t * pData,
+                                   uint16_t * pDataLength
+                                   )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ReadApplication");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wAid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pAids);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumSectors);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bKeyType);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyNumber);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wKeyVersion);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wBufferSize);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pData);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wAid_log, &wAid);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumSectors_log, &bNumSectors);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bKeyType_log, &bKeyType);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyNumber_log, &wKeyNumber);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wKeyVersion_log, &wKeyVersion);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wBufferSize_log, &wBufferSize);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pAids);
+	PH_ASSERT_NULL (pUid);
+	PH_ASSERT_NULL (pData);
+	PH_ASSERT_NULL (pDataLength);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ReadApplication((phalMfc_Sw_DataParams_t *)pDataParams, wAid, pAids, bNumSectors, bKeyType, wKeyNumber, wKeyVersion, pUid, bUidLength, wBufferSize, pData, pDataLength);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, pDataLength_log, pDataLength);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phalMfc_ResetAuthentication(
+                                       void * pDataParams
+                                       )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phalMfc_ResetAuthentication");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_AL_MFC)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHAL_MFC_SW
+    case PHAL_MFC_SW_ID:
+        status = phalMfc_Sw_ResetAuthentication((phalMfc_Sw_DataParams_t *)pDataParams);
+        break;
+#endif /* NXPBUILD__PHAL_MFC_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFC);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 phStatus_t phalMfc_PersonalizeUid(
                                   void * pDataParams,
                                   uint8_t bUidType
@@ -29,9 +29,31 @@
 #include "phalMfc_Int.h"
 #include <phpalMifare.h>
 #include <ph_RefDefs.h>
+#include <phTools.h>
 
 #ifdef NXPBUILD__PHAL_MFC
 
+#define A   PHAL_MFC_ACCESS_KEYA
+#define B   PHAL_MFC_ACCESS_KEYB
+#define AB  (PHAL_MFC_ACCESS_KEYA | PHAL_MFC_ACCESS_KEYB)
+#define N   PHAL_MFC_ACCESS_NONE
+
+/* Access conditions indexed by C1 C2 C3 */
+static const uint8_t PH_MEMLOC_CONST_ROM aDataRead[8]       = {AB, AB, AB, B,  AB, B,  AB, N};
+static const uint8_t PH_MEMLOC_CONST_ROM aDataWrite[8]      = {AB, N,  N,  B,  B,  N,  B,  N};
+static const uint8_t PH_MEMLOC_CONST_ROM aDataIncrement[8]  = {AB, N,  N,  N,  N,  N,  B,  N};
+static const uint8_t PH_MEMLOC_CONST_ROM aDataDecrement[8]  = {AB, AB, N,  N,  N,  N,  AB, N};
+static const uint8_t PH_MEMLOC_CONST_ROM aKeyAWrite[8]      = {A,  A,  N,  B,  B,  N,  N,  N};
+static const uint8_t PH_MEMLOC_CONST_ROM aAccessBitsRead[8] = {A,  A,  A,  AB, AB, AB, AB, AB};
+static const uint8_t PH_MEMLOC_CONST_ROM aAccessBitsWrite[8]= {N,  A,  N,  B,  N,  B,  N,  N};
+static const uint8_t PH_MEMLOC_CONST_ROM aKeyBRead[8]       = {A,  A,  A,  N,  N,  N,  N,  N};
+static const uint8_t PH_MEMLOC_CONST_ROM aKeyBWrite[8]      = {A,  A,  N,  B,  B,  N,  N,  N};
+
+#undef A
+#undef B
+#undef AB
+#undef N
+
 phStatus_t phalMfc_Int_Transfer(
                                 void * pPalMifareDataParams,
                                 uint8_t bBlockNo
@@ -153,6 +175,80 @@ phStatus_t phalMfc_Int_CheckValueBlockFormat(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFP);
 }
 
+phStatus_t phalMfc_Int_DecodeAccessBits(
+    uint8_t * pTrailer,
+    phalMfc_AccessConditions_t * pAccess
+    )
+{
+    uint8_t PH_MEMLOC_REM bAccess[PHAL_MFC_ACCESS_GROUPS + 1];
+    uint8_t PH_MEMLOC_REM bMask;
+    uint8_t PH_MEMLOC_COUNT bGroup;
+
+    /* each access bit is stored inverted as well */
+    if ((((pTrailer[7] >> 4) ^ pTrailer[6]) & 0x0F) != 0x0F ||
+        (((pTrailer[8] & 0x0F) ^ (pTrailer[6] >> 4)) & 0x0F) != 0x0F ||
+        (((pTrailer[8] >> 4) ^ pTrailer[7]) & 0x0F) != 0x0F)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFC);
+    }
+
+    /* C1 C2 C3 of each group, group 3 is the sector trailer */
+    for (bGroup = 0; bGroup <= PHAL_MFC_ACCESS_GROUPS; ++bGroup)
+    {
+        bAccess[bGroup] = (uint8_t)(
+            (((pTrailer[7] >> (4 + bGroup)) & 0x01) << 2) |
+            (((pTrailer[8] >> bGroup) & 0x01) << 1) |
+            ((pTrailer[8] >> (4 + bGroup)) & 0x01));
+    }
+
+    pAccess->bKeyAWrite         = aKeyAWrite[bAccess[PHAL_MFC_ACCESS_GROUPS]];
+    pAccess->bAccessBitsRead    = aAccessBitsRead[bAccess[PHAL_MFC_ACCESS_GROUPS]];
+    pAccess->bAccessBitsWrite   = aAccessBitsWrite[bAccess[PHAL_MFC_ACCESS_GROUPS]];
+    pAccess->bKeyBRead          = aKeyBRead[bAccess[PHAL_MFC_ACCESS_GROUPS]];
+    pAccess->bKeyBWrite         = aKeyBWrite[bAccess[PHAL_MFC_ACCESS_GROUPS]];
+
+    /* a readable key B cannot be used for authentication */
+    bMask = (pAccess->bKeyBRead != PHAL_MFC_ACCESS_NONE) ? (uint8_t)PHAL_MFC_ACCESS_KEYA : (uint8_t)(PHAL_MFC_ACCESS_KEYA | PHAL_MFC_ACCESS_KEYB);
+
+    for (bGroup = 0; bGroup < PHAL_MFC_ACCESS_GROUPS; ++bGroup)
+    {
+        pAccess->aDataRead[bGroup]      = aDataRead[bAccess[bGroup]] & bMask;
+        pAccess->aDataWrite[bGroup]     = aDataWrite[bAccess[bGroup]] & bMask;
+        pAccess->aDataIncrement[bGroup] = aDataIncrement[bAccess[bGroup]] & bMask;
+        pAccess->aDataDecrement[bGroup] = aDataDecrement[bAccess[bGroup]] & bMask;
+    }
+    pAccess->bKeyAWrite         &= bMask;
+    pAccess->bAccessBitsRead    &= bMask;
+    pAccess->bAccessBitsWrite   &= bMask;
+    pAccess->bKeyBWrite         &= bMask;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
+phStatus_t phalMfc_Int_CheckMadCrc(
+    uint8_t * pMad,
+    uint8_t bLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCrc;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc8(
+        PH_TOOLS_CRC_OPTION_MSB_FIRST,
+        PH_TOOLS_CRC8_PRESET_MAD,
+        PH_TOOLS_CRC8_POLY_EPCUID,
+        &pMad[1],
+        (uint16_t)(bLength - 1),
+        &bCrc));
+
+    if (bCrc != pMad[0])
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INTEGRITY_ERROR, PH_COMP_AL_MFC);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFC);
+}
+
 phStatus_t phalMfc_Int_ResolveReturnCode(
     uint8_t bRetCode
     )
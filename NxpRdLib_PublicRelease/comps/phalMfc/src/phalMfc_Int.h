@@ -92,6 +92,30 @@ phStatus_t phalMfc_Int_CheckValueBlockFormat(
     uint8_t * pBlock    /**< [In] Formatted Value block. */
     );
 
+/**
+* \brief Decode the access bits of a sector trailer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR The access bits are not consistent.
+*/
+phStatus_t phalMfc_Int_DecodeAccessBits(
+    uint8_t * pTrailer,                     /**< [In] Sector trailer. */
+    phalMfc_AccessConditions_t * pAccess    /**< [Out] Decoded access conditions. */
+    );
+
+/**
+* \brief Check the CRC of a MIFARE Application Directory.
+*
+* The CRC in the first byte covers all following bytes.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INTEGRITY_ERROR Wrong CRC.
+*/
+phStatus_t phalMfc_Int_CheckMadCrc(
+    uint8_t * pMad,     /**< [In] Directory starting with the CRC byte. */
+    uint8_t bLength     /**< [In] Length of the directory including the CRC byte. */
+    );
+
 /**
 * \brief Resolve MIFARE(R) error code from response.
 * \return Status code
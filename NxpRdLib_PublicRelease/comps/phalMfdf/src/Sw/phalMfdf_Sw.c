@@ -0,0 +1,425 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software MIFARE(R) DESFire Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalMfdf.h>
+#include <phpalMifare.h>
+#include <phKeyStore.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_MFDF_SW
+
+#include <string.h>
+#include "phalMfdf_Sw.h"
+#include "phalMfdf_Sw_Int.h"
+
+phStatus_t phalMfdf_Sw_Init(
+                            phalMfdf_Sw_DataParams_t * pDataParams,
+                            uint16_t wSizeOfDataParams,
+                            void * pPalMifareDataParams,
+                            void * pPalI14443p4DataParams,
+                            void * pKeyStoreDataParams,
+                            void * pCryptoDataParams,
+                            void * pCryptoRngDataParams
+                            )
+{
+    if (sizeof(phalMfdf_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_MFDF);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pPalMifareDataParams);
+
+    /* init private data */
+    pDataParams->wId                    = PH_COMP_AL_MFDF | PHAL_MFDF_SW_ID;
+    pDataParams->pPalMifareDataParams   = pPalMifareDataParams;
+    pDataParams->pPalI14443p4DataParams = pPalI14443p4DataParams;
+    pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
+    pDataParams->pCryptoDataParams      = pCryptoDataParams;
+    pDataParams->pCryptoRngDataParams   = pCryptoRngDataParams;
+    pDataParams->bWrapped               = PH_OFF;
+    pDataParams->bCardStatus            = PHAL_MFDF_RESP_OPERATION_OK;
+    pDataParams->bKeyNo                 = PHAL_MFDF_NOT_AUTHENTICATED;
+    pDataParams->wFrames                = 0;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_Authenticate(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    uint8_t bKeyNoCard,
+                                    uint16_t wKeyNo,
+                                    uint16_t wKeyVersion
+                                    )
+{
+#if defined(NXPBUILD__PH_CRYPTOSYM) && defined(NXPBUILD__PH_CRYPTORNG)
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM bKey[2 * PH_CRYPTOSYM_DES_KEY_SIZE];
+    uint16_t    PH_MEMLOC_REM wKeyType;
+    uint8_t     PH_MEMLOC_REM bRndA[PHAL_MFDF_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bRndB[PHAL_MFDF_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bToken[2 * PHAL_MFDF_DES_BLOCK_SIZE];
+    uint8_t *   PH_MEMLOC_REM pRxData;
+    uint16_t    PH_MEMLOC_REM wRxDataLength;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    pDataParams->wFrames = 0;
+    pDataParams->bKeyNo = PHAL_MFDF_NOT_AUTHENTICATED;
+
+    if ((pDataParams->pCryptoDataParams == NULL) || (pDataParams->pCryptoRngDataParams == NULL))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_MFDF);
+    }
+
+    /* retrieve the key */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNo,
+        wKeyVersion,
+        sizeof(bKey),
+        bKey,
+        &wKeyType));
+
+    if ((wKeyType != PH_KEYSTORE_KEY_TYPE_DES) && (wKeyType != PH_KEYSTORE_KEY_TYPE_2K3DES))
+    {
+        memset(bKey, 0x00, sizeof(bKey));  /* PRQA S 3200 */
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_AL_MFDF);
+    }
+
+    status = phCryptoSym_LoadKeyDirect(pDataParams->pCryptoDataParams, bKey, wKeyType);
+    memset(bKey, 0x00, sizeof(bKey));  /* PRQA S 3200 */
+    PH_CHECK_SUCCESS(status);
+
+    /* request ek(RndB) */
+    status = phalMfdf_Sw_Int_Exchange(pDataParams, PHAL_MFDF_CMD_AUTHENTICATE, &bKeyNoCard, 1, NULL, 0, &pRxData, &wRxDataLength);
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS_CHAINING)
+    {
+        return ((status & PH_ERR_MASK) == PH_ERR_SUCCESS) ? PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF) : status;
+    }
+    if (wRxDataLength != PHAL_MFDF_DES_BLOCK_SIZE)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_ECB,
+        pRxData,
+        PHAL_MFDF_DES_BLOCK_SIZE,
+        bRndB));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Rnd(
+        pDataParams->pCryptoRngDataParams,
+        PHAL_MFDF_DES_BLOCK_SIZE,
+        bRndA));
+
+    /* the reader deciphers what it sends: dk(RndA) || dk(RndB' ^ dk(RndA)), RndB' is RndB rotated left by one byte */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_ECB,
+        bRndA,
+        PHAL_MFDF_DES_BLOCK_SIZE,
+        bToken));
+
+    for (bIndex = 0; bIndex < PHAL_MFDF_DES_BLOCK_SIZE; ++bIndex)
+    {
+        bToken[PHAL_MFDF_DES_BLOCK_SIZE + bIndex] = bRndB[(bIndex + 1) % PHAL_MFDF_DES_BLOCK_SIZE] ^ bToken[bIndex];
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_ECB,
+        &bToken[PHAL_MFDF_DES_BLOCK_SIZE],
+        PHAL_MFDF_DES_BLOCK_SIZE,
+        &bToken[PHAL_MFDF_DES_BLOCK_SIZE]));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_Exchange(
+        pDataParams,
+        PHAL_MFDF_CMD_ADDITIONAL_FRAME,
+        NULL,
+        0,
+        bToken,
+        sizeof(bToken),
+        &pRxData,
+        &wRxDataLength));
+
+    if (wRxDataLength != PHAL_MFDF_DES_BLOCK_SIZE)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    /* ek(RndA') proves the card knows the key */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_ECB,
+        pRxData,
+        PHAL_MFDF_DES_BLOCK_SIZE,
+        bRndB));
+
+    if ((memcmp(bRndB, &bRndA[1], PHAL_MFDF_DES_BLOCK_SIZE - 1) != 0) ||
+        (bRndB[PHAL_MFDF_DES_BLOCK_SIZE - 1] != bRndA[0]))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    pDataParams->bKeyNo = bKeyNoCard;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+#else
+    /* satisfy compiler */
+    if (pDataParams || bKeyNoCard || wKeyNo || wKeyVersion);
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AL_MFDF);
+#endif
+}
+
+phStatus_t phalMfdf_Sw_GetApplicationIDs(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pAidBuffer,
+    uint8_t * pNumAids
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    pDataParams->wFrames = 0;
+    *pNumAids = 0;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ReadChained(
+        pDataParams,
+        PHAL_MFDF_CMD_GET_APPLICATION_IDS,
+        NULL,
+        0,
+        pAidBuffer,
+        PHAL_MFDF_MAX_APPLICATIONS * PHAL_MFDF_AID_LENGTH,
+        &wRxLength));
+
+    if ((wRxLength % PHAL_MFDF_AID_LENGTH) != 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+    *pNumAids = (uint8_t)(wRxLength / PHAL_MFDF_AID_LENGTH);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_SelectApplication(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pAid
+    )
+{
+    uint8_t *   PH_MEMLOC_REM pRxData;
+    uint16_t    PH_MEMLOC_REM wRxDataLength;
+
+    pDataParams->wFrames = 0;
+
+    /* selecting drops any authentication */
+    pDataParams->bKeyNo = PHAL_MFDF_NOT_AUTHENTICATED;
+
+    return phalMfdf_Sw_Int_Exchange(
+        pDataParams,
+        PHAL_MFDF_CMD_SELECT_APPLICATION,
+        pAid,
+        PHAL_MFDF_AID_LENGTH,
+        NULL,
+        0,
+        &pRxData,
+        &wRxDataLength);
+}
+
+phStatus_t phalMfdf_Sw_GetFileIDs(
+                                  phalMfdf_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pFid,
+                                  uint8_t * pNumFid
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    pDataParams->wFrames = 0;
+    *pNumFid = 0;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ReadChained(
+        pDataParams,
+        PHAL_MFDF_CMD_GET_FILE_IDS,
+        NULL,
+        0,
+        pFid,
+        PHAL_MFDF_MAX_FILES,
+        &wRxLength));
+
+    *pNumFid = (uint8_t)wRxLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_ReadData(
+                                phalMfdf_Sw_DataParams_t * pDataParams,
+                                uint8_t bFileNo,
+                                uint32_t dwOffset,
+                                uint32_t dwLength,
+                                uint8_t * pBuffer,
+                                uint16_t wBufferSize,
+                                uint16_t * pRxLength
+                                )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bHeader[PHAL_MFDF_MAX_HEADER_LENGTH];
+
+    pDataParams->wFrames = 0;
+    *pRxLength = 0;
+
+    if (dwLength > wBufferSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+    }
+
+    bHeader[0] = bFileNo;
+    phalMfdf_Sw_Int_Uint24ToArray(dwOffset, &bHeader[1]);
+    phalMfdf_Sw_Int_Uint24ToArray(dwLength, &bHeader[4]);
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_ReadChained(
+        pDataParams,
+        PHAL_MFDF_CMD_READ_DATA,
+        bHeader,
+        PHAL_MFDF_MAX_HEADER_LENGTH,
+        pBuffer,
+        wBufferSize,
+        pRxLength));
+
+    if ((dwLength != 0) && (*pRxLength != dwLength))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_WriteData(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint8_t bFileNo,
+                                 uint32_t dwOffset,
+                                 uint8_t * pData,
+                                 uint16_t wDataLength
+                                 )
+{
+    uint8_t PH_MEMLOC_REM bHeader[PHAL_MFDF_MAX_HEADER_LENGTH];
+
+    pDataParams->wFrames = 0;
+
+    bHeader[0] = bFileNo;
+    phalMfdf_Sw_Int_Uint24ToArray(dwOffset, &bHeader[1]);
+    phalMfdf_Sw_Int_Uint24ToArray(wDataLength, &bHeader[4]);
+
+    return phalMfdf_Sw_Int_WriteChained(
+        pDataParams,
+        PHAL_MFDF_CMD_WRITE_DATA,
+        bHeader,
+        PHAL_MFDF_MAX_HEADER_LENGTH,
+        pData,
+        wDataLength);
+}
+
+phStatus_t phalMfdf_Sw_ReadRecords(
+                                   phalMfdf_Sw_DataParams_t * pDataParams,
+                                   uint8_t bFileNo,
+                                   uint32_t dwRecordNo,
+                                   uint32_t dwNumRecords,
+                                   uint8_t * pBuffer,
+                                   uint16_t wBufferSize,
+                                   uint16_t * pRxLength
+                                   )
+{
+    uint8_t PH_MEMLOC_REM bHeader[PHAL_MFDF_MAX_HEADER_LENGTH];
+
+    pDataParams->wFrames = 0;
+    *pRxLength = 0;
+
+    bHeader[0] = bFileNo;
+    phalMfdf_Sw_Int_Uint24ToArray(dwRecordNo, &bHeader[1]);
+    phalMfdf_Sw_Int_Uint24ToArray(dwNumRecords, &bHeader[4]);
+
+    return phalMfdf_Sw_Int_ReadChained(
+        pDataParams,
+        PHAL_MFDF_CMD_READ_RECORDS,
+        bHeader,
+        PHAL_MFDF_MAX_HEADER_LENGTH,
+        pBuffer,
+        wBufferSize,
+        pRxLength);
+}
+
+phStatus_t phalMfdf_Sw_SetConfig(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHAL_MFDF_CONFIG_WRAPPED_MODE:
+        if ((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFDF);
+        }
+        pDataParams->bWrapped = (uint8_t)wValue;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_GetConfig(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHAL_MFDF_CONFIG_WRAPPED_MODE:
+        *pValue = (uint16_t)pDataParams->bWrapped;
+        break;
+    case PHAL_MFDF_CONFIG_CARD_STATUS:
+        *pValue = (uint16_t)pDataParams->bCardStatus;
+        break;
+    case PHAL_MFDF_CONFIG_FRAMES:
+        *pValue = pDataParams->wFrames;
+        break;
+    case PHAL_MFDF_CONFIG_KEY_NO:
+        *pValue = (uint16_t)pDataParams->bKeyNo;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFDF);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+#endif /* NXPBUILD__PHAL_MFDF_SW */
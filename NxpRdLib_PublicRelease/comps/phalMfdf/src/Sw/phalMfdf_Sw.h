@@ -0,0 +1,95 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software MIFARE(R) DESFire Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALMFDF_SW_H
+#define PHALMFDF_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phalMfdf_Sw_Authenticate(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    uint8_t bKeyNoCard,
+                                    uint16_t wKeyNo,
+                                    uint16_t wKeyVersion
+                                    );
+
+phStatus_t phalMfdf_Sw_GetApplicationIDs(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pAidBuffer,
+    uint8_t * pNumAids
+    );
+
+phStatus_t phalMfdf_Sw_SelectApplication(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t * pAid
+    );
+
+phStatus_t phalMfdf_Sw_GetFileIDs(
+                                  phalMfdf_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pFid,
+                                  uint8_t * pNumFid
+                                  );
+
+phStatus_t phalMfdf_Sw_ReadData(
+                                phalMfdf_Sw_DataParams_t * pDataParams,
+                                uint8_t bFileNo,
+                                uint32_t dwOffset,
+                                uint32_t dwLength,
+                                uint8_t * pBuffer,
+                                uint16_t wBufferSize,
+                                uint16_t * pRxLength
+                                );
+
+phStatus_t phalMfdf_Sw_WriteData(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint8_t bFileNo,
+                                 uint32_t dwOffset,
+                                 uint8_t * pData,
+                                 uint16_t wDataLength
+                                 );
+
+phStatus_t phalMfdf_Sw_ReadRecords(
+                                   phalMfdf_Sw_DataParams_t * pDataParams,
+                                   uint8_t bFileNo,
+                                   uint32_t dwRecordNo,
+                                   uint32_t dwNumRecords,
+                                   uint8_t * pBuffer,
+                                   uint16_t wBufferSize,
+                                   uint16_t * pRxLength
+                                   );
+
+phStatus_t phalMfdf_Sw_SetConfig(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 );
+
+phStatus_t phalMfdf_Sw_GetConfig(
+                                 phalMfdf_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 );
+
+#endif /* PHALMFDF_SW_H */
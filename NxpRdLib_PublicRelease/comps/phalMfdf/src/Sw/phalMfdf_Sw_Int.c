@@ -0,0 +1,344 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal functions of Software MIFARE(R) DESFire Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalMfdf.h>
+#include <phpalMifare.h>
+#include <phpalI14443p4.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_MFDF_SW
+
+#include <string.h>
+#include "phalMfdf_Sw_Int.h"
+
+#define PHAL_MFDF_EDC_LENGTH    2U      /**< Length of the CRC of an ISO14443-4 block. */
+
+/** Frame sizes of ISO14443-4 by FSCI. */
+static const uint16_t PH_MEMLOC_CONST_ROM phalMfdf_Sw_Int_FsTable[9] = {16, 24, 32, 40, 48, 64, 96, 128, 256};
+
+static phStatus_t phalMfdf_Sw_Int_ComputeErrorResponse(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t bStatus
+    );
+
+static phStatus_t phalMfdf_Sw_Int_GetFrameSize(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint16_t * pFrameSize
+    );
+
+phStatus_t phalMfdf_Sw_Int_Exchange(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    uint8_t bCmd,
+                                    uint8_t * pHeader,
+                                    uint8_t bHeaderLength,
+                                    uint8_t * pData,
+                                    uint16_t wDataLength,
+                                    uint8_t ** ppRxData,
+                                    uint16_t * pRxDataLength
+                                    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aFrame[PHAL_MFDF_WRAPPED_HEADER_LENGTH + PHAL_MFDF_MAX_HEADER_LENGTH];
+    uint8_t     PH_MEMLOC_REM bLe = 0x00;
+    uint8_t     PH_MEMLOC_REM bFrameLength;
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+    uint8_t     PH_MEMLOC_REM bStatus;
+
+    if (bHeaderLength > PHAL_MFDF_MAX_HEADER_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    if (pDataParams->bWrapped != PH_OFF)
+    {
+        aFrame[0] = PHAL_MFDF_WRAPPED_CLA;
+        aFrame[1] = bCmd;
+        aFrame[2] = 0x00;
+        aFrame[3] = 0x00;
+        aFrame[4] = (uint8_t)(bHeaderLength + wDataLength);
+        bFrameLength = (aFrame[4] != 0) ? PHAL_MFDF_WRAPPED_HEADER_LENGTH : (PHAL_MFDF_WRAPPED_HEADER_LENGTH - 1);
+    }
+    else
+    {
+        aFrame[0] = bCmd;
+        bFrameLength = 1;
+    }
+    memcpy(&aFrame[bFrameLength], pHeader, bHeaderLength);  /* PRQA S 3200 */
+    bFrameLength = bFrameLength + bHeaderLength;
+
+    /* the data is buffered by the PAL as it is, a wrapped command ends with Le */
+    pDataParams->wFrames++;
+    if ((wDataLength == 0) && (pDataParams->bWrapped == PH_OFF))
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL4(
+            pDataParams->pPalMifareDataParams,
+            PH_EXCHANGE_DEFAULT,
+            aFrame,
+            bFrameLength,
+            &pRxBuffer,
+            &wRxLength));
+    }
+    else
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL4(
+            pDataParams->pPalMifareDataParams,
+            PH_EXCHANGE_BUFFER_FIRST,
+            aFrame,
+            bFrameLength,
+            &pRxBuffer,
+            &wRxLength));
+
+        if (pDataParams->bWrapped != PH_OFF)
+        {
+            if (wDataLength != 0)
+            {
+                PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL4(
+                    pDataParams->pPalMifareDataParams,
+                    PH_EXCHANGE_BUFFER_CONT,
+                    pData,
+                    wDataLength,
+                    &pRxBuffer,
+                    &wRxLength));
+            }
+            pData = &bLe;
+            wDataLength = 1;
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL4(
+            pDataParams->pPalMifareDataParams,
+            PH_EXCHANGE_BUFFER_LAST,
+            pData,
+            wDataLength,
+            &pRxBuffer,
+            &wRxLength));
+    }
+
+    /* native answers start with the status, wrapped ones end with 91 and the status */
+    if (pDataParams->bWrapped != PH_OFF)
+    {
+        if ((wRxLength < 2) || (pRxBuffer[wRxLength - 2] != PHAL_MFDF_WRAPPED_SW1))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+        }
+        bStatus = pRxBuffer[wRxLength - 1];
+        *ppRxData = pRxBuffer;
+        *pRxDataLength = wRxLength - 2;
+    }
+    else
+    {
+        if (wRxLength < 1)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+        }
+        bStatus = pRxBuffer[0];
+        *ppRxData = &pRxBuffer[1];
+        *pRxDataLength = wRxLength - 1;
+    }
+
+    return phalMfdf_Sw_Int_ComputeErrorResponse(pDataParams, bStatus);
+}
+
+phStatus_t phalMfdf_Sw_Int_ReadChained(
+                                       phalMfdf_Sw_DataParams_t * pDataParams,
+                                       uint8_t bCmd,
+                                       uint8_t * pHeader,
+                                       uint8_t bHeaderLength,
+                                       uint8_t * pBuffer,
+                                       uint16_t wBufferSize,
+                                       uint16_t * pRxLength
+                                       )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t *   PH_MEMLOC_REM pRxData;
+    uint16_t    PH_MEMLOC_REM wRxDataLength;
+
+    *pRxLength = 0;
+    status = phalMfdf_Sw_Int_Exchange(pDataParams, bCmd, pHeader, bHeaderLength, NULL, 0, &pRxData, &wRxDataLength);
+
+    while (1)
+    {
+        if (((status & PH_ERR_MASK) != PH_ERR_SUCCESS) && ((status & PH_ERR_MASK) != PH_ERR_SUCCESS_CHAINING))
+        {
+            return status;
+        }
+
+        /* each frame goes straight from the receive buffer of the PAL to its place */
+        if (wRxDataLength > (wBufferSize - *pRxLength))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFDF);
+        }
+        memcpy(&pBuffer[*pRxLength], pRxData, wRxDataLength);  /* PRQA S 3200 */
+        *pRxLength = *pRxLength + wRxDataLength;
+
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            break;
+        }
+        status = phalMfdf_Sw_Int_Exchange(pDataParams, PHAL_MFDF_CMD_ADDITIONAL_FRAME, NULL, 0, NULL, 0, &pRxData, &wRxDataLength);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+phStatus_t phalMfdf_Sw_Int_WriteChained(
+                                        phalMfdf_Sw_DataParams_t * pDataParams,
+                                        uint8_t bCmd,
+                                        uint8_t * pHeader,
+                                        uint8_t bHeaderLength,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint16_t    PH_MEMLOC_REM wFrameSize;
+    uint16_t    PH_MEMLOC_REM wOverhead;
+    uint16_t    PH_MEMLOC_REM wChunk;
+    uint8_t *   PH_MEMLOC_REM pRxData;
+    uint16_t    PH_MEMLOC_REM wRxDataLength;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMfdf_Sw_Int_GetFrameSize(pDataParams, &wFrameSize));
+    wOverhead = (pDataParams->bWrapped != PH_OFF) ? (PHAL_MFDF_WRAPPED_HEADER_LENGTH + 1) : 1;
+
+    /* the first frame carries the header, all others the additional frame command only;
+       a header not leaving room for data in the smallest frames is sent alone */
+    wChunk = wOverhead + bHeaderLength;
+    wChunk = (wFrameSize > wChunk) ? (wFrameSize - wChunk) : 0;
+    if (wChunk > wDataLength)
+    {
+        wChunk = wDataLength;
+    }
+    status = phalMfdf_Sw_Int_Exchange(pDataParams, bCmd, pHeader, bHeaderLength, pData, wChunk, &pRxData, &wRxDataLength);
+    pData += wChunk;
+    wDataLength = wDataLength - wChunk;
+
+    while (wDataLength != 0)
+    {
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS_CHAINING)
+        {
+            return ((status & PH_ERR_MASK) == PH_ERR_SUCCESS) ? PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF) : status;
+        }
+
+        wChunk = wFrameSize - wOverhead;
+        if (wChunk > wDataLength)
+        {
+            wChunk = wDataLength;
+        }
+        status = phalMfdf_Sw_Int_Exchange(pDataParams, PHAL_MFDF_CMD_ADDITIONAL_FRAME, NULL, 0, pData, wChunk, &pRxData, &wRxDataLength);
+        pData += wChunk;
+        wDataLength = wDataLength - wChunk;
+    }
+
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS_CHAINING)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFDF);
+    }
+
+    return status;
+}
+
+void phalMfdf_Sw_Int_Uint24ToArray(
+                                   uint32_t dwValue,
+                                   uint8_t * pArray
+                                   )
+{
+    pArray[0] = (uint8_t)(dwValue);
+    pArray[1] = (uint8_t)(dwValue >> 8);
+    pArray[2] = (uint8_t)(dwValue >> 16);
+}
+
+static phStatus_t phalMfdf_Sw_Int_ComputeErrorResponse(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint8_t bStatus
+    )
+{
+    pDataParams->bCardStatus = bStatus;
+
+    switch (bStatus)
+    {
+    case PHAL_MFDF_RESP_OPERATION_OK:
+    case PHAL_MFDF_RESP_NO_CHANGES:
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_ADDITIONAL_FRAME:
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS_CHAINING, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_NO_SUCH_KEY:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_NO_SUCH_KEY, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_LENGTH_ERROR:
+        return PH_ADD_COMPCODE(PH_ERR_LENGTH_ERROR, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_PERMISSION_DENIED:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_PERMISSION_DENIED, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_APPLICATION_NOT_FOUND:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_APPLICATION_NOT_FOUND, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_AUTHENTICATION_ERROR:
+        return PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_BOUNDARY_ERROR:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_BOUNDARY_ERROR, PH_COMP_AL_MFDF);
+    case PHAL_MFDF_RESP_FILE_NOT_FOUND:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_FILE_NOT_FOUND, PH_COMP_AL_MFDF);
+    default:
+        return PH_ADD_COMPCODE(PHAL_MFDF_ERR_PICC, PH_COMP_AL_MFDF);
+    }
+}
+
+static phStatus_t phalMfdf_Sw_Int_GetFrameSize(
+    phalMfdf_Sw_DataParams_t * pDataParams,
+    uint16_t * pFrameSize
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wValue;
+
+    if (pDataParams->pPalI14443p4DataParams == NULL)
+    {
+        *pFrameSize = PHAL_MFDF_DEFAULT_FRAME_SIZE - PHAL_MFDF_EDC_LENGTH - 1;
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+    }
+
+    /* INF bytes of an I-block the card accepts */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_FSI, &wValue));
+    wValue = wValue & 0x00FF;
+    if (wValue > 8)
+    {
+        wValue = 8;
+    }
+    *pFrameSize = phalMfdf_Sw_Int_FsTable[wValue] - PHAL_MFDF_EDC_LENGTH - 1;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_CID, &wValue));
+    if (wValue & 0xFF00)
+    {
+        (*pFrameSize)--;
+    }
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_NAD, &wValue));
+    if (wValue & 0xFF00)
+    {
+        (*pFrameSize)--;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFDF);
+}
+
+#endif /* NXPBUILD__PHAL_MFDF_SW */
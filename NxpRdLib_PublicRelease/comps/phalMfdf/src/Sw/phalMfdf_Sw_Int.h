@@ -0,0 +1,113 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal functions of Software MIFARE(R) DESFire Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALMFDF_SW_INT_H
+#define PHALMFDF_SW_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+* @{
+*/
+
+#define PHAL_MFDF_CMD_AUTHENTICATE          0x0AU   /**< MIFARE DESFire Authenticate command byte */
+#define PHAL_MFDF_CMD_GET_APPLICATION_IDS   0x6AU   /**< MIFARE DESFire GetApplicationIDs command byte */
+#define PHAL_MFDF_CMD_SELECT_APPLICATION    0x5AU   /**< MIFARE DESFire SelectApplication command byte */
+#define PHAL_MFDF_CMD_GET_FILE_IDS          0x6FU   /**< MIFARE DESFire GetFileIDs command byte */
+#define PHAL_MFDF_CMD_READ_DATA             0xBDU   /**< MIFARE DESFire ReadData command byte */
+#define PHAL_MFDF_CMD_WRITE_DATA            0x3DU   /**< MIFARE DESFire WriteData command byte */
+#define PHAL_MFDF_CMD_READ_RECORDS          0xBBU   /**< MIFARE DESFire ReadRecords command byte */
+#define PHAL_MFDF_CMD_ADDITIONAL_FRAME      0xAFU   /**< MIFARE DESFire additional frame command byte */
+
+#define PHAL_MFDF_RESP_OPERATION_OK         0x00U   /**< MIFARE DESFire successful operation */
+#define PHAL_MFDF_RESP_NO_CHANGES           0x0CU   /**< MIFARE DESFire no changes done */
+#define PHAL_MFDF_RESP_NO_SUCH_KEY          0x40U   /**< MIFARE DESFire invalid key number */
+#define PHAL_MFDF_RESP_LENGTH_ERROR         0x7EU   /**< MIFARE DESFire length of command string invalid */
+#define PHAL_MFDF_RESP_PERMISSION_DENIED    0x9DU   /**< MIFARE DESFire current configuration or status does not allow the command */
+#define PHAL_MFDF_RESP_APPLICATION_NOT_FOUND 0xA0U  /**< MIFARE DESFire requested AID not present */
+#define PHAL_MFDF_RESP_AUTHENTICATION_ERROR 0xAEU   /**< MIFARE DESFire authentication status does not allow the command */
+#define PHAL_MFDF_RESP_ADDITIONAL_FRAME     0xAFU   /**< MIFARE DESFire additional data frame is expected */
+#define PHAL_MFDF_RESP_BOUNDARY_ERROR       0xBEU   /**< MIFARE DESFire attempt to read or write beyond the limits */
+#define PHAL_MFDF_RESP_FILE_NOT_FOUND       0xF0U   /**< MIFARE DESFire specified file number does not exist */
+
+#define PHAL_MFDF_WRAPPED_CLA               0x90U   /**< Class byte of a wrapped command */
+#define PHAL_MFDF_WRAPPED_SW1               0x91U   /**< First status byte of a wrapped answer */
+#define PHAL_MFDF_WRAPPED_HEADER_LENGTH     5U      /**< CLA, INS, P1, P2 and Lc of a wrapped command */
+#define PHAL_MFDF_MAX_HEADER_LENGTH         7U      /**< Longest command header, e.g. file number, offset and length */
+
+#define PHAL_MFDF_DES_BLOCK_SIZE            8U      /**< Length of a DES block */
+
+/** @} */
+
+/**
+* Send one frame of a command and return the data of the answer.
+* \c pHeader and \c pData follow each other in the frame; only \c pHeader is copied.
+* An additional frame status returns #PH_ERR_SUCCESS_CHAINING.
+*/
+phStatus_t phalMfdf_Sw_Int_Exchange(
+                                    phalMfdf_Sw_DataParams_t * pDataParams,
+                                    uint8_t bCmd,
+                                    uint8_t * pHeader,
+                                    uint8_t bHeaderLength,
+                                    uint8_t * pData,
+                                    uint16_t wDataLength,
+                                    uint8_t ** ppRxData,
+                                    uint16_t * pRxDataLength
+                                    );
+
+/**
+* Send a command and collect the data of all answer frames in \c pBuffer.
+*/
+phStatus_t phalMfdf_Sw_Int_ReadChained(
+                                       phalMfdf_Sw_DataParams_t * pDataParams,
+                                       uint8_t bCmd,
+                                       uint8_t * pHeader,
+                                       uint8_t bHeaderLength,
+                                       uint8_t * pBuffer,
+                                       uint16_t wBufferSize,
+                                       uint16_t * pRxLength
+                                       );
+
+/**
+* Send a command whose data is split into as many frames as the frame size of the card requires.
+*/
+phStatus_t phalMfdf_Sw_Int_WriteChained(
+                                        phalMfdf_Sw_DataParams_t * pDataParams,
+                                        uint8_t bCmd,
+                                        uint8_t * pHeader,
+                                        uint8_t bHeaderLength,
+                                        uint8_t * pData,
+                                        uint16_t wDataLength
+                                        );
+
+/**
+* Store a three byte value least significant byte first.
+*/
+void phalMfdf_Sw_Int_Uint24ToArray(
+                                   uint32_t dwValue,
+                                   uint8_t * pArray
+                                   );
+
+#endif /* PHALMFDF_SW_INT_H */
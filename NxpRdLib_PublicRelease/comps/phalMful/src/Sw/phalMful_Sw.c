@@ -27,10 +27,13 @@
 #include <phalMful.h>
 #include <phpalMifare.h>
 #include <phKeyStore.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
 #include <ph_RefDefs.h>
 
 #ifdef NXPBUILD__PHAL_MFUL_SW
 
+#include <string.h>
 #include "phalMful_Sw.h"
 #include "../phalMful_Int.h"
 
@@ -61,6 +64,11 @@ phStatus_t phalMful_Sw_Init(
     pDataParams->pKeyStoreDataParams    = pKeyStoreDataParams;
     pDataParams->pCryptoDataParams      = pCryptoDataParams;
     pDataParams->pCryptoRngDataParams   = pCryptoRngDataParams;
+    pDataParams->bFastRead              = PH_OFF;
+    pDataParams->bMaxFastReadPages      = PHAL_MFUL_DEFAULT_FAST_READ_PAGES;
+    pDataParams->bNumPages              = PHAL_MFUL_UL_PAGES;
+    pDataParams->bUserPages             = PHAL_MFUL_UL_USER_PAGES;
+    pDataParams->bWriteRetries          = 0;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
 }
@@ -71,7 +79,117 @@ phStatus_t phalMful_Sw_UlcAuthenticate(
                                        uint16_t wKeyVersion
                                        )
 {
-#ifndef NXPBUILD__PH_CRYPTOSYM
+#if defined(NXPBUILD__PH_CRYPTOSYM) && defined(NXPBUILD__PH_CRYPTORNG)
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM bKey[PHAL_MFUL_DES_KEY_LENGTH];
+    uint16_t    PH_MEMLOC_REM wKeyType;
+    uint8_t     PH_MEMLOC_REM bCmd[1 + (2 * PHAL_MFUL_DES_BLOCK_SIZE)];
+    uint8_t     PH_MEMLOC_REM bRndA[PHAL_MFUL_DES_BLOCK_SIZE];
+    uint8_t     PH_MEMLOC_REM bRndB[PHAL_MFUL_DES_BLOCK_SIZE];
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    if ((pDataParams->pCryptoDataParams == NULL) || (pDataParams->pCryptoRngDataParams == NULL))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_MFUL);
+    }
+
+    /* retrieve the key */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phKeyStore_GetKey(
+        pDataParams->pKeyStoreDataParams,
+        wKeyNumber,
+        wKeyVersion,
+        sizeof(bKey),
+        bKey,
+        &wKeyType));
+
+    if (wKeyType != PH_KEYSTORE_KEY_TYPE_2K3DES)
+    {
+        memset(bKey, 0x00, sizeof(bKey));  /* PRQA S 3200 */
+        return PH_ADD_COMPCODE(PH_ERR_KEY, PH_COMP_AL_MFUL);
+    }
+
+    status = phCryptoSym_LoadKeyDirect(pDataParams->pCryptoDataParams, bKey, PH_CRYPTOSYM_KEY_TYPE_2K3DES);
+    memset(bKey, 0x00, sizeof(bKey));  /* PRQA S 3200 */
+    PH_CHECK_SUCCESS(status);
+
+    /* request ek(RndB) */
+    bCmd[0] = PHAL_MFUL_CMD_AUTH;
+    bCmd[1] = 0x00;
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pDataParams->pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCmd,
+        2,
+        &pRxBuffer,
+        &wRxLength));
+
+    if ((wRxLength != (1 + PHAL_MFUL_DES_BLOCK_SIZE)) || (pRxBuffer[0] != PHAL_MFUL_PREAMBLE_TX))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    /* the chain starts with a zero IV and continues with the last cipher block of each frame */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_LoadIv(
+        pDataParams->pCryptoDataParams,
+        (uint8_t *)phalMful_Sw_FirstIv,
+        PHAL_MFUL_DES_BLOCK_SIZE));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &pRxBuffer[1],
+        PHAL_MFUL_DES_BLOCK_SIZE,
+        bRndB));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoRng_Rnd(
+        pDataParams->pCryptoRngDataParams,
+        PHAL_MFUL_DES_BLOCK_SIZE,
+        bRndA));
+
+    /* send ek(RndA || RndB'), RndB' is RndB rotated left by one byte */
+    bCmd[0] = PHAL_MFUL_PREAMBLE_TX;
+    memcpy(&bCmd[1], bRndA, PHAL_MFUL_DES_BLOCK_SIZE);  /* PRQA S 3200 */
+    memcpy(&bCmd[1 + PHAL_MFUL_DES_BLOCK_SIZE], &bRndB[1], PHAL_MFUL_DES_BLOCK_SIZE - 1);  /* PRQA S 3200 */
+    bCmd[2 * PHAL_MFUL_DES_BLOCK_SIZE] = bRndB[0];
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Encrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &bCmd[1],
+        2 * PHAL_MFUL_DES_BLOCK_SIZE,
+        &bCmd[1]));
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pDataParams->pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCmd,
+        sizeof(bCmd),
+        &pRxBuffer,
+        &wRxLength));
+
+    if ((wRxLength != (1 + PHAL_MFUL_DES_BLOCK_SIZE)) || (pRxBuffer[0] != PHAL_MFUL_PREAMBLE_RX))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    /* ek(RndA') proves the card knows the key */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phCryptoSym_Decrypt(
+        pDataParams->pCryptoDataParams,
+        PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        &pRxBuffer[1],
+        PHAL_MFUL_DES_BLOCK_SIZE,
+        bRndB));
+
+    if ((memcmp(bRndB, &bRndA[1], PHAL_MFUL_DES_BLOCK_SIZE - 1) != 0) ||
+        (bRndB[PHAL_MFUL_DES_BLOCK_SIZE - 1] != bRndA[0]))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_AUTH_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+#else
     /* satisfy compiler */
     if (pDataParams || wKeyNumber || wKeyVersion);
     return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_AL_MFUL);
@@ -105,4 +223,273 @@ phStatus_t phalMful_Sw_CompatibilityWrite(
     return phalMful_Int_CompatibilityWrite(pDataParams->pPalMifareDataParams, bAddress, pData);
 }
 
+phStatus_t phalMful_Sw_GetVersion(
+                                  phalMful_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pVersion
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+
+    /* chips without GET_VERSION are plain Ultralights until told otherwise */
+    pDataParams->bFastRead  = PH_OFF;
+    pDataParams->bNumPages  = PHAL_MFUL_UL_PAGES;
+    pDataParams->bUserPages = PHAL_MFUL_UL_USER_PAGES;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_GetVersion(pDataParams->pPalMifareDataParams, pVersion));
+
+    /* all chips answering GET_VERSION support FAST_READ */
+    pDataParams->bFastRead = PH_ON;
+
+    switch (pVersion[PHAL_MFUL_VERSION_STORAGE])
+    {
+    case 0x0B:  /* Ultralight EV1 MF0UL11, NTAG210 */
+        pDataParams->bNumPages  = 20;
+        pDataParams->bUserPages = 12;
+        break;
+    case 0x0E:  /* Ultralight EV1 MF0UL21, NTAG212 */
+        pDataParams->bNumPages  = 41;
+        pDataParams->bUserPages = 32;
+        break;
+    case 0x0F:  /* NTAG213 */
+        pDataParams->bNumPages  = 45;
+        pDataParams->bUserPages = 36;
+        break;
+    case 0x11:  /* NTAG215 */
+        pDataParams->bNumPages  = 135;
+        pDataParams->bUserPages = 126;
+        break;
+    case 0x13:  /* NTAG216 */
+        pDataParams->bNumPages  = 231;
+        pDataParams->bUserPages = 222;
+        break;
+    default:
+        /* unknown storage size, only the plain Ultralight memory is safe */
+        break;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Sw_FastRead(
+                                phalMful_Sw_DataParams_t * pDataParams,
+                                uint8_t bStartPage,
+                                uint8_t bEndPage,
+                                uint8_t * pData
+                                )
+{
+    return phalMful_Int_FastRead(pDataParams->pPalMifareDataParams, bStartPage, bEndPage, pData);
+}
+
+phStatus_t phalMful_Sw_ReadPages(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint8_t bStartPage,
+                                 uint16_t wNumPages,
+                                 uint8_t * pData
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aBlock[PHAL_MFUL_READ_BLOCK_LENGTH];
+    uint8_t     PH_MEMLOC_REM bChunk;
+    uint16_t    PH_MEMLOC_REM wOffset = 0;
+
+    if ((wNumPages == 0) || (((uint16_t)bStartPage + wNumPages) > pDataParams->bNumPages))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    while (wNumPages > 0)
+    {
+        if (pDataParams->bFastRead == PH_ON)
+        {
+            bChunk = (wNumPages > pDataParams->bMaxFastReadPages) ? pDataParams->bMaxFastReadPages : (uint8_t)wNumPages;
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_FastRead(
+                pDataParams->pPalMifareDataParams,
+                bStartPage,
+                (uint8_t)(bStartPage + bChunk - 1),
+                &pData[wOffset]));
+        }
+        else
+        {
+            /* READ always returns 4 pages, the surplus of the last one is dropped */
+            bChunk = (wNumPages > (PHAL_MFUL_READ_BLOCK_LENGTH / PHAL_MFUL_PAGE_LENGTH)) ?
+                (uint8_t)(PHAL_MFUL_READ_BLOCK_LENGTH / PHAL_MFUL_PAGE_LENGTH) : (uint8_t)wNumPages;
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Int_Read(pDataParams->pPalMifareDataParams, bStartPage, aBlock));
+            memcpy(&pData[wOffset], aBlock, bChunk * PHAL_MFUL_PAGE_LENGTH);  /* PRQA S 3200 */
+        }
+
+        bStartPage = (uint8_t)(bStartPage + bChunk);
+        wNumPages = (uint16_t)(wNumPages - bChunk);
+        wOffset = (uint16_t)(wOffset + (bChunk * PHAL_MFUL_PAGE_LENGTH));
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Sw_ReadUserMemory(
+                                      phalMful_Sw_DataParams_t * pDataParams,
+                                      uint16_t wBufferSize,
+                                      uint8_t * pData,
+                                      uint16_t * pDataLength
+                                      )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+
+    *pDataLength = 0;
+
+    if (((uint16_t)pDataParams->bUserPages * PHAL_MFUL_PAGE_LENGTH) > wBufferSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_MFUL);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Sw_ReadPages(
+        pDataParams,
+        PHAL_MFUL_USER_MEMORY_PAGE,
+        pDataParams->bUserPages,
+        pData));
+
+    *pDataLength = (uint16_t)(pDataParams->bUserPages * PHAL_MFUL_PAGE_LENGTH);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Sw_WritePages(
+                                  phalMful_Sw_DataParams_t * pDataParams,
+                                  uint8_t bStartPage,
+                                  uint16_t wNumPages,
+                                  uint8_t * pData,
+                                  uint8_t * pReference,
+                                  uint8_t * pPageStatus,
+                                  uint16_t * pNumFrames
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM status = PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+    uint8_t     PH_MEMLOC_REM bTry;
+    uint16_t    PH_MEMLOC_COUNT wIndex;
+
+    *pNumFrames = 0;
+
+    if ((wNumPages == 0) || (((uint16_t)bStartPage + wNumPages) > pDataParams->bNumPages))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    for (wIndex = 0; wIndex < wNumPages; ++wIndex)
+    {
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            pPageStatus[wIndex] = PHAL_MFUL_PAGE_NOT_WRITTEN;
+            continue;
+        }
+
+        if ((pReference != NULL) &&
+            (memcmp(&pData[wIndex * PHAL_MFUL_PAGE_LENGTH], &pReference[wIndex * PHAL_MFUL_PAGE_LENGTH], PHAL_MFUL_PAGE_LENGTH) == 0))
+        {
+            pPageStatus[wIndex] = PHAL_MFUL_PAGE_UNCHANGED;
+            continue;
+        }
+
+        for (bTry = 0; bTry <= pDataParams->bWriteRetries; ++bTry)
+        {
+            ++(*pNumFrames);
+            status = phalMful_Int_WritePage(
+                pDataParams->pPalMifareDataParams,
+                (uint8_t)(bStartPage + wIndex),
+                &pData[wIndex * PHAL_MFUL_PAGE_LENGTH]);
+
+            /* only a missing or broken answer is worth a retry, a NAK idles the chip */
+            if (((status & PH_ERR_MASK) != PH_ERR_IO_TIMEOUT) &&
+                ((status & PH_ERR_MASK) != PH_ERR_INTEGRITY_ERROR))
+            {
+                break;
+            }
+        }
+
+        pPageStatus[wIndex] = ((status & PH_ERR_MASK) == PH_ERR_SUCCESS) ? PHAL_MFUL_PAGE_WRITTEN : PHAL_MFUL_PAGE_FAILED;
+    }
+
+    return status;
+}
+
+phStatus_t phalMful_Sw_SetConfig(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHAL_MFUL_CONFIG_FAST_READ:
+        if ((wValue != PH_ON) && (wValue != PH_OFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+        }
+        pDataParams->bFastRead = (uint8_t)wValue;
+        break;
+    case PHAL_MFUL_CONFIG_MAX_FAST_READ_PAGES:
+        if ((wValue == 0) || (wValue > 0xFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+        }
+        pDataParams->bMaxFastReadPages = (uint8_t)wValue;
+        break;
+    case PHAL_MFUL_CONFIG_NUM_PAGES:
+        if ((wValue <= PHAL_MFUL_USER_MEMORY_PAGE) || (wValue > 0xFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+        }
+        pDataParams->bNumPages = (uint8_t)wValue;
+        break;
+    case PHAL_MFUL_CONFIG_USER_PAGES:
+        if ((wValue + PHAL_MFUL_USER_MEMORY_PAGE) > pDataParams->bNumPages)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+        }
+        pDataParams->bUserPages = (uint8_t)wValue;
+        break;
+    case PHAL_MFUL_CONFIG_WRITE_RETRIES:
+        if (wValue > 0xFF)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+        }
+        pDataParams->bWriteRetries = (uint8_t)wValue;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Sw_GetConfig(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHAL_MFUL_CONFIG_FAST_READ:
+        *pValue = (uint16_t)pDataParams->bFastRead;
+        break;
+    case PHAL_MFUL_CONFIG_MAX_FAST_READ_PAGES:
+        *pValue = (uint16_t)pDataParams->bMaxFastReadPages;
+        break;
+    case PHAL_MFUL_CONFIG_NUM_PAGES:
+        *pValue = (uint16_t)pDataParams->bNumPages;
+        break;
+    case PHAL_MFUL_CONFIG_USER_PAGES:
+        *pValue = (uint16_t)pDataParams->bUserPages;
+        break;
+    case PHAL_MFUL_CONFIG_WRITE_RETRIES:
+        *pValue = (uint16_t)pDataParams->bWriteRetries;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
 #endif /* NXPBUILD__PHAL_MFUL_SW */
@@ -52,4 +52,52 @@ phStatus_t phalMful_Sw_CompatibilityWrite(
     uint8_t * pData
     );
 
+phStatus_t phalMful_Sw_GetVersion(
+                                  phalMful_Sw_DataParams_t * pDataParams,
+                                  uint8_t * pVersion
+                                  );
+
+phStatus_t phalMful_Sw_FastRead(
+                                phalMful_Sw_DataParams_t * pDataParams,
+                                uint8_t bStartPage,
+                                uint8_t bEndPage,
+                                uint8_t * pData
+                                );
+
+phStatus_t phalMful_Sw_ReadPages(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint8_t bStartPage,
+                                 uint16_t wNumPages,
+                                 uint8_t * pData
+                                 );
+
+phStatus_t phalMful_Sw_ReadUserMemory(
+                                      phalMful_Sw_DataParams_t * pDataParams,
+                                      uint16_t wBufferSize,
+                                      uint8_t * pData,
+                                      uint16_t * pDataLength
+                                      );
+
+phStatus_t phalMful_Sw_WritePages(
+                                  phalMful_Sw_DataParams_t * pDataParams,
+                                  uint8_t bStartPage,
+                                  uint16_t wNumPages,
+                                  uint8_t * pData,
+                                  uint8_t * pReference,
+                                  uint8_t * pPageStatus,
+                                  uint16_t * pNumFrames
+                                  );
+
+phStatus_t phalMful_Sw_SetConfig(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 );
+
+phStatus_t phalMful_Sw_GetConfig(
+                                 phalMful_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 );
+
 #endif /* PHALMFUL_SW_H */
@@ -150,4 +150,106 @@ phStatus_t phalMful_Int_CompatibilityWrite(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
 }
 
+phStatus_t phalMful_Int_WritePage(
+                                  void * pPalMifareDataParams,
+                                  uint8_t bAddress,
+                                  uint8_t * pData
+                                  )
+{
+    uint8_t     PH_MEMLOC_REM bFrame[2 + PHAL_MFUL_WRITE_BLOCK_LENGTH];
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    /* command and data in one frame, without buffering in the PAL */
+    bFrame[0] = PHAL_MFUL_CMD_WRITE;
+    bFrame[1] = bAddress;
+    memcpy(&bFrame[2], pData, PHAL_MFUL_WRITE_BLOCK_LENGTH);  /* PRQA S 3200 */
+
+    return phpalMifare_ExchangeL3(
+        pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bFrame,
+        sizeof(bFrame),
+        &pRxBuffer,
+        &wRxLength
+        );
+}
+
+phStatus_t phalMful_Int_GetVersion(
+                                   void * pPalMifareDataParams,
+                                   uint8_t * pVersion
+                                   )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCommand[1];
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    /* build command frame */
+    bCommand[0] = PHAL_MFUL_CMD_GET_VERSION;
+
+    /* transmit the command frame */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCommand,
+        1,
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    /* check received length */
+    if (wRxLength != PHAL_MFUL_VERSION_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    memcpy(pVersion, pRxBuffer, wRxLength);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
+phStatus_t phalMful_Int_FastRead(
+                                 void * pPalMifareDataParams,
+                                 uint8_t bStartPage,
+                                 uint8_t bEndPage,
+                                 uint8_t * pData
+                                 )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bCommand[3];
+    uint8_t *   PH_MEMLOC_REM pRxBuffer;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    if (bEndPage < bStartPage)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_MFUL);
+    }
+
+    /* build command frame */
+    bCommand[0] = PHAL_MFUL_CMD_FAST_READ;
+    bCommand[1] = bStartPage;
+    bCommand[2] = bEndPage;
+
+    /* transmit the command frame */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalMifare_ExchangeL3(
+        pPalMifareDataParams,
+        PH_EXCHANGE_DEFAULT,
+        bCommand,
+        3,
+        &pRxBuffer,
+        &wRxLength
+        ));
+
+    /* check received length */
+    if (wRxLength != (((uint16_t)(bEndPage - bStartPage) + 1) * PHAL_MFUL_PAGE_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_MFUL);
+    }
+
+    memcpy(pData, pRxBuffer, wRxLength);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_MFUL);
+}
+
 #endif /* NXPBUILD__PHAL_MFUL */
@@ -42,6 +42,11 @@
 #define PHAL_MFUL_CMD_COMPWRITE 0xA0U   /**< MIFARE Ultralight Compatibility Write command byte */
 #define PHAL_MFUL_CMD_WRITE     0xA2U   /**< MIFARE Ultralight Write command byte */
 #define PHAL_MFUL_CMD_AUTH      0x1AU   /**< MIFARE Ultralight Authenticate command byte */
+#define PHAL_MFUL_CMD_GET_VERSION   0x60U   /**< MIFARE Ultralight EV1 / NTAG Get Version command byte */
+#define PHAL_MFUL_CMD_FAST_READ     0x3AU   /**< MIFARE Ultralight EV1 / NTAG Fast Read command byte */
+
+#define PHAL_MFUL_VERSION_PRODUCT   2U      /**< Position of the product type in the GET_VERSION response. */
+#define PHAL_MFUL_VERSION_STORAGE   6U      /**< Position of the storage size in the GET_VERSION response. */
 
 #define PHAL_MFUL_PREAMBLE_TX   0xAFU   /**< MIFARE Ultralight preamble byte (tx) for authentication. */
 #define PHAL_MFUL_PREAMBLE_RX   0x00U   /**< MIFARE Ultralight preamble byte (rx) for authentication. */
@@ -68,4 +73,22 @@ phStatus_t phalMful_Int_CompatibilityWrite(
     uint8_t * pData
     );
 
+phStatus_t phalMful_Int_WritePage(
+                                  void * pPalMifareDataParams,
+                                  uint8_t bAddress,
+                                  uint8_t * pData
+                                  );
+
+phStatus_t phalMful_Int_GetVersion(
+                                   void * pPalMifareDataParams,
+                                   uint8_t * pVersion
+                                   );
+
+phStatus_t phalMful_Int_FastRead(
+                                 void * pPalMifareDataParams,
+                                 uint8_t bStartPage,
+                                 uint8_t bEndPage,
+                                 uint8_t * pData
+                                 );
+
 #endif /* PHALMFUL_INT_H */
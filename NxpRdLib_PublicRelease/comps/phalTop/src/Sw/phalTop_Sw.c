@@ -0,0 +1,177 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Tag Operation Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalTop.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_TOP_SW
+
+#include <string.h>
+#include "phalTop_Sw.h"
+#include "phalTop_Sw_Int_T2T.h"
+#include "phalTop_Sw_Int_T4T.h"
+
+phStatus_t phalTop_Sw_Init(
+                           phalTop_Sw_DataParams_t * pDataParams,
+                           uint16_t wSizeOfDataParams,
+                           void * pAlMfulDataParams,
+                           void * pPalI14443p4DataParams
+                           )
+{
+    if (sizeof(phalTop_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_AL_TOP);
+    }
+    PH_ASSERT_NULL (pDataParams);
+
+    /* init private data */
+    pDataParams->wId                    = PH_COMP_AL_TOP | PHAL_TOP_SW_ID;
+    pDataParams->pAlMfulDataParams      = pAlMfulDataParams;
+    pDataParams->pPalI14443p4DataParams = pPalI14443p4DataParams;
+    pDataParams->bTagType               = 0;
+    pDataParams->wPagesRead             = 0;
+    pDataParams->wCommands              = 0;
+    memset(&pDataParams->sT2T, 0x00, sizeof(pDataParams->sT2T));  /* PRQA S 3200 */
+    memset(&pDataParams->sT4T, 0x00, sizeof(pDataParams->sT4T));  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_ReadNdef(
+                               phalTop_Sw_DataParams_t * pDataParams,
+                               uint8_t bTagType,
+                               uint8_t * pBuffer,
+                               uint16_t wBufferSize,
+                               uint8_t ** ppNdef,
+                               uint16_t * pNdefLength
+                               )
+{
+    pDataParams->bTagType = bTagType;
+    pDataParams->wPagesRead = 0;
+    pDataParams->wCommands = 0;
+    *ppNdef = pBuffer;
+    *pNdefLength = 0;
+
+    switch (bTagType)
+    {
+    case PHAL_TOP_TAG_TYPE_T2T:
+        if (pDataParams->pAlMfulDataParams == NULL)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_TOP);
+        }
+        return phalTop_Sw_Int_T2TReadNdef(pDataParams, pBuffer, wBufferSize, ppNdef, pNdefLength);
+    case PHAL_TOP_TAG_TYPE_T4T:
+        if (pDataParams->pPalI14443p4DataParams == NULL)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_TOP);
+        }
+        return phalTop_Sw_Int_T4TReadNdef(pDataParams, pBuffer, wBufferSize, NULL, NULL, pNdefLength);
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+    }
+}
+
+phStatus_t phalTop_Sw_ReadNdefStream(
+                                     phalTop_Sw_DataParams_t * pDataParams,
+                                     uint8_t bTagType,
+                                     phalTop_NdefCallback_t pCallback,
+                                     void * pContext,
+                                     uint16_t * pNdefLength
+                                     )
+{
+    pDataParams->bTagType = bTagType;
+    pDataParams->wPagesRead = 0;
+    pDataParams->wCommands = 0;
+    *pNdefLength = 0;
+
+    /* a Type 2 Tag message is compacted in the buffer, so only Type 4 Tags stream */
+    if (bTagType != PHAL_TOP_TAG_TYPE_T4T)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+    }
+    if (pDataParams->pPalI14443p4DataParams == NULL)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_TOP);
+    }
+
+    return phalTop_Sw_Int_T4TReadNdef(pDataParams, NULL, 0, pCallback, pContext, pNdefLength);
+}
+
+phStatus_t phalTop_Sw_SetUid(
+                             phalTop_Sw_DataParams_t * pDataParams,
+                             uint8_t * pUid,
+                             uint8_t bUidLength
+                             )
+{
+    if (bUidLength > PHAL_TOP_MAX_UID_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_AL_TOP);
+    }
+
+    memcpy(pDataParams->sT4T.aUid, pUid, bUidLength);  /* PRQA S 3200 */
+    pDataParams->sT4T.bUidLength = bUidLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+phStatus_t phalTop_Sw_GetConfig(
+                                phalTop_Sw_DataParams_t * pDataParams,
+                                uint16_t wConfig,
+                                uint16_t * pValue
+                                )
+{
+    switch (wConfig)
+    {
+    case PHAL_TOP_CONFIG_PAGES_READ:
+        *pValue = pDataParams->wPagesRead;
+        break;
+    case PHAL_TOP_CONFIG_VERSION:
+        if (pDataParams->bTagType == PHAL_TOP_TAG_TYPE_T4T)
+        {
+            *pValue = (uint16_t)pDataParams->sT4T.bVersion;
+        }
+        else
+        {
+            *pValue = (uint16_t)pDataParams->sT2T.bVersion;
+        }
+        break;
+    case PHAL_TOP_CONFIG_COMMANDS:
+        *pValue = pDataParams->wCommands;
+        break;
+    case PHAL_TOP_CONFIG_CC_CACHED:
+        *pValue = (uint16_t)pDataParams->sT4T.bCcCached;
+        break;
+    case PHAL_TOP_CONFIG_READ_LENGTH:
+        *pValue = pDataParams->sT4T.wReadLength;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_AL_TOP);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+#endif /* NXPBUILD__PHAL_TOP_SW */
@@ -0,0 +1,60 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Tag Operation Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALTOP_SW_H
+#define PHALTOP_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phalTop_Sw_ReadNdef(
+                               phalTop_Sw_DataParams_t * pDataParams,
+                               uint8_t bTagType,
+                               uint8_t * pBuffer,
+                               uint16_t wBufferSize,
+                               uint8_t ** ppNdef,
+                               uint16_t * pNdefLength
+                               );
+
+phStatus_t phalTop_Sw_ReadNdefStream(
+                                     phalTop_Sw_DataParams_t * pDataParams,
+                                     uint8_t bTagType,
+                                     phalTop_NdefCallback_t pCallback,
+                                     void * pContext,
+                                     uint16_t * pNdefLength
+                                     );
+
+phStatus_t phalTop_Sw_SetUid(
+                             phalTop_Sw_DataParams_t * pDataParams,
+                             uint8_t * pUid,
+                             uint8_t bUidLength
+                             );
+
+phStatus_t phalTop_Sw_GetConfig(
+                                phalTop_Sw_DataParams_t * pDataParams,
+                                uint16_t wConfig,
+                                uint16_t * pValue
+                                );
+
+#endif /* PHALTOP_SW_H */
@@ -0,0 +1,353 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Tag Operation Application Component, Type 2 Tag of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalTop.h>
+#include <phalMful.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_TOP_SW
+
+#include <string.h>
+#include "phalTop_Sw_Int_T2T.h"
+
+#define PHAL_TOP_T2T_PAGE_LENGTH    4U      /**< Length of a Type 2 Tag page. */
+#define PHAL_TOP_T2T_READ_PAGES     4U      /**< Pages a READ command returns, the look ahead of the TLV walk. */
+#define PHAL_TOP_T2T_CTRL_LENGTH    3U      /**< Length of the value of a Lock or Memory Control TLV. */
+
+static uint16_t phalTop_Sw_Int_T2TPhysical(
+    phalTop_T2T_t * pT2T,
+    uint16_t wLogical
+    );
+
+static phStatus_t phalTop_Sw_Int_T2TLoad(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pBuffer,
+    uint16_t wBufferSize,
+    uint16_t wStart,
+    uint16_t wEnd
+    );
+
+static phStatus_t phalTop_Sw_Int_T2TGetByte(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pBuffer,
+    uint16_t wBufferSize,
+    uint16_t wLogical,
+    uint8_t * pByte
+    );
+
+static void phalTop_Sw_Int_T2TAddReservedArea(
+    phalTop_T2T_t * pT2T,
+    uint8_t bType,
+    uint8_t * pValue
+    );
+
+phStatus_t phalTop_Sw_Int_T2TReadNdef(
+                                      phalTop_Sw_DataParams_t * pDataParams,
+                                      uint8_t * pBuffer,
+                                      uint16_t wBufferSize,
+                                      uint8_t ** ppNdef,
+                                      uint16_t * pNdefLength
+                                      )
+{
+    phStatus_t      PH_MEMLOC_REM statusTmp;
+    phalTop_T2T_t * PH_MEMLOC_REM pT2T = &pDataParams->sT2T;
+    uint8_t         PH_MEMLOC_REM aBlock[PHAL_MFUL_READ_BLOCK_LENGTH];
+    uint8_t         PH_MEMLOC_REM aValue[PHAL_TOP_T2T_CTRL_LENGTH];
+    uint16_t        PH_MEMLOC_REM wNumPages;
+    uint16_t        PH_MEMLOC_REM wLogical = 0;
+    uint16_t        PH_MEMLOC_REM wLength;
+    uint16_t        PH_MEMLOC_REM wStart;
+    uint16_t        PH_MEMLOC_REM wEnd;
+    uint16_t        PH_MEMLOC_COUNT wIndex;
+    uint8_t         PH_MEMLOC_REM bType;
+    uint8_t         PH_MEMLOC_REM bByte;
+
+    memset(pT2T, 0x00, sizeof(phalTop_T2T_t));  /* PRQA S 3200 */
+
+    /* one READ returns the Capability Container and the first three data pages */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_Read(pDataParams->pAlMfulDataParams, PHAL_TOP_T2T_CC_PAGE, aBlock));
+    pDataParams->wPagesRead = PHAL_TOP_T2T_READ_PAGES;
+
+    if (aBlock[0] != PHAL_TOP_T2T_NDEF_MAGIC)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NOT_FORMATTED, PH_COMP_AL_TOP);
+    }
+    pT2T->bVersion = aBlock[1];
+    pT2T->wDataAreaSize = (uint16_t)aBlock[2] << 3;
+    pT2T->bAccess = aBlock[3];
+
+    if ((pT2T->bVersion & 0xF0) != PHAL_TOP_T2T_MAJOR_VERSION)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_UNSUPPORTED_VERSION, PH_COMP_AL_TOP);
+    }
+    if ((pT2T->bAccess & 0xF0) != 0x00)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_TOP);
+    }
+
+    /* chips without GET_VERSION are known by the data area only */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_GetConfig(pDataParams->pAlMfulDataParams, PHAL_MFUL_CONFIG_NUM_PAGES, &wNumPages));
+    if (wNumPages < (PHAL_TOP_T2T_DATA_PAGE + (pT2T->wDataAreaSize / PHAL_TOP_T2T_PAGE_LENGTH)))
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_SetConfig(
+            pDataParams->pAlMfulDataParams,
+            PHAL_MFUL_CONFIG_NUM_PAGES,
+            PHAL_TOP_T2T_DATA_PAGE + (pT2T->wDataAreaSize / PHAL_TOP_T2T_PAGE_LENGTH)));
+    }
+
+    /* keep the data pages of the first READ */
+    pT2T->wLoadedEnd = (uint16_t)(((wBufferSize < (PHAL_MFUL_READ_BLOCK_LENGTH - PHAL_TOP_T2T_PAGE_LENGTH)) ?
+        wBufferSize : (PHAL_MFUL_READ_BLOCK_LENGTH - PHAL_TOP_T2T_PAGE_LENGTH)) / PHAL_TOP_T2T_PAGE_LENGTH);
+    memcpy(pBuffer, &aBlock[PHAL_TOP_T2T_PAGE_LENGTH], pT2T->wLoadedEnd * PHAL_TOP_T2T_PAGE_LENGTH);  /* PRQA S 3200 */
+
+    /* walk the TLVs up to the NDEF Message TLV */
+    do
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TGetByte(pDataParams, pBuffer, wBufferSize, wLogical++, &bType));
+        if (bType == PHAL_TOP_T2T_TLV_NULL)
+        {
+            continue;
+        }
+        if (bType == PHAL_TOP_T2T_TLV_TERMINATOR)
+        {
+            return PH_ADD_COMPCODE(PHAL_TOP_ERR_NO_NDEF, PH_COMP_AL_TOP);
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TGetByte(pDataParams, pBuffer, wBufferSize, wLogical++, &bByte));
+        wLength = bByte;
+        if (bByte == 0xFF)
+        {
+            /* three byte format */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TGetByte(pDataParams, pBuffer, wBufferSize, wLogical++, &bByte));
+            wLength = (uint16_t)bByte << 8;
+            PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TGetByte(pDataParams, pBuffer, wBufferSize, wLogical++, &bByte));
+            wLength |= bByte;
+        }
+
+        /* the value has to end within the data area, a hostile length must not wrap the offsets */
+        if ((wLogical > pT2T->wDataAreaSize) || (wLength > (uint16_t)(pT2T->wDataAreaSize - wLogical)))
+        {
+            return PH_ADD_COMPCODE(PHAL_TOP_ERR_INVALID_TLV, PH_COMP_AL_TOP);
+        }
+
+        if (((bType == PHAL_TOP_T2T_TLV_LOCK_CTRL) || (bType == PHAL_TOP_T2T_TLV_MEM_CTRL)) &&
+            (wLength == PHAL_TOP_T2T_CTRL_LENGTH))
+        {
+            for (wIndex = 0; wIndex < PHAL_TOP_T2T_CTRL_LENGTH; ++wIndex)
+            {
+                PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TGetByte(pDataParams, pBuffer, wBufferSize, wLogical++, &aValue[wIndex]));
+            }
+            phalTop_Sw_Int_T2TAddReservedArea(pT2T, bType, aValue);
+        }
+        else if (bType != PHAL_TOP_T2T_TLV_NDEF)
+        {
+            /* skip without reading */
+            wLogical = (uint16_t)(wLogical + wLength);
+        }
+    }
+    while (bType != PHAL_TOP_T2T_TLV_NDEF);
+
+    wStart = phalTop_Sw_Int_T2TPhysical(pT2T, wLogical);
+    *ppNdef = &pBuffer[wStart];
+    *pNdefLength = 0;
+    if (wLength == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
+    /* read the pages the message spans */
+    wEnd = (uint16_t)(phalTop_Sw_Int_T2TPhysical(pT2T, (uint16_t)(wLogical + wLength - 1)) + 1);
+    if (wEnd > pT2T->wDataAreaSize)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_INVALID_TLV, PH_COMP_AL_TOP);
+    }
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TLoad(pDataParams, pBuffer, wBufferSize, wStart, wEnd));
+
+    /* close the gaps of reserved areas, every byte moves towards the start */
+    if ((wEnd - wStart) != wLength)
+    {
+        for (wIndex = 0; wIndex < wLength; ++wIndex)
+        {
+            pBuffer[wStart + wIndex] = pBuffer[phalTop_Sw_Int_T2TPhysical(pT2T, (uint16_t)(wLogical + wIndex))];
+        }
+    }
+    *pNdefLength = wLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static uint16_t phalTop_Sw_Int_T2TPhysical(
+    phalTop_T2T_t * pT2T,
+    uint16_t wLogical
+    )
+{
+    uint16_t    PH_MEMLOC_REM wPhysical = wLogical;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    /* the areas are sorted, so each one shifts all following bytes */
+    for (bIndex = 0; bIndex < pT2T->bNumReservedAreas; ++bIndex)
+    {
+        if (pT2T->aReservedStart[bIndex] <= wPhysical)
+        {
+            wPhysical = (uint16_t)(wPhysical + pT2T->aReservedLength[bIndex]);
+        }
+    }
+
+    return wPhysical;
+}
+
+static phStatus_t phalTop_Sw_Int_T2TLoad(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pBuffer,
+    uint16_t wBufferSize,
+    uint16_t wStart,
+    uint16_t wEnd
+    )
+{
+    phStatus_t      PH_MEMLOC_REM statusTmp;
+    phalTop_T2T_t * PH_MEMLOC_REM pT2T = &pDataParams->sT2T;
+    uint16_t        PH_MEMLOC_REM wFirstPage = wStart / PHAL_TOP_T2T_PAGE_LENGTH;
+    uint16_t        PH_MEMLOC_REM wEndPage = (uint16_t)((wEnd + PHAL_TOP_T2T_PAGE_LENGTH - 1) / PHAL_TOP_T2T_PAGE_LENGTH);
+
+    if ((wEndPage * PHAL_TOP_T2T_PAGE_LENGTH) > wBufferSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_TOP);
+    }
+
+    /* continue the loaded pages or start anew behind a skipped TLV */
+    if ((wFirstPage >= pT2T->wLoadedStart) && (wFirstPage <= pT2T->wLoadedEnd))
+    {
+        if (wEndPage <= pT2T->wLoadedEnd)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+        }
+        wFirstPage = pT2T->wLoadedEnd;
+    }
+    else
+    {
+        pT2T->wLoadedStart = wFirstPage;
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalMful_ReadPages(
+        pDataParams->pAlMfulDataParams,
+        (uint8_t)(PHAL_TOP_T2T_DATA_PAGE + wFirstPage),
+        (uint16_t)(wEndPage - wFirstPage),
+        &pBuffer[wFirstPage * PHAL_TOP_T2T_PAGE_LENGTH]));
+
+    pDataParams->wPagesRead = (uint16_t)(pDataParams->wPagesRead + wEndPage - wFirstPage);
+    pT2T->wLoadedEnd = wEndPage;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phStatus_t phalTop_Sw_Int_T2TGetByte(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pBuffer,
+    uint16_t wBufferSize,
+    uint16_t wLogical,
+    uint8_t * pByte
+    )
+{
+    phStatus_t      PH_MEMLOC_REM statusTmp;
+    phalTop_T2T_t * PH_MEMLOC_REM pT2T = &pDataParams->sT2T;
+    uint16_t        PH_MEMLOC_REM wPhysical = phalTop_Sw_Int_T2TPhysical(pT2T, wLogical);
+    uint16_t        PH_MEMLOC_REM wPage = wPhysical / PHAL_TOP_T2T_PAGE_LENGTH;
+    uint16_t        PH_MEMLOC_REM wEnd;
+
+    if (wPhysical >= pT2T->wDataAreaSize)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NO_NDEF, PH_COMP_AL_TOP);
+    }
+
+    if ((wPage >= pT2T->wLoadedStart) && (wPage < pT2T->wLoadedEnd))
+    {
+        *pByte = pBuffer[wPhysical];
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+
+    /* a READ costs the same for one or four pages, so look ahead within data area and buffer */
+    wEnd = (uint16_t)((wPage + PHAL_TOP_T2T_READ_PAGES) * PHAL_TOP_T2T_PAGE_LENGTH);
+    if (wEnd > pT2T->wDataAreaSize)
+    {
+        wEnd = pT2T->wDataAreaSize;
+    }
+    if (wEnd > (wBufferSize & ~(PHAL_TOP_T2T_PAGE_LENGTH - 1)))
+    {
+        wEnd = (uint16_t)(wBufferSize & ~(PHAL_TOP_T2T_PAGE_LENGTH - 1));
+    }
+    if (wEnd <= wPhysical)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_TOP);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T2TLoad(pDataParams, pBuffer, wBufferSize, wPhysical, wEnd));
+    *pByte = pBuffer[wPhysical];
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static void phalTop_Sw_Int_T2TAddReservedArea(
+    phalTop_T2T_t * pT2T,
+    uint8_t bType,
+    uint8_t * pValue
+    )
+{
+    uint16_t    PH_MEMLOC_REM wAddress;
+    uint16_t    PH_MEMLOC_REM wLength;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    /* page address in the high nibble, page size as power of two, byte offset in the low nibble */
+    wAddress = (uint16_t)(((uint16_t)(pValue[0] >> 4) << (pValue[2] & 0x0F)) + (pValue[0] & 0x0F));
+    wLength = (pValue[1] == 0) ? 256 : pValue[1];
+    if (bType == PHAL_TOP_T2T_TLV_LOCK_CTRL)
+    {
+        /* the size of lock areas is given in bits */
+        wLength = (uint16_t)((wLength + 7) >> 3);
+    }
+
+    /* only areas within the data area interrupt the TLVs */
+    if ((wAddress < (PHAL_TOP_T2T_DATA_PAGE * PHAL_TOP_T2T_PAGE_LENGTH)) ||
+        (pT2T->bNumReservedAreas == PHAL_TOP_T2T_MAX_RESERVED_AREAS))
+    {
+        return;
+    }
+    wAddress = (uint16_t)(wAddress - (PHAL_TOP_T2T_DATA_PAGE * PHAL_TOP_T2T_PAGE_LENGTH));
+    if (wAddress >= pT2T->wDataAreaSize)
+    {
+        return;
+    }
+
+    for (bIndex = pT2T->bNumReservedAreas; (bIndex > 0) && (pT2T->aReservedStart[bIndex - 1] > wAddress); --bIndex)
+    {
+        pT2T->aReservedStart[bIndex] = pT2T->aReservedStart[bIndex - 1];
+        pT2T->aReservedLength[bIndex] = pT2T->aReservedLength[bIndex - 1];
+    }
+    pT2T->aReservedStart[bIndex] = wAddress;
+    pT2T->aReservedLength[bIndex] = wLength;
+    ++pT2T->bNumReservedAreas;
+}
+
+#endif /* NXPBUILD__PHAL_TOP_SW */
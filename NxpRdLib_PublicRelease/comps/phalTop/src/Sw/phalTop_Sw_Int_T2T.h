@@ -0,0 +1,42 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Tag Operation Application Component, Type 2 Tag of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALTOP_SW_INT_T2T_H
+#define PHALTOP_SW_INT_T2T_H
+
+#include <ph_Status.h>
+
+/**
+* Read the NDEF message of a Type 2 Tag through the MIFARE Ultralight AL.
+*/
+phStatus_t phalTop_Sw_Int_T2TReadNdef(
+                                      phalTop_Sw_DataParams_t * pDataParams,
+                                      uint8_t * pBuffer,
+                                      uint16_t wBufferSize,
+                                      uint8_t ** ppNdef,
+                                      uint16_t * pNdefLength
+                                      );
+
+#endif /* PHALTOP_SW_INT_T2T_H */
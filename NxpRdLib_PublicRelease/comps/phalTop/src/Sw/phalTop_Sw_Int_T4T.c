@@ -0,0 +1,473 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software Tag Operation Application Component, Type 4 Tag of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phalTop.h>
+#include <phpalI14443p4.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHAL_TOP_SW
+
+#include <string.h>
+#include "phalTop_Sw_Int_T4T.h"
+
+#define PHAL_TOP_T4T_SW_LENGTH          2U      /**< Length of the status word of a response. */
+#define PHAL_TOP_T4T_EDC_LENGTH         2U      /**< Length of the CRC of an ISO14443-4 block. */
+#define PHAL_TOP_T4T_MIN_MLE            0x000FU /**< Smallest MLe a Capability Container may give. */
+#define PHAL_TOP_T4T_TLV_NDEF_FILE      0x04U   /**< Type of the NDEF File Control TLV. */
+#define PHAL_TOP_T4T_TLV_NDEF_LENGTH    0x06U   /**< Length of the NDEF File Control TLV. */
+#define PHAL_TOP_T4T_ACCESS_GRANTED     0x00U   /**< Access condition without security. */
+
+/** Frame sizes of ISO14443-4 by FSDI. */
+static const uint16_t PH_MEMLOC_CONST_ROM phalTop_Sw_Int_T4TFsTable[9] = {16, 24, 32, 40, 48, 64, 96, 128, 256};
+
+/** Name of the NDEF application of mapping version 2.0; version 1.0 ends with 0x00. */
+static const uint8_t PH_MEMLOC_CONST_ROM phalTop_Sw_Int_T4TNdefAid[7] = {0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01};
+
+static phStatus_t phalTop_Sw_Int_T4TCommand(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pCommand,
+    uint16_t wLength,
+    uint8_t ** ppData,
+    uint16_t * pDataLength
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TSelectApplication(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pSelectP2
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TSelectFile(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t bSelectP2,
+    uint16_t wFileId
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TReadBinary(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint16_t wOffset,
+    uint8_t bLe,
+    uint8_t ** ppData,
+    uint16_t * pDataLength
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TReadCc(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t bSelectP2,
+    phalTop_T4T_Cc_t * pCc
+    );
+
+static phalTop_T4T_Cc_t * phalTop_Sw_Int_T4TFindCc(
+    phalTop_T4T_t * pT4T
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TGetReadLength(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint16_t wMLe,
+    uint16_t * pReadLength
+    );
+
+static phStatus_t phalTop_Sw_Int_T4TDeliver(
+    uint8_t * pBuffer,
+    phalTop_NdefCallback_t pCallback,
+    void * pContext,
+    uint8_t * pData,
+    uint16_t wOffset,
+    uint16_t wLength
+    );
+
+phStatus_t phalTop_Sw_Int_T4TReadNdef(
+                                      phalTop_Sw_DataParams_t * pDataParams,
+                                      uint8_t * pBuffer,
+                                      uint16_t wBufferSize,
+                                      phalTop_NdefCallback_t pCallback,
+                                      void * pContext,
+                                      uint16_t * pNdefLength
+                                      )
+{
+    phStatus_t          PH_MEMLOC_REM statusTmp;
+    phStatus_t          PH_MEMLOC_REM status;
+    phalTop_T4T_t *     PH_MEMLOC_REM pT4T = &pDataParams->sT4T;
+    phalTop_T4T_Cc_t *  PH_MEMLOC_REM pCc;
+    phalTop_T4T_Cc_t    PH_MEMLOC_REM sCc;
+    uint8_t *           PH_MEMLOC_REM pData;
+    uint16_t            PH_MEMLOC_REM wDataLength;
+    uint16_t            PH_MEMLOC_REM wNlen;
+    uint16_t            PH_MEMLOC_REM wOffset;
+    uint16_t            PH_MEMLOC_REM wEnd;
+    uint16_t            PH_MEMLOC_REM wLe;
+    uint8_t             PH_MEMLOC_REM bSelectP2;
+
+    pT4T->bCcCached = PH_OFF;
+    pT4T->bVersion = 0;
+    pT4T->wReadLength = 0;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TSelectApplication(pDataParams, &bSelectP2));
+
+    /* the Capability Container of a known tag is not read again */
+    pCc = phalTop_Sw_Int_T4TFindCc(pT4T);
+    if (pCc != NULL)
+    {
+        pT4T->bCcCached = PH_ON;
+    }
+    else
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TReadCc(pDataParams, bSelectP2, &sCc));
+        pCc = &sCc;
+        if (pT4T->bUidLength != 0)
+        {
+            pCc = &pT4T->aCcCache[pT4T->bNextCcEntry];
+            pT4T->bNextCcEntry = (uint8_t)((pT4T->bNextCcEntry + 1) % PHAL_TOP_T4T_CC_CACHE_SIZE);
+            memcpy(pCc, &sCc, sizeof(phalTop_T4T_Cc_t));  /* PRQA S 3200 */
+            memcpy(pCc->aUid, pT4T->aUid, pT4T->bUidLength);  /* PRQA S 3200 */
+            pCc->bUidLength = pT4T->bUidLength;
+        }
+    }
+    pT4T->bVersion = pCc->bVersion;
+
+    if (pCc->bReadAccess != PHAL_TOP_T4T_ACCESS_GRANTED)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_AL_TOP);
+    }
+
+    status = phalTop_Sw_Int_T4TSelectFile(pDataParams, bSelectP2, pCc->wFileId);
+    if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        /* the tag has been formatted anew, read its Capability Container next time */
+        pCc->bUidLength = 0;
+        return status;
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TGetReadLength(pDataParams, pCc->wMLe, &pT4T->wReadLength));
+
+    /* the first READ BINARY returns NLEN together with the start of the message */
+    wLe = (pT4T->wReadLength < pCc->wMaxNdefSize) ? pT4T->wReadLength : pCc->wMaxNdefSize;
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TReadBinary(pDataParams, 0, (uint8_t)wLe, &pData, &wDataLength));
+    if (wDataLength < PHAL_TOP_T4T_NLEN_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_TOP);
+    }
+
+    wNlen = (uint16_t)(((uint16_t)pData[0] << 8) | pData[1]);
+    if (wNlen > (pCc->wMaxNdefSize - PHAL_TOP_T4T_NLEN_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_LENGTH_ERROR, PH_COMP_AL_TOP);
+    }
+    if ((pCallback == NULL) && (wNlen > wBufferSize))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_AL_TOP);
+    }
+
+    wEnd = PHAL_TOP_T4T_NLEN_LENGTH + wNlen;
+    if (wDataLength > wEnd)
+    {
+        wDataLength = wEnd;
+    }
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TDeliver(
+        pBuffer,
+        pCallback,
+        pContext,
+        &pData[PHAL_TOP_T4T_NLEN_LENGTH],
+        0,
+        wDataLength - PHAL_TOP_T4T_NLEN_LENGTH));
+    wOffset = wDataLength;
+
+    while (wOffset < wEnd)
+    {
+        wLe = ((wEnd - wOffset) < pT4T->wReadLength) ? (wEnd - wOffset) : pT4T->wReadLength;
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TReadBinary(pDataParams, wOffset, (uint8_t)wLe, &pData, &wDataLength));
+        PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TDeliver(
+            pBuffer,
+            pCallback,
+            pContext,
+            pData,
+            wOffset - PHAL_TOP_T4T_NLEN_LENGTH,
+            wDataLength));
+        wOffset = wOffset + wDataLength;
+    }
+
+    *pNdefLength = wNlen;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phStatus_t phalTop_Sw_Int_T4TCommand(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pCommand,
+    uint16_t wLength,
+    uint8_t ** ppData,
+    uint16_t * pDataLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pResponse;
+    uint16_t    PH_MEMLOC_REM wResponseLength;
+
+    pDataParams->wCommands++;
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_Exchange(
+        pDataParams->pPalI14443p4DataParams,
+        PH_EXCHANGE_DEFAULT,
+        pCommand,
+        wLength,
+        &pResponse,
+        &wResponseLength));
+
+    if (wResponseLength < PHAL_TOP_T4T_SW_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_TOP);
+    }
+    wResponseLength = wResponseLength - PHAL_TOP_T4T_SW_LENGTH;
+    if ((pResponse[wResponseLength] != 0x90) || (pResponse[wResponseLength + 1] != 0x00))
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_ISO7816, PH_COMP_AL_TOP);
+    }
+
+    *ppData = pResponse;
+    *pDataLength = wResponseLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phStatus_t phalTop_Sw_Int_T4TSelectApplication(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t * pSelectP2
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM aCommand[13];
+    uint8_t *   PH_MEMLOC_REM pData;
+    uint16_t    PH_MEMLOC_REM wDataLength;
+
+    aCommand[0] = 0x00;
+    aCommand[1] = 0xA4;
+    aCommand[2] = 0x04;
+    aCommand[3] = 0x00;
+    aCommand[4] = (uint8_t)sizeof(phalTop_Sw_Int_T4TNdefAid);
+    memcpy(&aCommand[5], phalTop_Sw_Int_T4TNdefAid, sizeof(phalTop_Sw_Int_T4TNdefAid));  /* PRQA S 3200 */
+    aCommand[12] = 0x00;
+
+    /* mapping version 2.0 selects files without FCI, version 1.0 has another name and no Le */
+    status = phalTop_Sw_Int_T4TCommand(pDataParams, aCommand, 13, &pData, &wDataLength);
+    *pSelectP2 = 0x0C;
+    if ((status & PH_ERR_MASK) == PHAL_TOP_ERR_ISO7816)
+    {
+        aCommand[11] = 0x00;
+        status = phalTop_Sw_Int_T4TCommand(pDataParams, aCommand, 12, &pData, &wDataLength);
+        *pSelectP2 = 0x00;
+    }
+    if ((status & PH_ERR_MASK) == PHAL_TOP_ERR_ISO7816)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NOT_FORMATTED, PH_COMP_AL_TOP);
+    }
+
+    return status;
+}
+
+static phStatus_t phalTop_Sw_Int_T4TSelectFile(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t bSelectP2,
+    uint16_t wFileId
+    )
+{
+    uint8_t     PH_MEMLOC_REM aCommand[7];
+    uint8_t *   PH_MEMLOC_REM pData;
+    uint16_t    PH_MEMLOC_REM wDataLength;
+
+    aCommand[0] = 0x00;
+    aCommand[1] = 0xA4;
+    aCommand[2] = 0x00;
+    aCommand[3] = bSelectP2;
+    aCommand[4] = 0x02;
+    aCommand[5] = (uint8_t)(wFileId >> 8);
+    aCommand[6] = (uint8_t)(wFileId);
+
+    return phalTop_Sw_Int_T4TCommand(pDataParams, aCommand, 7, &pData, &wDataLength);
+}
+
+static phStatus_t phalTop_Sw_Int_T4TReadBinary(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint16_t wOffset,
+    uint8_t bLe,
+    uint8_t ** ppData,
+    uint16_t * pDataLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aCommand[5];
+
+    aCommand[0] = 0x00;
+    aCommand[1] = 0xB0;
+    aCommand[2] = (uint8_t)(wOffset >> 8);
+    aCommand[3] = (uint8_t)(wOffset);
+    aCommand[4] = bLe;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TCommand(pDataParams, aCommand, 5, ppData, pDataLength));
+
+    /* an empty answer would never end the read */
+    if ((*pDataLength == 0) || (*pDataLength > bLe))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_AL_TOP);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phStatus_t phalTop_Sw_Int_T4TReadCc(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint8_t bSelectP2,
+    phalTop_T4T_Cc_t * pCc
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pData;
+    uint16_t    PH_MEMLOC_REM wDataLength;
+    uint16_t    PH_MEMLOC_REM wCcLength;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TSelectFile(pDataParams, bSelectP2, PHAL_TOP_T4T_CC_FILE_ID));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phalTop_Sw_Int_T4TReadBinary(pDataParams, 0, PHAL_TOP_T4T_CC_LENGTH, &pData, &wDataLength));
+
+    if (wDataLength != PHAL_TOP_T4T_CC_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NOT_FORMATTED, PH_COMP_AL_TOP);
+    }
+
+    wCcLength = (uint16_t)(((uint16_t)pData[0] << 8) | pData[1]);
+    if ((wCcLength < PHAL_TOP_T4T_CC_LENGTH) ||
+        (pData[7] != PHAL_TOP_T4T_TLV_NDEF_FILE) ||
+        (pData[8] != PHAL_TOP_T4T_TLV_NDEF_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NOT_FORMATTED, PH_COMP_AL_TOP);
+    }
+
+    memset(pCc, 0x00, sizeof(phalTop_T4T_Cc_t));  /* PRQA S 3200 */
+    pCc->bVersion       = pData[2];
+    pCc->wMLe           = (uint16_t)(((uint16_t)pData[3] << 8) | pData[4]);
+    pCc->wMLc           = (uint16_t)(((uint16_t)pData[5] << 8) | pData[6]);
+    pCc->wFileId        = (uint16_t)(((uint16_t)pData[9] << 8) | pData[10]);
+    pCc->wMaxNdefSize   = (uint16_t)(((uint16_t)pData[11] << 8) | pData[12]);
+    pCc->bReadAccess    = pData[13];
+    pCc->bWriteAccess   = pData[14];
+
+    /* version 3.0 addresses the file by ENLEN and extended offsets */
+    if (((pCc->bVersion >> 4) != 0x01) && ((pCc->bVersion >> 4) != 0x02))
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_UNSUPPORTED_VERSION, PH_COMP_AL_TOP);
+    }
+    if ((pCc->wMLe < PHAL_TOP_T4T_MIN_MLE) || (pCc->wMaxNdefSize < PHAL_TOP_T4T_NLEN_LENGTH))
+    {
+        return PH_ADD_COMPCODE(PHAL_TOP_ERR_NOT_FORMATTED, PH_COMP_AL_TOP);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phalTop_T4T_Cc_t * phalTop_Sw_Int_T4TFindCc(
+    phalTop_T4T_t * pT4T
+    )
+{
+    uint8_t PH_MEMLOC_COUNT bIndex;
+
+    if (pT4T->bUidLength == 0)
+    {
+        return NULL;
+    }
+
+    for (bIndex = 0; bIndex < PHAL_TOP_T4T_CC_CACHE_SIZE; ++bIndex)
+    {
+        if ((pT4T->aCcCache[bIndex].bUidLength == pT4T->bUidLength) &&
+            (memcmp(pT4T->aCcCache[bIndex].aUid, pT4T->aUid, pT4T->bUidLength) == 0))
+        {
+            return &pT4T->aCcCache[bIndex];
+        }
+    }
+
+    return NULL;
+}
+
+static phStatus_t phalTop_Sw_Int_T4TGetReadLength(
+    phalTop_Sw_DataParams_t * pDataParams,
+    uint16_t wMLe,
+    uint16_t * pReadLength
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wValue;
+    uint16_t    PH_MEMLOC_REM wFsd;
+    uint16_t    PH_MEMLOC_REM wOverhead = PHAL_TOP_T4T_EDC_LENGTH + PHAL_TOP_T4T_SW_LENGTH + 1;
+
+    /* the PAL collects a chained answer in the receive buffer of the HAL, which the FSD stands for;
+    the largest READ BINARY fitting into one I-block costs a single frame */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_FSI, &wValue));
+    wValue = wValue >> 8;
+    if (wValue > 8)
+    {
+        wValue = 8;
+    }
+    wFsd = phalTop_Sw_Int_T4TFsTable[wValue];
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_CID, &wValue));
+    if (wValue & 0xFF00)
+    {
+        wOverhead++;
+    }
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4_GetConfig(pDataParams->pPalI14443p4DataParams, PHPAL_I14443P4_CONFIG_NAD, &wValue));
+    if (wValue & 0xFF00)
+    {
+        wOverhead++;
+    }
+
+    *pReadLength = wFsd - wOverhead;
+    if (wMLe < *pReadLength)
+    {
+        *pReadLength = wMLe;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+static phStatus_t phalTop_Sw_Int_T4TDeliver(
+    uint8_t * pBuffer,
+    phalTop_NdefCallback_t pCallback,
+    void * pContext,
+    uint8_t * pData,
+    uint16_t wOffset,
+    uint16_t wLength
+    )
+{
+    if (wLength == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+    }
+    if (pCallback != NULL)
+    {
+        return pCallback(pContext, pData, wOffset, wLength);
+    }
+
+    memcpy(&pBuffer[wOffset], pData, wLength);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_AL_TOP);
+}
+
+#endif /* NXPBUILD__PHAL_TOP_SW */
@@ -0,0 +1,1194 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software LLCP Link Layer Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phlnLlcp.h>
+#include <phpalI18092mPI.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHLN_LLCP_SW
+
+#include <string.h>
+#include "phlnLlcp_Sw.h"
+#include "../phlnLlcp_Int.h"
+
+#define PHLN_LLCP_SW_STATE_CLOSED           0x00U   /**< Data link is not used. */
+#define PHLN_LLCP_SW_STATE_CONNECTING       0x01U   /**< CONNECT PDU sent, waiting for CC or DM. */
+#define PHLN_LLCP_SW_STATE_CONNECTED        0x02U   /**< Data link is established. */
+#define PHLN_LLCP_SW_STATE_DISCONNECTING    0x03U   /**< DISC PDU sent, waiting for DM. */
+
+#define PHLN_LLCP_SW_PENDING_NONE           0x00U   /**< No control PDU waiting. */
+#define PHLN_LLCP_SW_PENDING_CONNECT        0x01U   /**< CONNECT PDU waiting. */
+#define PHLN_LLCP_SW_PENDING_DISC           0x02U   /**< DISC PDU waiting. */
+#define PHLN_LLCP_SW_PENDING_DM             0x03U   /**< DM PDU answering a DISC PDU waiting. */
+
+static const uint8_t PH_MEMLOC_CONST_ROM aLlcp_Magic[PHLN_LLCP_MAGIC_LENGTH] = {0x46, 0x66, 0x6D};
+
+static phStatus_t phlnLlcp_Sw_Exchange(
+    phlnLlcp_Sw_DataParams_t * pDataParams
+    );
+
+static uint16_t phlnLlcp_Sw_BuildFrame(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t ** ppFrame
+    );
+
+static uint8_t * phlnLlcp_Sw_AppendPdu(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint16_t * pFramePos,
+    uint16_t wFrameLimit,
+    uint8_t bDsap,
+    uint8_t bPtype,
+    uint8_t bSsap,
+    uint16_t wPayloadLength
+    );
+
+static phStatus_t phlnLlcp_Sw_HandlePdu(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t * pPdu,
+    uint16_t wPduLength,
+    uint8_t * pActivity
+    );
+
+static phStatus_t phlnLlcp_Sw_ParseParams(
+    uint8_t * pParams,
+    uint16_t wParamsLength,
+    uint16_t * pMiu,
+    uint8_t * pRw,
+    uint8_t * pVersion,
+    uint16_t * pWks
+    );
+
+static phlnLlcp_Sw_Link_t * phlnLlcp_Sw_FindLink(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t bLocalSap,
+    uint8_t bRemoteSap
+    );
+
+static phStatus_t phlnLlcp_Sw_GetLink(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t bLink,
+    phlnLlcp_Sw_Link_t ** ppLink
+    );
+
+phStatus_t phlnLlcp_Sw_Init(
+                            phlnLlcp_Sw_DataParams_t * pDataParams,
+                            uint16_t wSizeOfDataParams,
+                            void * pPalI18092mPIDataParams,
+                            phlnLlcp_Sw_Link_t * pLinks,
+                            uint8_t bNumLinks,
+                            uint8_t * pFrameBuffer,
+                            uint16_t wFrameBufferSize
+                            )
+{
+    if (sizeof(phlnLlcp_Sw_DataParams_t) != wSizeOfDataParams)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_LN_LLCP);
+    }
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pPalI18092mPIDataParams);
+    PH_ASSERT_NULL (pLinks);
+    PH_ASSERT_NULL (pFrameBuffer);
+
+    /* The frame buffer has to hold an I PDU of the default MIU */
+    if ((bNumLinks == 0) ||
+        (wFrameBufferSize < (PHLN_LLCP_MIU_DEFAULT + PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH)))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+    }
+
+    /* init private data */
+    pDataParams->wId                        = PH_COMP_LN_LLCP | PHLN_LLCP_SW_ID;
+    pDataParams->pPalI18092mPIDataParams    = pPalI18092mPIDataParams;
+    pDataParams->pLinks                     = pLinks;
+    pDataParams->bNumLinks                  = (bNumLinks > PHLN_LLCP_MAX_LINKS) ? (uint8_t)PHLN_LLCP_MAX_LINKS : bNumLinks;
+    pDataParams->bNextLink                  = 0;
+    pDataParams->pFrameBuffer               = pFrameBuffer;
+    pDataParams->wFrameBufferSize           = wFrameBufferSize;
+    pDataParams->wRemoteLinkMiu             = PHLN_LLCP_MIU_DEFAULT;
+    pDataParams->wRemoteWks                 = 0;
+    pDataParams->bVersion                   = 0;
+    pDataParams->bActive                    = PH_OFF;
+    pDataParams->bMaxSymm                   = PHLN_LLCP_MAX_SYMM_DEFAULT;
+    pDataParams->bSymmCount                 = 0;
+    pDataParams->bConfigLink                = 0;
+    pDataParams->bDmPending                 = PH_OFF;
+
+    /* Largest information field an I PDU received into the frame buffer may carry */
+    pDataParams->wLocalLinkMiu = wFrameBufferSize - (PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH);
+    if (pDataParams->wLocalLinkMiu > (PHLN_LLCP_MIU_DEFAULT + PHLN_LLCP_MIUX_MAX))
+    {
+        pDataParams->wLocalLinkMiu = PHLN_LLCP_MIU_DEFAULT + PHLN_LLCP_MIUX_MAX;
+    }
+
+    memset(pLinks, 0x00, (size_t)pDataParams->bNumLinks * sizeof(phlnLlcp_Sw_Link_t));  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_GetGeneralBytes(
+                                       phlnLlcp_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pGi,
+                                       uint8_t * pGiLength
+                                       )
+{
+    uint16_t PH_MEMLOC_REM wMiux;
+    uint8_t  PH_MEMLOC_REM bLength = 0;
+
+    memcpy(pGi, aLlcp_Magic, PHLN_LLCP_MAGIC_LENGTH);  /* PRQA S 3200 */
+    bLength = PHLN_LLCP_MAGIC_LENGTH;
+
+    pGi[bLength++] = PHLN_LLCP_PARAM_VERSION;
+    pGi[bLength++] = 1;
+    pGi[bLength++] = PHLN_LLCP_VERSION;
+
+    /* Announce the link MIU only if it exceeds the default */
+    wMiux = pDataParams->wLocalLinkMiu - PHLN_LLCP_MIU_DEFAULT;
+    if (wMiux > 0)
+    {
+        pGi[bLength++] = PHLN_LLCP_PARAM_MIUX;
+        pGi[bLength++] = 2;
+        pGi[bLength++] = (uint8_t)(wMiux >> 8);
+        pGi[bLength++] = (uint8_t)(wMiux);
+    }
+
+    pGi[bLength++] = PHLN_LLCP_PARAM_WKS;
+    pGi[bLength++] = 2;
+    pGi[bLength++] = (uint8_t)(PHLN_LLCP_WKS_LINK >> 8);
+    pGi[bLength++] = (uint8_t)(PHLN_LLCP_WKS_LINK);
+
+    pGi[bLength++] = PHLN_LLCP_PARAM_OPT;
+    pGi[bLength++] = 1;
+    pGi[bLength++] = PHLN_LLCP_OPT_LSC_CO;
+
+    *pGiLength = bLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Activate(
+                                phlnLlcp_Sw_DataParams_t * pDataParams,
+                                uint8_t * pAtrRes,
+                                uint8_t bAtrResLength
+                                )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wMiu = PHLN_LLCP_MIU_DEFAULT;
+    uint16_t    PH_MEMLOC_REM wWks = PHLN_LLCP_WKS_LINK;
+    uint8_t     PH_MEMLOC_REM bVersion = 0;
+
+    pDataParams->bActive = PH_OFF;
+
+    /* General bytes have to start with the LLCP magic number */
+    if ((bAtrResLength < (PHLN_LLCP_ATR_RES_GT_POS + PHLN_LLCP_MAGIC_LENGTH)) ||
+        (memcmp(&pAtrRes[PHLN_LLCP_ATR_RES_GT_POS], aLlcp_Magic, PHLN_LLCP_MAGIC_LENGTH) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+    }
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_ParseParams(
+        &pAtrRes[PHLN_LLCP_ATR_RES_GT_POS + PHLN_LLCP_MAGIC_LENGTH],
+        (uint16_t)(bAtrResLength - (PHLN_LLCP_ATR_RES_GT_POS + PHLN_LLCP_MAGIC_LENGTH)),
+        &wMiu,
+        NULL,
+        &bVersion,
+        &wWks));
+
+    /* Only the same major version is compatible, the lower minor version is used. */
+    if ((bVersion & 0xF0U) != PHLN_LLCP_VERSION_MAJOR)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+    }
+    pDataParams->bVersion = (bVersion < PHLN_LLCP_VERSION) ? bVersion : PHLN_LLCP_VERSION;
+
+    pDataParams->wRemoteLinkMiu = wMiu;
+    pDataParams->wRemoteWks     = wWks;
+    pDataParams->bNextLink      = 0;
+    pDataParams->bSymmCount     = 0;
+    pDataParams->bDmPending     = PH_OFF;
+    pDataParams->bActive        = PH_ON;
+
+    memset(pDataParams->pLinks, 0x00, (size_t)pDataParams->bNumLinks * sizeof(phlnLlcp_Sw_Link_t));  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Deactivate(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    uint8_t     PH_MEMLOC_REM aDisc[PHLN_LLCP_HEADER_LENGTH];
+    uint16_t    PH_MEMLOC_REM wRxLength;
+
+    if (pDataParams->bActive == PH_OFF)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+    }
+
+    /* DISC between the link management SAPs deactivates the LLCP link */
+    aDisc[0] = PHLN_LLCP_HEADER0(PHLN_LLCP_SAP_LINK, PHLN_LLCP_PTYPE_DISC);
+    aDisc[1] = PHLN_LLCP_HEADER1(PHLN_LLCP_PTYPE_DISC, PHLN_LLCP_SAP_LINK);
+
+    pDataParams->bActive = PH_OFF;
+    memset(pDataParams->pLinks, 0x00, (size_t)pDataParams->bNumLinks * sizeof(phlnLlcp_Sw_Link_t));  /* PRQA S 3200 */
+
+    /* The response of the target is of no interest any more */
+    status = phpalI18092mPI_BulkExchange(
+        pDataParams->pPalI18092mPIDataParams,
+        aDisc,
+        PHLN_LLCP_HEADER_LENGTH,
+        pDataParams->pFrameBuffer,
+        pDataParams->wFrameBufferSize,
+        &wRxLength,
+        NULL);
+
+    if ((status & PH_ERR_MASK) == PH_ERR_BUFFER_OVERFLOW)
+    {
+        status = PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+    }
+
+    return status;
+}
+
+phStatus_t phlnLlcp_Sw_Connect(
+                               phlnLlcp_Sw_DataParams_t * pDataParams,
+                               uint8_t bDsap,
+                               uint8_t * pServiceName,
+                               uint8_t bServiceNameLength,
+                               uint8_t bRw,
+                               uint8_t * pRxBuffer,
+                               uint16_t wRxBufferSize,
+                               uint8_t * pLink
+                               )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLinkState;
+    uint16_t    PH_MEMLOC_REM wMiu;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    *pLink = PHLN_LLCP_NO_LINK;
+
+    /* Connections by name are requested from the service discovery SAP */
+    if (pServiceName != NULL)
+    {
+        bDsap = PHLN_LLCP_SAP_SDP;
+    }
+
+    if ((bDsap == PHLN_LLCP_SAP_LINK) ||
+        (bDsap > PHLN_LLCP_SAP_MAX) ||
+        (bRw == 0) ||
+        (bRw > PHLN_LLCP_RW_MAX))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+    }
+
+    /* Largest MIU the receive buffer allows for the requested window */
+    wMiu = (uint16_t)((wRxBufferSize / bRw) - 2);
+    if ((wRxBufferSize / bRw) < (PHLN_LLCP_MIU_DEFAULT + 2))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+    }
+    if (wMiu > pDataParams->wLocalLinkMiu)
+    {
+        wMiu = pDataParams->wLocalLinkMiu;
+    }
+
+    if (pDataParams->bActive == PH_OFF)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_LN_LLCP);
+    }
+
+    /* Search a free data link */
+    for (bIndex = 0; bIndex < pDataParams->bNumLinks; ++bIndex)
+    {
+        if ((pDataParams->pLinks[bIndex].bState == PHLN_LLCP_SW_STATE_CLOSED) &&
+            (pDataParams->pLinks[bIndex].bPending == PHLN_LLCP_SW_PENDING_NONE))
+        {
+            break;
+        }
+    }
+    if (bIndex == pDataParams->bNumLinks)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_LN_LLCP);
+    }
+
+    pLinkState = &pDataParams->pLinks[bIndex];
+    memset(pLinkState, 0x00, sizeof(phlnLlcp_Sw_Link_t));  /* PRQA S 3200 */
+    pLinkState->bState              = PHLN_LLCP_SW_STATE_CONNECTING;
+    pLinkState->bPending            = PHLN_LLCP_SW_PENDING_CONNECT;
+    pLinkState->bLocalSap           = (uint8_t)(PHLN_LLCP_SAP_FIRST_LOCAL + bIndex);
+    pLinkState->bRemoteSap          = bDsap;
+    pLinkState->bReason             = PHLN_LLCP_DM_NONE;
+    pLinkState->bLocalRw            = bRw;
+    pLinkState->wLocalMiu           = wMiu;
+    pLinkState->wRemoteMiu          = PHLN_LLCP_MIU_DEFAULT;
+    pLinkState->bRemoteRw           = 1;
+    pLinkState->pServiceName        = pServiceName;
+    pLinkState->bServiceNameLength  = (pServiceName != NULL) ? bServiceNameLength : 0;
+    pLinkState->pRxBuffer           = pRxBuffer;
+
+    /* Wait for CC or DM */
+    pDataParams->bSymmCount = 0;
+    do
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Exchange(pDataParams));
+
+        if (pDataParams->bSymmCount >= pDataParams->bMaxSymm)
+        {
+            pLinkState->bState = PHLN_LLCP_SW_STATE_CLOSED;
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_LN_LLCP);
+        }
+    }
+    while (pLinkState->bState == PHLN_LLCP_SW_STATE_CONNECTING);
+
+    if (pLinkState->bState != PHLN_LLCP_SW_STATE_CONNECTED)
+    {
+        return PH_ADD_COMPCODE(PHLN_LLCP_ERR_REJECTED, PH_COMP_LN_LLCP);
+    }
+
+    *pLink = bIndex;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Disconnect(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams,
+                                  uint8_t bLink
+                                  )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLinkState;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_GetLink(pDataParams, bLink, &pLinkState));
+
+    if ((pLinkState->bState == PHLN_LLCP_SW_STATE_CLOSED) || (pDataParams->bActive == PH_OFF))
+    {
+        pLinkState->bState = PHLN_LLCP_SW_STATE_CLOSED;
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+    }
+
+    /* Data which has not been sent yet is dropped */
+    pLinkState->bState      = PHLN_LLCP_SW_STATE_DISCONNECTING;
+    pLinkState->bPending    = PHLN_LLCP_SW_PENDING_DISC;
+    pLinkState->wTxLength   = 0;
+
+    /* Wait for DM */
+    pDataParams->bSymmCount = 0;
+    do
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Exchange(pDataParams));
+
+        if (pDataParams->bSymmCount >= pDataParams->bMaxSymm)
+        {
+            pLinkState->bState = PHLN_LLCP_SW_STATE_CLOSED;
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_LN_LLCP);
+        }
+    }
+    while (pLinkState->bState != PHLN_LLCP_SW_STATE_CLOSED);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Send(
+                            phlnLlcp_Sw_DataParams_t * pDataParams,
+                            uint8_t bLink,
+                            uint8_t * pData,
+                            uint16_t wDataLength
+                            )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLinkState;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_GetLink(pDataParams, bLink, &pLinkState));
+
+    if (pLinkState->bState != PHLN_LLCP_SW_STATE_CONNECTED)
+    {
+        return PH_ADD_COMPCODE(PHLN_LLCP_ERR_DISCONNECTED, PH_COMP_LN_LLCP);
+    }
+
+    if (pLinkState->wTxLength != 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_LN_LLCP);
+    }
+
+    pLinkState->pTxData     = pData;
+    pLinkState->wTxLength   = wDataLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Transceive(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams
+                                  )
+{
+    return phlnLlcp_Sw_Exchange(pDataParams);
+}
+
+phStatus_t phlnLlcp_Sw_Flush(
+                             phlnLlcp_Sw_DataParams_t * pDataParams,
+                             uint8_t bLink
+                             )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLinkState;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_GetLink(pDataParams, bLink, &pLinkState));
+
+    pDataParams->bSymmCount = 0;
+    while ((pLinkState->wTxLength != 0) || (pLinkState->bVsa != pLinkState->bVs))
+    {
+        if (pLinkState->bState != PHLN_LLCP_SW_STATE_CONNECTED)
+        {
+            return PH_ADD_COMPCODE(PHLN_LLCP_ERR_DISCONNECTED, PH_COMP_LN_LLCP);
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Exchange(pDataParams));
+
+        if (pDataParams->bSymmCount >= pDataParams->bMaxSymm)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_LN_LLCP);
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_Receive(
+                               phlnLlcp_Sw_DataParams_t * pDataParams,
+                               uint8_t bLink,
+                               uint8_t * pData,
+                               uint16_t wDataSize,
+                               uint16_t * pDataLength
+                               )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLinkState;
+    uint8_t *   PH_MEMLOC_REM pSlot;
+    uint16_t    PH_MEMLOC_REM wLength;
+
+    *pDataLength = 0;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_GetLink(pDataParams, bLink, &pLinkState));
+
+    pDataParams->bSymmCount = 0;
+    while (pLinkState->bRxCount == 0)
+    {
+        if (pLinkState->bState != PHLN_LLCP_SW_STATE_CONNECTED)
+        {
+            return PH_ADD_COMPCODE(PHLN_LLCP_ERR_DISCONNECTED, PH_COMP_LN_LLCP);
+        }
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_Exchange(pDataParams));
+
+        if (pDataParams->bSymmCount >= pDataParams->bMaxSymm)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_LN_LLCP);
+        }
+    }
+
+    /* Slots consist of a two byte length and the information field */
+    pSlot = &pLinkState->pRxBuffer[(uint16_t)pLinkState->bRxFirst * (pLinkState->wLocalMiu + 2)];
+    wLength = (uint16_t)(((uint16_t)pSlot[0] << 8) | pSlot[1]);
+
+    if (wLength > wDataSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_LN_LLCP);
+    }
+
+    memcpy(pData, &pSlot[2], wLength);  /* PRQA S 3200 */
+    *pDataLength = wLength;
+
+    /* Free the slot, the next frame acknowledges it */
+    pLinkState->bRxFirst = (uint8_t)((pLinkState->bRxFirst + 1) % pLinkState->bLocalRw);
+    --pLinkState->bRxCount;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_SetConfig(
+                                 phlnLlcp_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHLN_LLCP_CONFIG_MAX_SYMM:
+        if ((wValue == 0) || (wValue > 0xFF))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+        }
+        pDataParams->bMaxSymm = (uint8_t)wValue;
+        break;
+
+    case PHLN_LLCP_CONFIG_LINK:
+        if (wValue >= pDataParams->bNumLinks)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+        }
+        pDataParams->bConfigLink = (uint8_t)wValue;
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_LN_LLCP);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+phStatus_t phlnLlcp_Sw_GetConfig(
+                                 phlnLlcp_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 )
+{
+    switch (wConfig)
+    {
+    case PHLN_LLCP_CONFIG_MAX_SYMM:
+        *pValue = pDataParams->bMaxSymm;
+        break;
+
+    case PHLN_LLCP_CONFIG_LOCAL_MIU:
+        *pValue = pDataParams->wLocalLinkMiu;
+        break;
+
+    case PHLN_LLCP_CONFIG_REMOTE_MIU:
+        *pValue = pDataParams->wRemoteLinkMiu;
+        break;
+
+    case PHLN_LLCP_CONFIG_REMOTE_WKS:
+        *pValue = pDataParams->wRemoteWks;
+        break;
+
+    case PHLN_LLCP_CONFIG_VERSION:
+        *pValue = pDataParams->bVersion;
+        break;
+
+    case PHLN_LLCP_CONFIG_REASON:
+        *pValue = pDataParams->pLinks[pDataParams->bConfigLink].bReason;
+        break;
+
+    case PHLN_LLCP_CONFIG_LINK:
+        *pValue = pDataParams->bConfigLink;
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_LN_LLCP);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+static phStatus_t phlnLlcp_Sw_Exchange(
+                                       phlnLlcp_Sw_DataParams_t * pDataParams
+                                       )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t *   PH_MEMLOC_REM pFrame;
+    uint16_t    PH_MEMLOC_REM wFrameLength;
+    uint16_t    PH_MEMLOC_REM wRxLength;
+    uint16_t    PH_MEMLOC_REM wPos;
+    uint16_t    PH_MEMLOC_REM wPduLength;
+    uint8_t     PH_MEMLOC_REM bActivity;
+
+    if (pDataParams->bActive == PH_OFF)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_LN_LLCP);
+    }
+
+    wFrameLength = phlnLlcp_Sw_BuildFrame(pDataParams, &pFrame);
+
+    /* Anything but SYMM counts as activity */
+    bActivity = (PHLN_LLCP_GET_PTYPE(pFrame) != PHLN_LLCP_PTYPE_SYMM) ? PH_ON : PH_OFF;
+
+    /* The frame is sent completely before the response is written to the same buffer */
+    status = phpalI18092mPI_BulkExchange(
+        pDataParams->pPalI18092mPIDataParams,
+        pFrame,
+        wFrameLength,
+        pDataParams->pFrameBuffer,
+        pDataParams->wFrameBufferSize,
+        &wRxLength,
+        NULL);
+
+    /* The target sent more than its link MIU allows */
+    if ((status & PH_ERR_MASK) == PH_ERR_BUFFER_OVERFLOW)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+    }
+    PH_CHECK_SUCCESS(status);
+
+    pFrame = pDataParams->pFrameBuffer;
+    if (wRxLength < PHLN_LLCP_HEADER_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+    }
+
+    if (PHLN_LLCP_GET_PTYPE(pFrame) == PHLN_LLCP_PTYPE_AGF)
+    {
+        /* Each aggregated PDU is preceded by its length */
+        wPos = PHLN_LLCP_HEADER_LENGTH;
+        while (wPos < wRxLength)
+        {
+            if ((wPos + PHLN_LLCP_AGF_LENGTH_SIZE) > wRxLength)
+            {
+                return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+            }
+
+            wPduLength = (uint16_t)(((uint16_t)pFrame[wPos] << 8) | pFrame[wPos + 1]);
+            wPos = wPos + PHLN_LLCP_AGF_LENGTH_SIZE;
+
+            /* Aggregated frames must not be nested */
+            if ((wPduLength < PHLN_LLCP_HEADER_LENGTH) ||
+                ((wPos + wPduLength) > wRxLength) ||
+                (PHLN_LLCP_GET_PTYPE(&pFrame[wPos]) == PHLN_LLCP_PTYPE_AGF))
+            {
+                return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+            }
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_HandlePdu(pDataParams, &pFrame[wPos], wPduLength, &bActivity));
+            wPos = wPos + wPduLength;
+        }
+    }
+    else
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_HandlePdu(pDataParams, pFrame, wRxLength, &bActivity));
+    }
+
+    if (pDataParams->bActive == PH_OFF)
+    {
+        return PH_ADD_COMPCODE(PHLN_LLCP_ERR_DEACTIVATED, PH_COMP_LN_LLCP);
+    }
+
+    if (bActivity == PH_OFF)
+    {
+        if (pDataParams->bSymmCount < 0xFF)
+        {
+            ++pDataParams->bSymmCount;
+        }
+    }
+    else
+    {
+        pDataParams->bSymmCount = 0;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+static uint16_t phlnLlcp_Sw_BuildFrame(
+                                       phlnLlcp_Sw_DataParams_t * pDataParams,
+                                       uint8_t ** ppFrame
+                                       )
+{
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLink;
+    uint8_t *   PH_MEMLOC_REM pFrame = pDataParams->pFrameBuffer;
+    uint8_t *   PH_MEMLOC_REM pPayload;
+    uint16_t    PH_MEMLOC_REM wFrameLimit;
+    uint16_t    PH_MEMLOC_REM wFramePos;
+    uint16_t    PH_MEMLOC_REM wLength;
+    uint16_t    PH_MEMLOC_REM wMiux;
+    uint8_t     PH_MEMLOC_REM bNumPdus = 0;
+    uint8_t     PH_MEMLOC_REM bNr;
+    uint8_t     PH_MEMLOC_REM bFull = PH_OFF;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    /* The information field of the AGF PDU is limited by the link MIU of the target. */
+    wFrameLimit = PHLN_LLCP_HEADER_LENGTH + pDataParams->wRemoteLinkMiu;
+    if (wFrameLimit > pDataParams->wFrameBufferSize)
+    {
+        wFrameLimit = pDataParams->wFrameBufferSize;
+    }
+
+    /* Leave space for the AGF header */
+    wFramePos = PHLN_LLCP_HEADER_LENGTH;
+
+    /* Answer to a PDU for which no data link exists */
+    if (pDataParams->bDmPending != PH_OFF)
+    {
+        pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+            pDataParams->bDmDsap, PHLN_LLCP_PTYPE_DM, pDataParams->bDmSsap, 1);
+        pPayload[0] = pDataParams->bDmReason;
+        pDataParams->bDmPending = PH_OFF;
+        ++bNumPdus;
+    }
+
+    /* Serve the data links round robin, so every one gets its share of the frame */
+    for (bIndex = 0; (bIndex < pDataParams->bNumLinks) && (bFull == PH_OFF); ++bIndex)
+    {
+        pLink = &pDataParams->pLinks[(pDataParams->bNextLink + bIndex) % pDataParams->bNumLinks];
+
+        if (pLink->bPending == PHLN_LLCP_SW_PENDING_CONNECT)
+        {
+            /* MIUX and RW parameters, and the service name if present */
+            wLength = 4 + 3 + ((pLink->pServiceName != NULL) ? (2 + (uint16_t)pLink->bServiceNameLength) : 0);
+
+            pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+                pLink->bRemoteSap, PHLN_LLCP_PTYPE_CONNECT, pLink->bLocalSap, wLength);
+            if (pPayload == NULL)
+            {
+                bFull = PH_ON;
+                continue;
+            }
+
+            wMiux = pLink->wLocalMiu - PHLN_LLCP_MIU_DEFAULT;
+            pPayload[0] = PHLN_LLCP_PARAM_MIUX;
+            pPayload[1] = 2;
+            pPayload[2] = (uint8_t)(wMiux >> 8);
+            pPayload[3] = (uint8_t)(wMiux);
+            pPayload[4] = PHLN_LLCP_PARAM_RW;
+            pPayload[5] = 1;
+            pPayload[6] = pLink->bLocalRw;
+            if (pLink->pServiceName != NULL)
+            {
+                pPayload[7] = PHLN_LLCP_PARAM_SN;
+                pPayload[8] = pLink->bServiceNameLength;
+                memcpy(&pPayload[9], pLink->pServiceName, pLink->bServiceNameLength);  /* PRQA S 3200 */
+            }
+
+            pLink->bPending = PHLN_LLCP_SW_PENDING_NONE;
+            ++bNumPdus;
+        }
+        else if (pLink->bPending == PHLN_LLCP_SW_PENDING_DISC)
+        {
+            pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+                pLink->bRemoteSap, PHLN_LLCP_PTYPE_DISC, pLink->bLocalSap, 0);
+            if (pPayload == NULL)
+            {
+                bFull = PH_ON;
+                continue;
+            }
+
+            pLink->bPending = PHLN_LLCP_SW_PENDING_NONE;
+            ++bNumPdus;
+        }
+        else if (pLink->bPending == PHLN_LLCP_SW_PENDING_DM)
+        {
+            pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+                pLink->bRemoteSap, PHLN_LLCP_PTYPE_DM, pLink->bLocalSap, 1);
+            if (pPayload == NULL)
+            {
+                bFull = PH_ON;
+                continue;
+            }
+
+            pPayload[0] = PHLN_LLCP_DM_DISC;
+            pLink->bPending = PHLN_LLCP_SW_PENDING_NONE;
+            ++bNumPdus;
+        }
+
+        if (pLink->bState != PHLN_LLCP_SW_STATE_CONNECTED)
+        {
+            continue;
+        }
+
+        /* Only information units the application has taken out of the receive window are acknowledged */
+        bNr = (uint8_t)((pLink->bVr - pLink->bRxCount) & PHLN_LLCP_SEQUENCE_MASK);
+
+        /* Send I PDUs as long as the receive window of the remote side is not full */
+        while ((pLink->wTxLength != 0) &&
+            (pLink->bRemoteBusy == PH_OFF) &&
+            (((pLink->bVs - pLink->bVsa) & PHLN_LLCP_SEQUENCE_MASK) < pLink->bRemoteRw))
+        {
+            /* Fill the frame, the last I PDU may be shorter than the MIU */
+            if ((wFramePos + PHLN_LLCP_AGF_LENGTH_SIZE + PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH) >= wFrameLimit)
+            {
+                bFull = PH_ON;
+                break;
+            }
+            wLength = wFrameLimit - (wFramePos + PHLN_LLCP_AGF_LENGTH_SIZE + PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH);
+            if (wLength > pLink->wRemoteMiu)
+            {
+                wLength = pLink->wRemoteMiu;
+            }
+            if (wLength > pLink->wTxLength)
+            {
+                wLength = pLink->wTxLength;
+            }
+
+            pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+                pLink->bRemoteSap, PHLN_LLCP_PTYPE_I, pLink->bLocalSap, PHLN_LLCP_SEQUENCE_LENGTH + wLength);
+
+            pPayload[0] = (uint8_t)((pLink->bVs << 4) | bNr);
+            memcpy(&pPayload[1], pLink->pTxData, wLength);  /* PRQA S 3200 */
+
+            pLink->pTxData += wLength;
+            pLink->wTxLength = pLink->wTxLength - wLength;
+            pLink->bVs = (uint8_t)((pLink->bVs + 1) & PHLN_LLCP_SEQUENCE_MASK);
+            pLink->bVra = bNr;
+            ++bNumPdus;
+        }
+
+        /* Acknowledge without I PDU */
+        if ((bNr != pLink->bVra) && (bFull == PH_OFF))
+        {
+            pPayload = phlnLlcp_Sw_AppendPdu(pDataParams, &wFramePos, wFrameLimit,
+                pLink->bRemoteSap, PHLN_LLCP_PTYPE_RR, pLink->bLocalSap, PHLN_LLCP_SEQUENCE_LENGTH);
+            if (pPayload == NULL)
+            {
+                bFull = PH_ON;
+                continue;
+            }
+
+            pPayload[0] = bNr;
+            pLink->bVra = bNr;
+            ++bNumPdus;
+        }
+    }
+
+    pDataParams->bNextLink = (uint8_t)((pDataParams->bNextLink + 1) % pDataParams->bNumLinks);
+
+    /* Nothing to send */
+    if (bNumPdus == 0)
+    {
+        pFrame[0] = PHLN_LLCP_HEADER0(PHLN_LLCP_SAP_LINK, PHLN_LLCP_PTYPE_SYMM);
+        pFrame[1] = PHLN_LLCP_HEADER1(PHLN_LLCP_PTYPE_SYMM, PHLN_LLCP_SAP_LINK);
+        *ppFrame = pFrame;
+        return PHLN_LLCP_HEADER_LENGTH;
+    }
+
+    /* A single PDU is sent without aggregation */
+    if (bNumPdus == 1)
+    {
+        *ppFrame = &pFrame[PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_AGF_LENGTH_SIZE];
+        return wFramePos - (PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_AGF_LENGTH_SIZE);
+    }
+
+    pFrame[0] = PHLN_LLCP_HEADER0(PHLN_LLCP_SAP_LINK, PHLN_LLCP_PTYPE_AGF);
+    pFrame[1] = PHLN_LLCP_HEADER1(PHLN_LLCP_PTYPE_AGF, PHLN_LLCP_SAP_LINK);
+    *ppFrame = pFrame;
+    return wFramePos;
+}
+
+static uint8_t * phlnLlcp_Sw_AppendPdu(
+                                       phlnLlcp_Sw_DataParams_t * pDataParams,
+                                       uint16_t * pFramePos,
+                                       uint16_t wFrameLimit,
+                                       uint8_t bDsap,
+                                       uint8_t bPtype,
+                                       uint8_t bSsap,
+                                       uint16_t wPayloadLength
+                                       )
+{
+    uint8_t * PH_MEMLOC_REM pPdu;
+    uint16_t  PH_MEMLOC_REM wPduLength = PHLN_LLCP_HEADER_LENGTH + wPayloadLength;
+
+    if ((*pFramePos + PHLN_LLCP_AGF_LENGTH_SIZE + wPduLength) > wFrameLimit)
+    {
+        return NULL;
+    }
+
+    pPdu = &pDataParams->pFrameBuffer[*pFramePos];
+    pPdu[0] = (uint8_t)(wPduLength >> 8);
+    pPdu[1] = (uint8_t)(wPduLength);
+    pPdu[2] = PHLN_LLCP_HEADER0(bDsap, bPtype);
+    pPdu[3] = PHLN_LLCP_HEADER1(bPtype, bSsap);
+
+    *pFramePos = *pFramePos + PHLN_LLCP_AGF_LENGTH_SIZE + wPduLength;
+
+    return &pPdu[PHLN_LLCP_AGF_LENGTH_SIZE + PHLN_LLCP_HEADER_LENGTH];
+}
+
+static phStatus_t phlnLlcp_Sw_HandlePdu(
+                                        phlnLlcp_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pPdu,
+                                        uint16_t wPduLength,
+                                        uint8_t * pActivity
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLink;
+    uint8_t     PH_MEMLOC_REM bDsap = PHLN_LLCP_GET_DSAP(pPdu);
+    uint8_t     PH_MEMLOC_REM bPtype = PHLN_LLCP_GET_PTYPE(pPdu);
+    uint8_t     PH_MEMLOC_REM bSsap = PHLN_LLCP_GET_SSAP(pPdu);
+    uint8_t     PH_MEMLOC_REM bNs;
+    uint8_t     PH_MEMLOC_REM bNr;
+    uint8_t *   PH_MEMLOC_REM pSlot;
+    uint16_t    PH_MEMLOC_REM wLength;
+    uint16_t    PH_MEMLOC_REM wMiu;
+    uint8_t     PH_MEMLOC_REM bRw;
+
+    if (bPtype != PHLN_LLCP_PTYPE_SYMM)
+    {
+        *pActivity = PH_ON;
+    }
+
+    switch (bPtype)
+    {
+    case PHLN_LLCP_PTYPE_CONNECT:
+        /* No service is offered on this side */
+        pDataParams->bDmPending = PH_ON;
+        pDataParams->bDmDsap    = bSsap;
+        pDataParams->bDmSsap    = bDsap;
+        pDataParams->bDmReason  = PHLN_LLCP_DM_REJECTED;
+        break;
+
+    case PHLN_LLCP_PTYPE_DISC:
+        /* DISC between the link management SAPs deactivates the LLCP link */
+        if ((bDsap == PHLN_LLCP_SAP_LINK) && (bSsap == PHLN_LLCP_SAP_LINK))
+        {
+            pDataParams->bActive = PH_OFF;
+            memset(pDataParams->pLinks, 0x00, (size_t)pDataParams->bNumLinks * sizeof(phlnLlcp_Sw_Link_t));  /* PRQA S 3200 */
+            break;
+        }
+
+        /* The DM PDU is sent by the data link, so several DISC PDUs within one frame are all answered */
+        pLink = phlnLlcp_Sw_FindLink(pDataParams, bDsap, bSsap);
+        if (pLink == NULL)
+        {
+            pDataParams->bDmPending = PH_ON;
+            pDataParams->bDmDsap    = bSsap;
+            pDataParams->bDmSsap    = bDsap;
+            pDataParams->bDmReason  = PHLN_LLCP_DM_NO_CONNECTION;
+            break;
+        }
+
+        pLink->bState   = PHLN_LLCP_SW_STATE_CLOSED;
+        pLink->bPending = PHLN_LLCP_SW_PENDING_DM;
+        pLink->bReason  = PHLN_LLCP_DM_DISC;
+        break;
+
+    case PHLN_LLCP_PTYPE_CC:
+        /* A connection by name is completed by the SAP of the service */
+        pLink = phlnLlcp_Sw_FindLink(pDataParams, bDsap, PHLN_LLCP_SAP_MAX + 1);
+        if ((pLink == NULL) || (pLink->bState != PHLN_LLCP_SW_STATE_CONNECTING))
+        {
+            break;
+        }
+
+        wMiu = PHLN_LLCP_MIU_DEFAULT;
+        bRw = 1;
+        PH_CHECK_SUCCESS_FCT(statusTmp, phlnLlcp_Sw_ParseParams(
+            &pPdu[PHLN_LLCP_HEADER_LENGTH],
+            wPduLength - PHLN_LLCP_HEADER_LENGTH,
+            &wMiu,
+            &bRw,
+            NULL,
+            NULL));
+
+        pLink->bRemoteSap   = bSsap;
+        pLink->wRemoteMiu   = wMiu;
+        pLink->bRemoteRw    = bRw;
+        pLink->bState       = PHLN_LLCP_SW_STATE_CONNECTED;
+        break;
+
+    case PHLN_LLCP_PTYPE_DM:
+        pLink = phlnLlcp_Sw_FindLink(pDataParams, bDsap, PHLN_LLCP_SAP_MAX + 1);
+        if ((pLink != NULL) &&
+            ((pLink->bState == PHLN_LLCP_SW_STATE_CONNECTING) || (pLink->bRemoteSap == bSsap)))
+        {
+            pLink->bState   = PHLN_LLCP_SW_STATE_CLOSED;
+            pLink->bPending = PHLN_LLCP_SW_PENDING_NONE;
+            pLink->bReason  = (wPduLength > PHLN_LLCP_HEADER_LENGTH) ? pPdu[PHLN_LLCP_HEADER_LENGTH] : PHLN_LLCP_DM_NONE;
+        }
+        break;
+
+    case PHLN_LLCP_PTYPE_FRMR:
+        pLink = phlnLlcp_Sw_FindLink(pDataParams, bDsap, bSsap);
+        if (pLink != NULL)
+        {
+            pLink->bState   = PHLN_LLCP_SW_STATE_CLOSED;
+            pLink->bPending = PHLN_LLCP_SW_PENDING_NONE;
+            pLink->bReason  = PHLN_LLCP_DM_NONE;
+        }
+        break;
+
+    case PHLN_LLCP_PTYPE_I:
+    case PHLN_LLCP_PTYPE_RR:
+    case PHLN_LLCP_PTYPE_RNR:
+        pLink = phlnLlcp_Sw_FindLink(pDataParams, bDsap, bSsap);
+        if ((pLink == NULL) || (pLink->bState != PHLN_LLCP_SW_STATE_CONNECTED))
+        {
+            pDataParams->bDmPending = PH_ON;
+            pDataParams->bDmDsap    = bSsap;
+            pDataParams->bDmSsap    = bDsap;
+            pDataParams->bDmReason  = PHLN_LLCP_DM_NO_CONNECTION;
+            break;
+        }
+
+        if (wPduLength < (PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+        }
+
+        bNs = pPdu[PHLN_LLCP_HEADER_LENGTH] >> 4;
+        bNr = pPdu[PHLN_LLCP_HEADER_LENGTH] & PHLN_LLCP_SEQUENCE_MASK;
+
+        /* N(R) has to acknowledge I PDUs which have been sent */
+        if (((bNr - pLink->bVsa) & PHLN_LLCP_SEQUENCE_MASK) > ((pLink->bVs - pLink->bVsa) & PHLN_LLCP_SEQUENCE_MASK))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+        }
+        pLink->bVsa = bNr;
+
+        if (bPtype != PHLN_LLCP_PTYPE_I)
+        {
+            pLink->bRemoteBusy = (bPtype == PHLN_LLCP_PTYPE_RNR) ? PH_ON : PH_OFF;
+            break;
+        }
+
+        /* I PDUs have to arrive in sequence, within the receive window and within the MIU */
+        wLength = wPduLength - (PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH);
+        if ((bNs != pLink->bVr) ||
+            (pLink->bRxCount >= pLink->bLocalRw) ||
+            (wLength > pLink->wLocalMiu))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+        }
+
+        pSlot = &pLink->pRxBuffer[(uint16_t)((pLink->bRxFirst + pLink->bRxCount) % pLink->bLocalRw) * (pLink->wLocalMiu + 2)];
+        pSlot[0] = (uint8_t)(wLength >> 8);
+        pSlot[1] = (uint8_t)(wLength);
+        memcpy(&pSlot[2], &pPdu[PHLN_LLCP_HEADER_LENGTH + PHLN_LLCP_SEQUENCE_LENGTH], wLength);  /* PRQA S 3200 */
+
+        ++pLink->bRxCount;
+        pLink->bVr = (uint8_t)((pLink->bVr + 1) & PHLN_LLCP_SEQUENCE_MASK);
+        break;
+
+    default:
+        /* SYMM, PAX, UI and SNL need no action */
+        break;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+static phStatus_t phlnLlcp_Sw_ParseParams(
+    uint8_t * pParams,
+    uint16_t wParamsLength,
+    uint16_t * pMiu,
+    uint8_t * pRw,
+    uint8_t * pVersion,
+    uint16_t * pWks
+    )
+{
+    uint16_t PH_MEMLOC_REM wPos = 0;
+    uint8_t  PH_MEMLOC_REM bType;
+    uint8_t  PH_MEMLOC_REM bLength;
+
+    while (wPos < wParamsLength)
+    {
+        if ((wPos + 2) > wParamsLength)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+        }
+
+        bType   = pParams[wPos];
+        bLength = pParams[wPos + 1];
+        wPos    = wPos + 2;
+
+        if ((wPos + bLength) > wParamsLength)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_LN_LLCP);
+        }
+
+        /* Unknown parameters and parameters of unexpected length are ignored */
+        switch (bType)
+        {
+        case PHLN_LLCP_PARAM_VERSION:
+            if ((pVersion != NULL) && (bLength == 1))
+            {
+                *pVersion = pParams[wPos];
+            }
+            break;
+
+        case PHLN_LLCP_PARAM_MIUX:
+            if ((pMiu != NULL) && (bLength == 2))
+            {
+                *pMiu = PHLN_LLCP_MIU_DEFAULT + ((((uint16_t)pParams[wPos] << 8) | pParams[wPos + 1]) & PHLN_LLCP_MIUX_MAX);
+            }
+            break;
+
+        case PHLN_LLCP_PARAM_WKS:
+            if ((pWks != NULL) && (bLength == 2))
+            {
+                *pWks = (uint16_t)(((uint16_t)pParams[wPos] << 8) | pParams[wPos + 1]);
+            }
+            break;
+
+        case PHLN_LLCP_PARAM_RW:
+            if ((pRw != NULL) && (bLength == 1))
+            {
+                *pRw = pParams[wPos] & PHLN_LLCP_SEQUENCE_MASK;
+            }
+            break;
+
+        default:
+            break;
+        }
+
+        wPos = wPos + bLength;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+static phlnLlcp_Sw_Link_t * phlnLlcp_Sw_FindLink(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t bLocalSap,
+    uint8_t bRemoteSap
+    )
+{
+    phlnLlcp_Sw_Link_t * PH_MEMLOC_REM pLink;
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    /* Local SAPs are assigned by data link index */
+    if ((bLocalSap < PHLN_LLCP_SAP_FIRST_LOCAL) ||
+        ((bLocalSap - PHLN_LLCP_SAP_FIRST_LOCAL) >= pDataParams->bNumLinks))
+    {
+        return NULL;
+    }
+
+    bIndex = bLocalSap - PHLN_LLCP_SAP_FIRST_LOCAL;
+    pLink = &pDataParams->pLinks[bIndex];
+
+    /* A remote SAP beyond the valid range matches any remote SAP */
+    if ((pLink->bState == PHLN_LLCP_SW_STATE_CLOSED) ||
+        ((bRemoteSap <= PHLN_LLCP_SAP_MAX) && (pLink->bRemoteSap != bRemoteSap)))
+    {
+        return NULL;
+    }
+
+    return pLink;
+}
+
+static phStatus_t phlnLlcp_Sw_GetLink(
+    phlnLlcp_Sw_DataParams_t * pDataParams,
+    uint8_t bLink,
+    phlnLlcp_Sw_Link_t ** ppLink
+    )
+{
+    if (bLink >= pDataParams->bNumLinks)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_LN_LLCP);
+    }
+
+    *ppLink = &pDataParams->pLinks[bLink];
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_LN_LLCP);
+}
+
+#endif /* NXPBUILD__PHLN_LLCP_SW */
@@ -0,0 +1,99 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Software LLCP Link Layer Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHLNLLCP_SW_H
+#define PHLNLLCP_SW_H
+
+#include <ph_Status.h>
+
+phStatus_t phlnLlcp_Sw_GetGeneralBytes(
+                                       phlnLlcp_Sw_DataParams_t * pDataParams,
+                                       uint8_t * pGi,
+                                       uint8_t * pGiLength
+                                       );
+
+phStatus_t phlnLlcp_Sw_Activate(
+                                phlnLlcp_Sw_DataParams_t * pDataParams,
+                                uint8_t * pAtrRes,
+                                uint8_t bAtrResLength
+                                );
+
+phStatus_t phlnLlcp_Sw_Deactivate(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams
+                                  );
+
+phStatus_t phlnLlcp_Sw_Connect(
+                               phlnLlcp_Sw_DataParams_t * pDataParams,
+                               uint8_t bDsap,
+                               uint8_t * pServiceName,
+                               uint8_t bServiceNameLength,
+                               uint8_t bRw,
+                               uint8_t * pRxBuffer,
+                               uint16_t wRxBufferSize,
+                               uint8_t * pLink
+                               );
+
+phStatus_t phlnLlcp_Sw_Disconnect(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams,
+                                  uint8_t bLink
+                                  );
+
+phStatus_t phlnLlcp_Sw_Send(
+                            phlnLlcp_Sw_DataParams_t * pDataParams,
+                            uint8_t bLink,
+                            uint8_t * pData,
+                            uint16_t wDataLength
+                            );
+
+phStatus_t phlnLlcp_Sw_Transceive(
+                                  phlnLlcp_Sw_DataParams_t * pDataParams
+                                  );
+
+phStatus_t phlnLlcp_Sw_Flush(
+                             phlnLlcp_Sw_DataParams_t * pDataParams,
+                             uint8_t bLink
+                             );
+
+phStatus_t phlnLlcp_Sw_Receive(
+                               phlnLlcp_Sw_DataParams_t * pDataParams,
+                               uint8_t bLink,
+                               uint8_t * pData,
+                               uint16_t wDataSize,
+                               uint16_t * pDataLength
+                               );
+
+phStatus_t phlnLlcp_Sw_SetConfig(
+                                 phlnLlcp_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t wValue
+                                 );
+
+phStatus_t phlnLlcp_Sw_GetConfig(
+                                 phlnLlcp_Sw_DataParams_t * pDataParams,
+                                 uint16_t wConfig,
+                                 uint16_t * pValue
+                                 );
+
+#endif /* PHLNLLCP_SW_H */
@@ -0,0 +1,96 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal definitions of the LLCP Link Layer Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHLNLLCP_INT_H
+#define PHLNLLCP_INT_H
+
+#include <ph_Status.h>
+
+/** \addtogroup ph_Private
+* @{
+*/
+
+/** Build the first header byte of a PDU. */
+#define PHLN_LLCP_HEADER0(bDsap, bPtype)    ((uint8_t)(((bDsap) << 2) | ((bPtype) >> 2)))
+/** Build the second header byte of a PDU. */
+#define PHLN_LLCP_HEADER1(bPtype, bSsap)    ((uint8_t)((((bPtype) & 0x03U) << 6) | (bSsap)))
+/** Retrieve DSAP from a PDU header. */
+#define PHLN_LLCP_GET_DSAP(pPdu)            ((uint8_t)((pPdu)[0] >> 2))
+/** Retrieve PTYPE from a PDU header. */
+#define PHLN_LLCP_GET_PTYPE(pPdu)           ((uint8_t)((((pPdu)[0] & 0x03U) << 2) | ((pPdu)[1] >> 6)))
+/** Retrieve SSAP from a PDU header. */
+#define PHLN_LLCP_GET_SSAP(pPdu)            ((uint8_t)((pPdu)[1] & 0x3FU))
+
+#define PHLN_LLCP_PTYPE_SYMM        0x00U   /**< Symmetry PDU. */
+#define PHLN_LLCP_PTYPE_PAX         0x01U   /**< Parameter exchange PDU. */
+#define PHLN_LLCP_PTYPE_AGF         0x02U   /**< Aggregated frame PDU. */
+#define PHLN_LLCP_PTYPE_UI          0x03U   /**< Unnumbered information PDU. */
+#define PHLN_LLCP_PTYPE_CONNECT     0x04U   /**< Connect PDU. */
+#define PHLN_LLCP_PTYPE_DISC        0x05U   /**< Disconnect PDU. */
+#define PHLN_LLCP_PTYPE_CC          0x06U   /**< Connection complete PDU. */
+#define PHLN_LLCP_PTYPE_DM          0x07U   /**< Disconnected mode PDU. */
+#define PHLN_LLCP_PTYPE_FRMR        0x08U   /**< Frame reject PDU. */
+#define PHLN_LLCP_PTYPE_SNL         0x09U   /**< Service name lookup PDU. */
+#define PHLN_LLCP_PTYPE_I           0x0CU   /**< Information PDU. */
+#define PHLN_LLCP_PTYPE_RR          0x0DU   /**< Receive ready PDU. */
+#define PHLN_LLCP_PTYPE_RNR         0x0EU   /**< Receive not ready PDU. */
+
+#define PHLN_LLCP_PARAM_VERSION     0x01U   /**< Version number parameter. */
+#define PHLN_LLCP_PARAM_MIUX        0x02U   /**< Maximum information unit extension parameter. */
+#define PHLN_LLCP_PARAM_WKS         0x03U   /**< Well-known service list parameter. */
+#define PHLN_LLCP_PARAM_LTO         0x04U   /**< Link timeout parameter. */
+#define PHLN_LLCP_PARAM_RW          0x05U   /**< Receive window size parameter. */
+#define PHLN_LLCP_PARAM_SN          0x06U   /**< Service name parameter. */
+#define PHLN_LLCP_PARAM_OPT         0x07U   /**< Option parameter. */
+
+#define PHLN_LLCP_VERSION           0x11U   /**< Supported LLCP version 1.1. */
+#define PHLN_LLCP_VERSION_MAJOR     0x10U   /**< Supported major version in the upper nibble. */
+#define PHLN_LLCP_WKS_LINK          0x0001U /**< Well-known service of the LLC link management. */
+#define PHLN_LLCP_OPT_LSC_CO        0x02U   /**< Link service class 2, connection-oriented transport only. */
+#define PHLN_LLCP_MIUX_MAX          0x07FFU /**< Largest MIU extension. */
+
+#define PHLN_LLCP_SAP_LINK          0x00U   /**< Service access point of the LLC link management. */
+#define PHLN_LLCP_SAP_FIRST_LOCAL   0x20U   /**< First service access point used for outgoing connections. */
+
+#define PHLN_LLCP_DM_DISC           0x00U   /**< DM reason: DISC PDU received. */
+#define PHLN_LLCP_DM_NO_CONNECTION  0x01U   /**< DM reason: no active connection at the SAP. */
+#define PHLN_LLCP_DM_REJECTED       0x03U   /**< DM reason: CONNECT PDU rejected. */
+#define PHLN_LLCP_DM_NONE           0xFFU   /**< No DM reason, e.g. the data link has been closed by a FRMR PDU. */
+
+#define PHLN_LLCP_HEADER_LENGTH     2U      /**< Length of the PDU header. */
+#define PHLN_LLCP_SEQUENCE_LENGTH   1U      /**< Length of the sequence field of I, RR and RNR PDUs. */
+#define PHLN_LLCP_AGF_LENGTH_SIZE   2U      /**< Length of the length field preceding each PDU within an AGF PDU. */
+#define PHLN_LLCP_SEQUENCE_MASK     0x0FU   /**< Sequence numbers are counted modulo 16. */
+
+#define PHLN_LLCP_ATR_RES_GT_POS    17U     /**< Position of the general bytes within ATR_RES. */
+#define PHLN_LLCP_MAGIC_LENGTH      3U      /**< Length of the LLCP magic number. */
+
+#define PHLN_LLCP_MAX_SYMM_DEFAULT  100U    /**< Default number of consecutive SYMM exchanges while waiting. */
+
+/** @}
+* end of ph_Private
+*/
+
+#endif /* PHLNLLCP_INT_H */
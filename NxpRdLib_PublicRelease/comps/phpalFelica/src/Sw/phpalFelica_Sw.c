@@ -27,6 +27,9 @@
 #include <phhalHw.h>
 #include <phpalFelica.h>
 #include <ph_RefDefs.h>
+#ifdef NXPBUILD__PHHAL_HW_RC523
+#include <phhalHw_Rc523_Cmd.h>
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
 
 #ifdef  NXPBUILD__PHPAL_FELICA_SW
 
@@ -511,4 +514,248 @@ phStatus_t phpalFelica_Sw_GetSerialNo(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_FELICA);
 }
 
+phStatus_t phpalFelica_Sw_Inventory(
+                                    phpalFelica_Sw_DataParams_t * pDataParams,
+                                    uint8_t * pSystemCode,
+                                    uint8_t bNumTimeSlots,
+                                    uint16_t wDataRate,
+                                    uint8_t * pIDmPMmList,
+                                    uint8_t bMaxCards,
+                                    uint8_t * pNumCards,
+                                    uint32_t * pRfTimeUs,
+                                    uint8_t * pMoreCardsAvailable
+                                    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bPoll;
+    uint8_t     PH_MEMLOC_REM bQuietPolls;
+    uint8_t     PH_MEMLOC_REM bNewCards;
+    uint8_t     PH_MEMLOC_REM bCollisions;
+    uint8_t     PH_MEMLOC_REM bAllSlotsReceived;
+
+    *pNumCards = 0;
+    *pRfTimeUs = 0;
+    *pMoreCardsAvailable = 0;
+
+    /* parameter check */
+    switch (bNumTimeSlots)
+    {
+    case PHPAL_FELICA_NUMSLOTS_1:
+    case PHPAL_FELICA_NUMSLOTS_2:
+    case PHPAL_FELICA_NUMSLOTS_4:
+    case PHPAL_FELICA_NUMSLOTS_8:
+    case PHPAL_FELICA_NUMSLOTS_16:
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_FELICA);
+    }
+
+    if ((wDataRate != PHHAL_HW_RF_DATARATE_212) && (wDataRate != PHHAL_HW_RF_DATARATE_424))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_FELICA);
+    }
+
+    /* Apply the data rate */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXDATARATE, wDataRate));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXDATARATE, wDataRate));
+
+    /* reset validity of stored card IDs */
+    pDataParams->bIDmPMmValid = PHPAL_FELICA_SW_IDMPMM_INVALID;
+
+    bQuietPolls = 0;
+    for (bPoll = 0; bPoll < PHPAL_FELICA_SW_INVENTORY_MAX_POLLS; ++bPoll)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalFelica_Sw_InventoryPoll(
+            pDataParams,
+            pSystemCode,
+            bNumTimeSlots,
+            pIDmPMmList,
+            bMaxCards,
+            pNumCards,
+            &bNewCards,
+            &bCollisions,
+            pMoreCardsAvailable,
+            &bAllSlotsReceived));
+
+        /* The response window always elapses completely */
+        *pRfTimeUs += PHPAL_FELICA_SW_RESP_TIME_A_US + ((uint32_t)bNumTimeSlots * PHPAL_FELICA_SW_RESP_TIME_B_US);
+
+        /* The list is full */
+        if (*pMoreCardsAvailable)
+        {
+            break;
+        }
+
+        /* Spread the colliding cards over more time slots */
+        if (bCollisions)
+        {
+            if (bNumTimeSlots < PHPAL_FELICA_NUMSLOTS_16)
+            {
+                bNumTimeSlots = (uint8_t)((bNumTimeSlots << 1) + 1);
+            }
+            bQuietPolls = 0;
+            continue;
+        }
+
+        /* Every card answered alone in its time slot, so all of them are known */
+        if (bAllSlotsReceived)
+        {
+            break;
+        }
+
+        /* Only the earliest answer is seen, so stop once no new card shows up anymore */
+        if (bNewCards)
+        {
+            bQuietPolls = 0;
+        }
+        else if (++bQuietPolls >= PHPAL_FELICA_SW_INVENTORY_QUIET_POLLS)
+        {
+            break;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_FELICA);
+}
+
+phStatus_t phpalFelica_Sw_InventoryPoll(
+    phpalFelica_Sw_DataParams_t * pDataParams,
+    uint8_t * pSystemCode,
+    uint8_t bNumTimeSlots,
+    uint8_t * pIDmPMmList,
+    uint8_t bMaxCards,
+    uint8_t * pNumCards,
+    uint8_t * pNewCards,
+    uint8_t * pCollisions,
+    uint8_t * pMoreCardsAvailable,
+    uint8_t * pAllSlotsReceived
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aCmd[6];
+    uint8_t *   PH_MEMLOC_REM pRxBufferTmp;
+    uint16_t    PH_MEMLOC_REM wRxLengthTmp;
+    uint8_t     PH_MEMLOC_REM bAnswer;
+    uint8_t     PH_MEMLOC_COUNT bIndex;
+
+    *pNewCards = 0;
+    *pCollisions = 0;
+    *pAllSlotsReceived = 0;
+
+    /* build the command frame */
+    aCmd[0] = 6;
+    aCmd[1] = PHPAL_FELICA_SW_CMD_REQC;
+    aCmd[2] = pSystemCode[0];
+    aCmd[3] = pSystemCode[1];
+    aCmd[4] = 0x00; /* Reserved */
+    aCmd[5] = bNumTimeSlots;
+
+    /* Set ReqC timeout according to the number of slots */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(
+        pDataParams->pHalDataParams,
+        PHHAL_HW_CONFIG_TIMEOUT_VALUE_US,
+        PHPAL_FELICA_SW_RESP_TIME_A_US + (bNumTimeSlots * PHPAL_FELICA_SW_RESP_TIME_B_US)));
+
+    /* Exchange command */
+    status = phhalHw_Exchange(
+        pDataParams->pHalDataParams,
+        PH_EXCHANGE_DEFAULT,
+        aCmd,
+        6,
+        &pRxBufferTmp,
+        &wRxLengthTmp);
+
+    /* At most one answer per time slot */
+    for (bAnswer = 0; ; ++bAnswer)
+    {
+        switch (status & PH_ERR_MASK)
+        {
+        case PH_ERR_SUCCESS:
+            /* Check length */
+            if ((wRxLengthTmp != (PHPAL_FELICA_ATQC_LENGTH + 1)) ||
+                (pRxBufferTmp[0] != wRxLengthTmp) ||
+                (pRxBufferTmp[1] != PHPAL_FELICA_SW_RSP_REQC))
+            {
+                ++(*pCollisions);
+                break;
+            }
+
+            /* Skip cards which are already known */
+            for (bIndex = 0; bIndex < *pNumCards; ++bIndex)
+            {
+                if (memcmp(&pIDmPMmList[bIndex * (PHPAL_FELICA_IDM_LENGTH + PHPAL_FELICA_PMM_LENGTH)], &pRxBufferTmp[2], PHPAL_FELICA_IDM_LENGTH) == 0)
+                {
+                    break;
+                }
+            }
+            if (bIndex < *pNumCards)
+            {
+                break;
+            }
+
+            if (*pNumCards == bMaxCards)
+            {
+                *pMoreCardsAvailable = 1;
+                break;
+            }
+
+            /* Store IDm and PMm */
+            memcpy(&pIDmPMmList[*pNumCards * (PHPAL_FELICA_IDM_LENGTH + PHPAL_FELICA_PMM_LENGTH)], &pRxBufferTmp[2], PHPAL_FELICA_IDM_LENGTH + PHPAL_FELICA_PMM_LENGTH);  /* PRQA S 3200 */
+            ++(*pNumCards);
+            ++(*pNewCards);
+            break;
+
+        /* The response window has elapsed */
+        case PH_ERR_IO_TIMEOUT:
+            *pAllSlotsReceived = 1;
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_FELICA);
+
+        /* More than one card answered in the same time slot */
+        case PH_ERR_INTEGRITY_ERROR:
+        case PH_ERR_COLLISION_ERROR:
+        case PH_ERR_PROTOCOL_ERROR:
+        case PH_ERR_FRAMING_ERROR:
+            ++(*pCollisions);
+            break;
+
+        default:
+            return status;
+        }
+
+        /* Every time slot has been answered */
+        if (bAnswer >= bNumTimeSlots)
+        {
+            *pAllSlotsReceived = 1;
+            break;
+        }
+
+#ifdef NXPBUILD__PHHAL_HW_RC523
+        /* The Rc523 can restart its receiver to catch the answers of the following time slots */
+        if (PH_GET_COMPID(pDataParams->pHalDataParams) == PHHAL_HW_RC523_ID)
+        {
+            PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(
+                pDataParams->pHalDataParams,
+                PHHAL_HW_CONFIG_TIMEOUT_VALUE_US,
+                bNumTimeSlots * PHPAL_FELICA_SW_RESP_TIME_B_US));
+
+            status = phhalHw_Rc523_Cmd_Receive(
+                (phhalHw_Rc523_DataParams_t *)pDataParams->pHalDataParams,
+                PHHAL_HW_RC523_OPTION_RXTX_TIMER_START,
+                &pRxBufferTmp,
+                &wRxLengthTmp);
+            continue;
+        }
+#endif /* NXPBUILD__PHHAL_HW_RC523 */
+
+        /* Wait until all slots are finished */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_Wait(
+            pDataParams->pHalDataParams,
+            PHHAL_HW_TIME_MICROSECONDS,
+            (bNumTimeSlots * PHPAL_FELICA_SW_RESP_TIME_B_US)));
+        break;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_FELICA);
+}
+
 #endif /* NXPBUILD__PHPAL_FELICA_SW */
@@ -63,4 +63,16 @@ phStatus_t phpalFelica_Sw_GetSerialNo(
                                       );
 
 
+phStatus_t phpalFelica_Sw_Inventory(
+                                    phpalFelica_Sw_DataParams_t * pDataParams,
+                                    uint8_t * pSystemCode,
+                                    uint8_t bNumTimeSlots,
+                                    uint16_t wDataRate,
+                                    uint8_t * pIDmPMmList,
+                                    uint8_t bMaxCards,
+                                    uint8_t * pNumCards,
+                                    uint32_t * pRfTimeUs,
+                                    uint8_t * pMoreCardsAvailable
+                                    );
+
 #endif /* PHPALFELICA_SW_H */
@@ -76,6 +76,35 @@
 #define PHPAL_FELICA_SW_RESP_TIME_B_US      1208U
 /*@}*/
 
+/** \name Inventory
+*/
+/*@{*/
+#define PHPAL_FELICA_SW_INVENTORY_MAX_POLLS     16U     /**< Maximum number of ReqC commands of an inventory. */
+#define PHPAL_FELICA_SW_INVENTORY_QUIET_POLLS   3U      /**< Number of ReqC commands without new card which end a single response inventory. */
+/*@}*/
+
+/**
+* \brief Send one ReqC command and collect the answers to it.
+*
+* Every valid answer whose IDm is not yet part of the list is appended to it.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalFelica_Sw_InventoryPoll(
+    phpalFelica_Sw_DataParams_t * pDataParams,  /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pSystemCode,                      /**< [In] System-Code; uint8_t[2]. */
+    uint8_t bNumTimeSlots,                      /**< [In] Number of timeslots. */
+    uint8_t * pIDmPMmList,                      /**< [In,Out] IDm/PMm list. */
+    uint8_t bMaxCards,                          /**< [In] Number of cards \c pIDmPMmList can hold. */
+    uint8_t * pNumCards,                        /**< [In,Out] Number of cards in the list. */
+    uint8_t * pNewCards,                        /**< [Out] Number of cards added to the list. */
+    uint8_t * pCollisions,                      /**< [Out] Number of corrupted answers. */
+    uint8_t * pMoreCardsAvailable,              /**< [Out] Set if a new card did not fit into the list. */
+    uint8_t * pAllSlotsReceived                 /**< [Out] Unequal '0' if the answers of all time slots have been received. */
+    );
+
 /** @}
 * end of ph_Private
 */
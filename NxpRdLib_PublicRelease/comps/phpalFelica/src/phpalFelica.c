@@ -274,4 +274,80 @@ phStatus_t phpalFelica_GetSerialNo(
     return status;
 }
 
+phStatus_t phpalFelica_Inventory(
+                                 void * pDataParams,
+                                 uint8_t * pSystemCode,
+                                 uint8_t bNumTimeSlots,
+                                 uint16_t wDataRate,
+                                 uint8_t * pIDmPMmList,
+                                 uint8_t bMaxCards,
+                                 uint8_t * pNumCards,
+                                 uint32_t * pRfTimeUs,
+                                 uint8_t * pMoreCardsAvailable
+                                 )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalFelica_Inventory");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pSystemCode);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumTimeSlots);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wDataRate);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pIDmPMmList);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bMaxCards);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumCards);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRfTimeUs);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMoreCardsAvailable);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pSystemCode_log, pSystemCode, 2);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumTimeSlots_log, &bNumTimeSlots);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wDataRate_log, &wDataRate);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bMaxCards_log, &bMaxCards);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+    PH_ASSERT_NULL (pDataParams);
+    PH_ASSERT_NULL (pSystemCode);
+    PH_ASSERT_NULL (pNumCards);
+    PH_ASSERT_NULL (pRfTimeUs);
+    PH_ASSERT_NULL (pMoreCardsAvailable);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_FELICA)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_FELICA);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_FELICA_SW
+    case PHPAL_FELICA_SW_ID:
+        status = phpalFelica_Sw_Inventory((phpalFelica_Sw_DataParams_t *)pDataParams, pSystemCode, bNumTimeSlots, wDataRate, pIDmPMmList, bMaxCards, pNumCards, pRfTimeUs, pMoreCardsAvailable);
+        break;
+#endif /* NXPBUILD__PHPAL_FELICA_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_FELICA);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNumCards_log, pNumCards);
+        PH_LOG_HELPER_ADDPARAM_UINT32(PH_LOG_LOGTYPE_DEBUG, pRfTimeUs_log, pRfTimeUs);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMoreCardsAvailable_log, pMoreCardsAvailable);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 #endif /* NXPBUILD__PHPAL_FELICA */
@@ -51,6 +51,7 @@ phStatus_t phpalI14443p3a_Sw_Init(
     pDataParams->pHalDataParams = pHalDataParams;
     pDataParams->bUidLength     = 0;
     pDataParams->bUidComplete   = 0;
+    pDataParams->bAtqaValid     = 0;
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3A);
 }
@@ -597,6 +598,8 @@ phStatus_t phpalI14443p3a_Sw_RequestAEx(
     if (wRespLength == PHPAL_I14443P3A_ATQA_LENGTH)
     {
         memcpy(pAtqa, pResp, PHPAL_I14443P3A_ATQA_LENGTH);  /* PRQA S 3200 */
+        memcpy(pDataParams->abAtqa, pResp, PHPAL_I14443P3A_ATQA_LENGTH);  /* PRQA S 3200 */
+        pDataParams->bAtqaValid = 1;
     }
     else
     {
@@ -625,4 +628,20 @@ phStatus_t phpalI14443p3a_Sw_GetSerialNo(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3A);
 }
 
+phStatus_t phpalI14443p3a_Sw_GetAtqa(
+                                     phpalI14443p3a_Sw_DataParams_t * pDataParams,
+                                     uint8_t * pAtqa
+                                     )
+{
+    /* Return an error if no ATQA has been received */
+    if (!pDataParams->bAtqaValid)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_USE_CONDITION, PH_COMP_PAL_ISO14443P3A);
+    }
+
+    memcpy(pAtqa, pDataParams->abAtqa, PHPAL_I14443P3A_ATQA_LENGTH);  /* PRQA S 3200 */
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3A);
+}
+
 #endif /* NXPBUILD__PHPAL_I14443P3A_SW */
@@ -83,4 +83,9 @@ phStatus_t phpalI14443p3a_Sw_GetSerialNo(
     uint8_t * pLenUidOut
     );
 
+phStatus_t phpalI14443p3a_Sw_GetAtqa(
+                                     phpalI14443p3a_Sw_DataParams_t * pDataParams,
+                                     uint8_t * pAtqa
+                                     );
+
 #endif /* PHPALI14443P3A_SW_H */
@@ -654,6 +654,191 @@ phStatus_t phpalI14443p3b_Sw_GetProtocolParams(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3B);
 }
 
+phStatus_t phpalI14443p3b_Sw_Inventory(
+                                        phpalI14443p3b_Sw_DataParams_t * pDataParams,
+                                        uint8_t bNumSlots,
+                                        uint8_t bAfi,
+                                        uint8_t bExtAtqb,
+                                        phpalI14443p3b_CardInfo_t * pCards,
+                                        uint8_t bMaxCards,
+                                        uint8_t * pNumCards,
+                                        uint8_t * pMoreCardsAvailable
+                                        )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bRound;
+    uint8_t     PH_MEMLOC_REM bSlot;
+    uint8_t     PH_MEMLOC_REM bSlots;
+    uint8_t     PH_MEMLOC_REM bCollisions;
+    uint8_t     PH_MEMLOC_REM bIndex;
+    uint8_t     PH_MEMLOC_REM aAtqb[13];
+    uint8_t     PH_MEMLOC_REM bAtqbLen;
+    uint16_t    PH_MEMLOC_REM wEstimate;
+
+    *pNumCards = 0;
+    *pMoreCardsAvailable = 0x00;
+
+    /* Parameter check */
+    if (bNumSlots > PHPAL_I14443P3B_NUMSLOTS_16)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P3B);
+    }
+
+    for (bRound = 0; bRound < PHPAL_I14443P3B_SW_INVENTORY_MAX_ROUNDS; ++bRound)
+    {
+        bSlots = (uint8_t)(1 << bNumSlots);
+        bCollisions = 0;
+
+        /* Halted cards do not answer anymore, so every round only sees the unresolved cards */
+        status = phpalI14443p3b_Sw_RequestBEx(pDataParams, 0, bNumSlots, bAfi, bExtAtqb, aAtqb, &bAtqbLen);
+
+        for (bSlot = 1; ; ++bSlot)
+        {
+            switch (status & PH_ERR_MASK)
+            {
+            case PH_ERR_SUCCESS:
+                /* Check whether the card has already been found */
+                for (bIndex = 0; bIndex < *pNumCards; ++bIndex)
+                {
+                    if (memcmp(&pCards[bIndex].aAtqb[1], &aAtqb[1], 4) == 0)
+                    {
+                        break;
+                    }
+                }
+
+                if (bIndex == *pNumCards)
+                {
+                    /* No space left, the card stays unresolved */
+                    if (*pNumCards == bMaxCards)
+                    {
+                        *pMoreCardsAvailable = 0x01;
+                        break;
+                    }
+
+                    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p3b_Sw_StoreCardInfo(aAtqb, bAtqbLen, &pCards[*pNumCards]));
+                    ++(*pNumCards);
+                }
+
+                /* Halt the card, a card which misses the HaltB is filtered out in the next round */
+                statusTmp = phpalI14443p3b_Sw_HaltB(pDataParams);
+                if (((statusTmp & PH_ERR_MASK) != PH_ERR_SUCCESS) &&
+                    ((statusTmp & PH_ERR_MASK) != PH_ERR_IO_TIMEOUT) &&
+                    ((statusTmp & PH_ERR_MASK) != PH_ERR_INTEGRITY_ERROR) &&
+                    ((statusTmp & PH_ERR_MASK) != PH_ERR_PROTOCOL_ERROR))
+                {
+                    return statusTmp;
+                }
+
+                /* HaltB changed the timeout, restore it for the remaining SlotMarkers */
+                PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(
+                    pDataParams->pHalDataParams,
+                    PHHAL_HW_CONFIG_TIMEOUT_VALUE_US,
+                    PHPAL_I14443P3B_SW_ATQB_TIME_US + PHPAL_I14443P3B_SW_EXT_TIME_US));
+                break;
+
+            /* Empty slot */
+            case PH_ERR_IO_TIMEOUT:
+                break;
+
+            /* More than one card answered */
+            case PH_ERR_INTEGRITY_ERROR:
+            case PH_ERR_COLLISION_ERROR:
+            case PH_ERR_PROTOCOL_ERROR:
+                ++bCollisions;
+                break;
+
+            default:
+                return status;
+            }
+
+            if (bSlot >= bSlots)
+            {
+                break;
+            }
+
+            status = phpalI14443p3b_Sw_SlotMarker(pDataParams, (uint8_t)(bSlot + 1), aAtqb, &bAtqbLen);
+        }
+
+        /* All cards are resolved after a round without collision */
+        if ((bCollisions == 0) || (*pMoreCardsAvailable != 0x00))
+        {
+            break;
+        }
+
+        /* Each collided slot holds about 2.4 cards; use the smallest slot count which fits them */
+        wEstimate = (uint16_t)(((uint16_t)bCollisions * 5 + 1) >> 1);
+        for (bNumSlots = PHPAL_I14443P3B_NUMSLOTS_1; bNumSlots < PHPAL_I14443P3B_NUMSLOTS_16; ++bNumSlots)
+        {
+            if ((uint16_t)(1 << bNumSlots) >= wEstimate)
+            {
+                break;
+            }
+        }
+    }
+
+    /* Collisions remained after the last round */
+    if (bRound == PHPAL_I14443P3B_SW_INVENTORY_MAX_ROUNDS)
+    {
+        *pMoreCardsAvailable = 0x01;
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3B);
+}
+
+phStatus_t phpalI14443p3b_Sw_ActivateInventoryCard(
+    phpalI14443p3b_Sw_DataParams_t * pDataParams,
+    phpalI14443p3b_CardInfo_t * pCard,
+    uint8_t bFsdi,
+    uint8_t bCid,
+    uint8_t bDri,
+    uint8_t bDsi,
+    uint8_t * pMbli
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM aAtqb[13];
+    uint8_t     PH_MEMLOC_REM bAtqbLen;
+
+    /* Wake up all halted cards; with a single slot they are expected to collide */
+    status = phpalI14443p3b_Sw_RequestBEx(
+        pDataParams,
+        1,
+        PHPAL_I14443P3B_NUMSLOTS_1,
+        0x00,
+        (pCard->bAtqbLen == 13) ? PH_ON : PH_OFF,
+        aAtqb,
+        &bAtqbLen);
+
+    if (((status & PH_ERR_MASK) != PH_ERR_SUCCESS) &&
+        ((status & PH_ERR_MASK) != PH_ERR_INTEGRITY_ERROR) &&
+        ((status & PH_ERR_MASK) != PH_ERR_COLLISION_ERROR) &&
+        ((status & PH_ERR_MASK) != PH_ERR_PROTOCOL_ERROR))
+    {
+        return status;
+    }
+
+    /* Use the highest data rates supported by both sides */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p3b_Sw_DecideBaudRateEx(pCard->bBitRateCaps, &bDri, &bDsi));
+
+    /* Only the card with the cached PUPI accepts the Attrib */
+    status = phpalI14443p3b_Sw_Attrib(pDataParams, pCard->aAtqb, pCard->bAtqbLen, bFsdi, bCid, bDri, bDsi, pMbli);
+
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        memcpy(pDataParams->pPupi, &pCard->aAtqb[1], sizeof(pDataParams->pPupi));  /* PRQA S 3200 */
+        pDataParams->bPupiValid = PH_ON;
+    }
+    else
+    {
+        /* PUPI is invalid */
+        pDataParams->bPupiValid = PH_OFF;
+    }
+
+    return status;
+}
+
 phStatus_t phpalI14443p3b_Sw_CheckATQBEx(
     phpalI14443p3b_Sw_DataParams_t * pDataParams,
     uint8_t * pResp,
@@ -969,4 +1154,27 @@ phStatus_t phpalI14443p3b_Sw_DecideBaudRateEx( uint8_t bBitRateCapability, uint8
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3B);
 }
 
+phStatus_t phpalI14443p3b_Sw_StoreCardInfo(
+    uint8_t * pAtqb,
+    uint8_t bAtqbLen,
+    phpalI14443p3b_CardInfo_t * pCard
+    )
+{
+    memcpy(pCard->aAtqb, pAtqb, bAtqbLen);  /* PRQA S 3200 */
+    pCard->bAtqbLen = bAtqbLen;
+
+    /* Protocol info: [Bit_Rate_Capability][Max_Frame_Size|Protocol_Type][FWI|ADC|FO] */
+    pCard->bBitRateCaps = pAtqb[9];
+    pCard->bFsci = (uint8_t)(pAtqb[10] >> 4);
+    pCard->bFwi = (uint8_t)(pAtqb[11] >> 4);
+    if (pCard->bFwi == 0x0F)
+    {
+        pCard->bFwi = PHPAL_I14443P3B_SW_FWI_DEFAULT;
+    }
+    pCard->bCidSupported = pAtqb[11] & 0x01;
+    pCard->bNadSupported = (pAtqb[11] & 0x02) >> 1;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P3B);
+}
+
 #endif /* NXPBUILD__PHPAL_I14443P3B_SW */
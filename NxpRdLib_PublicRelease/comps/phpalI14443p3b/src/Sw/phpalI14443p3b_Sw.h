@@ -141,4 +141,25 @@ phStatus_t phpalI14443p3b_Sw_GetProtocolParams(
     uint8_t * pFsci
     );
 
+phStatus_t phpalI14443p3b_Sw_Inventory(
+                                        phpalI14443p3b_Sw_DataParams_t * pDataParams,
+                                        uint8_t bNumSlots,
+                                        uint8_t bAfi,
+                                        uint8_t bExtAtqb,
+                                        phpalI14443p3b_CardInfo_t * pCards,
+                                        uint8_t bMaxCards,
+                                        uint8_t * pNumCards,
+                                        uint8_t * pMoreCardsAvailable
+                                        );
+
+phStatus_t phpalI14443p3b_Sw_ActivateInventoryCard(
+    phpalI14443p3b_Sw_DataParams_t * pDataParams,
+    phpalI14443p3b_CardInfo_t * pCard,
+    uint8_t bFsdi,
+    uint8_t bCid,
+    uint8_t bDri,
+    uint8_t bDsi,
+    uint8_t * pMbli
+    );
+
 #endif /* PHPALI14443P3B_SW_H */
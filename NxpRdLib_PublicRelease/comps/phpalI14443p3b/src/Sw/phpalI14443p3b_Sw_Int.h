@@ -71,6 +71,22 @@
 /** Time extension in microseconds for all commands.  */
 #define PHPAL_I14443P3B_SW_EXT_TIME_US              60
 
+/** Maximum number of ReqB rounds of an inventory. */
+#define PHPAL_I14443P3B_SW_INVENTORY_MAX_ROUNDS     16U
+
+/**
+* \brief Store a card found during an inventory.
+*
+* The AtqB is copied and its protocol parameters are decoded.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phpalI14443p3b_Sw_StoreCardInfo(
+    uint8_t * pAtqb,                        /**< [In] AtqB; uint8_t[12/13]. */
+    uint8_t bAtqbLen,                       /**< [In] Length of the AtqB. */
+    phpalI14443p3b_CardInfo_t * pCard       /**< [Out] Card information. */
+    );
+
 /**
 * \brief Perform a ISO14443-3B Request/Wakeup command.
 * \return Status code
@@ -820,4 +820,143 @@ phStatus_t phpalI14443p3b_GetProtocolParams(
     return status;
 }
 
+phStatus_t phpalI14443p3b_Inventory(
+                                    void * pDataParams,
+                                    uint8_t bNumSlots,
+                                    uint8_t bAfi,
+                                    uint8_t bExtAtqb,
+                                    phpalI14443p3b_CardInfo_t * pCards,
+                                    uint8_t bMaxCards,
+                                    uint8_t * pNumCards,
+                                    uint8_t * pMoreCardsAvailable
+                                    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalI14443p3b_Inventory");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bNumSlots);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bAfi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bExtAtqb);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pCards);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bMaxCards);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumCards);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMoreCardsAvailable);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bNumSlots_log, &bNumSlots);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bAfi_log, &bAfi);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bExtAtqb_log, &bExtAtqb);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bMaxCards_log, &bMaxCards);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pNumCards);
+	PH_ASSERT_NULL (pMoreCardsAvailable);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_ISO14443P3B)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_ISO14443P3B);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_I14443P3B_SW
+    case PHPAL_I14443P3B_SW_ID:
+        status = phpalI14443p3b_Sw_Inventory((phpalI14443p3b_Sw_DataParams_t *)pDataParams, bNumSlots, bAfi, bExtAtqb, pCards, bMaxCards, pNumCards, pMoreCardsAvailable);
+        break;
+#endif /* NXPBUILD__PHPAL_I14443P3B_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_ISO14443P3B);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNumCards_log, pNumCards);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMoreCardsAvailable_log, pMoreCardsAvailable);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
+phStatus_t phpalI14443p3b_ActivateInventoryCard(
+    void * pDataParams,
+    phpalI14443p3b_CardInfo_t * pCard,
+    uint8_t bFsdi,
+    uint8_t bCid,
+    uint8_t bDri,
+    uint8_t bDsi,
+    uint8_t * pMbli
+    )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalI14443p3b_ActivateInventoryCard");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pCard);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bFsdi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bCid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bDri);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bDsi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMbli);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bFsdi_log, &bFsdi);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bCid_log, &bCid);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bDri_log, &bDri);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bDsi_log, &bDsi);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pCard);
+	PH_ASSERT_NULL (pMbli);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_ISO14443P3B)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_ISO14443P3B);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_I14443P3B_SW
+    case PHPAL_I14443P3B_SW_ID:
+        status = phpalI14443p3b_Sw_ActivateInventoryCard((phpalI14443p3b_Sw_DataParams_t *)pDataParams, pCard, bFsdi, bCid, bDri, bDsi, pMbli);
+        break;
+#endif /* NXPBUILD__PHPAL_I14443P3B_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_ISO14443P3B);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMbli_log, pMbli);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 #endif /* NXPBUILD__PHPAL_I14443P3B */
@@ -26,6 +26,7 @@
 #include <ph_Status.h>
 #include <phhalHw.h>
 #include <phpalI14443p4a.h>
+#include <phTools.h>
 #include <ph_RefDefs.h>
 
 #ifdef NXPBUILD__PHPAL_I14443P4A_SW
@@ -67,6 +68,11 @@ phStatus_t phpalI14443p4a_Sw_Init(
     pDataParams->bFsdi          = 0x00;
     pDataParams->bDri           = 0x00;
     pDataParams->bDsi           = 0x00;
+    pDataParams->bPcdDriCaps    = 0x00;
+    pDataParams->bPcdDsiCaps    = 0x00;
+    pDataParams->wModelId       = 0x0000;
+    pDataParams->bRateMemoryNext = 0x00;
+    memset(pDataParams->aRateMemory, 0x00, sizeof(pDataParams->aRateMemory));  /* PRQA S 3200 */
 
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
 }
@@ -122,6 +128,15 @@ phStatus_t phpalI14443p4a_Sw_Rats(
         /* Copy ATS buffer */
         memcpy(pAts, pResp, wRespLength);  /* PRQA S 3200 */
 
+        /* The ATS identifies the card model */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phTools_CalculateCrc16(
+            PH_TOOLS_CRC_OPTION_DEFAULT,
+            PH_TOOLS_CRC16_PRESET_ISO14443A,
+            PH_TOOLS_CRC16_POLY_ISO14443,
+            pAts,
+            wRespLength,
+            &pDataParams->wModelId));
+
         /* Set default values */
         /* */
         pDataParams->bCidSupported  = PH_ON;
@@ -405,6 +420,89 @@ phStatus_t phpalI14443p4a_Sw_Pps(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
 }
 
+phStatus_t phpalI14443p4a_Sw_PpsAuto(
+                                     phpalI14443p4a_Sw_DataParams_t * pDataParams,
+                                     uint8_t * pDri,
+                                     uint8_t * pDsi
+                                     )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint8_t     PH_MEMLOC_REM bDriMask;
+    uint8_t     PH_MEMLOC_REM bDsiMask;
+    uint8_t     PH_MEMLOC_REM bBadDriMask;
+    uint8_t     PH_MEMLOC_REM bBadDsiMask;
+    uint8_t     PH_MEMLOC_REM bDri;
+    uint8_t     PH_MEMLOC_REM bDsi;
+
+    /* Retrieve the data rates of the PCD */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_GetPcdDatarates(pDataParams, &bDriMask, &bDsiMask));
+
+    /* Intersect with the data rates of the PICC; ISO/IEC 14443-4:2008, Section 5.2.4 */
+    bDriMask &= (uint8_t)(PHPAL_I14443P4A_SW_DATARATE_MASK_106 | ((pDataParams->bBitRateCaps & PHPAL_I14443P4A_SW_ATS_TA1_DR_MASK) << 1));
+    bDsiMask &= (uint8_t)(PHPAL_I14443P4A_SW_DATARATE_MASK_106 | ((pDataParams->bBitRateCaps & PHPAL_I14443P4A_SW_ATS_TA1_DS_MASK) >> 3));
+
+    /* Skip the data rates which proved unreliable for this card model */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_GetUnreliableDatarates(pDataParams, &bBadDriMask, &bBadDsiMask));
+    bDriMask &= (uint8_t)~bBadDriMask;
+    bDsiMask &= (uint8_t)~bBadDsiMask;
+
+    /* The PICC may require the same data rate in both directions */
+    if (pDataParams->bBitRateCaps & PHPAL_I14443P4A_SW_ATS_TA1_SAME_D)
+    {
+        bDriMask &= bDsiMask;
+        bDsiMask = bDriMask;
+    }
+
+    do
+    {
+        bDri = phpalI14443p4a_Sw_GetHighestDatarate(bDriMask);
+        bDsi = phpalI14443p4a_Sw_GetHighestDatarate(bDsiMask);
+
+        /* No PPS is needed to stay at 106 kBit/s */
+        if ((bDri == PHPAL_I14443P4A_DATARATE_106) && (bDsi == PHPAL_I14443P4A_DATARATE_106))
+        {
+            break;
+        }
+
+        status = phpalI14443p4a_Sw_Pps(pDataParams, bDri, bDsi);
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            break;
+        }
+
+        /* Only transmission errors allow a fallback */
+        if (!I14443P4A_SW_IS_INVALID_BLOCK_STATUS(status) && ((status & PH_ERR_MASK) != PH_ERR_PROTOCOL_ERROR))
+        {
+            return status;
+        }
+
+        /* Remember the failed data rates and step down */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_AddUnreliableDatarates(pDataParams, bDri, bDsi));
+        if (bDri != PHPAL_I14443P4A_DATARATE_106)
+        {
+            bDriMask &= (uint8_t)~(uint8_t)(1 << bDri);
+        }
+        if (bDsi != PHPAL_I14443P4A_DATARATE_106)
+        {
+            bDsiMask &= (uint8_t)~(uint8_t)(1 << bDsi);
+        }
+    }
+    while (1);
+
+    *pDri = pDataParams->bDri;
+    *pDsi = pDataParams->bDsi;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+phStatus_t phpalI14443p4a_Sw_MarkDatarateUnreliable(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams
+    )
+{
+    return phpalI14443p4a_Sw_AddUnreliableDatarates(pDataParams, pDataParams->bDri, pDataParams->bDsi);
+}
+
 phStatus_t phpalI14443p4a_Sw_ActivateCard(
     phpalI14443p4a_Sw_DataParams_t * pDataParams,
     uint8_t bFsdi,
@@ -416,6 +514,22 @@ phStatus_t phpalI14443p4a_Sw_ActivateCard(
 {
     phStatus_t PH_MEMLOC_REM statusTmp;
 
+    /* Automatic data rate selection */
+    if ((bDri == PHPAL_I14443P4A_DATARATE_AUTO) || (bDsi == PHPAL_I14443P4A_DATARATE_AUTO))
+    {
+        /* Only allowed for both directions */
+        if (bDri != bDsi)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P4A);
+        }
+
+        /* Perform RATS */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_Rats(pDataParams, bFsdi, bCid, pAts));
+
+        /* Perform PPS */
+        return phpalI14443p4a_Sw_PpsAuto(pDataParams, &bDri, &bDsi);
+    }
+
     /* Check Dri value */
     switch (bDri)
     {
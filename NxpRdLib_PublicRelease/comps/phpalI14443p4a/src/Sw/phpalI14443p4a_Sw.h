@@ -41,6 +41,16 @@ phStatus_t phpalI14443p4a_Sw_Pps(
                                  uint8_t bDsi
                                  );
 
+phStatus_t phpalI14443p4a_Sw_PpsAuto(
+                                     phpalI14443p4a_Sw_DataParams_t * pDataParams,
+                                     uint8_t * pDri,
+                                     uint8_t * pDsi
+                                     );
+
+phStatus_t phpalI14443p4a_Sw_MarkDatarateUnreliable(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams
+    );
+
 phStatus_t phpalI14443p4a_Sw_ActivateCard(
     phpalI14443p4a_Sw_DataParams_t * pDataParams,
     uint8_t bFsdi,
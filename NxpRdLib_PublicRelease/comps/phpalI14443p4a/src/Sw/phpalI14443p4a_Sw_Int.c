@@ -0,0 +1,239 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Internal functions for Software ISO14443-4A Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+#include <phhalHw.h>
+#include <phpalI14443p4a.h>
+#include <ph_RefDefs.h>
+
+#ifdef NXPBUILD__PHPAL_I14443P4A_SW
+
+#include "phpalI14443p4a_Sw.h"
+#include "phpalI14443p4a_Sw_Int.h"
+
+static phStatus_t phpalI14443p4a_Sw_ProbeHalDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,
+    uint16_t wConfig,
+    uint8_t * pMask
+    );
+
+phStatus_t phpalI14443p4a_Sw_ConvertDatarate(
+    uint8_t bDxi,
+    uint16_t * pHalDatarate
+    )
+{
+    switch (bDxi)
+    {
+    case PHPAL_I14443P4A_DATARATE_106:
+        *pHalDatarate = PHHAL_HW_RF_DATARATE_106;
+        break;
+    case PHPAL_I14443P4A_DATARATE_212:
+        *pHalDatarate = PHHAL_HW_RF_DATARATE_212;
+        break;
+    case PHPAL_I14443P4A_DATARATE_424:
+        *pHalDatarate = PHHAL_HW_RF_DATARATE_424;
+        break;
+    case PHPAL_I14443P4A_DATARATE_848:
+        *pHalDatarate = PHHAL_HW_RF_DATARATE_848;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_ISO14443P4A);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+phStatus_t phpalI14443p4a_Sw_GetPcdDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,
+    uint8_t * pDriMask,
+    uint8_t * pDsiMask
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+
+    /* Probe the HAL only once, 106 kBit/s is always set in a valid mask */
+    if ((pDataParams->bPcdDriCaps == 0) || (pDataParams->bPcdDsiCaps == 0))
+    {
+        /* DRI is the PCD to PICC direction, which is the Tx direction of the HAL */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_ProbeHalDatarates(
+            pDataParams,
+            PHHAL_HW_CONFIG_TXDATARATE,
+            &pDataParams->bPcdDriCaps));
+
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI14443p4a_Sw_ProbeHalDatarates(
+            pDataParams,
+            PHHAL_HW_CONFIG_RXDATARATE,
+            &pDataParams->bPcdDsiCaps));
+    }
+
+    *pDriMask = pDataParams->bPcdDriCaps;
+    *pDsiMask = pDataParams->bPcdDsiCaps;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+phStatus_t phpalI14443p4a_Sw_GetUnreliableDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,
+    uint8_t * pBadDriMask,
+    uint8_t * pBadDsiMask
+    )
+{
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    *pBadDriMask = 0x00;
+    *pBadDsiMask = 0x00;
+
+    for (bIndex = 0; bIndex < PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE; ++bIndex)
+    {
+        if ((pDataParams->aRateMemory[bIndex].bBadDri | pDataParams->aRateMemory[bIndex].bBadDsi) &&
+            (pDataParams->aRateMemory[bIndex].wModelId == pDataParams->wModelId))
+        {
+            *pBadDriMask = pDataParams->aRateMemory[bIndex].bBadDri;
+            *pBadDsiMask = pDataParams->aRateMemory[bIndex].bBadDsi;
+            break;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+phStatus_t phpalI14443p4a_Sw_AddUnreliableDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,
+    uint8_t bDri,
+    uint8_t bDsi
+    )
+{
+    uint8_t PH_MEMLOC_REM bIndex;
+
+    /* 106 kBit/s is mandatory and therefore never unreliable */
+    if ((bDri == PHPAL_I14443P4A_DATARATE_106) && (bDsi == PHPAL_I14443P4A_DATARATE_106))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+    }
+
+    /* Search the entry of the current card model */
+    for (bIndex = 0; bIndex < PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE; ++bIndex)
+    {
+        if ((pDataParams->aRateMemory[bIndex].bBadDri | pDataParams->aRateMemory[bIndex].bBadDsi) &&
+            (pDataParams->aRateMemory[bIndex].wModelId == pDataParams->wModelId))
+        {
+            break;
+        }
+    }
+
+    /* Replace the oldest entry if the card model is unknown */
+    if (bIndex == PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE)
+    {
+        bIndex = pDataParams->bRateMemoryNext;
+        pDataParams->bRateMemoryNext = (uint8_t)((bIndex + 1) % PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE);
+
+        pDataParams->aRateMemory[bIndex].wModelId = pDataParams->wModelId;
+        pDataParams->aRateMemory[bIndex].bBadDri = 0x00;
+        pDataParams->aRateMemory[bIndex].bBadDsi = 0x00;
+    }
+
+    if (bDri != PHPAL_I14443P4A_DATARATE_106)
+    {
+        pDataParams->aRateMemory[bIndex].bBadDri |= (uint8_t)(1 << bDri);
+    }
+    if (bDsi != PHPAL_I14443P4A_DATARATE_106)
+    {
+        pDataParams->aRateMemory[bIndex].bBadDsi |= (uint8_t)(1 << bDsi);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+uint8_t phpalI14443p4a_Sw_GetHighestDatarate(
+    uint8_t bMask
+    )
+{
+    uint8_t PH_MEMLOC_REM bDxi;
+
+    for (bDxi = PHPAL_I14443P4A_DATARATE_848; bDxi > PHPAL_I14443P4A_DATARATE_106; --bDxi)
+    {
+        if (bMask & (uint8_t)(1 << bDxi))
+        {
+            break;
+        }
+    }
+
+    return bDxi;
+}
+
+static phStatus_t phpalI14443p4a_Sw_ProbeHalDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,
+    uint16_t wConfig,
+    uint8_t * pMask
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusProbe = PH_ERR_SUCCESS;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wCurrentDatarate;
+    uint16_t    PH_MEMLOC_REM wHalDatarate;
+    uint8_t     PH_MEMLOC_REM bDxi;
+
+    /* Remember the current setting */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, wConfig, &wCurrentDatarate));
+
+    *pMask = PHPAL_I14443P4A_SW_DATARATE_MASK_106;
+
+    for (bDxi = PHPAL_I14443P4A_DATARATE_212; bDxi <= PHPAL_I14443P4A_DATARATE_848; ++bDxi)
+    {
+        status = phpalI14443p4a_Sw_ConvertDatarate(bDxi, &wHalDatarate);
+        if ((status & PH_ERR_MASK) != PH_ERR_SUCCESS)
+        {
+            statusProbe = status;
+            break;
+        }
+
+        status = phhalHw_SetConfig(pDataParams->pHalDataParams, wConfig, wHalDatarate);
+
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            *pMask |= (uint8_t)(1 << bDxi);
+        }
+        /* A rejected data rate is not supported, everything else is a real error */
+        else if (((status & PH_ERR_MASK) != PH_ERR_INVALID_PARAMETER) &&
+            ((status & PH_ERR_MASK) != PH_ERR_UNSUPPORTED_PARAMETER))
+        {
+            statusProbe = status;
+            break;
+        }
+    }
+
+    /* Restore the original setting, also after a failed probe */
+    status = phhalHw_SetConfig(pDataParams->pHalDataParams, wConfig, wCurrentDatarate);
+    if ((statusProbe & PH_ERR_MASK) != PH_ERR_SUCCESS)
+    {
+        return statusProbe;
+    }
+    PH_CHECK_SUCCESS(status);
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4A);
+}
+
+#endif /* NXPBUILD__PHPAL_I14443P4A_SW */
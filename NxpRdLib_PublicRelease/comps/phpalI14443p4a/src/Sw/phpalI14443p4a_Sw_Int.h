@@ -95,6 +95,80 @@
 /** Time extension in microseconds for all commands.  */
 #define PHPAL_I14443P4A_SW_EXT_TIME_US          60
 
+/** Bits within TA(1) which signal the supported DR (PCD to PICC) values. */
+#define PHPAL_I14443P4A_SW_ATS_TA1_DR_MASK      0x07U
+
+/** Bits within TA(1) which signal the supported DS (PICC to PCD) values. */
+#define PHPAL_I14443P4A_SW_ATS_TA1_DS_MASK      0x70U
+
+/** Bit within TA(1) which signals that only the same data rate is allowed in both directions. */
+#define PHPAL_I14443P4A_SW_ATS_TA1_SAME_D       0x80U
+
+/** Bitmask entry of the always supported 106 kBit/s data rate. */
+#define PHPAL_I14443P4A_SW_DATARATE_MASK_106    0x01U
+
+/**
+* \brief Convert a DRI/DSI value to the corresponding HAL data rate.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid DRI/DSI value.
+*/
+phStatus_t phpalI14443p4a_Sw_ConvertDatarate(
+    uint8_t bDxi,               /**< [In] DRI/DSI value; 0-3 */
+    uint16_t * pHalDatarate     /**< [Out] HAL data rate, e.g. #PHHAL_HW_RF_DATARATE_106. */
+    );
+
+/**
+* \brief Retrieve the DRI/DSI values the HAL is able to transmit and receive with.
+*
+* The HAL is probed once per component instance by applying each data rate to
+* #PHHAL_HW_CONFIG_TXDATARATE and #PHHAL_HW_CONFIG_RXDATARATE; the original
+* settings are restored afterwards.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalI14443p4a_Sw_GetPcdDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pDriMask,                             /**< [Out] Bitmask of supported DRI values (bit n represents DRI n). */
+    uint8_t * pDsiMask                              /**< [Out] Bitmask of supported DSI values (bit n represents DSI n). */
+    );
+
+/**
+* \brief Retrieve the data rates which proved unreliable for the model of the current card.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phpalI14443p4a_Sw_GetUnreliableDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t * pBadDriMask,                          /**< [Out] Bitmask of unreliable DRI values. */
+    uint8_t * pBadDsiMask                           /**< [Out] Bitmask of unreliable DSI values. */
+    );
+
+/**
+* \brief Remember data rates as unreliable for the model of the current card.
+*
+* 106 kBit/s is never remembered. If no entry exists for the card model,
+* the oldest entry of the rate memory is replaced.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phpalI14443p4a_Sw_AddUnreliableDatarates(
+    phpalI14443p4a_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+    uint8_t bDri,                                   /**< [In] Unreliable Divisor Receive (PCD to PICC) Integer; 0-3 */
+    uint8_t bDsi                                    /**< [In] Unreliable Divisor Send (PICC to PCD) Integer; 0-3 */
+    );
+
+/**
+* \brief Retrieve the highest DRI/DSI value of a data rate bitmask.
+* \return Highest DRI/DSI value; #PHPAL_I14443P4A_DATARATE_106 for an empty bitmask.
+*/
+uint8_t phpalI14443p4a_Sw_GetHighestDatarate(
+    uint8_t bMask   /**< [In] Bitmask of DRI/DSI values (bit n represents value n). */
+    );
+
 /** @}
 * end of ph_Private
 */
@@ -35,6 +35,23 @@
 static const uint16_t PH_MEMLOC_CONST_ROM aI18092_FsTable[4] = {64, 128, 192, 253};
 static const uint16_t PH_MEMLOC_CONST_ROM aI18092_DrTable[3] = {PHHAL_HW_RF_DATARATE_106, PHHAL_HW_RF_DATARATE_212, PHHAL_HW_RF_DATARATE_424};
 
+static phStatus_t phpalI18092mPI_Sw_GetHalFrameSize(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint8_t * pFsl
+    );
+
+static phStatus_t phpalI18092mPI_Sw_GetHighestDatarate(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint16_t wConfig,
+    uint8_t bTargetCaps,
+    uint8_t * pDxi
+    );
+
+static uint32_t phpalI18092mPI_Sw_GetAirTime(
+    uint8_t bDxi,
+    uint16_t wFrameLength
+    );
+
 phStatus_t phpalI18092mPI_Sw_Init(
                                   phpalI18092mPI_Sw_DataParams_t * pDataParams,
                                   uint16_t wSizeOfDataParams,
@@ -481,13 +498,19 @@ phStatus_t phpalI18092mPI_Sw_ActivateCard(
 
     /* Parameter check */
     if ((bDid > PHPAL_I18092MPI_DID_MAX) ||
-        (bDsi > PHPAL_I18092MPI_DATARATE_424) ||
-        (bDri > PHPAL_I18092MPI_DATARATE_424) ||
-        (bFsl > PHPAL_I18092MPI_FRAMESIZE_254))
+        ((bDsi > PHPAL_I18092MPI_DATARATE_424) && (bDsi != PHPAL_I18092MPI_DATARATE_AUTO)) ||
+        ((bDri > PHPAL_I18092MPI_DATARATE_424) && (bDri != PHPAL_I18092MPI_DATARATE_AUTO)) ||
+        ((bFsl > PHPAL_I18092MPI_FRAMESIZE_254) && (bFsl != PHPAL_I18092MPI_FRAMESIZE_AUTO)))
     {
         return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_I18092MPI);
     }
 
+    /* Request the largest frames the HAL buffers can hold. */
+    if (bFsl == PHPAL_I18092MPI_FRAMESIZE_AUTO)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_GetHalFrameSize(pDataParams, &bFsl));
+    }
+
     /* First, send ATR request command. */
     PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_Atr(pDataParams,
         pNfcid3i,
@@ -500,6 +523,26 @@ phStatus_t phpalI18092mPI_Sw_ActivateCard(
         pAtrRes,
         pAtrResLength));
 
+    /* BR(T) lists the data rates the target is able to receive, i.e. the initiator's send data rates. */
+    if (bDsi == PHPAL_I18092MPI_DATARATE_AUTO)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_GetHighestDatarate(
+            pDataParams,
+            PHHAL_HW_CONFIG_TXDATARATE,
+            pAtrRes[PHPAL_I18092MPI_SW_ATR_RES_BRT_POS],
+            &bDsi));
+    }
+
+    /* BS(T) lists the data rates the target is able to send, i.e. the initiator's receive data rates. */
+    if (bDri == PHPAL_I18092MPI_DATARATE_AUTO)
+    {
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_GetHighestDatarate(
+            pDataParams,
+            PHHAL_HW_CONFIG_RXDATARATE,
+            pAtrRes[PHPAL_I18092MPI_SW_ATR_RES_BST_POS],
+            &bDri));
+    }
+
     return phpalI18092mPI_Sw_Psl(pDataParams, bDsi, bDri, pDataParams->bFsl);
 }
 
@@ -1157,6 +1200,207 @@ phStatus_t phpalI18092mPI_Sw_Exchange(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
 }
 
+phStatus_t phpalI18092mPI_Sw_BulkExchange(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint8_t * pTxBuffer,
+    uint16_t wTxLength,
+    uint8_t * pRxBuffer,
+    uint16_t wRxBufferSize,
+    uint16_t * pRxLength,
+    phpalI18092mPI_BulkStats_t * pStats
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phpalI18092mPI_BulkStats_t PH_MEMLOC_REM sStats;
+
+    /* Used to build block frames */
+    uint8_t     PH_MEMLOC_REM bHeaderLength;
+    uint16_t    PH_MEMLOC_REM wTxBufferSize;
+    uint16_t    PH_MEMLOC_REM wMaxFrameSize;
+    uint16_t    PH_MEMLOC_REM wBytesToSend;
+
+    /* Used for Exchange */
+    uint8_t     PH_MEMLOC_REM bBufferOverflow = 0;
+    uint8_t   * PH_MEMLOC_REM pRawResponse;
+    uint16_t    PH_MEMLOC_REM wRawResponseLength;
+    uint8_t   * PH_MEMLOC_REM pNormalizedResponse;
+    uint16_t    PH_MEMLOC_REM wNormalizedResponseLength;
+    uint8_t   * PH_MEMLOC_REM pPayloadResponse;
+    uint16_t    PH_MEMLOC_REM wPayloadLength;
+
+    /* Reset receive length and statistics */
+    *pRxLength = 0;
+    memset(&sStats, 0x00, sizeof(sStats));  /* PRQA S 3200 */
+
+    /* Find the biggest possible frame size before chaining is needed. */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXBUFFER_BUFSIZE, &wTxBufferSize));
+    wMaxFrameSize = (wTxBufferSize < aI18092_FsTable[pDataParams->bFsl]) ? wTxBufferSize : aI18092_FsTable[pDataParams->bFsl];
+
+    pDataParams->bStateNow = PHPAL_I18092MPI_SW_STATE_INFORMATION_PDU_TX;
+
+    /* ******************************** */
+    /*       PDU TRANSMISSION LOOP      */
+    /* ******************************** */
+    do
+    {
+        /* Forecast header length, NAD is only counted for the first PDU of a chain */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_GetPduHeaderLength(pDataParams, &bHeaderLength));
+
+        /* TxBuffer needs space for at least the header */
+        if (((uint16_t)bHeaderLength + 1) > wMaxFrameSize)
+        {
+            return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_PAL_I18092MPI);
+        }
+        wBytesToSend = wMaxFrameSize - (uint16_t)bHeaderLength;
+
+        /* Chain as long as the remaining data does not fit into one PDU */
+        if (wTxLength > wBytesToSend)
+        {
+            /* If there was no chaining indicate that this is the first chain */
+            if (!(pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_CHAINING_BIT))
+            {
+                pDataParams->bStateNow |= (PHPAL_I18092MPI_SW_STATE_CHAINING_BIT | PHPAL_I18092MPI_SW_STATE_CHAINING_FIRST_BIT);
+            }
+        }
+        else
+        {
+            wBytesToSend = wTxLength;
+
+            /* Chaining has been performed -> this is the last chain */
+            if (pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_CHAINING_BIT)
+            {
+                pDataParams->bStateNow &= (uint8_t)~(uint8_t)PHPAL_I18092MPI_SW_STATE_CHAINING_BIT;
+                pDataParams->bStateNow |= PHPAL_I18092MPI_SW_STATE_CHAINING_LAST_BIT;
+            }
+        }
+
+        /* Write PDU header to internal HAL buffer. */
+        PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_WritePduHeader(
+            pDataParams,
+            PHPAL_I18092MPI_SW_PFB_INFORMATION_PDU_MASK,
+            (pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_CHAINING_BIT) ? PH_ON : PH_OFF,
+            (uint8_t)wBytesToSend));
+
+        /* Append payload, transmit and receive ACK or response. */
+        PH_CHECK_SUCCESS_FCT(status, phpalI18092mPI_Sw_TransceivePdu(
+            pDataParams,
+            PH_EXCHANGE_BUFFER_LAST,
+            pTxBuffer,
+            wBytesToSend,
+            &pRawResponse,
+            &wRawResponseLength,
+            &pNormalizedResponse,
+            &wNormalizedResponseLength,
+            &pPayloadResponse,
+            &wPayloadLength));
+
+        ++sStats.wNumPdus;
+        sStats.dwAirTimeUs += phpalI18092mPI_Sw_GetAirTime(pDataParams->bDsi, (uint16_t)bHeaderLength + wBytesToSend);
+        sStats.dwAirTimeUs += phpalI18092mPI_Sw_GetAirTime(pDataParams->bDri, wRawResponseLength);
+
+        if (pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_RETRANSMIT_BIT)
+        {
+            /* Retransmission requested. */
+            pDataParams->bStateNow &= (uint8_t)~(uint8_t)PHPAL_I18092MPI_SW_STATE_RETRANSMIT_BIT;
+        }
+        else
+        {
+            /* Advance input data buffer. */
+            pTxBuffer += wBytesToSend;
+            wTxLength = wTxLength - wBytesToSend;
+            sStats.wTxPayload = sStats.wTxPayload + wBytesToSend;
+
+            /* Clean-up state */
+            pDataParams->bStateNow &= (uint8_t)~(uint8_t)(PHPAL_I18092MPI_SW_STATE_CHAINING_FIRST_BIT | PHPAL_I18092MPI_SW_STATE_CHAINING_LAST_BIT);
+
+            /* Last PDU has been answered, the chaining bit now reflects the response. */
+            if (wTxLength == 0)
+            {
+                pDataParams->bStateNow &= (uint8_t)~(uint8_t)PHPAL_I18092MPI_SW_STATE_MASK;
+                pDataParams->bStateNow |= PHPAL_I18092MPI_SW_STATE_INFORMATION_PDU_RX;
+            }
+        }
+    }
+    /* Loop as long as the state does not transit to RX mode. */
+    while ((pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_MASK) != PHPAL_I18092MPI_SW_STATE_INFORMATION_PDU_RX);
+
+    /* ******************************** */
+    /*        PDU RECEPTION LOOP        */
+    /* ******************************** */
+    do
+    {
+        /* Collect payload of information PDUs, responses to ATN carry none. */
+        if (PHPAL_I18092MPI_SW_IS_INFORMATION_PDU(pNormalizedResponse[3]))
+        {
+            /* Keep on acknowledging the chain to leave the target in a defined state. */
+            if (((uint32_t)*pRxLength + wPayloadLength) > wRxBufferSize)
+            {
+                bBufferOverflow = 1;
+            }
+
+            if (!bBufferOverflow)
+            {
+                memcpy(&pRxBuffer[*pRxLength], pPayloadResponse, wPayloadLength);  /* PRQA S 3200 */
+                *pRxLength = *pRxLength + wPayloadLength;
+            }
+            sStats.wRxPayload = sStats.wRxPayload + wPayloadLength;
+        }
+
+        /* We're not done yet, chaining is in progress */
+        if (pDataParams->bStateNow & PHPAL_I18092MPI_SW_STATE_CHAINING_BIT)
+        {
+            /* Chaining information PDU received, send ACK. ACK PDUs carry neither NAD nor payload. */
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_GetPduHeaderLength(pDataParams, &bHeaderLength));
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalI18092mPI_Sw_WritePduHeader(
+                pDataParams,
+                PHPAL_I18092MPI_SW_PFB_ACK_PDU_MASK,
+                PH_OFF,
+                0));
+
+            PH_CHECK_SUCCESS_FCT(status, phpalI18092mPI_Sw_TransceivePdu(
+                pDataParams,
+                PH_EXCHANGE_BUFFER_LAST,
+                NULL,
+                0,
+                &pRawResponse,
+                &wRawResponseLength,
+                &pNormalizedResponse,
+                &wNormalizedResponseLength,
+                &pPayloadResponse,
+                &wPayloadLength));
+
+            ++sStats.wNumPdus;
+            sStats.dwAirTimeUs += phpalI18092mPI_Sw_GetAirTime(pDataParams->bDsi, (uint16_t)bHeaderLength);
+            sStats.dwAirTimeUs += phpalI18092mPI_Sw_GetAirTime(pDataParams->bDri, wRawResponseLength);
+        }
+        /* No chaining -> reception finished */
+        else
+        {
+            pDataParams->bStateNow = PHPAL_I18092MPI_SW_STATE_FINISHED;
+        }
+    }
+    while (pDataParams->bStateNow != PHPAL_I18092MPI_SW_STATE_FINISHED);
+
+    /* Bytes per second, the air time is scaled by 1/64 to keep the calculation within 32 bits. */
+    if (sStats.dwAirTimeUs >= 64)
+    {
+        sStats.dwGoodput = (((uint32_t)sStats.wTxPayload + sStats.wRxPayload) * 15625UL) / (sStats.dwAirTimeUs >> 6);
+    }
+
+    if (pStats != NULL)
+    {
+        memcpy(pStats, &sStats, sizeof(sStats));  /* PRQA S 3200 */
+    }
+
+    if (bBufferOverflow)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_PAL_I18092MPI);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
+}
+
 phStatus_t phpalI18092mPI_Sw_SetConfig(
                                        phpalI18092mPI_Sw_DataParams_t * pDataParams,
                                        uint16_t wConfig,
@@ -1290,4 +1534,97 @@ phStatus_t phpalI18092mPI_Sw_GetSerialNo(
     }
 }
 
+static phStatus_t phpalI18092mPI_Sw_GetHalFrameSize(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint8_t * pFsl
+    )
+{
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wRxBufferSize;
+    uint16_t    PH_MEMLOC_REM wTxBufferSize;
+
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_RXBUFFER_BUFSIZE, &wRxBufferSize));
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, PHHAL_HW_CONFIG_TXBUFFER_BUFSIZE, &wTxBufferSize));
+
+    if (wTxBufferSize < wRxBufferSize)
+    {
+        wRxBufferSize = wTxBufferSize;
+    }
+
+    /* Reserve space for the start byte at 106kbps, the smallest frame size is always requested. */
+    for (*pFsl = PHPAL_I18092MPI_FRAMESIZE_254; *pFsl > PHPAL_I18092MPI_FRAMESIZE_64; --(*pFsl))
+    {
+        if ((aI18092_FsTable[*pFsl] + 1) <= wRxBufferSize)
+        {
+            break;
+        }
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
+}
+
+static phStatus_t phpalI18092mPI_Sw_GetHighestDatarate(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint16_t wConfig,
+    uint8_t bTargetCaps,
+    uint8_t * pDxi
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    uint16_t    PH_MEMLOC_REM wCurrentDatarate;
+
+    /* Remember the current setting */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_GetConfig(pDataParams->pHalDataParams, wConfig, &wCurrentDatarate));
+
+    for (*pDxi = PHPAL_I18092MPI_DATARATE_424; *pDxi > PHPAL_I18092MPI_DATARATE_106; --(*pDxi))
+    {
+        /* Bit 0 of BS(T) / BR(T) stands for 212kbps, bit 1 for 424kbps. ISO/IEC 18092:2004(E) section 12.5.1.2 */
+        if (!(bTargetCaps & (uint8_t)(1 << (*pDxi - 1))))
+        {
+            continue;
+        }
+
+        status = phhalHw_SetConfig(pDataParams->pHalDataParams, wConfig, aI18092_DrTable[*pDxi]);
+
+        if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+        {
+            break;
+        }
+        /* A rejected data rate is not supported, everything else is a real error */
+        else if (((status & PH_ERR_MASK) != PH_ERR_INVALID_PARAMETER) &&
+            ((status & PH_ERR_MASK) != PH_ERR_UNSUPPORTED_PARAMETER))
+        {
+            return status;
+        }
+    }
+
+    /* Restore the original setting, the data rate is applied by the PSL request. */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phhalHw_SetConfig(pDataParams->pHalDataParams, wConfig, wCurrentDatarate));
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
+}
+
+static uint32_t phpalI18092mPI_Sw_GetAirTime(
+    uint8_t bDxi,
+    uint16_t wFrameLength
+    )
+{
+    uint32_t PH_MEMLOC_REM dwBits;
+
+    if (bDxi == PHPAL_I18092MPI_DATARATE_106)
+    {
+        /* Start bit, every byte with parity and two CRC bytes. */
+        dwBits = 1 + (((uint32_t)wFrameLength + 2) * 9);
+    }
+    else
+    {
+        /* 48 bit preamble, two sync bytes and two CRC bytes. */
+        dwBits = 48 + (((uint32_t)wFrameLength + 4) * 8);
+    }
+
+    /* A bit lasts 128/D cycles of the 13.56MHz carrier. */
+    return (dwBits * 12800UL) / (1356UL << bDxi);
+}
+
 #endif /* NXPBUILD__PHPAL_I18092MPI_SW */
@@ -85,6 +85,16 @@ phStatus_t phpalI18092mPI_Sw_Exchange(
                                       uint16_t * pRxLength
                                       );
 
+phStatus_t phpalI18092mPI_Sw_BulkExchange(
+    phpalI18092mPI_Sw_DataParams_t * pDataParams,
+    uint8_t * pTxBuffer,
+    uint16_t wTxLength,
+    uint8_t * pRxBuffer,
+    uint16_t wRxBufferSize,
+    uint16_t * pRxLength,
+    phpalI18092mPI_BulkStats_t * pStats
+    );
+
 phStatus_t phpalI18092mPI_Sw_GetSerialNo(
     phpalI18092mPI_Sw_DataParams_t * pDataParams,
     uint8_t * pNfcId3Out
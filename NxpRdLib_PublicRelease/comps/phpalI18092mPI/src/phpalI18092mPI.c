@@ -473,6 +473,70 @@ phStatus_t phpalI18092mPI_Exchange(
     return status;
 }
 
+phStatus_t phpalI18092mPI_BulkExchange(
+                                       void * pDataParams,
+                                       uint8_t * pTxBuffer,
+                                       uint16_t wTxLength,
+                                       uint8_t * pRxBuffer,
+                                       uint16_t wRxBufferSize,
+                                       uint16_t * pRxLength,
+                                       phpalI18092mPI_BulkStats_t * pStats
+                                       )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalI18092mPI_BulkExchange");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pTxBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRxBuffer);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(wRxBufferSize);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pTxBuffer_log, pTxBuffer, wTxLength);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_DEBUG, wRxBufferSize_log, &wRxBufferSize);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	if (wTxLength) PH_ASSERT_NULL (pTxBuffer);
+	if (wRxBufferSize) PH_ASSERT_NULL (pRxBuffer);
+	PH_ASSERT_NULL (pRxLength);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_I18092MPI)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_I18092MPI);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_I18092MPI_SW
+    case PHPAL_I18092MPI_SW_ID:
+        status = phpalI18092mPI_Sw_BulkExchange((phpalI18092mPI_Sw_DataParams_t *)pDataParams, pTxBuffer, wTxLength, pRxBuffer, wRxBufferSize, pRxLength, pStats);
+        break;
+#endif /* NXPBUILD__PHPAL_I18092MPI_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_I18092MPI);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pRxBuffer_log, pRxBuffer, *pRxLength);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 phStatus_t phpalI18092mPI_SetConfig(
                                     void * pDataParams,
                                     uint16_t wConfig,
@@ -33,6 +33,15 @@
 #include "phpalSli15693_Sw.h"
 #include "phpalSli15693_Sw_Int.h"
 
+static uint8_t phpalSli15693_Sw_PushNode(
+    phpalSli15693_Sw_InventoryNode_t * pNodes,
+    uint8_t * pNumNodes,
+    phpalSli15693_Sw_InventoryNode_t * pParent,
+    uint8_t bValue,
+    uint8_t bNumBits,
+    uint8_t bMode
+    );
+
 phStatus_t phpalSli15693_Sw_Init(
                                  phpalSli15693_Sw_DataParams_t * pDataParams,
                                  uint16_t wSizeOfDataParams,
@@ -774,6 +783,24 @@ phStatus_t phpalSli15693_Sw_GetSerialNo(
     return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_SLI15693);
 }
 
+phStatus_t phpalSli15693_Sw_SetSerialNo(
+                                        phpalSli15693_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pUid,
+                                        uint8_t bUidLength
+                                        )
+{
+    if (bUidLength != PHPAL_SLI15693_UID_LENGTH)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_PARAMETER, PH_COMP_PAL_SLI15693);
+    }
+
+    /* copy the UID */
+    memcpy(pDataParams->pUid, pUid, PHPAL_SLI15693_UID_LENGTH); /* PRQA S 3200 */
+    pDataParams->bUidBitLength = PHPAL_SLI15693_SW_UID_COMPLETE;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_SLI15693);
+}
+
 phStatus_t phpalSli15693_Sw_SetConfig(
                                       phpalSli15693_Sw_DataParams_t * pDataParams,
                                       uint16_t wConfig,
@@ -1059,6 +1086,253 @@ phStatus_t phpalSli15693_Sw_FastInventoryPageRead(
         pDataLength);
 }
 
+phStatus_t phpalSli15693_Sw_InventoryAll(
+    phpalSli15693_Sw_DataParams_t * pDataParams,
+    uint8_t bFlags,
+    uint8_t bAfi,
+    uint8_t * pUids,
+    uint8_t * pDsfids,
+    uint8_t bMaxTags,
+    uint8_t * pNumTags,
+    phpalSli15693_RoundStats_t * pRoundStats,
+    uint8_t bMaxRounds,
+    uint8_t * pNumRounds,
+    uint8_t * pMoreTagsAvailable
+    )
+{
+    phStatus_t  PH_MEMLOC_REM status;
+    phStatus_t  PH_MEMLOC_REM statusTmp;
+    phpalSli15693_Sw_InventoryNode_t PH_MEMLOC_REM aNodes[PHPAL_SLI15693_SW_INVENTORY_STACK_SIZE];
+    phpalSli15693_Sw_InventoryNode_t PH_MEMLOC_REM sNode;
+    phpalSli15693_RoundStats_t PH_MEMLOC_REM sStats;
+    uint8_t     PH_MEMLOC_REM bNumNodes;
+    uint8_t     PH_MEMLOC_REM bNumSlots;
+    uint8_t     PH_MEMLOC_REM bSlot;
+    uint8_t     PH_MEMLOC_REM bChildMode;
+    uint8_t     PH_MEMLOC_REM bFirstTag;
+    uint8_t     PH_MEMLOC_REM bIndex;
+    uint16_t    PH_MEMLOC_REM wCollisions;
+    uint8_t     PH_MEMLOC_REM aUid[PHPAL_SLI15693_UID_LENGTH];
+    uint8_t     PH_MEMLOC_REM bUidLength;
+    uint8_t     PH_MEMLOC_REM bDsfid;
+    uint8_t     PH_MEMLOC_REM bDataDummy[1];
+    uint16_t    PH_MEMLOC_REM wDataLengthDummy;
+
+    *pNumTags = 0;
+    *pNumRounds = 0;
+    *pMoreTagsAvailable = 0;
+
+    /* The number of slots is chosen per round */
+    bFlags &= (uint8_t)(PHPAL_SLI15693_FLAG_TWO_SUB_CARRIERS | PHPAL_SLI15693_FLAG_DATA_RATE | PHPAL_SLI15693_FLAG_AFI);
+
+    /* Start with the whole population; nothing is known about it yet, so use 16 slots */
+    memset(aNodes[0].aMask, 0, PHPAL_SLI15693_UID_LENGTH);  /* PRQA S 3200 */
+    aNodes[0].bMaskBitLength = 0;
+    aNodes[0].bMode = PHPAL_SLI15693_SW_NODE_16SLOTS;
+    bNumNodes = 1;
+
+    while (bNumNodes > 0)
+    {
+        memcpy(&sNode, &aNodes[--bNumNodes], sizeof(phpalSli15693_Sw_InventoryNode_t));  /* PRQA S 3200 */
+
+        bNumSlots = (sNode.bMode == PHPAL_SLI15693_SW_NODE_16SLOTS) ? 16 : 1;
+
+        sStats.bMaskBitLength = sNode.bMaskBitLength;
+        sStats.bNumSlots = bNumSlots;
+        sStats.bNumTags = 0;
+        sStats.bNumCollisions = 0;
+        sStats.bNumEmpty = 0;
+        wCollisions = 0;
+        bFirstTag = *pNumTags;
+
+        status = phpalSli15693_Sw_Inventory(
+            pDataParams,
+            (bNumSlots == 1) ? (uint8_t)(bFlags | PHPAL_SLI15693_FLAG_NBSLOTS) : bFlags,
+            bAfi,
+            sNode.aMask,
+            sNode.bMaskBitLength,
+            &bDsfid,
+            aUid);
+
+        /* Slot marker loop */
+        for (bSlot = 0; bSlot < bNumSlots; ++bSlot)
+        {
+            if (bSlot > 0)
+            {
+                status = phpalSli15693_Sw_SendEof(
+                    pDataParams,
+                    PHPAL_SLI15693_EOF_NEXT_SLOT,
+                    &bDsfid,
+                    aUid,
+                    &bUidLength,
+                    bDataDummy,
+                    &wDataLengthDummy);
+            }
+
+            switch (status & PH_ERR_MASK)
+            {
+            case PH_ERR_SUCCESS:
+                ++sStats.bNumTags;
+                if (*pNumTags < bMaxTags)
+                {
+                    memcpy(&pUids[*pNumTags * PHPAL_SLI15693_UID_LENGTH], aUid, PHPAL_SLI15693_UID_LENGTH);  /* PRQA S 3200 */
+                    pDsfids[*pNumTags] = bDsfid;
+                    ++(*pNumTags);
+                }
+                else
+                {
+                    *pMoreTagsAvailable = 1;
+                }
+                break;
+
+            case PH_ERR_IO_TIMEOUT:
+                ++sStats.bNumEmpty;
+                break;
+
+                /* A CRC error is a collision which could not be detected on bit level */
+            case PH_ERR_COLLISION_ERROR:
+            case PH_ERR_INTEGRITY_ERROR:
+                ++sStats.bNumCollisions;
+                wCollisions |= (uint16_t)(1 << bSlot);
+                break;
+
+            default:
+                return status;
+            }
+        }
+
+        if (*pNumRounds < bMaxRounds)
+        {
+            memcpy(&pRoundStats[*pNumRounds], &sStats, sizeof(phpalSli15693_RoundStats_t));  /* PRQA S 3200 */
+        }
+        if (*pNumRounds < 0xFF)
+        {
+            ++(*pNumRounds);
+        }
+
+        /* Any request ends the slot sequence, so the tags of this round are put to quiet state afterwards */
+        for (bIndex = bFirstTag; bIndex < *pNumTags; ++bIndex)
+        {
+            memcpy(pDataParams->pUid, &pUids[bIndex * PHPAL_SLI15693_UID_LENGTH], PHPAL_SLI15693_UID_LENGTH);  /* PRQA S 3200 */
+            pDataParams->bUidBitLength = PHPAL_SLI15693_SW_UID_COMPLETE;
+
+            PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_Sw_StayQuiet(pDataParams));
+        }
+
+        /* No need to go on if there is no space left */
+        if (*pNumTags == bMaxTags)
+        {
+            if (wCollisions || bNumNodes)
+            {
+                *pMoreTagsAvailable = 1;
+            }
+            break;
+        }
+
+        if (!wCollisions)
+        {
+            continue;
+        }
+
+        if (bNumSlots == 16)
+        {
+            /* More collisions than single responses hint at several tags per colliding slot */
+            bChildMode = (sStats.bNumCollisions > sStats.bNumTags) ? PHPAL_SLI15693_SW_NODE_16SLOTS : PHPAL_SLI15693_SW_NODE_1SLOT;
+            if ((uint16_t)(sNode.bMaskBitLength + 4) > PHPAL_SLI15693_SW_MASK_MAX_16SLOTS)
+            {
+                bChildMode = PHPAL_SLI15693_SW_NODE_1SLOT;
+            }
+
+            /* Push in reverse order, so the slots are resolved in ascending order */
+            for (bSlot = 16; bSlot > 0; --bSlot)
+            {
+                if (wCollisions & (uint16_t)(1 << (bSlot - 1)))
+                {
+                    if (!phpalSli15693_Sw_PushNode(aNodes, &bNumNodes, &sNode, (uint8_t)(bSlot - 1), 4, bChildMode))
+                    {
+                        *pMoreTagsAvailable = 1;
+                    }
+                }
+            }
+        }
+        /* The half of a split collided again, so there are at least two more tags: use 16 slots */
+        else if ((sNode.bMode == PHPAL_SLI15693_SW_NODE_1SLOT_SPLIT) && (sNode.bMaskBitLength <= PHPAL_SLI15693_SW_MASK_MAX_16SLOTS))
+        {
+            if (!phpalSli15693_Sw_PushNode(aNodes, &bNumNodes, &sNode, 0, 0, PHPAL_SLI15693_SW_NODE_16SLOTS))
+            {
+                *pMoreTagsAvailable = 1;
+            }
+        }
+        /* Split the collision by the next mask bit */
+        else if (sNode.bMaskBitLength < PHPAL_SLI15693_SW_UID_COMPLETE)
+        {
+            if (!phpalSli15693_Sw_PushNode(aNodes, &bNumNodes, &sNode, 1, 1, PHPAL_SLI15693_SW_NODE_1SLOT_SPLIT) ||
+                !phpalSli15693_Sw_PushNode(aNodes, &bNumNodes, &sNode, 0, 1, PHPAL_SLI15693_SW_NODE_1SLOT_SPLIT))
+            {
+                *pMoreTagsAvailable = 1;
+            }
+        }
+        /* A collision with a complete UID can not be resolved */
+        else
+        {
+            *pMoreTagsAvailable = 1;
+        }
+    }
+
+    /* Set long timeout. */
+    PH_CHECK_SUCCESS_FCT(statusTmp, phpalSli15693_SetConfig(
+        pDataParams,
+        PHPAL_SLI15693_CONFIG_TIMEOUT_US,
+        PHPAL_SLI15693_TIMEOUT_LONG_US));
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_SLI15693);
+}
+
+static uint8_t phpalSli15693_Sw_PushNode(
+    phpalSli15693_Sw_InventoryNode_t * pNodes,
+    uint8_t * pNumNodes,
+    phpalSli15693_Sw_InventoryNode_t * pParent,
+    uint8_t bValue,
+    uint8_t bNumBits,
+    uint8_t bMode
+    )
+{
+    phpalSli15693_Sw_InventoryNode_t * PH_MEMLOC_REM pNode;
+    uint8_t     PH_MEMLOC_REM bByte;
+    uint8_t     PH_MEMLOC_REM bBit;
+
+    if (*pNumNodes == PHPAL_SLI15693_SW_INVENTORY_STACK_SIZE)
+    {
+        return 0;
+    }
+
+    pNode = &pNodes[(*pNumNodes)++];
+    memcpy(pNode, pParent, sizeof(phpalSli15693_Sw_InventoryNode_t));  /* PRQA S 3200 */
+    pNode->bMode = bMode;
+
+    if (bNumBits == 0)
+    {
+        return 1;
+    }
+
+    /* Append the bits to the mask, least significant bit first */
+    bByte = pNode->bMaskBitLength >> 3;
+    bBit = pNode->bMaskBitLength & 0x07;
+
+    pNode->aMask[bByte] &= (uint8_t)(0xFF >> (8 - bBit));
+    pNode->aMask[bByte] |= (uint8_t)(bValue << bBit);
+
+    /* Bits which do not fit into the incomplete byte go to the next byte */
+    if ((bBit + bNumBits) > 8)
+    {
+        pNode->aMask[bByte + 1] = (uint8_t)(bValue >> (8 - bBit));
+    }
+
+    pNode->bMaskBitLength = pNode->bMaskBitLength + bNumBits;
+
+    return 1;
+}
+
 phStatus_t phpalSli15693_Sw_InventoryEx(
                                         phpalSli15693_Sw_DataParams_t * pDataParams,
                                         uint8_t bCmd,
@@ -1265,6 +1539,9 @@ phStatus_t phpalSli15693_Sw_InventoryEx(
                 }
             }
 
+            /* UID is now complete */
+            pDataParams->bUidBitLength = PHPAL_SLI15693_SW_UID_COMPLETE;
+
             /* shift pointer and length */
             pResp += *pUidLength;
             wRespLength = wRespLength - *pUidLength;
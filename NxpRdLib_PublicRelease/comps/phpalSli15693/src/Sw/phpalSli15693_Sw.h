@@ -86,6 +86,12 @@ phStatus_t phpalSli15693_Sw_GetSerialNo(
                                         uint8_t * bUidLength
                                         );
 
+phStatus_t phpalSli15693_Sw_SetSerialNo(
+                                        phpalSli15693_Sw_DataParams_t * pDataParams,
+                                        uint8_t * pUid,
+                                        uint8_t bUidLength
+                                        );
+
 phStatus_t phpalSli15693_Sw_SetConfig(
                                       phpalSli15693_Sw_DataParams_t * pDataParams,
                                       uint16_t wConfig,
@@ -154,4 +160,18 @@ phStatus_t phpalSli15693_Sw_FastInventoryPageRead(
     uint16_t * pDataLength
     );
 
+phStatus_t phpalSli15693_Sw_InventoryAll(
+                                         phpalSli15693_Sw_DataParams_t * pDataParams,
+                                         uint8_t bFlags,
+                                         uint8_t bAfi,
+                                         uint8_t * pUids,
+                                         uint8_t * pDsfids,
+                                         uint8_t bMaxTags,
+                                         uint8_t * pNumTags,
+                                         phpalSli15693_RoundStats_t * pRoundStats,
+                                         uint8_t bMaxRounds,
+                                         uint8_t * pNumRounds,
+                                         uint8_t * pMoreTagsAvailable
+                                         );
+
 #endif /* PHPALSLI15693_SW_H */
@@ -82,6 +82,31 @@
 #define PHPAL_SLI15693_SW_CMD_FAST_INVENTORY_PAGE_READ  0xB1U
 /*@}*/
 
+/** \name Inventory engine
+*/
+/*@{*/
+/** Number of pending mask tree nodes of #phpalSli15693_Sw_InventoryAll. */
+#define PHPAL_SLI15693_SW_INVENTORY_STACK_SIZE      32U
+/** Maximum mask length in bits of a 16 slot inventory. */
+#define PHPAL_SLI15693_SW_MASK_MAX_16SLOTS          60U
+/** Node is resolved with a 16 slot round. */
+#define PHPAL_SLI15693_SW_NODE_16SLOTS              0x00U
+/** Node is resolved with a 1 slot round. */
+#define PHPAL_SLI15693_SW_NODE_1SLOT                0x01U
+/** Node is one half of a 1 slot round which collided. */
+#define PHPAL_SLI15693_SW_NODE_1SLOT_SPLIT          0x02U
+/*@}*/
+
+/**
+* \brief Pending node of the inventory mask tree.
+*/
+typedef struct
+{
+    uint8_t aMask[PHPAL_SLI15693_UID_LENGTH];   /**< UID mask of the node. */
+    uint8_t bMaskBitLength;                     /**< Length of the UID mask in bits. */
+    uint8_t bMode;                              /**< How the node is resolved, e.g. #PHPAL_SLI15693_SW_NODE_16SLOTS. */
+} phpalSli15693_Sw_InventoryNode_t;
+
 /**
 * \brief Perform all kinds of Inventory commands.
 * \return Status code
@@ -541,6 +541,57 @@ phStatus_t phpalSli15693_GetSerialNo(
     return status;
 }
 
+phStatus_t phpalSli15693_SetSerialNo(
+                                     void * pDataParams,
+                                     uint8_t * pUid,
+                                     uint8_t bUidLength
+                                     )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalSli15693_SetSerialNo");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUid);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bUidLength);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_BUFFER(PH_LOG_LOGTYPE_DEBUG, pUid_log, pUid, bUidLength);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bUidLength_log, &bUidLength);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUid);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_SLI15693)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_SLI15693);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_SLI15693_SW
+    case PHPAL_SLI15693_SW_ID:
+        status = phpalSli15693_Sw_SetSerialNo((phpalSli15693_Sw_DataParams_t *)pDataParams, pUid, bUidLength);
+        break;
+#endif /* NXPBUILD__PHPAL_SLI15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_SLI15693);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 phStatus_t phpalSli15693_SetConfig(
                                    void * pDataParams,
                                    uint16_t wConfig,
@@ -1015,4 +1066,85 @@ phStatus_t phpalSli15693_FastInventoryPageRead(
     return status;
 }
 
+phStatus_t phpalSli15693_InventoryAll(
+                                      void * pDataParams,
+                                      uint8_t bFlags,
+                                      uint8_t bAfi,
+                                      uint8_t * pUids,
+                                      uint8_t * pDsfids,
+                                      uint8_t bMaxTags,
+                                      uint8_t * pNumTags,
+                                      phpalSli15693_RoundStats_t * pRoundStats,
+                                      uint8_t bMaxRounds,
+                                      uint8_t * pNumRounds,
+                                      uint8_t * pMoreTagsAvailable
+                                      )
+{
+    phStatus_t PH_MEMLOC_REM status;
+
+    PH_LOG_HELPER_ALLOCATE_TEXT(bFunctionName, "phpalSli15693_InventoryAll");
+    /*PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDataParams);*/
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bFlags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bAfi);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pUids);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pDsfids);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bMaxTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumTags);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pRoundStats);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(bMaxRounds);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pNumRounds);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(pMoreTagsAvailable);
+    PH_LOG_HELPER_ALLOCATE_PARAMNAME(status);
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bFlags_log, &bFlags);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bAfi_log, &bAfi);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bMaxTags_log, &bMaxTags);
+    PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, bMaxRounds_log, &bMaxRounds);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_ENTER);
+	PH_ASSERT_NULL (pDataParams);
+	PH_ASSERT_NULL (pUids);
+	PH_ASSERT_NULL (pDsfids);
+	PH_ASSERT_NULL (pNumTags);
+	PH_ASSERT_NULL (pNumRounds);
+	PH_ASSERT_NULL (pMoreTagsAvailable);
+
+    /* Check data parameters */
+    if (PH_GET_COMPCODE(pDataParams) != PH_COMP_PAL_SLI15693)
+    {
+        PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+        PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+        PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+        return PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_SLI15693);
+    }
+
+    /* perform operation on active layer */
+    switch (PH_GET_COMPID(pDataParams))
+    {
+#ifdef NXPBUILD__PHPAL_SLI15693_SW
+    case PHPAL_SLI15693_SW_ID:
+        status = phpalSli15693_Sw_InventoryAll((phpalSli15693_Sw_DataParams_t *)pDataParams, bFlags, bAfi, pUids, pDsfids, bMaxTags, pNumTags, pRoundStats, bMaxRounds, pNumRounds, pMoreTagsAvailable);
+        break;
+#endif /* NXPBUILD__PHPAL_SLI15693_SW */
+
+    default:
+        status = PH_ADD_COMPCODE(PH_ERR_INVALID_DATA_PARAMS, PH_COMP_PAL_SLI15693);
+        break;
+    }
+
+    PH_LOG_HELPER_ADDSTRING(PH_LOG_LOGTYPE_INFO, bFunctionName);
+#ifdef NXPBUILD__PH_LOG
+    if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS)
+    {
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNumTags_log, pNumTags);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pNumRounds_log, pNumRounds);
+        PH_LOG_HELPER_ADDPARAM_UINT8(PH_LOG_LOGTYPE_DEBUG, pMoreTagsAvailable_log, pMoreTagsAvailable);
+    }
+#endif
+    PH_LOG_HELPER_ADDPARAM_UINT16(PH_LOG_LOGTYPE_INFO, status_log, &status);
+    PH_LOG_HELPER_EXECUTE(PH_LOG_OPTION_CATEGORY_LEAVE);
+
+    return status;
+}
+
 #endif /* NXPBUILD__PHPAL_SLI15693 */
@@ -0,0 +1,93 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Random Number Generator Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHCRYPTORNG_H
+#define PHCRYPTORNG_H
+
+#include <ph_Status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PH_CRYPTORNG_SW
+
+/** \defgroup phCryptoRng_Sw Component : Software
+* \brief Random numbers from the random number generator of the Linux kernel (getrandom).
+*
+* The kernel pool is seeded by the system and needs no seed from this layer.
+* @{
+*/
+
+#define PH_CRYPTORNG_SW_ID      0x01U   /**< ID for Software CryptoRng layer. */
+
+/**
+* \brief Software parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;   /**< Layer ID for this component, NEVER MODIFY! */
+} phCryptoRng_Sw_DataParams_t;
+
+/**
+* \brief Initialise the CryptoRng component.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoRng_Sw_Init(
+                               phCryptoRng_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wSizeOfDataParams                   /**< [In] Specifies the size of the data parameter structure. */
+                               );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTORNG_SW */
+
+#ifdef NXPBUILD__PH_CRYPTORNG
+
+/** \defgroup phCryptoRng CryptoRng
+* \brief Random numbers for challenges and session keys.
+* @{
+*/
+
+/**
+* \brief Get random bytes.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INTERNAL_ERROR No random bytes available.
+*/
+phStatus_t phCryptoRng_Rnd(
+                           void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                           uint16_t wNoOfRndBytes,  /**< [In] Number of random bytes. */
+                           uint8_t * pRnd           /**< [Out] Random bytes; uint8_t[wNoOfRndBytes]. */
+                           );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTORNG */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHCRYPTORNG_H */
@@ -0,0 +1,231 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Symmetric Cryptography Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHCRYPTOSYM_H
+#define PHCRYPTOSYM_H
+
+#include <ph_Status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PH_CRYPTOSYM_SW
+
+/** \defgroup phCryptoSym_Sw Component : Software
+* \brief Software implementation of DES and Triple DES.
+*
+* The round function uses combined S-box and permutation tables, the key schedule is
+* expanded once when a key is loaded. Optionally the table lookups run in constant time.
+* @{
+*/
+
+#define PH_CRYPTOSYM_SW_ID          0x01U   /**< ID for Software CryptoSym layer. */
+
+#define PH_CRYPTOSYM_SW_SUBKEYS     32U     /**< Number of expanded subkey words of one DES key. */
+
+/**
+* \brief Software parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                                           /**< Layer ID for this component, NEVER MODIFY! */
+    void * pKeyStoreDataParams;                             /**< Pointer to the parameter structure of the KeyStore layer; may be NULL. */
+    uint32_t aEncKeys[3][PH_CRYPTOSYM_SW_SUBKEYS];          /**< Expanded encryption subkeys of the loaded key. */
+    uint32_t aDecKeys[3][PH_CRYPTOSYM_SW_SUBKEYS];          /**< Expanded decryption subkeys of the loaded key. */
+    uint8_t pIV[8];                                         /**< Initialization vector of the CBC mode. */
+    uint16_t wKeyType;                                      /**< Type of the loaded key, #PH_CRYPTOSYM_KEY_TYPE_INVALID if none. */
+    uint8_t bConstantTime;                                  /**< Whether the table lookups run in constant time. */
+} phCryptoSym_Sw_DataParams_t;
+
+/**
+* \brief Initialise the CryptoSym component.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoSym_Sw_Init(
+                               phCryptoSym_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wSizeOfDataParams,                  /**< [In] Specifies the size of the data parameter structure. */
+                               void * pKeyStoreDataParams                   /**< [In] Pointer to a key store structure; may be NULL if only direct keys are used. */
+                               );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTOSYM_SW */
+
+#ifdef NXPBUILD__PH_CRYPTOSYM
+
+/** \defgroup phCryptoSym CryptoSym
+* \brief Symmetric block ciphers in ECB and CBC mode.
+*
+* In CBC mode the IV is replaced by the last cipher block of each call, so consecutive calls
+* continue the chain. Load a new IV with \ref phCryptoSym_LoadIv to start another one.
+* @{
+*/
+
+/**
+* \name Key types
+*/
+/*@{*/
+#define PH_CRYPTOSYM_KEY_TYPE_DES       0x0003U     /**< DES single key; uint8_t[8]. */
+#define PH_CRYPTOSYM_KEY_TYPE_2K3DES    0x0004U     /**< Two key Triple DES; uint8_t[16]. */
+#define PH_CRYPTOSYM_KEY_TYPE_3K3DES    0x0005U     /**< Three key Triple DES; uint8_t[24]. */
+#define PH_CRYPTOSYM_KEY_TYPE_INVALID   0xFFFFU     /**< No key loaded. */
+/*@}*/
+
+/**
+* \name Cipher modes
+*/
+/*@{*/
+#define PH_CRYPTOSYM_CIPHER_MODE_ECB    0x0000U     /**< Electronic code book mode. */
+#define PH_CRYPTOSYM_CIPHER_MODE_CBC    0x0001U     /**< Cipher block chaining mode. */
+/*@}*/
+
+/**
+* \name Configuration options
+*/
+/*@{*/
+#define PH_CRYPTOSYM_CONFIG_KEY_TYPE        0x0000U     /**< Type of the loaded key; read only. */
+#define PH_CRYPTOSYM_CONFIG_BLOCK_SIZE      0x0001U     /**< Block size of the loaded key; read only. */
+#define PH_CRYPTOSYM_CONFIG_CONSTANT_TIME   0x0002U     /**< #PH_ON runs the table lookups independent of key and data; default #PH_OFF. */
+/*@}*/
+
+#define PH_CRYPTOSYM_DES_BLOCK_SIZE     8U      /**< Block size of DES and Triple DES. */
+#define PH_CRYPTOSYM_DES_KEY_SIZE       8U      /**< Size of a single DES key. */
+
+/**
+* \brief Load a key from the key store.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_KEY The stored key has another type.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unsupported key type.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phCryptoSym_LoadKey(
+                               void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wKeyNo,         /**< [In] Key number in the key store. */
+                               uint16_t wKeyVersion,    /**< [In] Key version in the key store. */
+                               uint16_t wKeyType        /**< [In] Expected key type, e.g. #PH_CRYPTOSYM_KEY_TYPE_2K3DES. */
+                               );
+
+/**
+* \brief Load a key given by the caller.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unsupported key type.
+*/
+phStatus_t phCryptoSym_LoadKeyDirect(
+                                     void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t * pKey,        /**< [In] Key; its length is given by the key type. */
+                                     uint16_t wKeyType      /**< [In] Key type, e.g. #PH_CRYPTOSYM_KEY_TYPE_2K3DES. */
+                                     );
+
+/**
+* \brief Load the initialization vector of the CBC mode.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The length differs from the block size.
+*/
+phStatus_t phCryptoSym_LoadIv(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t * pIV,        /**< [In] Initialization vector. */
+                              uint8_t bIVLength     /**< [In] Length of the initialization vector. */
+                              );
+
+/**
+* \brief Encrypt whole blocks.
+*
+* The plain and the encrypted buffer may be the same.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The length is no multiple of the block size or unknown mode.
+* \retval #PH_ERR_KEY No key loaded.
+*/
+phStatus_t phCryptoSym_Encrypt(
+                               void * pDataParams,          /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wOption,            /**< [In] Cipher mode, e.g. #PH_CRYPTOSYM_CIPHER_MODE_CBC. */
+                               uint8_t * pPlainBuffer,      /**< [In] Plain data. */
+                               uint16_t wBufferLength,      /**< [In] Length of the data. */
+                               uint8_t * pEncryptedBuffer   /**< [Out] Encrypted data. */
+                               );
+
+/**
+* \brief Decrypt whole blocks.
+*
+* The encrypted and the plain buffer may be the same.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The length is no multiple of the block size or unknown mode.
+* \retval #PH_ERR_KEY No key loaded.
+*/
+phStatus_t phCryptoSym_Decrypt(
+                               void * pDataParams,          /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wOption,            /**< [In] Cipher mode, e.g. #PH_CRYPTOSYM_CIPHER_MODE_CBC. */
+                               uint8_t * pEncryptedBuffer,  /**< [In] Encrypted data. */
+                               uint16_t wBufferLength,      /**< [In] Length of the data. */
+                               uint8_t * pPlainBuffer       /**< [Out] Plain data. */
+                               );
+
+/**
+* \brief Discard the loaded key and IV.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phCryptoSym_InvalidateKey(
+                                     void * pDataParams     /**< [In] Pointer to this layer's parameter structure. */
+                                     );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown or read only configuration option.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid value.
+*/
+phStatus_t phCryptoSym_SetConfig(
+                                 void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                 uint16_t wConfig,      /**< [In] Configuration Identifier */
+                                 uint16_t wValue        /**< [In] Configuration Value */
+                                 );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phCryptoSym_GetConfig(
+                                 void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                 uint16_t wConfig,      /**< [In] Configuration Identifier */
+                                 uint16_t * pValue      /**< [Out] Configuration Value */
+                                 );
+
+/** @} */
+#endif /* NXPBUILD__PH_CRYPTOSYM */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHCRYPTOSYM_H */
@@ -102,6 +102,118 @@ phStatus_t phKeyStore_Sw_Init(
 /** @} */
 #endif /* NXPBUILD__PH_KEYSTORE_SW */
 
+#ifdef NXPBUILD__PH_KEYSTORE_IDX
+
+/** \defgroup phKeyStore_Idx Component : Indexed Software
+* \brief Keystore implementation in Software for concurrent readers.
+*
+* Keys are found through a hash index on (key number, key version) instead of a scan over the versions.
+* Reading a key takes no lock : a store wide sequence counter is read before and after the copy and the
+* copy is repeated if a writer ran in between. Writers are serialized by the same counter. The key usage
+* counters are incremented atomically, so several threads may share one keystore, e.g. one HAL each calling
+* phhalHw_MfcAuthenticateKeyNo.
+* @{
+*/
+
+#define PH_KEYSTORE_IDX_ID              0x05    /**< ID for indexed Software KeyStore component. */
+#define PH_KEYSTORE_IDX_MAX_KEY_SIZE    32U     /**< Maximum size of a Key. */
+#define PH_KEYSTORE_IDX_INDEX_EMPTY     0xFFFFU /**< Value of an unused index slot. */
+
+/**
+* \brief Idx KeyVersionPair structure
+*/
+typedef struct
+{
+    uint8_t pKey[PH_KEYSTORE_IDX_MAX_KEY_SIZE]; /**< Array containing a Key  */
+    uint16_t wVersion;                          /**< Versions related to  the Key*/
+} phKeyStore_Idx_KeyVersionPair_t;
+
+/**
+* \brief Idx KeyEntry structure
+*/
+typedef struct
+{
+    uint16_t wKeyType;      /**< Type of the keys in pKeys. */
+    uint16_t wRefNoKUC;     /**< Key usage counter number of the keys in pKeys. */
+} phKeyStore_Idx_KeyEntry_t;
+
+/**
+* \brief Idx KeyUsageCounter structure
+*/
+typedef struct
+{
+    uint32_t dwLimit;   /**< Limit of the Key Usage Counter. */
+    uint32_t dwCurVal;  /**< Current Value of the KUC, incremented atomically. */
+} phKeyStore_Idx_KUCEntry_t;
+
+/**
+* \brief Idx parameter structure
+*/
+typedef struct
+{
+    uint16_t  wId;                                      /**< Layer ID for this component, NEVER MODIFY! */
+    phKeyStore_Idx_KeyEntry_t * pKeyEntries;            /**< Key entry storage, size = sizeof(#phKeyStore_Idx_KeyEntry_t) * wNoOfKeyEntries. */
+    phKeyStore_Idx_KeyVersionPair_t * pKeyVersionPairs; /**< Key version pairs, size = sizeof(#phKeyStore_Idx_KeyVersionPair_t) * wNoOfKeyEntries * wNoOfVersions. */
+    uint16_t wNoOfKeyEntries;                           /**< Number of key entries in that storage. */
+    uint16_t wNoOfVersions;                             /**< Number of versions in each key entry. */
+    phKeyStore_Idx_KUCEntry_t * pKUCEntries;            /**< Key usage counter entry storage, size = sizeof(#phKeyStore_Idx_KUCEntry_t) * wNoOfKUCEntries. */
+    uint16_t wNoOfKUCEntries;                           /**< Number of Key usage counter entries. */
+    uint16_t * pIndex;                                  /**< Hash index, position of the key version pair of each (key number, version). */
+    uint16_t wIndexSize;                                /**< Number of slots of pIndex, a power of two. */
+    uint32_t dwSequence;                                /**< Odd while a writer modifies the keystore. */
+} phKeyStore_Idx_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+*
+* The index needs a power of two greater than the number of key version pairs as size,
+* twice this number keeps the lookups short.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The index is too small or its size no power of two.
+*/
+phStatus_t phKeyStore_Idx_Init(
+                               phKeyStore_Idx_DataParams_t * pDataParams,           /**< [In] Pointer to this layer's parameter structure. */
+                               uint16_t wSizeOfDataParams,                          /**< [In] Specifies the size of the data parameter structure. */
+                               phKeyStore_Idx_KeyEntry_t * pKeyEntries,             /**< [In] Pointer to a storage containing the key entries. */
+                               uint16_t wNoOfKeyEntries,                            /**< [In] size of pKeyEntries. */
+                               phKeyStore_Idx_KeyVersionPair_t * pKeyVersionPairs,  /**< [In] Pointer to a storage containing the key version pairs. */
+                               uint16_t wNoOfVersionPairs,                          /**< [In] amount of key versions available in each key entry. */
+                               phKeyStore_Idx_KUCEntry_t * pKUCEntries,             /**< [In] Key usage counter entry storage, size = sizeof(phKeyStore_Idx_KUCEntry_t) * wNumKUCEntries */
+                               uint16_t wNoOfKUCEntries,                            /**< [In] Number of Key usage counter entries. */
+                               uint16_t * pIndex,                                   /**< [In] Storage of the hash index. */
+                               uint16_t wIndexSize                                  /**< [In] Number of slots of pIndex. */
+                               );
+
+/**
+* \name Key file
+*/
+/*@{*/
+#define PH_KEYSTORE_IDX_FILE_HEADER_SIZE    4U  /**< Size of the header of a key file, 7Fh 'K' 'S' '1'. */
+#define PH_KEYSTORE_IDX_FILE_RECORD_SIZE    8U  /**< Size of a record without its key. */
+/*@}*/
+
+/**
+* \brief Import a binary key file.
+*
+* The file starts with the header 7Fh 'K' 'S' '1' followed by one record per key : key number, key version,
+* key type and key usage counter number (#PH_KEYSTORE_INVALID_ID for none) as little endian 16 bit values,
+* then the key itself whose length is given by its type. Each record replaces the key entry, its key becomes
+* the first version. The records are checked before anything is imported.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid header, truncated record, unknown key type or key number out of range.
+*/
+phStatus_t phKeyStore_Idx_ImportKeys(
+                                     phKeyStore_Idx_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t * pData,                           /**< [In] Content of the key file. */
+                                     uint32_t dwDataLength,                     /**< [In] Length of the key file. */
+                                     uint16_t * pNoOfKeys                       /**< [Out] Number of imported keys. */
+                                     );
+
+/** @} */
+#endif /* NXPBUILD__PH_KEYSTORE_IDX */
+
 #ifdef NXPBUILD__PH_KEYSTORE_RC663
 
 #include <phhalHw.h>
@@ -0,0 +1,202 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Session Manager Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHSESSIONMANAGER_H
+#define PHSESSIONMANAGER_H
+
+#include <ph_Status.h>
+#include <phhalHw.h>
+#include <phpalI14443p4.h>
+#include <phCidManager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PH_SESSIONMANAGER
+
+/** \defgroup phSessionManager Session Manager
+* \brief Keeps several ISO14443-4A cards active at the same time.
+*
+* Each card is activated once with its own CID retrieved from the \ref phCidManager
+* and keeps its own ISO14443-4 protocol state, so APDUs for different cards can be
+* interleaved freely without repeating the activation sequence.
+* @{
+*/
+
+#define PH_SESSIONMANAGER_MAX_SESSIONS  PH_CIDMANAGER_LAST_CID  /**< Maximum number of concurrent sessions. */
+#define PH_SESSIONMANAGER_NO_SESSION    0xFFU                   /**< Session handle value meaning "no session". */
+
+/**
+* \brief Activate all ISO14443-4A cards in the field, each one in its own session.
+*
+* Cards are activated until the field is empty, no session or CID is left, or a card
+* without CID support has been activated. Cards which are not ISO14443-4 compliant are halted.
+* A card without CID support is only kept if it is the only active card, otherwise it is deselected.
+* The data rates are negotiated per card, #PHPAL_I14443P4A_DATARATE_AUTO may be used for both.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if no card has been found.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phSessionManager_ActivateCards(
+                                          void * pDataParams,       /**< [In] Pointer to this layer's parameter structure. */
+                                          uint8_t bFsdi,            /**< [In] Frame Size Integer; 0-8 */
+                                          uint8_t bDri,             /**< [In] Divisor Receive (PCD to PICC) Integer; 0-3 or #PHPAL_I14443P4A_DATARATE_AUTO */
+                                          uint8_t bDsi,             /**< [In] Divisor Send (PICC to PCD) Integer; 0-3 or #PHPAL_I14443P4A_DATARATE_AUTO */
+                                          uint8_t * pNoOfSessions   /**< [Out] Number of active sessions. */
+                                          );
+
+/**
+* \brief Make a session the current one.
+*
+* The HAL data rates and frame waiting time are only reapplied if the session changes.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid or unused session handle.
+*/
+phStatus_t phSessionManager_SelectSession(
+                                          void * pDataParams,               /**< [In] Pointer to this layer's parameter structure. */
+                                          uint8_t bSession,                 /**< [In] Session handle. */
+                                          void ** ppPalI14443p4DataParams   /**< [Out] ISO14443-4 layer parameter structure of the session; may be NULL. */
+                                          );
+
+/**
+* \brief Perform an ISO14443-4 exchange with the card of a session.
+*
+* Same as \ref phpalI14443p4_Exchange on the session selected by \ref phSessionManager_SelectSession.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid or unused session handle.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phSessionManager_Exchange(
+                                     void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t bSession,      /**< [In] Session handle. */
+                                     uint16_t wOption,      /**< [In] Option parameter. */
+                                     uint8_t * pTxBuffer,   /**< [In] Data to transmit. */
+                                     uint16_t wTxLength,    /**< [In] Length of data to transmit. */
+                                     uint8_t ** ppRxBuffer, /**< [Out] Pointer to received data. */
+                                     uint16_t * pRxLength   /**< [Out] number of received data bytes. */
+                                     );
+
+/**
+* \brief Deselect the card of a session and release its CID.
+*
+* The session is released even if the card does not answer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid or unused session handle.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phSessionManager_Deselect(
+                                     void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t bSession       /**< [In] Session handle. */
+                                     );
+
+/**
+* \brief Retrieve the card information of a session.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid or unused session handle.
+*/
+phStatus_t phSessionManager_GetSessionInfo(
+                                           void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                                           uint8_t bSession,        /**< [In] Session handle. */
+                                           uint8_t * pUid,          /**< [Out] Uid of the card; uint8_t[10]. */
+                                           uint8_t * pUidLength,    /**< [Out] Length of the Uid; 4/7/10. */
+                                           uint8_t * pSak,          /**< [Out] Select Acknowledge of the card. */
+                                           uint8_t * pCid           /**< [Out] Card Identifier of the session. */
+                                           );
+
+/** @} */
+#endif /* NXPBUILD__PH_SESSIONMANAGER */
+
+#ifdef NXPBUILD__PH_SESSIONMANAGER_SW
+
+/** \defgroup phSessionManager_Sw Component : Software
+* \brief Software implementation.
+* @{
+*/
+
+#define PH_SESSIONMANAGER_SW_ID     0x01U   /**< ID for Software component. */
+
+/**
+* \brief State of one ISO14443-4A card session.
+*/
+typedef struct
+{
+    uint8_t bActive;                /**< Session state; Unequal '0' if a card is active in this session. */
+    uint8_t bCid;                   /**< Card Identifier of the session; '0' if the card does not support CIDs. */
+    uint8_t bSak;                   /**< Select Acknowledge of the card. */
+    uint8_t bUidLength;             /**< Length of the Uid; 4/7/10. */
+    uint8_t aUid[10];               /**< Uid of the card. */
+    uint8_t bFwi;                   /**< Frame Waiting Integer of the card. */
+    uint16_t wTxDatarate;           /**< HAL Tx data rate negotiated with the card, e.g. #PHHAL_HW_RF_DATARATE_106. */
+    uint16_t wRxDatarate;           /**< HAL Rx data rate negotiated with the card, e.g. #PHHAL_HW_RF_DATARATE_106. */
+    phpalI14443p4_Sw_DataParams_t sPalI14443p4; /**< ISO14443-4 protocol state (block number, frame sizes) of the card. */
+} phSessionManager_Sw_Session_t;
+
+/**
+* \brief Software Session Manager parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                               /**< Layer ID for this component, NEVER MODIFY! */
+    void * pHalDataParams;                      /**< Pointer to the parameter structure of the underlying HAL layer. */
+    void * pPalI14443p3aDataParams;             /**< Pointer to the parameter structure of the ISO14443-3A layer. */
+    void * pPalI14443p4aDataParams;             /**< Pointer to the parameter structure of the ISO14443-4A layer. */
+    void * pCidManagerDataParams;               /**< Pointer to the parameter structure of the Cid Manager. */
+    phSessionManager_Sw_Session_t * pSessions;  /**< Pointer to the session storage. */
+    uint8_t bNoOfSessions;                      /**< Number of sessions in the session storage. */
+    uint8_t bCurrentSession;                    /**< Session the HAL is currently configured for; #PH_SESSIONMANAGER_NO_SESSION if none. */
+} phSessionManager_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+*
+* The ISO14443-4 protocol state of each session is initialised on top of \c pHalDataParams.
+* At most #PH_SESSIONMANAGER_MAX_SESSIONS sessions are usable, additional storage is ignored.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phSessionManager_Sw_Init(
+                                    phSessionManager_Sw_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                    uint16_t wSizeOfDataParams,                     /**< [In] Specifies the size of the data parameter structure. */
+                                    void * pHalDataParams,                          /**< [In] Pointer to the parameter structure of the underlying HAL layer. */
+                                    void * pPalI14443p3aDataParams,                 /**< [In] Pointer to the parameter structure of the ISO14443-3A layer. */
+                                    void * pPalI14443p4aDataParams,                 /**< [In] Pointer to the parameter structure of the ISO14443-4A layer. */
+                                    void * pCidManagerDataParams,                   /**< [In] Pointer to the parameter structure of the Cid Manager. */
+                                    phSessionManager_Sw_Session_t * pSessions,      /**< [In] Session storage. */
+                                    uint8_t bNoOfSessions                           /**< [In] Number of sessions in the session storage. */
+                                    );
+
+/** @} */
+#endif /* NXPBUILD__PH_SESSIONMANAGER_SW */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHSESSIONMANAGER_H */
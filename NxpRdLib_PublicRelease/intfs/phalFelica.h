@@ -0,0 +1,179 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Felica Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALFELICA_H
+#define PHALFELICA_H
+
+#include <ph_Status.h>
+#include <phpalFelica.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PHAL_FELICA_SW
+
+/** \defgroup phalFelica_Sw Component : Software
+* @{
+*/
+
+#define PHAL_FELICA_SW_ID       0x01    /**< ID for Software Felica layer */
+
+/**
+* \brief Private parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                                   /**< Layer ID for this component, NEVER MODIFY! */
+    void * pPalFelicaDataParams;                    /**< Pointer to palFelica parameter structure. */
+    uint8_t bMaxReadBlocks;                         /**< Blocks per Read Without Encryption command; '0' derives the limit from PMm. */
+    uint8_t bMaxWriteBlocks;                        /**< Blocks per Write Without Encryption command; '0' derives the limit from PMm. */
+    uint8_t bLearnedReadBlocks;                     /**< Read limit learned from the card addressed by \c aIDm; '0' if none. */
+    uint8_t bLearnedWriteBlocks;                    /**< Write limit learned from the card addressed by \c aIDm; '0' if none. */
+    uint8_t aIDm[PHPAL_FELICA_IDM_LENGTH];          /**< IDm of the card the learned limits belong to. */
+} phalFelica_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalFelica_Sw_Init(
+                              phalFelica_Sw_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wSizeOfDataParams,               /**< [In] Specifies the size of the data parameter structure. */
+                              void * pPalFelicaDataParams               /**< [In] Pointer to palFelica parameter structure. */
+                              );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_FELICA_SW */
+
+#ifdef NXPBUILD__PHAL_FELICA
+
+/** \defgroup phalFelica Felica
+* \brief These Components implement the Felica commands without encryption.
+*
+* Block lists are split into as few commands as possible. Each command carries as many
+* services and blocks as the frame size and the block limit of the card allow, the response
+* timeout of each command is derived from PMm for its number of blocks by the \ref phpalFelica layer.
+* @{
+*/
+
+/**
+* \name Felica error codes
+*/
+/*@{*/
+#define PHAL_FELICA_ERR_FELICA  (PH_ERR_CUSTOM_BEGIN+0)     /**< The card reported an error in the status flags. */
+/*@}*/
+
+/**
+* \name Felica configuration options
+*/
+/*@{*/
+#define PHAL_FELICA_CONFIG_MAX_READ_BLOCKS   0x0000U    /**< Blocks per Read Without Encryption command; '0' derives the limit from PMm. */
+#define PHAL_FELICA_CONFIG_MAX_WRITE_BLOCKS  0x0001U    /**< Blocks per Write Without Encryption command; '0' derives the limit from PMm. */
+/*@}*/
+
+#define PHAL_FELICA_BLOCK_LENGTH        16U     /**< Length of a Felica data block. */
+#define PHAL_FELICA_MAX_SERVICES        16U     /**< Maximum number of services in one command. */
+#define PHAL_FELICA_MAX_BLOCKS          15U     /**< Maximum number of blocks in one command. */
+
+/**
+* \brief Address of one block in a block list.
+*/
+typedef struct
+{
+    uint16_t wServiceCode;      /**< Service code the block belongs to. */
+    uint16_t wBlockNo;          /**< Block number within the service. */
+} phalFelica_Block_t;
+
+/**
+* \brief Read the blocks of a block list (Read Without Encryption).
+*
+* The blocks may belong to different services and may be given in any order.
+* The data is stored in the order of the block list.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PHAL_FELICA_ERR_FELICA The card reported an error, see \c pStatusFlags.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalFelica_ReadWithoutEncryption(
+                                            void * pDataParams,             /**< [In] Pointer to this layer's parameter structure. */
+                                            phalFelica_Block_t * pBlocks,   /**< [In] Block list. */
+                                            uint16_t wNumBlocks,            /**< [In] Number of blocks in the block list. */
+                                            uint8_t * pData,                /**< [Out] Block data; uint8_t[#PHAL_FELICA_BLOCK_LENGTH * wNumBlocks]. */
+                                            uint8_t * pStatusFlags          /**< [Out] Status flag 1 and 2 of the last command; uint8_t[2]. */
+                                            );
+
+/**
+* \brief Write the blocks of a block list (Write Without Encryption).
+*
+* The blocks may belong to different services and may be given in any order.
+* If an error occurs, the blocks of all preceding commands have been written.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PHAL_FELICA_ERR_FELICA The card reported an error, see \c pStatusFlags.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalFelica_WriteWithoutEncryption(
+                                             void * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+                                             phalFelica_Block_t * pBlocks,  /**< [In] Block list. */
+                                             uint16_t wNumBlocks,           /**< [In] Number of blocks in the block list. */
+                                             uint8_t * pData,               /**< [In] Block data; uint8_t[#PHAL_FELICA_BLOCK_LENGTH * wNumBlocks]. */
+                                             uint8_t * pStatusFlags         /**< [Out] Status flag 1 and 2 of the last command; uint8_t[2]. */
+                                             );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid value.
+*/
+phStatus_t phalFelica_SetConfig(
+                                void * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                uint16_t wConfig,   /**< [In] Configuration Identifier */
+                                uint16_t wValue     /**< [In] Configuration Value */
+                                );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phalFelica_GetConfig(
+                                void * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                                uint16_t wConfig,   /**< [In] Configuration Identifier */
+                                uint16_t * pValue   /**< [Out] Configuration Value */
+                                );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_FELICA */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHALFELICA_H */
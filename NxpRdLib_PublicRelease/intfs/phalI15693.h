@@ -0,0 +1,150 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic ISO15693 Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALI15693_H
+#define PHALI15693_H
+
+#include <ph_Status.h>
+#include <phpalSli15693.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PHAL_I15693_SW
+
+/** \defgroup phalI15693_Sw Component : Software
+* @{
+*/
+
+#define PHAL_I15693_SW_ID       0x01    /**< ID for Software ISO15693 layer */
+
+/**
+* \brief Private parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
+    void * pPalSli15693DataParams;  /**< Pointer to palSli15693 parameter structure. */
+} phalI15693_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalI15693_Sw_Init(
+                              phalI15693_Sw_DataParams_t * pDataParams, /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wSizeOfDataParams,               /**< [In] Specifies the size of the data parameter structure. */
+                              void * pPalSli15693DataParams             /**< [In] Pointer to palSli15693 parameter structure. */
+                              );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_I15693_SW */
+
+#ifdef NXPBUILD__PHAL_I15693
+
+/** \defgroup phalI15693 ISO/IEC 15693
+* \brief These Components implement the ISO/IEC 15693 commands.
+* @{
+*/
+
+/**
+* \name Harvest options
+*/
+/*@{*/
+#define PHAL_I15693_HARVEST_DEFAULT             0x00U   /**< Use InventoryRead, fall back to Read Multiple Blocks. */
+#define PHAL_I15693_HARVEST_FAST                0x01U   /**< Use FastInventoryRead instead of InventoryRead. */
+#define PHAL_I15693_HARVEST_READ_MULTIPLE_ONLY  0x02U   /**< Do not use InventoryRead, e.g. for tags of other manufacturers. */
+/*@}*/
+
+/**
+* \name Harvest result records
+*
+* The result arena holds one record per tag: [UID][source][block data].
+*/
+/*@{*/
+#define PHAL_I15693_HARVEST_UID_OFFSET          0U      /**< Offset of the UID in a record. */
+#define PHAL_I15693_HARVEST_SOURCE_OFFSET       8U      /**< Offset of the source byte in a record. */
+#define PHAL_I15693_HARVEST_DATA_OFFSET         9U      /**< Offset of the block data in a record. */
+/** Length of a record for \c wNumBlocks blocks. */
+#define PHAL_I15693_HARVEST_RECORD_LENGTH(wNumBlocks)   (PHAL_I15693_HARVEST_DATA_OFFSET + ((wNumBlocks) * PHPAL_SLI15693_BLOCK_LENGTH))
+
+#define PHAL_I15693_HARVEST_SOURCE_NONE         0x00U   /**< The block data could not be read. */
+#define PHAL_I15693_HARVEST_SOURCE_INV_READ     0x01U   /**< The block data was received with the inventory response. */
+#define PHAL_I15693_HARVEST_SOURCE_READ_MULTIPLE 0x02U  /**< The block data was read with Read Multiple Blocks. */
+/*@}*/
+
+/**
+* \brief Perform a ISO15693 Read Multiple Blocks command.
+*
+* Flags and addressing are taken from the \ref phpalSli15693 layer, the option flag shall not be set.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR Invalid response received.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalI15693_ReadMultipleBlocks(
+                                         void * pDataParams,        /**< [In] Pointer to this layer's parameter structure. */
+                                         uint8_t bBlockNo,          /**< [In] Block number of the first block to read. */
+                                         uint16_t wNumBlocks,       /**< [In] Number of blocks to read; 1-256. */
+                                         uint8_t * pData,           /**< [Out] Block data; uint8_t[#PHPAL_SLI15693_BLOCK_LENGTH * wNumBlocks]. */
+                                         uint16_t * pDataLength     /**< [Out] Number of received data bytes. */
+                                         );
+
+/**
+* \brief Read the same blocks from every tag in the field.
+*
+* Unless #PHAL_I15693_HARVEST_READ_MULTIPLE_ONLY is given, the tags are enumerated with
+* 1 slot InventoryRead requests, so every tag returns its UID and the block data in its inventory response.
+* Tags which did not deliver the data this way are enumerated with \ref phpalSli15693_InventoryAll
+* and read with addressed Read Multiple Blocks commands, using the largest block count the tag accepts.
+*
+* The high data rate is always used. Every tag which has been found is left in quiet state.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if no tag has been found.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalI15693_Harvest(
+                              void * pDataParams,           /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bOption,              /**< [In] Option, e.g. #PHAL_I15693_HARVEST_DEFAULT. */
+                              uint8_t bFlags,               /**< [In] Request flags byte; see \ref phpalSli15693_InventoryAll. */
+                              uint8_t bAfi,                 /**< [In] Application Family Identifier. */
+                              uint8_t bBlockNo,             /**< [In] Block number of the first block to read. */
+                              uint16_t wNumBlocks,          /**< [In] Number of blocks to read; 1-256. */
+                              uint8_t * pArena,             /**< [Out] Result records; uint8_t[#PHAL_I15693_HARVEST_RECORD_LENGTH(wNumBlocks) * bMaxTags]. */
+                              uint8_t bMaxTags,             /**< [In] Maximum number of records. */
+                              uint8_t * pNumTags,           /**< [Out] Number of records. */
+                              uint8_t * pMoreTagsAvailable  /**< [Out] Unequal '0' if not all tags could be retrieved. */
+                              );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_I15693 */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHALI15693_H */
@@ -50,6 +50,11 @@ typedef struct
     uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
     void * pPalMifareDataParams;    /**< Pointer to the parameter structure of the palMifare component. */
     void * pKeyStoreDataParams;     /**< Pointer to the parameter structure of the KeyStore component. */
+    uint8_t bAuthSector;            /**< Sector the card is authenticated to; #PHAL_MFC_NO_SECTOR if none. */
+    uint8_t bAuthKeyType;           /**< Key type of the current authentication. */
+    uint16_t wAuthKeyNo;            /**< Key number of the current authentication. */
+    uint16_t wAuthKeyVersion;       /**< Key version of the current authentication. */
+    uint8_t aAuthUid[4];            /**< Serial number used by the current authentication. */
 } phalMfc_Sw_DataParams_t;
 
 /**
@@ -90,6 +95,125 @@ phStatus_t phalMfc_Sw_Init(
 #define PHAL_MFC_VALUE_BLOCK_LENGTH      4U     /**< Length of a MIFARE(R) Classic value block. */
 /*@}*/
 
+/**
+* \name Sector geometry
+* Sectors 0-31 consist of 4 blocks, sectors 32-39 (MIFARE(R) Classic 4K only) of 16 blocks.
+* The last block of each sector is the sector trailer.
+*/
+/*@{*/
+#define PHAL_MFC_MAX_SECTORS            40U     /**< Number of sectors of a MIFARE(R) Classic 4K. */
+#define PHAL_MFC_MAX_SMALL_SECTORS      32U     /**< Number of 4 block sectors of a MIFARE(R) Classic 4K. */
+#define PHAL_MFC_SMALL_SECTOR_BLOCKS     4U     /**< Number of blocks of sectors 0-31. */
+#define PHAL_MFC_LARGE_SECTOR_BLOCKS    16U     /**< Number of blocks of sectors 32-39. */
+#define PHAL_MFC_NO_SECTOR            0xFFU     /**< Sector value meaning "no sector". */
+
+/** Sector a block belongs to. */
+#define PHAL_MFC_GET_SECTOR(bBlockNo)       ((uint8_t)(((uint32_t)(bBlockNo) < 128U) ? ((uint32_t)(bBlockNo) >> 2) : (32U + (((uint32_t)(bBlockNo) - 128U) >> 4))))
+/** First block of a sector. */
+#define PHAL_MFC_GET_FIRST_BLOCK(bSectorNo) ((uint8_t)(((uint32_t)(bSectorNo) < 32U) ? ((uint32_t)(bSectorNo) << 2) : (128U + (((uint32_t)(bSectorNo) - 32U) << 4))))
+/** Number of blocks of a sector. */
+#define PHAL_MFC_GET_SECTOR_BLOCKS(bSectorNo) ((uint8_t)(((uint32_t)(bSectorNo) < 32U) ? PHAL_MFC_SMALL_SECTOR_BLOCKS : PHAL_MFC_LARGE_SECTOR_BLOCKS))
+/*@}*/
+
+/**
+* \name Access permissions
+* Keys permitted to perform an operation, combined by OR.
+*/
+/*@{*/
+#define PHAL_MFC_ACCESS_NONE            0x00U   /**< Operation is never permitted. */
+#define PHAL_MFC_ACCESS_KEYA            0x01U   /**< Operation is permitted after authentication with key A. */
+#define PHAL_MFC_ACCESS_KEYB            0x02U   /**< Operation is permitted after authentication with key B. */
+/*@}*/
+
+#define PHAL_MFC_ACCESS_GROUPS          3U      /**< Number of data block groups of a sector. */
+
+/**
+* \brief Access conditions of a sector, decoded from the sector trailer.
+*
+* Sectors of 4 blocks have one block per data block group. The data block groups
+* of sectors of 16 blocks consist of 5 blocks each.
+* If key B is readable it cannot be used for authentication, so it is never permitted.
+*/
+typedef struct
+{
+    uint8_t aDataRead[PHAL_MFC_ACCESS_GROUPS];      /**< Keys permitted to read the data blocks of each group. */
+    uint8_t aDataWrite[PHAL_MFC_ACCESS_GROUPS];     /**< Keys permitted to write the data blocks of each group. */
+    uint8_t aDataIncrement[PHAL_MFC_ACCESS_GROUPS]; /**< Keys permitted to increment the value blocks of each group. */
+    uint8_t aDataDecrement[PHAL_MFC_ACCESS_GROUPS]; /**< Keys permitted to decrement, transfer and restore the value blocks of each group. */
+    uint8_t bKeyAWrite;                             /**< Keys permitted to write key A. */
+    uint8_t bAccessBitsRead;                        /**< Keys permitted to read the access bits. */
+    uint8_t bAccessBitsWrite;                       /**< Keys permitted to write the access bits. */
+    uint8_t bKeyBRead;                              /**< Keys permitted to read key B. */
+    uint8_t bKeyBWrite;                             /**< Keys permitted to write key B. */
+} phalMfc_AccessConditions_t;
+
+/** Data block group a block of a sector belongs to; the sector trailer yields #PHAL_MFC_ACCESS_GROUPS. */
+#define PHAL_MFC_GET_ACCESS_GROUP(bSectorNo, bBlockIndex) ((uint8_t)(((bSectorNo) < 32U) ? (bBlockIndex) : ((bBlockIndex) / 5U)))
+
+/**
+* \name MIFARE Classic error codes
+*/
+/*@{*/
+#define PHAL_MFC_ERR_NOT_EXECUTED   (PH_ERR_CUSTOM_BEGIN+0)     /**< The operation has not been executed because a preceding one failed. */
+#define PHAL_MFC_ERR_NO_MAD         (PH_ERR_CUSTOM_BEGIN+1)     /**< The card holds no MIFARE Application Directory. */
+/*@}*/
+
+/**
+* \name Value operations
+*/
+/*@{*/
+#define PHAL_MFC_VALUE_OP_INCREMENT     0x00U   /**< Increment the source block and transfer it to the destination block. */
+#define PHAL_MFC_VALUE_OP_DECREMENT     0x01U   /**< Decrement the source block and transfer it to the destination block. */
+#define PHAL_MFC_VALUE_OP_RESTORE       0x02U   /**< Copy the source block to the destination block. */
+#define PHAL_MFC_VALUE_OP_WRITE         0x03U   /**< Write a value block to the destination block; the source block is ignored. */
+/*@}*/
+
+/**
+* \name Value transaction options
+*/
+/*@{*/
+#define PHAL_MFC_VALUE_CHECK_OFF        0x00U   /**< The card checks the value block format itself. */
+#define PHAL_MFC_VALUE_CHECK_FORMAT     0x01U   /**< Read the source block and check its value block format before the operation. */
+/*@}*/
+
+/**
+* \brief One operation of a value transaction.
+*
+* Source and destination block have to be data blocks of the same sector.
+*/
+typedef struct
+{
+    uint8_t bOperation;                             /**< [In] Operation, e.g. #PHAL_MFC_VALUE_OP_DECREMENT. */
+    uint8_t bSrcBlockNo;                            /**< [In] Block the operation reads the value from. */
+    uint8_t bDstBlockNo;                            /**< [In] Block the result is transferred to. */
+    uint8_t bKeyType;                               /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+    uint16_t wKeyNumber;                            /**< [In] Key number to be used in authentication. */
+    uint16_t wKeyVersion;                           /**< [In] Key version to be used in authentication. */
+    uint8_t aValue[PHAL_MFC_VALUE_BLOCK_LENGTH];    /**< [In] Operand (LSB first); ignored for #PHAL_MFC_VALUE_OP_RESTORE. */
+    uint8_t bAddrData;                              /**< [In] Address byte of the value block; only used by #PHAL_MFC_VALUE_OP_WRITE. */
+    phStatus_t wStatus;                             /**< [Out] Result of the operation. */
+} phalMfc_ValueOperation_t;
+
+/**
+* \name MIFARE Application Directory
+*/
+/*@{*/
+#define PHAL_MFC_MAD_SECTOR             0x00U   /**< Sector of MAD1. */
+#define PHAL_MFC_MAD2_SECTOR            0x10U   /**< Sector of the MAD2 extension on cards with more than 16 sectors. */
+#define PHAL_MFC_MAD_GPB_DA             0x80U   /**< General purpose byte: MIFARE Application Directory available. */
+#define PHAL_MFC_MAD_GPB_ADV_MASK       0x03U   /**< General purpose byte: MAD version. */
+#define PHAL_MFC_MAD_VERSION_1          0x01U   /**< MAD version 1; 16 sectors. */
+#define PHAL_MFC_MAD_VERSION_2          0x02U   /**< MAD version 2; up to 40 sectors. */
+/** Application identifiers are function cluster code (MSB) and application code (LSB); the application code is stored first. */
+#define PHAL_MFC_MAD_AID_FREE           0x0000U /**< Sector is free. */
+#define PHAL_MFC_MAD_AID_DEFECT         0x0001U /**< Sector is defect. */
+#define PHAL_MFC_MAD_AID_RESERVED       0x0002U /**< Sector is reserved. */
+#define PHAL_MFC_MAD_AID_ADDITIONAL     0x0003U /**< Sector contains additional directory info. */
+#define PHAL_MFC_MAD_AID_CARDHOLDER     0x0004U /**< Sector contains card holder information. */
+#define PHAL_MFC_MAD_AID_NOT_APPLICABLE 0x0005U /**< Sector does not exist or is a directory sector. */
+#define PHAL_MFC_MAD_AID_NDEF           0xE103U /**< Sector contains NFC Forum NDEF data; stored as 03 E1, hence also written 0x03E1. */
+/*@}*/
+
 /**
 * \name UID Type definitions
 */
@@ -236,6 +360,197 @@ phStatus_t phalMfc_RestoreTransfer(
                                    uint8_t bDstBlockNo  /**< [In] block number to be transferred to. */
                                    );
 
+/**
+* \brief Read all blocks of a sector, including the sector trailer.
+*
+* Same as \ref phalMfc_ReadRange for the blocks of one sector.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid sector number.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_ReadSector(
+                              void * pDataParams,       /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bSectorNo,        /**< [In] Sector number; 0-39 */
+                              uint8_t bKeyType,         /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                              uint16_t wKeyNumber,      /**< [In] Key number to be used in authentication. */
+                              uint16_t wKeyVersion,     /**< [In] Key version to be used in authentication. */
+                              uint8_t * pUid,           /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                              uint8_t bUidLength,       /**< [In] Length of provided serial number (4/7/10). */
+                              uint8_t * pData           /**< [Out] Sector data; uint8_t[#PHAL_MFC_DATA_BLOCK_LENGTH * 4/16]. */
+                              );
+
+/**
+* \brief Read consecutive blocks, which may span several sectors.
+*
+* Each sector is authenticated once with the same key, the blocks of the sector are read
+* back to back. The authentication is skipped if the card is still authenticated to the sector
+* with the same key, see \ref phalMfc_ResetAuthentication.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The range exceeds the last block.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_ReadRange(
+                             void * pDataParams,        /**< [In] Pointer to this layer's parameter structure. */
+                             uint8_t bBlockNo,          /**< [In] First block to read. */
+                             uint16_t wNumBlocks,       /**< [In] Number of blocks to read. */
+                             uint8_t bKeyType,          /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                             uint16_t wKeyNumber,       /**< [In] Key number to be used in authentication. */
+                             uint16_t wKeyVersion,      /**< [In] Key version to be used in authentication. */
+                             uint8_t * pUid,            /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                             uint8_t bUidLength,        /**< [In] Length of provided serial number (4/7/10). */
+                             uint8_t * pData            /**< [Out] Block data; uint8_t[#PHAL_MFC_DATA_BLOCK_LENGTH * wNumBlocks]. */
+                             );
+
+/**
+* \brief Write consecutive blocks, which may span several sectors.
+*
+* Each sector is authenticated once with the same key, see \ref phalMfc_ReadRange.
+* Sector trailers within the range are written as well.
+* If an error occurs, all preceding blocks have been written.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The range exceeds the last block.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_WriteRange(
+                              void * pDataParams,       /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bBlockNo,         /**< [In] First block to write. */
+                              uint16_t wNumBlocks,      /**< [In] Number of blocks to write. */
+                              uint8_t bKeyType,         /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                              uint16_t wKeyNumber,      /**< [In] Key number to be used in authentication. */
+                              uint16_t wKeyVersion,     /**< [In] Key version to be used in authentication. */
+                              uint8_t * pUid,           /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                              uint8_t bUidLength,       /**< [In] Length of provided serial number (4/7/10). */
+                              uint8_t * pData           /**< [In] Block data; uint8_t[#PHAL_MFC_DATA_BLOCK_LENGTH * wNumBlocks]. */
+                              );
+
+/**
+* \brief Decode the access bits of a sector trailer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR The access bits are not consistent; the sector is blocked.
+*/
+phStatus_t phalMfc_DecodeAccessBits(
+                                    void * pDataParams,                         /**< [In] Pointer to this layer's parameter structure. */
+                                    uint8_t * pTrailer,                         /**< [In] Sector trailer; uint8_t[#PHAL_MFC_DATA_BLOCK_LENGTH]. */
+                                    phalMfc_AccessConditions_t * pAccess        /**< [Out] Decoded access conditions. */
+                                    );
+
+/**
+* \brief Read all blocks of a sector which the access conditions permit with one key.
+*
+* The sector is authenticated once and the sector trailer is read first. Then only the data blocks
+* whose access conditions permit reading with \c bKeyType are read, no command is sent that is known to fail.
+* Blocks which only the other key may read are reported in \c pOtherKeyMask, so the caller can retry these with
+* the other key. Blocks which are not readable with any key are neither read nor reported.
+* Bit n of the masks corresponds to block n of the sector, the data of blocks which are not read is left unchanged.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid sector number.
+* \retval #PH_ERR_PROTOCOL_ERROR The access bits are not consistent; only the sector trailer has been read.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_ReadSectorPlanned(
+                                     void * pDataParams,        /**< [In] Pointer to this layer's parameter structure. */
+                                     uint8_t bSectorNo,         /**< [In] Sector number; 0-39 */
+                                     uint8_t bKeyType,          /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                                     uint16_t wKeyNumber,       /**< [In] Key number to be used in authentication. */
+                                     uint16_t wKeyVersion,      /**< [In] Key version to be used in authentication. */
+                                     uint8_t * pUid,            /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                                     uint8_t bUidLength,        /**< [In] Length of provided serial number (4/7/10). */
+                                     uint8_t * pData,           /**< [Out] Sector data; uint8_t[#PHAL_MFC_DATA_BLOCK_LENGTH * 4/16]. */
+                                     uint16_t * pReadMask,      /**< [Out] Blocks which have been read. */
+                                     uint16_t * pOtherKeyMask   /**< [Out] Blocks which only the other key may read. */
+                                     );
+
+/**
+* \brief Execute a list of value operations with one authentication per sector and key.
+*
+* All operations are checked before the first command is sent. The operations are then executed grouped by
+* sector and key, in the order in which the first operation of each group appears in the list; operations of one
+* group keep their order, so backup patterns such as a decrement followed by a restore to a backup block stay intact.
+* The result of each operation is stored in its \c wStatus. The card drops its authentication on any error,
+* so all operations following a failed one are not executed and report #PHAL_MFC_ERR_NOT_EXECUTED.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER An operation is invalid; no command has been sent.
+* \retval #PH_ERR_PROTOCOL_ERROR A source block is not a value block (#PHAL_MFC_VALUE_CHECK_FORMAT).
+* \retval Other Status of the failed operation, depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_ValueTransaction(
+                                    void * pDataParams,                         /**< [In] Pointer to this layer's parameter structure. */
+                                    uint8_t * pUid,                             /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                                    uint8_t bUidLength,                         /**< [In] Length of provided serial number (4/7/10). */
+                                    uint8_t bOption,                            /**< [In] Either #PHAL_MFC_VALUE_CHECK_OFF or #PHAL_MFC_VALUE_CHECK_FORMAT. */
+                                    phalMfc_ValueOperation_t * pOperations,     /**< [In,Out] Value operations. */
+                                    uint8_t bNumOperations                      /**< [In] Number of value operations. */
+                                    );
+
+/**
+* \brief Read the MIFARE Application Directory.
+*
+* Sector 0 is authenticated once and MAD1 is read along with the general purpose byte of its sector trailer.
+* For MAD version 2 and more than 16 sectors, sector 16 is read as well. The CRC of each directory is verified.
+* \c pAids is indexed by sector number, the entries of the directory sectors and of sectors not covered by the
+* directory are set to #PHAL_MFC_MAD_AID_NOT_APPLICABLE.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid number of sectors.
+* \retval #PHAL_MFC_ERR_NO_MAD The general purpose byte does not announce a MAD.
+* \retval #PH_ERR_INTEGRITY_ERROR Wrong MAD CRC.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfc_ReadMad(
+                           void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                           uint8_t bKeyType,        /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                           uint16_t wKeyNumber,     /**< [In] Key number to be used in authentication; the public MAD key is A0A1A2A3A4A5 (key A). */
+                           uint16_t wKeyVersion,    /**< [In] Key version to be used in authentication. */
+                           uint8_t * pUid,          /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                           uint8_t bUidLength,      /**< [In] Length of provided serial number (4/7/10). */
+                           uint8_t bNumSectors,     /**< [In] Number of sectors of the card; 1-40 */
+                           uint16_t * pAids,        /**< [Out] Application identifier of each sector; uint16_t[bNumSectors]. */
+                           uint8_t * pMadVersion    /**< [Out] MAD version, e.g. #PHAL_MFC_MAD_VERSION_1. */
+                           );
+
+/**
+* \brief Read the data blocks of all sectors of one application.
+*
+* Only the sectors which the directory assigns to \c wAid are read, each with one authentication.
+* The data blocks of these sectors are concatenated in ascending sector order, sector trailers are skipped.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; \c pDataLength is '0' if no sector belongs to \c wAid.
+* \retval #PH_ERR_BUFFER_OVERFLOW \c wBufferSize is too small; nothing has been read.
+* \retval Other Depending on implementation and underlaying component; \c pDataLength holds the length read so far.
+*/
+phStatus_t phalMfc_ReadApplication(
+                                   void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                                   uint16_t wAid,           /**< [In] Application identifier, e.g. #PHAL_MFC_MAD_AID_NDEF. */
+                                   uint16_t * pAids,        /**< [In] Directory as returned by \ref phalMfc_ReadMad. */
+                                   uint8_t bNumSectors,     /**< [In] Number of entries of \c pAids. */
+                                   uint8_t bKeyType,        /**< [In] Either #PHAL_MFC_KEYA or #PHAL_MFC_KEYB. */
+                                   uint16_t wKeyNumber,     /**< [In] Key number to be used in authentication; the public NDEF key is D3F7D3F7D3F7 (key A). */
+                                   uint16_t wKeyVersion,    /**< [In] Key version to be used in authentication. */
+                                   uint8_t * pUid,          /**< [In] Complete serial number; uint8_t[4/7/10]. */
+                                   uint8_t bUidLength,      /**< [In] Length of provided serial number (4/7/10). */
+                                   uint16_t wBufferSize,    /**< [In] Size of \c pData. */
+                                   uint8_t * pData,         /**< [Out] Application data. */
+                                   uint16_t * pDataLength   /**< [Out] Length of the application data. */
+                                   );
+
+/**
+* \brief Forget the current authentication.
+*
+* Has to be called when the card has been reactivated or the key of the current key number has changed,
+* so the next sector access authenticates again. Failed commands reset the authentication automatically.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalMfc_ResetAuthentication(
+                                       void * pDataParams   /**< [In] Pointer to this layer's parameter structure. */
+                                       );
+
 /**
 * \brief Perform MIFARE(R) Personalize UID usage command sequence with MIFARE Picc.
 * UID type can be one of 
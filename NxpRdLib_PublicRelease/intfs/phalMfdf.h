@@ -0,0 +1,269 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic MIFARE(R) DESFire Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALMFDF_H
+#define PHALMFDF_H
+
+#include <ph_Status.h>
+#include <phpalMifare.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PHAL_MFDF_SW
+
+/** \defgroup phalMfdf_Sw Component : Software
+* @{
+*/
+
+#define PHAL_MFDF_SW_ID         0x01    /**< ID for Software MIFARE DESFire layer */
+
+/**
+* \brief Private parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
+    void * pPalMifareDataParams;    /**< Pointer to palMifare parameter structure. */
+    void * pPalI14443p4DataParams;  /**< Pointer to the parameter structure of the ISO14443-4 PAL; may be NULL. */
+    void * pKeyStoreDataParams;     /**< Pointer to phKeystore parameter structure. */
+    void * pCryptoDataParams;       /**< Pointer to phCrypto data parameters structure. */
+    void * pCryptoRngDataParams;    /**< Pointer to the parameter structure of the CryptoRng layer. */
+    uint8_t bWrapped;               /**< Wrap the native commands into ISO 7816-4 APDUs; #PH_ON or #PH_OFF. */
+    uint8_t bCardStatus;            /**< Status code of the last card answer. */
+    uint8_t bKeyNo;                 /**< Card key number of the current authentication, #PHAL_MFDF_NOT_AUTHENTICATED if none. */
+    uint16_t wFrames;               /**< Number of frames sent by the last command. */
+} phalMfdf_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+*
+* \c pPalI14443p4DataParams gives the frame size of the card; without it frames of
+* #PHAL_MFDF_DEFAULT_FRAME_SIZE bytes are sent.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalMfdf_Sw_Init(
+                            phalMfdf_Sw_DataParams_t * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                            uint16_t wSizeOfDataParams,                 /**< [In] Specifies the size of the data parameter structure. */
+                            void * pPalMifareDataParams,                /**< [In] Pointer to palMifare parameter structure. */
+                            void * pPalI14443p4DataParams,              /**< [In] Pointer to the parameter structure of the ISO14443-4 PAL. */
+                            void * pKeyStoreDataParams,                 /**< [In] Pointer to phKeystore parameter structure. */
+                            void * pCryptoDataParams,                   /**< [In] Pointer to phCrypto data parameters structure. */
+                            void * pCryptoRngDataParams                 /**< [In] Pointer to the parameter structure of the CryptoRng layer. */
+                            );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_MFDF_SW */
+
+#ifdef NXPBUILD__PHAL_MFDF
+
+/** \defgroup phalMfdf MIFARE(R) DESFire
+* \brief These Components implement the MIFARE(R) DESFire commands.
+*
+* Answers with the additional frame status are continued internally; the data of each
+* frame is copied once, from the receive buffer of the PAL to the buffer of the caller.
+* Data is exchanged in plain communication mode.
+* @{
+*/
+
+/**
+* \name Error codes
+*/
+/*@{*/
+#define PHAL_MFDF_ERR_NO_SUCH_KEY           (PH_ERR_CUSTOM_BEGIN+0)     /**< The card key does not exist. */
+#define PHAL_MFDF_ERR_PERMISSION_DENIED     (PH_ERR_CUSTOM_BEGIN+1)     /**< The access rights deny the command. */
+#define PHAL_MFDF_ERR_APPLICATION_NOT_FOUND (PH_ERR_CUSTOM_BEGIN+2)     /**< The application does not exist. */
+#define PHAL_MFDF_ERR_FILE_NOT_FOUND        (PH_ERR_CUSTOM_BEGIN+3)     /**< The file does not exist. */
+#define PHAL_MFDF_ERR_BOUNDARY_ERROR        (PH_ERR_CUSTOM_BEGIN+4)     /**< The range exceeds the file. */
+#define PHAL_MFDF_ERR_PICC                  (PH_ERR_CUSTOM_BEGIN+5)     /**< Any other card error, see #PHAL_MFDF_CONFIG_CARD_STATUS. */
+/*@}*/
+
+/**
+* \name Configuration options
+*/
+/*@{*/
+#define PHAL_MFDF_CONFIG_WRAPPED_MODE       0x0000U     /**< Wrap the native commands into ISO 7816-4 APDUs; #PH_ON or #PH_OFF, default #PH_OFF. */
+#define PHAL_MFDF_CONFIG_CARD_STATUS        0x0001U     /**< Status code of the last card answer; read only. */
+#define PHAL_MFDF_CONFIG_FRAMES             0x0002U     /**< Number of frames sent by the last command; read only. */
+#define PHAL_MFDF_CONFIG_KEY_NO             0x0003U     /**< Card key number of the current authentication; read only. */
+/*@}*/
+
+/**
+* \name Sizes
+*/
+/*@{*/
+#define PHAL_MFDF_AID_LENGTH                3U      /**< Length of an application identifier. */
+#define PHAL_MFDF_MAX_APPLICATIONS          28U     /**< Maximum number of applications besides the card level. */
+#define PHAL_MFDF_MAX_FILES                 32U     /**< Maximum number of files of an application. */
+#define PHAL_MFDF_DEFAULT_FRAME_SIZE        32U     /**< Frame size of the card if the ISO14443-4 PAL is unknown. */
+/*@}*/
+
+#define PHAL_MFDF_NOT_AUTHENTICATED         0xFFU   /**< Card key number if no authentication is in effect. */
+
+/**
+* \brief Perform MIFARE(R) DESFire Authenticate command with a DES or 2K3DES key.
+*
+* The key is taken from the key store; the random numbers from the CryptoRng layer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_AUTH_ERROR The card did not prove the key.
+* \retval #PH_ERR_KEY The stored key is neither DES nor 2K3DES.
+* \retval #PH_ERR_USE_CONDITION No crypto components given.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_Authenticate(
+                                 void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                                 uint8_t bKeyNoCard,    /**< [In] Key number on the card. */
+                                 uint16_t wKeyNo,       /**< [In] Key number in the key store. */
+                                 uint16_t wKeyVersion   /**< [In] Key version in the key store. */
+                                 );
+
+/**
+* \brief Perform MIFARE(R) DESFire GetApplicationIDs command.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_GetApplicationIDs(
+                                      void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                      uint8_t * pAidBuffer, /**< [Out] Application identifiers; #PHAL_MFDF_MAX_APPLICATIONS * #PHAL_MFDF_AID_LENGTH bytes. */
+                                      uint8_t * pNumAids    /**< [Out] Number of application identifiers. */
+                                      );
+
+/**
+* \brief Perform MIFARE(R) DESFire SelectApplication command.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PHAL_MFDF_ERR_APPLICATION_NOT_FOUND The application does not exist.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_SelectApplication(
+                                      void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                      uint8_t * pAid        /**< [In] Application identifier, #PHAL_MFDF_AID_LENGTH bytes. */
+                                      );
+
+/**
+* \brief Perform MIFARE(R) DESFire GetFileIDs command.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_GetFileIDs(
+                               void * pDataParams,  /**< [In] Pointer to this layer's parameter structure. */
+                               uint8_t * pFid,      /**< [Out] File numbers; #PHAL_MFDF_MAX_FILES bytes. */
+                               uint8_t * pNumFid    /**< [Out] Number of files. */
+                               );
+
+/**
+* \brief Perform MIFARE(R) DESFire ReadData command.
+*
+* The answer is reassembled in \c pBuffer however many frames the card sends.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW The data exceeds \c pBuffer.
+* \retval #PHAL_MFDF_ERR_BOUNDARY_ERROR The range exceeds the file.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_ReadData(
+                             void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                             uint8_t bFileNo,       /**< [In] File number. */
+                             uint32_t dwOffset,     /**< [In] Position of the first byte. */
+                             uint32_t dwLength,     /**< [In] Number of bytes; '0' reads up to the end of the file. */
+                             uint8_t * pBuffer,     /**< [Out] Data. */
+                             uint16_t wBufferSize,  /**< [In] Size of \c pBuffer. */
+                             uint16_t * pRxLength   /**< [Out] Number of bytes read. */
+                             );
+
+/**
+* \brief Perform MIFARE(R) DESFire WriteData command.
+*
+* The data is split into frames the card accepts.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PHAL_MFDF_ERR_BOUNDARY_ERROR The range exceeds the file.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_WriteData(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bFileNo,      /**< [In] File number. */
+                              uint32_t dwOffset,    /**< [In] Position of the first byte. */
+                              uint8_t * pData,      /**< [In] Data. */
+                              uint16_t wDataLength  /**< [In] Number of bytes. */
+                              );
+
+/**
+* \brief Perform MIFARE(R) DESFire ReadRecords command.
+*
+* The answer is reassembled in \c pBuffer however many frames the card sends.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW The records exceed \c pBuffer.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMfdf_ReadRecords(
+                                void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                                uint8_t bFileNo,        /**< [In] File number. */
+                                uint32_t dwRecordNo,    /**< [In] Record to start with, '0' is the newest. */
+                                uint32_t dwNumRecords,  /**< [In] Number of records; '0' reads all records. */
+                                uint8_t * pBuffer,      /**< [Out] Records. */
+                                uint16_t wBufferSize,   /**< [In] Size of \c pBuffer. */
+                                uint16_t * pRxLength    /**< [Out] Number of bytes read. */
+                                );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown or read only configuration option.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid value.
+*/
+phStatus_t phalMfdf_SetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t wValue       /**< [In] Configuration Value */
+                              );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phalMfdf_GetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t * pValue     /**< [Out] Configuration Value */
+                              );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_MFDF */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHALMFDF_H */
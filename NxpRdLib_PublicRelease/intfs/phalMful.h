@@ -52,10 +52,18 @@ typedef struct
     void * pKeyStoreDataParams;     /**< Pointer to phKeystore parameter structure. */
     void * pCryptoDataParams;       /**< Pointer to phCrypto data parameters structure. */
     void * pCryptoRngDataParams;    /**< Pointer to the parameter structure of the CryptoRng layer. */
+    uint8_t bFastRead;              /**< Use FAST_READ for page ranges; #PH_ON or #PH_OFF. */
+    uint8_t bMaxFastReadPages;      /**< Maximum number of pages per FAST_READ command. */
+    uint8_t bNumPages;              /**< Number of pages of the chip. */
+    uint8_t bUserPages;             /**< Number of user memory pages of the chip, starting at page 4. */
+    uint8_t bWriteRetries;          /**< Number of retries of a page write without valid answer. */
 } phalMful_Sw_DataParams_t;
 
 /**
 * \brief Initialise this layer.
+*
+* The chip is handled like a plain MIFARE(R) Ultralight until \ref phalMful_GetVersion
+* or \ref phalMful_SetConfig tells otherwise.
 * \return Status code
 * \retval #PH_ERR_SUCCESS Operation successful.
 */
@@ -85,8 +93,42 @@ phStatus_t phalMful_Sw_Init(
 #define PHAL_MFUL_READ_BLOCK_LENGTH         16U     /**< Length of a read MIFARE(R) Ultralight data block. */
 #define PHAL_MFUL_WRITE_BLOCK_LENGTH        4U      /**< Length of a write MIFARE(R) Ultralight data block. */
 #define PHAL_MFUL_COMPWRITE_BLOCK_LENGTH    16U     /**< Length of a compatibility write MIFARE(R) Ultralight data block. */
+#define PHAL_MFUL_PAGE_LENGTH               4U      /**< Length of a MIFARE(R) Ultralight page. */
+#define PHAL_MFUL_VERSION_LENGTH            8U      /**< Length of the GET_VERSION response. */
+#define PHAL_MFUL_USER_MEMORY_PAGE          4U      /**< First page of the user memory. */
+/*@}*/
+
+/**
+* \name Memory of a plain MIFARE(R) Ultralight
+*/
+/*@{*/
+#define PHAL_MFUL_UL_PAGES                  16U     /**< Number of pages. */
+#define PHAL_MFUL_UL_USER_PAGES             12U     /**< Number of user memory pages. */
+/*@}*/
+
+/**
+* \name Configuration options
+*/
+/*@{*/
+#define PHAL_MFUL_CONFIG_FAST_READ              0x0000U     /**< Read page ranges with FAST_READ; #PH_ON or #PH_OFF. */
+#define PHAL_MFUL_CONFIG_MAX_FAST_READ_PAGES    0x0001U     /**< Maximum number of pages per FAST_READ; should be the HAL RX buffer size divided by #PHAL_MFUL_PAGE_LENGTH. */
+#define PHAL_MFUL_CONFIG_NUM_PAGES              0x0002U     /**< Number of pages of the chip, e.g. 48 for an Ultralight C. */
+#define PHAL_MFUL_CONFIG_USER_PAGES             0x0003U     /**< Number of user memory pages of the chip, e.g. 36 for an Ultralight C. */
+#define PHAL_MFUL_CONFIG_WRITE_RETRIES          0x0004U     /**< Number of retries of a page write without valid answer; default '0'. */
+/*@}*/
+
+/**
+* \name Page write results
+*/
+/*@{*/
+#define PHAL_MFUL_PAGE_WRITTEN              0x00U   /**< The page has been written. */
+#define PHAL_MFUL_PAGE_UNCHANGED            0x01U   /**< The page already holds the data and has been skipped. */
+#define PHAL_MFUL_PAGE_FAILED               0x02U   /**< Writing the page failed. */
+#define PHAL_MFUL_PAGE_NOT_WRITTEN          0x03U   /**< The page has not been written because a preceding page failed. */
 /*@}*/
 
+#define PHAL_MFUL_DEFAULT_FAST_READ_PAGES   15U     /**< Default pages per FAST_READ; the response fits into a 64 byte HAL RX buffer. */
+
 /**
 * \name Crypto definitions
 */
@@ -144,6 +186,116 @@ phStatus_t phalMful_CompatibilityWrite(
                                        uint8_t * pData      /**< [In] pData[#PHAL_MFUL_COMPWRITE_BLOCK_LENGTH] containing block to be written to the Picc. */
                                        );
 
+/**
+* \brief Perform GET_VERSION and configure the memory layout of the chip.
+*
+* MIFARE(R) Ultralight EV1 and NTAG2xx chips answer with their product and storage size, FAST_READ is enabled
+* and the number of pages is taken from the storage size. Any other chip is configured as a plain MIFARE(R) Ultralight.
+* Chips which do not support GET_VERSION, such as the plain Ultralight and the Ultralight C, do not answer and fall back
+* to the idle state, so they have to be activated again.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component; the chip has to be activated again.
+*/
+phStatus_t phalMful_GetVersion(
+                               void * pDataParams,  /**< [In] Pointer to this layer's parameter structure. */
+                               uint8_t * pVersion   /**< [Out] GET_VERSION response; uint8_t[#PHAL_MFUL_VERSION_LENGTH]. */
+                               );
+
+/**
+* \brief Perform FAST_READ command with Picc.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMful_FastRead(
+                             void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                             uint8_t bStartPage,    /**< [In] First page to read. */
+                             uint8_t bEndPage,      /**< [In] Last page to read. */
+                             uint8_t * pData        /**< [Out] Page data; uint8_t[#PHAL_MFUL_PAGE_LENGTH * (bEndPage - bStartPage + 1)]. */
+                             );
+
+/**
+* \brief Read consecutive pages into one buffer with as few commands as possible.
+*
+* With FAST_READ each command reads up to #PHAL_MFUL_CONFIG_MAX_FAST_READ_PAGES pages,
+* otherwise the pages are read with back to back READ commands of 4 pages each.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The range exceeds the last page of the chip.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMful_ReadPages(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint8_t bStartPage,   /**< [In] First page to read. */
+                              uint16_t wNumPages,   /**< [In] Number of pages to read. */
+                              uint8_t * pData       /**< [Out] Page data; uint8_t[#PHAL_MFUL_PAGE_LENGTH * wNumPages]. */
+                              );
+
+/**
+* \brief Read the whole user memory of the chip.
+*
+* Same as \ref phalMful_ReadPages for the user memory pages, see \ref phalMful_GetVersion.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW \c wBufferSize is too small; nothing has been read.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalMful_ReadUserMemory(
+                                   void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                                   uint16_t wBufferSize,    /**< [In] Size of \c pData. */
+                                   uint8_t * pData,         /**< [Out] User memory. */
+                                   uint16_t * pDataLength   /**< [Out] Length of the user memory. */
+                                   );
+
+/**
+* \brief Write consecutive pages with as little overhead per page as possible.
+*
+* Each page is written with a single WRITE frame. Pages whose data equals \c pReference, e.g. the result of
+* \ref phalMful_ReadPages, are skipped. A page write without valid answer is repeated #PHAL_MFUL_CONFIG_WRITE_RETRIES times.
+* A NAK is not repeated because the chip falls back to the idle state, the following pages are not written then.
+* Pages 2 and 3 hold lock and OTP bits, which can only be set.
+* The RF time of the whole write can be measured by the HAL with #PHHAL_HW_TIMING_MODE_COMM.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The range exceeds the last page of the chip.
+* \retval Other Status of the failed page, depending on implementation and underlaying component.
+*/
+phStatus_t phalMful_WritePages(
+                               void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                               uint8_t bStartPage,      /**< [In] First page to write. */
+                               uint16_t wNumPages,      /**< [In] Number of pages to write. */
+                               uint8_t * pData,         /**< [In] Page data; uint8_t[#PHAL_MFUL_PAGE_LENGTH * wNumPages]. */
+                               uint8_t * pReference,    /**< [In] Current page data or NULL to write all pages; uint8_t[#PHAL_MFUL_PAGE_LENGTH * wNumPages]. */
+                               uint8_t * pPageStatus,   /**< [Out] Result of each page, e.g. #PHAL_MFUL_PAGE_WRITTEN; uint8_t[wNumPages]. */
+                               uint16_t * pNumFrames    /**< [Out] Number of WRITE frames sent, including retries. */
+                               );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid value.
+*/
+phStatus_t phalMful_SetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t wValue       /**< [In] Configuration Value */
+                              );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phalMful_GetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t * pValue     /**< [Out] Configuration Value */
+                              );
+
 /** @} */
 #endif /* NXPBUILD__PHAL_MFUL */
 
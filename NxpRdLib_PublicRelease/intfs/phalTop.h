@@ -0,0 +1,281 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic Tag Operation Application Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHALTOP_H
+#define PHALTOP_H
+
+#include <ph_Status.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PHAL_TOP_SW
+
+/** \defgroup phalTop_Sw Component : Software
+* @{
+*/
+
+#define PHAL_TOP_SW_ID              0x01U   /**< ID for Software Tag Operation layer. */
+
+#define PHAL_TOP_T2T_MAX_RESERVED_AREAS 4U  /**< Number of lock and memory control areas kept per Type 2 Tag. */
+#define PHAL_TOP_T4T_CC_CACHE_SIZE      4U  /**< Number of Type 4 Tag Capability Containers kept. */
+#define PHAL_TOP_MAX_UID_LENGTH         10U /**< Maximum length of a UID. */
+
+/**
+* \brief Type 2 Tag state, valid after \ref phalTop_ReadNdef.
+*/
+typedef struct
+{
+    uint8_t bVersion;                                           /**< Mapping version of the Capability Container. */
+    uint8_t bAccess;                                            /**< Read and write access byte of the Capability Container. */
+    uint16_t wDataAreaSize;                                     /**< Size of the data area starting at page 4. */
+    uint16_t wLoadedStart;                                      /**< First data area page held by the read buffer. */
+    uint16_t wLoadedEnd;                                        /**< Data area page after the last one held by the read buffer. */
+    uint8_t bNumReservedAreas;                                  /**< Number of reserved areas. */
+    uint16_t aReservedStart[PHAL_TOP_T2T_MAX_RESERVED_AREAS];   /**< Data area offsets of the reserved areas, ascending. */
+    uint16_t aReservedLength[PHAL_TOP_T2T_MAX_RESERVED_AREAS];  /**< Lengths of the reserved areas. */
+} phalTop_T2T_t;
+
+/**
+* \brief Capability Container of a Type 4 Tag.
+*/
+typedef struct
+{
+    uint8_t aUid[PHAL_TOP_MAX_UID_LENGTH];  /**< UID of the tag. */
+    uint8_t bUidLength;                     /**< Length of the UID; '0' if the entry is free. */
+    uint8_t bVersion;                       /**< Mapping version. */
+    uint16_t wMLe;                          /**< Maximum R-APDU data size. */
+    uint16_t wMLc;                          /**< Maximum C-APDU data size. */
+    uint16_t wFileId;                       /**< File identifier of the NDEF file. */
+    uint16_t wMaxNdefSize;                  /**< Size of the NDEF file, including NLEN. */
+    uint8_t bReadAccess;                    /**< Read access condition of the NDEF file. */
+    uint8_t bWriteAccess;                   /**< Write access condition of the NDEF file. */
+} phalTop_T4T_Cc_t;
+
+/**
+* \brief Type 4 Tag state.
+*/
+typedef struct
+{
+    uint8_t aUid[PHAL_TOP_MAX_UID_LENGTH];                  /**< UID of the current tag. */
+    uint8_t bUidLength;                                     /**< Length of the UID of the current tag; '0' disables the cache. */
+    phalTop_T4T_Cc_t aCcCache[PHAL_TOP_T4T_CC_CACHE_SIZE];  /**< Capability Containers of the last tags. */
+    uint8_t bNextCcEntry;                                   /**< Cache entry replaced next. */
+    uint8_t bCcCached;                                      /**< Whether the last read took the Capability Container from the cache. */
+    uint8_t bVersion;                                       /**< Mapping version of the last tag read. */
+    uint16_t wReadLength;                                   /**< Data bytes per READ BINARY of the last read. */
+} phalTop_T4T_t;
+
+/**
+* \brief Private parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                   /**< Layer ID for this component, NEVER MODIFY! */
+    void * pAlMfulDataParams;       /**< Pointer to the parameter structure of the MIFARE Ultralight AL; may be NULL. */
+    void * pPalI14443p4DataParams;  /**< Pointer to the parameter structure of the ISO14443-4 PAL; may be NULL. */
+    uint8_t bTagType;               /**< Tag type of the last operation. */
+    uint16_t wPagesRead;            /**< Number of pages read by the last operation. */
+    uint16_t wCommands;             /**< Number of commands sent by the last operation. */
+    phalTop_T2T_t sT2T;             /**< Type 2 Tag state. */
+    phalTop_T4T_t sT4T;             /**< Type 4 Tag state. */
+} phalTop_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phalTop_Sw_Init(
+                           phalTop_Sw_DataParams_t * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                           uint16_t wSizeOfDataParams,              /**< [In] Specifies the size of the data parameter structure. */
+                           void * pAlMfulDataParams,                /**< [In] Pointer to the parameter structure of the MIFARE Ultralight AL used for Type 2 Tags. */
+                           void * pPalI14443p4DataParams            /**< [In] Pointer to the parameter structure of the ISO14443-4 PAL used for Type 4 Tags. */
+                           );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_TOP_SW */
+
+#ifdef NXPBUILD__PHAL_TOP
+
+/** \defgroup phalTop Tag Operation
+* \brief These Components read NDEF messages of NFC Forum tags.
+*
+* Only the memory holding the NDEF message is read. The message is handed back as a
+* pointer into the read buffer, it is not copied.
+* @{
+*/
+
+/**
+* \name Tag Operation error codes
+*/
+/*@{*/
+#define PHAL_TOP_ERR_NOT_FORMATTED          (PH_ERR_CUSTOM_BEGIN+0)     /**< The tag holds no valid Capability Container. */
+#define PHAL_TOP_ERR_UNSUPPORTED_VERSION    (PH_ERR_CUSTOM_BEGIN+1)     /**< The major mapping version is not supported. */
+#define PHAL_TOP_ERR_NO_NDEF                (PH_ERR_CUSTOM_BEGIN+2)     /**< The tag holds no NDEF message. */
+#define PHAL_TOP_ERR_INVALID_TLV            (PH_ERR_CUSTOM_BEGIN+3)     /**< A TLV exceeds the data area. */
+#define PHAL_TOP_ERR_ISO7816                (PH_ERR_CUSTOM_BEGIN+4)     /**< The tag answered a command with a status word other than 9000. */
+/*@}*/
+
+/**
+* \name Tag types
+*/
+/*@{*/
+#define PHAL_TOP_TAG_TYPE_T2T       0x02U   /**< NFC Forum Type 2 Tag, e.g. MIFARE Ultralight and NTAG. */
+#define PHAL_TOP_TAG_TYPE_T4T       0x04U   /**< NFC Forum Type 4 Tag, e.g. MIFARE DESFire and NTAG 424. */
+/*@}*/
+
+/**
+* \name Tag Operation configuration options
+*/
+/*@{*/
+#define PHAL_TOP_CONFIG_PAGES_READ      0x0000U     /**< Number of pages read by the last \ref phalTop_ReadNdef, including the Capability Container. */
+#define PHAL_TOP_CONFIG_VERSION         0x0001U     /**< Mapping version of the last tag read. */
+#define PHAL_TOP_CONFIG_COMMANDS        0x0002U     /**< Number of commands sent by the last Type 4 Tag read. */
+#define PHAL_TOP_CONFIG_CC_CACHED       0x0003U     /**< #PH_ON if the last Type 4 Tag read took the Capability Container from the cache. */
+#define PHAL_TOP_CONFIG_READ_LENGTH     0x0004U     /**< Data bytes per READ BINARY of the last Type 4 Tag read. */
+/*@}*/
+
+/**
+* \name Type 2 Tag definitions
+*/
+/*@{*/
+#define PHAL_TOP_T2T_CC_PAGE            3U      /**< Page of the Capability Container. */
+#define PHAL_TOP_T2T_DATA_PAGE          4U      /**< First page of the data area. */
+#define PHAL_TOP_T2T_NDEF_MAGIC         0xE1U   /**< First byte of the Capability Container of an NDEF tag. */
+#define PHAL_TOP_T2T_MAJOR_VERSION      0x10U   /**< Supported major mapping version. */
+
+#define PHAL_TOP_T2T_TLV_NULL           0x00U   /**< NULL TLV. */
+#define PHAL_TOP_T2T_TLV_LOCK_CTRL      0x01U   /**< Lock Control TLV. */
+#define PHAL_TOP_T2T_TLV_MEM_CTRL       0x02U   /**< Memory Control TLV. */
+#define PHAL_TOP_T2T_TLV_NDEF           0x03U   /**< NDEF Message TLV. */
+#define PHAL_TOP_T2T_TLV_TERMINATOR     0xFEU   /**< Terminator TLV. */
+/*@}*/
+
+/**
+* \name Type 4 Tag definitions
+*/
+/*@{*/
+#define PHAL_TOP_T4T_CC_FILE_ID         0xE103U     /**< File identifier of the Capability Container. */
+#define PHAL_TOP_T4T_CC_LENGTH          15U         /**< Length of the Capability Container up to the NDEF File Control TLV. */
+#define PHAL_TOP_T4T_NLEN_LENGTH        2U          /**< Length of the NDEF length field of the NDEF file. */
+/*@}*/
+
+/**
+* \brief Called with each part of a streamed NDEF message.
+*
+* \c pData points into the receive buffer of the underlying layer and is valid during the call only.
+* A status other than #PH_ERR_SUCCESS aborts the read and is returned by \ref phalTop_ReadNdefStream.
+*/
+typedef phStatus_t (*phalTop_NdefCallback_t)(
+    void * pContext,    /**< [In] Context given to \ref phalTop_ReadNdefStream. */
+    uint8_t * pData,    /**< [In] Part of the NDEF message. */
+    uint16_t wOffset,   /**< [In] Position of the part within the NDEF message. */
+    uint16_t wLength    /**< [In] Length of the part. */
+    );
+
+/**
+* \brief Read the NDEF message of a tag.
+*
+* For a Type 2 Tag the Capability Container and the first data pages are read with one command.
+* The TLVs are walked up to the NDEF Message TLV, the pages it spans are read in as few commands as
+* the MIFARE Ultralight AL allows. Bytes of lock and memory control areas are removed from the message.
+* \c pBuffer holds the data area from its start, it must reach up to the page of the last message byte.
+*
+* For a Type 4 Tag the NDEF application and file are selected, the Capability Container is taken from
+* the cache if the tag set by \ref phalTop_SetUid has been read before. The NDEF file is read with
+* READ BINARY commands as long as MLe and the frame size of the reader allow, the first one returns NLEN
+* together with the start of the message. \c pBuffer holds the message only.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW The message does not fit into the buffer.
+* \retval #PH_ERR_USE_CONDITION The tag does not grant read access.
+* \retval #PHAL_TOP_ERR_NOT_FORMATTED The tag is not NDEF formatted.
+* \retval #PHAL_TOP_ERR_NO_NDEF The tag holds no NDEF message.
+* \retval #PHAL_TOP_ERR_ISO7816 A Type 4 Tag rejected a command.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phalTop_ReadNdef(
+                            void * pDataParams,         /**< [In] Pointer to this layer's parameter structure. */
+                            uint8_t bTagType,           /**< [In] Tag type, e.g. #PHAL_TOP_TAG_TYPE_T2T. */
+                            uint8_t * pBuffer,          /**< [In] Read buffer. */
+                            uint16_t wBufferSize,       /**< [In] Size of the read buffer. */
+                            uint8_t ** ppNdef,          /**< [Out] Pointer to the NDEF message within \c pBuffer. */
+                            uint16_t * pNdefLength      /**< [Out] Length of the NDEF message; '0' for an empty message. */
+                            );
+
+/**
+* \brief Read the NDEF message of a Type 4 Tag part by part.
+*
+* Works like \ref phalTop_ReadNdef without a buffer: each READ BINARY response is handed to \c pCallback
+* as it arrives, so messages of any size up to the NDEF file are read.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The tag type does not support streaming.
+* \retval Other See \ref phalTop_ReadNdef or the status of \c pCallback.
+*/
+phStatus_t phalTop_ReadNdefStream(
+                                  void * pDataParams,                   /**< [In] Pointer to this layer's parameter structure. */
+                                  uint8_t bTagType,                     /**< [In] Tag type, #PHAL_TOP_TAG_TYPE_T4T. */
+                                  phalTop_NdefCallback_t pCallback,     /**< [In] Receiver of the message parts. */
+                                  void * pContext,                      /**< [In] Context handed to \c pCallback. */
+                                  uint16_t * pNdefLength                /**< [Out] Length of the NDEF message. */
+                                  );
+
+/**
+* \brief Set the UID of the tag the next operations address.
+*
+* Type 4 Tag Capability Containers are cached by this UID. A length of '0' reads them always.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER The UID is too long.
+*/
+phStatus_t phalTop_SetUid(
+                          void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                          uint8_t * pUid,       /**< [In] UID of the tag. */
+                          uint8_t bUidLength    /**< [In] Length of the UID. */
+                          );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phalTop_GetConfig(
+                             void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                             uint16_t wConfig,      /**< [In] Configuration Identifier */
+                             uint16_t * pValue      /**< [Out] Configuration Value */
+                             );
+
+/** @} */
+#endif /* NXPBUILD__PHAL_TOP */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHALTOP_H */
@@ -0,0 +1,336 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Generic LLCP Link Layer Component of Reader Library Framework.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHLNLLCP_H
+#define PHLNLLCP_H
+
+#include <ph_Status.h>
+#include <phpalI18092mPI.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif	/* __cplusplus */
+
+#ifdef NXPBUILD__PHLN_LLCP_SW
+
+/** \defgroup phlnLlcp_Sw Component : Software
+* @{
+*/
+
+#define PHLN_LLCP_SW_ID         0x01U   /**< ID for Software LLCP layer */
+
+/**
+* \brief State of one logical data link.
+*/
+typedef struct
+{
+    uint8_t bState;                 /**< Connection state of the data link. */
+    uint8_t bPending;               /**< Control PDU waiting to be sent. */
+    uint8_t bLocalSap;              /**< Service access point of this side. */
+    uint8_t bRemoteSap;             /**< Service access point of the remote side. */
+    uint8_t bReason;                /**< Reason of the last DM PDU received. */
+    uint8_t bLocalRw;               /**< Receive window offered to the remote side; 1-15 */
+    uint8_t bRemoteRw;              /**< Receive window of the remote side; 0-15 */
+    uint8_t bRemoteBusy;            /**< Unequal '0' if the remote side sent RNR. */
+    uint16_t wLocalMiu;             /**< Maximum information unit this side accepts. */
+    uint16_t wRemoteMiu;            /**< Maximum information unit the remote side accepts. */
+    uint8_t bVs;                    /**< Send state variable V(S). */
+    uint8_t bVsa;                   /**< Send acknowledgement state variable V(SA). */
+    uint8_t bVr;                    /**< Receive state variable V(R). */
+    uint8_t bVra;                   /**< Receive acknowledgement state variable V(RA). */
+    uint8_t * pServiceName;         /**< Service name sent with the CONNECT PDU; may be NULL. */
+    uint8_t bServiceNameLength;     /**< Length of the service name. */
+    uint8_t * pTxData;              /**< Data which has not been sent yet. */
+    uint16_t wTxLength;             /**< Number of bytes which have not been sent yet. */
+    uint8_t * pRxBuffer;            /**< Receive slots; \c bLocalRw slots of \c wLocalMiu + 2 bytes. */
+    uint8_t bRxFirst;               /**< Slot holding the oldest received information unit. */
+    uint8_t bRxCount;               /**< Number of occupied receive slots. */
+} phlnLlcp_Sw_Link_t;
+
+/**
+* \brief Private parameter structure
+*/
+typedef struct
+{
+    uint16_t wId;                           /**< Layer ID for this component, NEVER MODIFY! */
+    void * pPalI18092mPIDataParams;         /**< Pointer to the parameter structure of the ISO18092 layer. */
+    phlnLlcp_Sw_Link_t * pLinks;            /**< Pointer to the data link storage. */
+    uint8_t bNumLinks;                      /**< Number of data links in the data link storage. */
+    uint8_t bNextLink;                      /**< Data link served first when building the next frame. */
+    uint8_t * pFrameBuffer;                 /**< Buffer for building and receiving LLC frames. */
+    uint16_t wFrameBufferSize;              /**< Size of the frame buffer. */
+    uint16_t wLocalLinkMiu;                 /**< Link MIU of this side, derived from the frame buffer size. */
+    uint16_t wRemoteLinkMiu;                /**< Link MIU of the remote side. */
+    uint16_t wRemoteWks;                    /**< Well-known services of the remote side. */
+    uint8_t bVersion;                       /**< Agreed LLCP version; major version in the upper nibble. */
+    uint8_t bActive;                        /**< Unequal '0' if the LLCP link is activated. */
+    uint8_t bMaxSymm;                       /**< Maximum number of consecutive SYMM exchanges while waiting. */
+    uint8_t bSymmCount;                     /**< Number of consecutive SYMM exchanges. */
+    uint8_t bConfigLink;                    /**< Data link selected by #PHLN_LLCP_CONFIG_LINK. */
+    uint8_t bDmPending;                     /**< Unequal '0' if a DM PDU for an unknown data link is waiting to be sent. */
+    uint8_t bDmDsap;                        /**< Destination of the waiting DM PDU. */
+    uint8_t bDmSsap;                        /**< Source of the waiting DM PDU. */
+    uint8_t bDmReason;                      /**< Reason of the waiting DM PDU. */
+} phlnLlcp_Sw_DataParams_t;
+
+/**
+* \brief Initialise this layer.
+*
+* At most #PHLN_LLCP_MAX_LINKS data links are usable, additional storage is ignored.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Frame buffer too small or no data link storage.
+*/
+phStatus_t phlnLlcp_Sw_Init(
+                            phlnLlcp_Sw_DataParams_t * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                            uint16_t wSizeOfDataParams,                 /**< [In] Specifies the size of the data parameter structure. */
+                            void * pPalI18092mPIDataParams,             /**< [In] Pointer to the parameter structure of the ISO18092 layer. */
+                            phlnLlcp_Sw_Link_t * pLinks,                /**< [In] Data link storage. */
+                            uint8_t bNumLinks,                          /**< [In] Number of data links in the data link storage. */
+                            uint8_t * pFrameBuffer,                     /**< [In] Frame buffer; at least #PHLN_LLCP_MIU_DEFAULT + 3 bytes. */
+                            uint16_t wFrameBufferSize                   /**< [In] Size of the frame buffer. */
+                            );
+
+/** @} */
+#endif /* NXPBUILD__PHLN_LLCP_SW */
+
+#ifdef NXPBUILD__PHLN_LLCP
+
+/** \defgroup phlnLlcp LLCP
+* \brief These Components implement the NFC Forum Logical Link Control Protocol on top of the \ref phpalI18092mPI layer.
+*
+* The link parameters are exchanged with the general bytes of ATR_REQ and ATR_RES. Several
+* connection-oriented data links share the NFC-DEP link. Each DEP frame carries as many PDUs of all
+* data links as fit into the link MIU of the target, aggregated into one AGF PDU, and a data link keeps
+* sending I PDUs until the receive window of the remote side is full. SYMM PDUs are only exchanged
+* if neither side has anything to send.
+* @{
+*/
+
+/**
+* \name LLCP error codes
+*/
+/*@{*/
+#define PHLN_LLCP_ERR_REJECTED      (PH_ERR_CUSTOM_BEGIN+0)     /**< The remote side rejected the connection, see #PHLN_LLCP_CONFIG_REASON. */
+#define PHLN_LLCP_ERR_DISCONNECTED  (PH_ERR_CUSTOM_BEGIN+1)     /**< The data link has been closed by the remote side. */
+#define PHLN_LLCP_ERR_DEACTIVATED   (PH_ERR_CUSTOM_BEGIN+2)     /**< The LLCP link has been deactivated by the remote side. */
+/*@}*/
+
+/**
+* \name LLCP configuration options
+*/
+/*@{*/
+#define PHLN_LLCP_CONFIG_MAX_SYMM       0x0000U     /**< Number of consecutive SYMM exchanges after which waiting functions return #PH_ERR_IO_TIMEOUT. */
+#define PHLN_LLCP_CONFIG_LOCAL_MIU      0x0001U     /**< Link MIU of this side; read only. */
+#define PHLN_LLCP_CONFIG_REMOTE_MIU     0x0002U     /**< Link MIU of the remote side; read only. */
+#define PHLN_LLCP_CONFIG_REMOTE_WKS     0x0003U     /**< Well-known services of the remote side; read only. */
+#define PHLN_LLCP_CONFIG_VERSION        0x0004U     /**< Agreed LLCP version; read only. */
+#define PHLN_LLCP_CONFIG_REASON         0x0005U     /**< Reason of the last DM PDU of the data link set by #PHLN_LLCP_CONFIG_LINK; read only. */
+#define PHLN_LLCP_CONFIG_LINK           0x0006U     /**< Data link used by #PHLN_LLCP_CONFIG_REASON. */
+/*@}*/
+
+#define PHLN_LLCP_SAP_SDP           0x01U   /**< Service access point of the service discovery protocol. */
+#define PHLN_LLCP_SAP_SNEP          0x04U   /**< Service access point of the simple NDEF exchange protocol. */
+#define PHLN_LLCP_SAP_MAX           0x3FU   /**< The last valid service access point. */
+#define PHLN_LLCP_MIU_DEFAULT       128U    /**< MIU used if no MIUX parameter is exchanged. */
+#define PHLN_LLCP_RW_MAX            15U     /**< The maximum receive window. */
+#define PHLN_LLCP_MAX_LINKS         32U     /**< The maximum number of data links. */
+#define PHLN_LLCP_MAX_GI_LENGTH     20U     /**< Maximum length of the general bytes built by #phlnLlcp_GetGeneralBytes. */
+#define PHLN_LLCP_NO_LINK           0xFFU   /**< Data link handle value meaning "no data link". */
+
+/**
+* \brief Build the general bytes announcing LLCP to the target.
+*
+* The general bytes have to be passed to \ref phpalI18092mPI_ActivateCard.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phlnLlcp_GetGeneralBytes(
+                                    void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                                    uint8_t * pGi,          /**< [Out] General bytes; uint8_t[#PHLN_LLCP_MAX_GI_LENGTH]. */
+                                    uint8_t * pGiLength     /**< [Out] Length of the general bytes. */
+                                    );
+
+/**
+* \brief Activate the LLCP link with the general bytes of the target.
+*
+* The version of the target has to be compatible, all data links are closed.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR The target does not support a compatible LLCP version.
+*/
+phStatus_t phlnLlcp_Activate(
+                             void * pDataParams,        /**< [In] Pointer to this layer's parameter structure. */
+                             uint8_t * pAtrRes,         /**< [In] Attribute Response as returned by \ref phpalI18092mPI_ActivateCard. */
+                             uint8_t bAtrResLength      /**< [In] Attribute Response Length. */
+                             );
+
+/**
+* \brief Deactivate the LLCP link.
+*
+* All data links are closed without disconnecting them. The NFC-DEP link stays active,
+* use \ref phpalI18092mPI_Deselect afterwards.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Deactivate(
+                               void * pDataParams       /**< [In] Pointer to this layer's parameter structure. */
+                               );
+
+/**
+* \brief Connect a data link to a service of the target.
+*
+* If a service name is given the connection is requested from the service discovery SAP and \c bDsap is ignored.
+* The receive buffer holds \c bRw information units, their size is the largest one
+* the buffer allows but at least #PHLN_LLCP_MIU_DEFAULT.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid SAP or receive window, or receive buffer too small.
+* \retval #PH_ERR_USE_CONDITION LLCP link not active or no free data link.
+* \retval #PHLN_LLCP_ERR_REJECTED The target rejected the connection.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Connect(
+                            void * pDataParams,             /**< [In] Pointer to this layer's parameter structure. */
+                            uint8_t bDsap,                  /**< [In] Service access point of the target. */
+                            uint8_t * pServiceName,         /**< [In] Service name; may be NULL. */
+                            uint8_t bServiceNameLength,     /**< [In] Length of the service name. */
+                            uint8_t bRw,                    /**< [In] Receive window offered to the target; 1-15 */
+                            uint8_t * pRxBuffer,            /**< [In] Receive buffer; has to be available until the data link is closed. */
+                            uint16_t wRxBufferSize,         /**< [In] Size of the receive buffer. */
+                            uint8_t * pLink                 /**< [Out] Data link handle. */
+                            );
+
+/**
+* \brief Disconnect a data link.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if the data link was already closed by the target.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid data link handle.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Disconnect(
+                               void * pDataParams,      /**< [In] Pointer to this layer's parameter structure. */
+                               uint8_t bLink            /**< [In] Data link handle. */
+                               );
+
+/**
+* \brief Queue data for sending on a data link.
+*
+* The data is split into I PDUs of the MIU of the target and sent by the following calls of
+* \ref phlnLlcp_Transceive, \ref phlnLlcp_Flush or \ref phlnLlcp_Receive. It has to stay available until it has been sent.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid data link handle.
+* \retval #PH_ERR_USE_CONDITION Previous data has not been sent yet.
+* \retval #PHLN_LLCP_ERR_DISCONNECTED The data link is closed.
+*/
+phStatus_t phlnLlcp_Send(
+                         void * pDataParams,    /**< [In] Pointer to this layer's parameter structure. */
+                         uint8_t bLink,         /**< [In] Data link handle. */
+                         uint8_t * pData,       /**< [In] Data to send. */
+                         uint16_t wDataLength   /**< [In] Length of the data. */
+                         );
+
+/**
+* \brief Exchange one frame with the target.
+*
+* The frame contains the PDUs of all data links or SYMM if there is nothing to send.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION LLCP link not active.
+* \retval #PH_ERR_PROTOCOL_ERROR The target violated the protocol.
+* \retval #PHLN_LLCP_ERR_DEACTIVATED The target deactivated the LLCP link.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Transceive(
+                               void * pDataParams       /**< [In] Pointer to this layer's parameter structure. */
+                               );
+
+/**
+* \brief Exchange frames until all queued data of a data link has been sent and acknowledged.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_IO_TIMEOUT Nothing happened for #PHLN_LLCP_CONFIG_MAX_SYMM exchanges.
+* \retval #PHLN_LLCP_ERR_DISCONNECTED The data link has been closed.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Flush(
+                          void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                          uint8_t bLink         /**< [In] Data link handle. */
+                          );
+
+/**
+* \brief Receive one information unit of a data link.
+*
+* Frames are exchanged until an information unit is available.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW Information unit does not fit into \c pData; it is kept.
+* \retval #PH_ERR_IO_TIMEOUT Nothing happened for #PHLN_LLCP_CONFIG_MAX_SYMM exchanges.
+* \retval #PHLN_LLCP_ERR_DISCONNECTED The data link has been closed and no data is left.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phlnLlcp_Receive(
+                            void * pDataParams,     /**< [In] Pointer to this layer's parameter structure. */
+                            uint8_t bLink,          /**< [In] Data link handle. */
+                            uint8_t * pData,        /**< [Out] Received information unit. */
+                            uint16_t wDataSize,     /**< [In] Size of \c pData. */
+                            uint16_t * pDataLength  /**< [Out] Length of the information unit. */
+                            );
+
+/**
+* \brief Set configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown or read only configuration option.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid value.
+*/
+phStatus_t phlnLlcp_SetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t wValue       /**< [In] Configuration Value */
+                              );
+
+/**
+* \brief Get configuration parameter.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_UNSUPPORTED_PARAMETER Unknown configuration option.
+*/
+phStatus_t phlnLlcp_GetConfig(
+                              void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                              uint16_t wConfig,     /**< [In] Configuration Identifier */
+                              uint16_t * pValue     /**< [Out] Configuration Value */
+                              );
+
+/** @} */
+#endif /* NXPBUILD__PHLN_LLCP */
+
+#ifdef __cplusplus
+} /* Extern C */
+#endif
+
+#endif /* PHLNLLCP_H */
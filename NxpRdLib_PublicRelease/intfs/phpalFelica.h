@@ -185,6 +185,33 @@ phStatus_t phpalFelica_GetSerialNo(
                                    uint8_t * pLenUidOut /**< [Out] Length of Uid; 0 or 16. */
                                    );
 
+/**
+* \brief Perform an inventory of all Felica cards in the field.
+*
+* Every ReqC command uses the given number of time slots. On a HAL which is able to continue
+* reception after the first answer (e.g. \ref phhalHw_Rc523_Cmd_Receive), the answers of all
+* time slots of one ReqC are collected. Otherwise each ReqC only yields the answer of the earliest
+* time slot and polling is repeated until no new card shows up.\n
+* The number of time slots is doubled whenever a collision is detected. Cards are deduplicated
+* by their IDm. Use \ref phpalFelica_ActivateCard with an IDm/PMm of the list to address a card.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if no card has been found.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid number of time slots or data rate.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalFelica_Inventory(
+                                 void * pDataParams,            /**< [In] Pointer to this layer's parameter structure. */
+                                 uint8_t * pSystemCode,         /**< [In] System-Code; uint8_t[2]. */
+                                 uint8_t bNumTimeSlots,         /**< [In] Number of timeslots of the first ReqC. Refer to e.g. #PHPAL_FELICA_NUMSLOTS_1 for valid values. */
+                                 uint16_t wDataRate,            /**< [In] Data rate; #PHHAL_HW_RF_DATARATE_212 or #PHHAL_HW_RF_DATARATE_424. */
+                                 uint8_t * pIDmPMmList,         /**< [Out] 8 bytes IDm + 8 bytes PMm per card; uint8_t[16 * bMaxCards]. */
+                                 uint8_t bMaxCards,             /**< [In] Number of cards \c pIDmPMmList can hold. */
+                                 uint8_t * pNumCards,           /**< [Out] Number of cards found. */
+                                 uint32_t * pRfTimeUs,          /**< [Out] RF time spent polling in microseconds, calculated from the response windows. */
+                                 uint8_t * pMoreCardsAvailable  /**< [Out] Whether there are more cards in the field than \c bMaxCards or not; uint8_t. */
+                                 );
+
 /** @} */
 #endif /* NXPBUILD__PHPAL_FELICA */
 
@@ -51,6 +51,8 @@ typedef struct
     uint8_t abUid[10];      /**< Array holding the activated UID. */
     uint8_t bUidLength;     /**< Length of UID stored in \c abUid. */
     uint8_t bUidComplete;   /**< Whether the UID is complete (\c 1) or not (\c 0). */
+    uint8_t abAtqa[2];      /**< ATQA of the last successful ReqA or WupA. */
+    uint8_t bAtqaValid;     /**< Whether \c abAtqa has been received (\c 1) or not (\c 0). */
 } phpalI14443p3a_Sw_DataParams_t;
 
 /**
@@ -291,6 +293,17 @@ phStatus_t phpalI14443p3a_GetSerialNo(
                                       uint8_t * pLenUidOut  /**< [Out] Length of Uid; 4/7/10. */
                                       );
 
+/**
+* \brief Retrieve the ATQA received by the last ReqA or WupA, e.g. during \ref phpalI14443p3a_ActivateCard.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_USE_CONDITION No ATQA available at the moment.
+*/
+phStatus_t phpalI14443p3a_GetAtqa(
+                                  void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                  uint8_t * pAtqa       /**< [Out] ATQA; uint8_t[2]. */
+                                  );
+
 /** @} */
 #endif /* NXPBUILD__PHPAL_I14443P3A */
 
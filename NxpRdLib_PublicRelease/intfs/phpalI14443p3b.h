@@ -105,6 +105,23 @@ phStatus_t phpalI14443p3b_Sw_Init(
 #define PHPAL_I14443P3B_DATARATE_FORCE  0x80U   /**< Flag that forces the use of the given baud rates */
 /*@}*/
 
+/**
+* \brief Card found by \ref phpalI14443p3b_Inventory.
+*
+* The protocol parameters are decoded from the AtqB once, so that a later
+* \ref phpalI14443p3b_ActivateInventoryCard does not need to request the card again.
+*/
+typedef struct
+{
+    uint8_t aAtqb[13];          /**< AtqB of the card. */
+    uint8_t bAtqbLen;           /**< Length of the AtqB; 12/13. */
+    uint8_t bBitRateCaps;       /**< Bit rate capability byte of the AtqB. */
+    uint8_t bFsci;              /**< PICC Frame Size Integer; 0-8. */
+    uint8_t bFwi;               /**< Frame Waiting Integer. */
+    uint8_t bCidSupported;      /**< Cid Support indicator; Unequal '0' if supported. */
+    uint8_t bNadSupported;      /**< Nad Support indicator; Unequal '0' if supported. */
+} phpalI14443p3b_CardInfo_t;
+
 /**
 * \brief Set configuration value.
 * \return Status code
@@ -313,6 +330,55 @@ phStatus_t phpalI14443p3b_GetProtocolParams(
     uint8_t * pFsci             /**< [Out] PICC Frame Size Integer; 0-8. */
     );
 
+/**
+* \brief Perform a complete ISO14443-3B inventory of all cards in the field.
+*
+* Every round performs a ReqB followed by SlotMarker commands for all slots.
+* Each card which answers alone in its slot is stored and halted, so it does not
+* answer in the following rounds. The number of slots is raised when collisions
+* are observed and lowered when most slots stay empty. The inventory ends after a
+* round without collision, when \c bMaxCards cards have been found or after a
+* maximum number of rounds.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if no card has been found.
+* \retval #PH_ERR_INVALID_PARAMETER Invalid number of slots.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalI14443p3b_Inventory(
+                                    void * pDataParams,                     /**< [In] Pointer to this layers parameter structure. */
+                                    uint8_t bNumSlots,                      /**< [In] Number of slots of the first round; N = 2^bNumSlots, 0-4. */
+                                    uint8_t bAfi,                           /**< [In] AFI; Application Family Indentifier. */
+                                    uint8_t bExtAtqb,                       /**< [In] Enable Extended AtqB. */
+                                    phpalI14443p3b_CardInfo_t * pCards,     /**< [Out] Cards found. */
+                                    uint8_t bMaxCards,                      /**< [In] Number of entries in \c pCards. */
+                                    uint8_t * pNumCards,                    /**< [Out] Number of cards found. */
+                                    uint8_t * pMoreCardsAvailable           /**< [Out] Whether there are unresolved cards left in the field or not. */
+                                    );
+
+/**
+* \brief Activate a card found by \ref phpalI14443p3b_Inventory.
+*
+* The halted card is woken up by a WupB with AFI 0x00 and activated by an Attrib command
+* using the cached AtqB. \c bDri and \c bDsi specify the highest data rates the reader
+* shall use; they are lowered to the highest data rates supported by the card
+* unless #PHPAL_I14443P3B_DATARATE_FORCE is set.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR Invalid response received.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalI14443p3b_ActivateInventoryCard(
+    void * pDataParams,                     /**< [In] Pointer to this layers parameter structure. */
+    phpalI14443p3b_CardInfo_t * pCard,      /**< [In] Card found by \ref phpalI14443p3b_Inventory. */
+    uint8_t bFsdi,                          /**< [In] Frame Size Integer; 0-8. */
+    uint8_t bCid,                           /**< [In] Card Identifier; 0-14. */
+    uint8_t bDri,                           /**< [In] Highest Divisor Receive (PCD to PICC) Integer; 0-3. */
+    uint8_t bDsi,                           /**< [In] Highest Divisor Send (PICC to PCD) Integer; 0-3. */
+    uint8_t * pMbli                         /**< [Out] MBLI byte; uint8_t. */
+    );
+
 /** @} */
 #endif /* NXPBUILD__PHPAL_I14443P3B */
 
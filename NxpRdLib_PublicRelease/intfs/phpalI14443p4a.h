@@ -41,6 +41,18 @@ extern "C" {
 
 #define PHPAL_I14443P4A_SW_ID   0x01    /**< ID for Software ISO14443-4A layer     */
 
+#define PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE 8U  /**< Number of card models for which unreliable data rates are remembered. */
+
+/**
+* \brief Unreliable data rates of one card model.
+*/
+typedef struct
+{
+    uint16_t wModelId;      /**< Card model identifier; CRC16 over the ATS. */
+    uint8_t bBadDri;        /**< Bitmask of unreliable DRI values (bit n represents DRI n); '0' if the entry is unused. */
+    uint8_t bBadDsi;        /**< Bitmask of unreliable DSI values (bit n represents DSI n); '0' if the entry is unused. */
+} phpalI14443p4a_Sw_RateMemory_t;
+
 /**
 * \brief Software PAL-ISO14443P4A parameter structure
 */
@@ -57,6 +69,11 @@ typedef struct
     uint8_t bFsdi;          /**< (Current) PCD Frame Size Integer; 0-8; */
     uint8_t bDri;           /**< (Current) Divisor Receive (PCD to PICC) Integer; 0-3; */
     uint8_t bDsi;           /**< (Current) Divisor Send (PICC to PCD) Integer; 0-3; */
+    uint8_t bPcdDriCaps;    /**< Bitmask of DRI values the HAL can transmit with (bit n represents DRI n); '0' if not yet retrieved. */
+    uint8_t bPcdDsiCaps;    /**< Bitmask of DSI values the HAL can receive with (bit n represents DSI n); '0' if not yet retrieved. */
+    uint16_t wModelId;      /**< Model identifier of the current card; CRC16 over its ATS. */
+    uint8_t bRateMemoryNext;                                                        /**< Index of the rate memory entry to be replaced next. */
+    phpalI14443p4a_Sw_RateMemory_t aRateMemory[PHPAL_I14443P4A_SW_RATE_MEMORY_SIZE];  /**< Unreliable data rates per card model. */
 } phpalI14443p4a_Sw_DataParams_t;
 
 /**
@@ -123,6 +140,7 @@ phStatus_t phpalI14443p4a_Rd710_Init(
 #define PHPAL_I14443P4A_DATARATE_212    0x01U   /**< DRI/DSI value for 212 kBit/s   */
 #define PHPAL_I14443P4A_DATARATE_424    0x02U   /**< DRI/DSI value for 424 kBit/s   */
 #define PHPAL_I14443P4A_DATARATE_848    0x03U   /**< DRI/DSI value for 848 kBit/s   */
+#define PHPAL_I14443P4A_DATARATE_AUTO   0xFFU   /**< DRI/DSI value for the fastest data rate supported by PCD and PICC; see \ref phpalI14443p4a_PpsAuto. */
 /*@}*/
 
 /**
@@ -169,9 +187,46 @@ phStatus_t phpalI14443p4a_Pps(
                               uint8_t bDsi          /**< [In] Divisor Send (PICC to PCD) Integer; 0-3 */
                               );
 
+/**
+* \brief Perform a ISO14443-4A "Protocol and Parameter Selection" command using the fastest common data rates.
+*
+* The data rates announced by the PICC in TA(1) of the ATS are intersected with the data rates
+* the HAL accepts for #PHHAL_HW_CONFIG_TXDATARATE and #PHHAL_HW_CONFIG_RXDATARATE.
+* Data rates which proved unreliable for the card model (see \ref phpalI14443p4a_MarkDatarateUnreliable)
+* are skipped. If the PPS fails, the failed data rates are remembered and the next lower common
+* data rates are tried. No PPS is sent if only 106 kBit/s remains.\n
+* Has to be called directly after \ref phpalI14443p4a_Rats.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_PROTOCOL_ERROR Invalid response received.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalI14443p4a_PpsAuto(
+                                  void * pDataParams,   /**< [In] Pointer to this layer's parameter structure. */
+                                  uint8_t * pDri,       /**< [Out] Selected Divisor Receive (PCD to PICC) Integer; 0-3 */
+                                  uint8_t * pDsi        /**< [Out] Selected Divisor Send (PICC to PCD) Integer; 0-3 */
+                                  );
+
+/**
+* \brief Remember the current data rates as unreliable for the model of the activated card.
+*
+* Subsequent calls to \ref phpalI14443p4a_PpsAuto for cards with the same ATS
+* do not select these data rates anymore.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+*/
+phStatus_t phpalI14443p4a_MarkDatarateUnreliable(
+    void * pDataParams  /**< [In] Pointer to this layer's parameter structure. */
+    );
+
 /**
 * \brief Perform ISO14443-4A Rats and Pps commands.
 *
+* If \c bDri and \c bDsi are both set to #PHPAL_I14443P4A_DATARATE_AUTO
+* the data rates are negotiated by \ref phpalI14443p4a_PpsAuto.
+*
 * \return Status code
 * \retval #PH_ERR_SUCCESS Operation successful.
 * \retval #PH_ERR_PROTOCOL_ERROR Invalid response received.
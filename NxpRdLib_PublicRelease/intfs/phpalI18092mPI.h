@@ -153,6 +153,7 @@ phStatus_t phpalI18092mPI_Sw_Init(
 #define PHPAL_I18092MPI_DATARATE_106   0x00U   /**< DRI/DSI value for 106 kBit/s. */
 #define PHPAL_I18092MPI_DATARATE_212   0x01U   /**< DRI/DSI value for 212 kBit/s. */
 #define PHPAL_I18092MPI_DATARATE_424   0x02U   /**< DRI/DSI value for 424 kBit/s. */
+#define PHPAL_I18092MPI_DATARATE_AUTO  0xFFU   /**< DRI/DSI value for the fastest data rate supported by initiator and target; only for #phpalI18092mPI_ActivateCard. */
 /*@}*/
 
 /**
@@ -163,6 +164,7 @@ phStatus_t phpalI18092mPI_Sw_Init(
 #define PHPAL_I18092MPI_FRAMESIZE_128  0x01U   /**< FSL value for max. framesize of 128 Bytes. */
 #define PHPAL_I18092MPI_FRAMESIZE_192  0x02U   /**< FSL value for max. framesize of 192 Bytes. */
 #define PHPAL_I18092MPI_FRAMESIZE_254  0x03U   /**< FSL value for max. framesize of 254 Bytes. */
+#define PHPAL_I18092MPI_FRAMESIZE_AUTO 0xFFU   /**< FSL value for the largest framesize the HAL buffers can hold; only for #phpalI18092mPI_ActivateCard. */
 /*@}*/
 
 /**
@@ -250,6 +252,12 @@ phStatus_t phpalI18092mPI_Psl(
 * \li #PHPAL_I18092MPI_FRAMESIZE_128
 * \li #PHPAL_I18092MPI_FRAMESIZE_192
 * \li #PHPAL_I18092MPI_FRAMESIZE_254
+* \li #PHPAL_I18092MPI_FRAMESIZE_AUTO
+*
+* #PHPAL_I18092MPI_DATARATE_AUTO selects the fastest data rate which is supported by the HAL
+* and announced by the target in BS(T) / BR(T) of the Attribute Response.
+* #PHPAL_I18092MPI_FRAMESIZE_AUTO requests the largest LR(I) a frame of which still fits into
+* the HAL buffers; the final frame size is the smaller one of LR(I) and LR(T).
 *
 * \return Status code
 * \retval #PH_ERR_SUCCESS Operation successful, target activated.
@@ -265,9 +273,9 @@ phStatus_t phpalI18092mPI_ActivateCard(
                                                             uint8_t bDid,           /**< [In] Device Identifier; '0' to disable usage else 1-14. */
                                                             uint8_t bNadEnable,     /**< [In] Enable usage of Node Address; Unequal '0' to enable. */
                                                             uint8_t bNad,           /**< [In] Node Address; Ignored if bNadEnabled is equal '0'. */
-                                                            uint8_t bDsi,           /**< [In] Divisor Send (target to initiator) Integer; 0-7 */
-                                                            uint8_t bDri,           /**< [In] Divisor Receive (initiator to target) Integer; 0-7 */
-                                                            uint8_t bFsl,           /**< [In] Frame Length Byte; 0-3 */
+                                                            uint8_t bDsi,           /**< [In] Divisor Send (target to initiator) Integer; 0-2 or #PHPAL_I18092MPI_DATARATE_AUTO */
+                                                            uint8_t bDri,           /**< [In] Divisor Receive (initiator to target) Integer; 0-2 or #PHPAL_I18092MPI_DATARATE_AUTO */
+                                                            uint8_t bFsl,           /**< [In] Frame Length Byte; 0-3 or #PHPAL_I18092MPI_FRAMESIZE_AUTO */
                                                             uint8_t * pGi,          /**< [In] Optional General Information bytes. */
                                                             uint8_t bGiLength,      /**< [In] Number of General Information bytes. */
                                                             uint8_t * pAtrRes,      /**< [Out] Attribute Response; uint8_t[64]. */
@@ -337,6 +345,49 @@ phStatus_t phpalI18092mPI_Exchange(
                                    uint16_t * pRxLength      /**< [Out] number of received data bytes. */
                                    );
 
+/**
+* \brief Statistics of a bulk transfer.
+*
+* The air time is calculated from the frame lengths and data rates, it neither contains the
+* response time of the target nor frames sent during error recovery.
+*/
+typedef struct
+{
+    uint16_t wTxPayload;    /**< Number of payload bytes sent. */
+    uint16_t wRxPayload;    /**< Number of payload bytes received. */
+    uint16_t wNumPdus;      /**< Number of information and ACK PDUs sent. */
+    uint32_t dwAirTimeUs;   /**< Air time of all frames in both directions in microseconds. */
+    uint32_t dwGoodput;     /**< Payload bytes of both directions per second of air time. */
+} phpalI18092mPI_BulkStats_t;
+
+/**
+* \brief Transfer a large amount of data to the target and receive its complete response.
+*
+* The data is split into chained information PDUs of the negotiated frame size. The protocol
+* header is built only once per transfer and just patched for every PDU, the payload is sent
+* directly from \c pTxBuffer. The chained response of the target is collected into \c pRxBuffer,
+* so neither direction is limited by the size of the HAL buffers.
+* \c pRxBuffer may be the same buffer as \c pTxBuffer.
+* Use #phpalI18092mPI_ActivateCard with #PHPAL_I18092MPI_DATARATE_AUTO and #PHPAL_I18092MPI_FRAMESIZE_AUTO
+* to get the largest frames at the fastest data rate.
+*
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_BUFFER_OVERFLOW Response does not fit into \c pRxBuffer; the transfer has been completed anyway.
+* \retval #PH_ERR_PROTOCOL_ERROR Received response is not ISO/IEC 18092 compliant.
+* \retval #PHPAL_I18092MPI_ERR_RECOVERY_FAILED Recovery failed, target does not respond any more.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalI18092mPI_BulkExchange(
+                                       void * pDataParams,                      /**< [In] Pointer to this layer's parameter structure. */
+                                       uint8_t * pTxBuffer,                     /**< [In] Data to transmit. */
+                                       uint16_t wTxLength,                      /**< [In] Length of data to transmit. */
+                                       uint8_t * pRxBuffer,                     /**< [Out] Received data. */
+                                       uint16_t wRxBufferSize,                  /**< [In] Size of \c pRxBuffer. */
+                                       uint16_t * pRxLength,                    /**< [Out] Number of received data bytes. */
+                                       phpalI18092mPI_BulkStats_t * pStats      /**< [Out] Statistics of the transfer; may be NULL. */
+                                       );
+
 /**
 * \brief Set configuration parameter.
 * \return Status code
@@ -309,6 +309,20 @@ phStatus_t phpalSli15693_GetSerialNo(
                                      uint8_t * bUidLength   /**< [Out] Length of received UID bytes. */
                                      );
 
+/**
+* \brief Set the serial number of the VICC to address.
+*
+* Allows addressed commands to a VICC whose UID is already known, e.g. one in quiet state.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful.
+* \retval #PH_ERR_INVALID_PARAMETER \c bUidLength is not #PHPAL_SLI15693_UID_LENGTH.
+*/
+phStatus_t phpalSli15693_SetSerialNo(
+                                     void * pDataParams,    /**< [In] Pointer to this layers parameter structure. */
+                                     uint8_t * pUid,        /**< [In] Buffer, holding the UID (8 bytes) */
+                                     uint8_t bUidLength     /**< [In] Length of the UID. */
+                                     );
+
 /**
 * \brief Perform a SetConfig command.
 *
@@ -425,6 +439,48 @@ phStatus_t phpalSli15693_FastInventoryPageRead(
     uint16_t * pDataLength      /**< [Out] Number of received data bytes. */
     );
 
+/**
+* \brief Statistics of one inventory round of \ref phpalSli15693_InventoryAll.
+*
+* A round is one Inventory request followed by the slot markers (EOFs) of its slots.
+*/
+typedef struct
+{
+    uint8_t bMaskBitLength;     /**< Length of the UID mask of the round in bits. */
+    uint8_t bNumSlots;          /**< Number of slots of the round; 1 or 16. */
+    uint8_t bNumTags;           /**< Number of tags resolved in the round. */
+    uint8_t bNumCollisions;     /**< Number of slots with a collision. */
+    uint8_t bNumEmpty;          /**< Number of slots without a response. */
+} phpalSli15693_RoundStats_t;
+
+/**
+* \brief Retrieve the UIDs of all tags in the field.
+*
+* The mask tree is walked depth first over the colliding slots. Each round uses 16 slots
+* if the previous round indicates many tags per colliding slot and 1 slot otherwise,
+* in which case a collision is resolved bit by bit. Every resolved tag is put to the quiet state,
+* so it does not answer again until it is reset to ready or leaves the field.
+*
+* Only #PHPAL_SLI15693_FLAG_TWO_SUB_CARRIERS, #PHPAL_SLI15693_FLAG_DATA_RATE and #PHPAL_SLI15693_FLAG_AFI
+* of \c bFlags are used, the number of slots is chosen per round.
+* \return Status code
+* \retval #PH_ERR_SUCCESS Operation successful; also if no tag has been found.
+* \retval Other Depending on implementation and underlaying component.
+*/
+phStatus_t phpalSli15693_InventoryAll(
+                                      void * pDataParams,                           /**< [In] Pointer to this layers parameter structure. */
+                                      uint8_t bFlags,                               /**< [In] Request flags byte. */
+                                      uint8_t bAfi,                                 /**< [In] Application Family Identifier. */
+                                      uint8_t * pUids,                              /**< [Out] Received UIDs; uint8_t[#PHPAL_SLI15693_UID_LENGTH * bMaxTags]. */
+                                      uint8_t * pDsfids,                            /**< [Out] Data Storage Format Identifier of each tag; uint8_t[bMaxTags]. */
+                                      uint8_t bMaxTags,                             /**< [In] Maximum number of tags to retrieve. */
+                                      uint8_t * pNumTags,                           /**< [Out] Number of retrieved tags. */
+                                      phpalSli15693_RoundStats_t * pRoundStats,     /**< [Out] Statistics of the first \c bMaxRounds rounds; may be NULL if \c bMaxRounds is 0. */
+                                      uint8_t bMaxRounds,                           /**< [In] Number of entries in \c pRoundStats. */
+                                      uint8_t * pNumRounds,                         /**< [Out] Number of performed rounds; may exceed \c bMaxRounds. */
+                                      uint8_t * pMoreTagsAvailable                  /**< [Out] Unequal '0' if not all tags could be retrieved. */
+                                      );
+
 /** @} */
 #endif /* NXPBUILD__PHPAL_SLI15693 */
 
@@ -152,14 +152,27 @@
 
 /* PAL ISO 18092 components */
 
-//#define NXPBUILD__PHPAL_I18092MPI_SW            /**< Software PAL ISO 18092 definition */
+#define NXPBUILD__PHPAL_I18092MPI_SW            /**< Software PAL ISO 18092 definition */
 
 #if defined (NXPBUILD__PHPAL_I18092MPI_SW)
     #define NXPBUILD__PHPAL_I18092MPI           /**< Generic PAL ISO 18092 definition */
 #endif
 
+/* LN LLCP components */
+
+#define NXPBUILD__PHLN_LLCP_SW                  /**< Software LN LLCP definition */
+
+#if defined (NXPBUILD__PHLN_LLCP_SW)
+    #define NXPBUILD__PHLN_LLCP                 /**< Generic LN LLCP definition */
+#endif
+
 /* AL Felica components */
 
+#define NXPBUILD__PHAL_FELICA_SW                /**< Software AL Felica */
+
+#if defined (NXPBUILD__PHAL_FELICA_SW)
+    #define NXPBUILD__PHAL_FELICA               /**< Generic AL Felica definition */
+#endif
 
 /* AL MIFARE Classic components */
 
@@ -169,6 +182,14 @@
     #define NXPBUILD__PHAL_MFC                  /**< Generic AL MIFARE Classic definition */
 #endif
 
+/* AL MIFARE DESFire components */
+
+#define NXPBUILD__PHAL_MFDF_SW                  /**< Software MIFARE DESFire */
+
+#if defined (NXPBUILD__PHAL_MFDF_SW)
+    #define NXPBUILD__PHAL_MFDF                 /**< Generic AL MIFARE DESFire definition */
+#endif
+
 /* AL MIFARE Plus components */
 
 
@@ -180,6 +201,14 @@
     #define NXPBUILD__PHAL_MFUL                 /**< Generic AL MIFARE Ultralight definition */
 #endif
 
+/* AL Tag Operation components */
+
+#define NXPBUILD__PHAL_TOP_SW                   /**< Software Tag Operation */
+
+#if defined (NXPBUILD__PHAL_TOP_SW)
+    #define NXPBUILD__PHAL_TOP                  /**< Generic AL Tag Operation definition */
+#endif
+
 /* AL Virtual Card Architecture components */
 
 
@@ -203,6 +232,11 @@
 
 /* AL I15693 components */
 
+#define NXPBUILD__PHAL_I15693_SW                /**< Software AL I15693 */
+
+#if defined (NXPBUILD__PHAL_I15693_SW)
+    #define NXPBUILD__PHAL_I15693               /**< Generic AL I15693 definition */
+#endif
 
 /* AL Sli components */
 
@@ -217,20 +251,41 @@
     #define NXPBUILD__PH_CIDMANAGER             /**< Generic CID Manager definition */
 #endif
 
+/* Session Manager components */
+
+#define NXPBUILD__PH_SESSIONMANAGER_SW          /**< Software Session Manager */
+
+#if defined (NXPBUILD__PH_SESSIONMANAGER_SW)
+    #define NXPBUILD__PH_SESSIONMANAGER         /**< Generic Session Manager definition */
+#endif
+
 /* Crypto components */
 
+#define NXPBUILD__PH_CRYPTOSYM_SW               /**< Software Crypto */
+
+#if defined (NXPBUILD__PH_CRYPTOSYM_SW)
+    #define NXPBUILD__PH_CRYPTOSYM              /**< Generic Crypto definition */
+#endif
 
 /* CryptoRng components */
 
+#define NXPBUILD__PH_CRYPTORNG_SW               /**< Software CryptoRng */
+
+#if defined (NXPBUILD__PH_CRYPTORNG_SW)
+    #define NXPBUILD__PH_CRYPTORNG              /**< Generic CryptoRng definition */
+#endif
+
 
 /* KeyStore components */
 
 #define NXPBUILD__PH_KEYSTORE_SW                /**< Software KeyStore */
+#define NXPBUILD__PH_KEYSTORE_IDX               /**< Indexed Software KeyStore */
 //#define NXPBUILD__PH_KEYSTORE_RC632             /**< RC632 KeyStore */
 #define NXPBUILD__PH_KEYSTORE_RC663             /**< RC663 KeyStore */
 //#define NXPBUILD__PH_KEYSTORE_RD710             /**< Rd710 KeyStore */
 
 #if defined (NXPBUILD__PH_KEYSTORE_SW)      || \
+    defined (NXPBUILD__PH_KEYSTORE_IDX)     || \
     defined (NXPBUILD__PH_KEYSTORE_RC663)   || \
     defined (NXPBUILD__PH_KEYSTORE_RC632)   || \
     defined (NXPBUILD__PH_KEYSTORE_RD710)
@@ -144,6 +144,8 @@
 #define PH_COMP_AL_MFDF                 0x1900U /**< MIFARE DESFIRE EV1 AL Component Code. */
 #define PH_COMP_AL_P40CMDPRIV           0x1A00U /**< P40 command libraryAL-Component Code. */
 #define PH_COMP_AL_P40CMDPUB			0x1B00U /**< P40 command libraryAL-Component Code. */
+#define PH_COMP_AL_TOP                  0x1C00U /**< Tag Operation AL-Component Code. */
+#define PH_COMP_LN_LLCP                 0x2000U /**< LLCP Link Layer-Component Code. */
 #define PH_COMP_DL_AMP					0x3000U /**< Amplifier DL-Component Code. */
 #define PH_COMP_DL_THSTRM				0x3100U /**< Thermostream DL-Component Code. */
 #define PH_COMP_DL_OSCI					0x3200U /**< Oscilloscope DL-Component Code. */
@@ -155,6 +157,7 @@
 #define PH_COMP_KEYSTORE                0xE200U /**< KeyStore Component Code. */
 #define PH_COMP_TOOLS                   0xE300U /**< Tools Component Code. */
 #define PH_COMP_CRYPTORNG               0xE400U /**< CryptoRng Component Code. */
+#define PH_COMP_SESSIONMANAGER          0xE500U /**< Session Manager Component Code. */
 #define PH_COMP_LOG                     0xEF00U /**< Log Component Code. */
 /*@}*/
 
@@ -3,24 +3,155 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <ph_NxpBuild.h>
 #include <ph_Status.h>
 
 #include <phpalI14443p3a.h>
 #include <phpalI14443p4.h>
+#include <phpalI14443p4a.h>
 #include <phalMfc.h>
+#include <phalMful.h>
+#include <phalTop.h>
+#include <phKeyStore.h>
+#include <phCryptoSym.h>
+#include <phCryptoRng.h>
 
-static const uint8_t nbSector = 16;
 static const uint8_t nbBlockData = 16;
-static const uint8_t nbSectorData = 64;
+static const uint16_t nbSectorDataMax = 16 * 16;
+/* Data blocks of a 4K without the sector trailers */
+static const uint16_t nbCardDataMax = (32 * 3 + 8 * 15) * 16;
+
+/* Public keys A of the MIFARE Application Directory and of the NDEF sectors */
+static uint8_t madKey[6] = { 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5 };
+static uint8_t ndefKey[6] = { 0xD3, 0xF7, 0xD3, 0xF7, 0xD3, 0xF7 };
+/* Default 2K3DES key of the MIFARE Ultralight C, "BREAKMEIFYOUCAN!" */
+static uint8_t ulcKey[16] = { 0x42, 0x52, 0x45, 0x41, 0x4B, 0x4D, 0x45, 0x49,
+  0x46, 0x59, 0x4F, 0x55, 0x43, 0x41, 0x4E, 0x21 };
+
+/* Persistent cache of the keys which opened the sectors of the cards seen so far.
+ * The file is mapped and updated in place. For every UID and sector it stores the
+ * keys A and B found, and for every sector and key type the keys which opened it
+ * on the most cards. */
+#define KEYCACHE_MAGIC 0x3143464BU /* "KFC1" */
+#define KEYCACHE_POPULAR 8
+#define KEYCACHE_SLOTS 8192 /* power of two */
+#define KEYCACHE_PROBES 32
+#define KEYCACHE_DEFAULT_FILE "pi-nfc.keycache"
+
+typedef struct {
+  uint8_t key[6];
+  uint8_t pad[2];
+  uint32_t count; /* number of cards this key opened */
+} keycache_popular_t;
+
+typedef struct {
+  uint8_t uid[10];
+  uint8_t uidLength; /* 0 for a free slot */
+  uint8_t sector;
+  uint8_t known; /* bit 0 key A, bit 1 key B */
+  uint8_t keys[2][6];
+  uint8_t pad[3];
+} keycache_slot_t;
+
+typedef struct {
+  uint32_t magic;
+  uint32_t nbSlots;
+  /* sorted by decreasing count */
+  keycache_popular_t popular[PHAL_MFC_MAX_SECTORS][2][KEYCACHE_POPULAR];
+  keycache_slot_t slots[KEYCACHE_SLOTS];
+} keycache_t;
+
+/* Keys of a dictionary, contiguous. A compiled dictionary is mapped,
+ * a text one is parsed into a single allocation. */
+typedef struct {
+  uint8_t (* keys)[6];
+  uint32_t nbKeys;
+  void * map; /* mapped file, NULL if keys was allocated */
+  size_t mapLength;
+} keydict_t;
+
+/* Order in which the keys are tried on one sector with one key type :
+ * the key cached for this card, the popular keys, then the dictionary */
+typedef struct {
+  uint8_t first[1 + KEYCACHE_POPULAR][6];
+  uint8_t nbFirst;
+  uint8_t nextFirst;
+  uint32_t nextKey;
+} keytrial_t;
+
+/* Card families, each one read with its own command set */
+#define CARD_UNKNOWN 0
+#define CARD_MFC 1 /* MIFARE Classic, Mini and Plus in security level 2 */
+#define CARD_MFUL 2 /* MIFARE Ultralight, Ultralight C, Ultralight EV1 and NTAG */
+#define CARD_ISODEP 3 /* ISO14443-4 card, read as NFC Forum Type 4 Tag */
+
+/* SAK bits of the MIFARE Classic protocol and of the ISO14443-4 compliance */
+#define SAK_MFC 0x18
+#define SAK_ISODEP 0x20
+/* ATQA of the Ultralight family, least significant byte first */
+#define ATQA_MFUL 0x0044
+#define ATQA_DESFIRE 0x0344
+
+/* Ultralight C : 48 pages, the 4 last ones hold the 3DES key and cannot be read.
+ * A plain Ultralight refuses any page beyond its 16. */
+#define MFUL_ULC_PAGES 48
+#define MFUL_ULC_USER_PAGES 36
+#define MFUL_ULC_KEY_PAGE 44
+#define MFUL_ULC_PROBE_PAGE 16
+
+/* PCD frame size 64, the size of the HAL buffers */
+#define ISODEP_FSDI 5
+
+/* 64 KiB, the largest NDEF file of a Type 4 Tag */
+#define CARD_LINES_MAX 4096
+
+/* Dump of any card : the identification of the card and its memory as lines
+ * of 16 bytes, grouped in paragraphs (the sectors of a MIFARE Classic) */
+typedef struct {
+  uint8_t type;
+  uint8_t uid[10];
+  uint8_t uidLength;
+  uint8_t sak;
+  uint8_t atqa[2];
+  uint8_t version[PHAL_MFUL_VERSION_LENGTH];
+  uint8_t versionLength; /* 0 if the card has no GET_VERSION */
+  uint8_t ats[256];
+  uint8_t atsLength; /* 0 if the card is not an ISO14443-4 one */
+  uint16_t nbPages; /* pages of an Ultralight */
+  uint8_t nbGroups;
+  uint16_t groupLines[PHAL_MFC_MAX_SECTORS];
+  uint16_t nbLines;
+  uint8_t lineLength[CARD_LINES_MAX];
+  uint8_t readable[CARD_LINES_MAX];
+  uint8_t data[CARD_LINES_MAX][16];
+} card_dump_t;
 
 static phStatus_t initLayers();
 static phStatus_t search_card(uint8_t * pUid, uint8_t * pLength, uint8_t * pSak, uint8_t * pNbCards);
-static phStatus_t readSector(uint8_t sector_id, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t * data);
-static phStatus_t forceReadSector(uint8_t sector_id, uint8_t ** keys, uint16_t nbKeys, uint8_t * data);
+static phStatus_t card_geometry(uint8_t * pNbSectors);
+static uint8_t sak2sectors(uint8_t sak);
+static phStatus_t detect_card(card_dump_t * card);
+static phStatus_t read_card(card_dump_t * card, uint8_t (* keys)[6], uint32_t nbKeys);
+static phStatus_t loadKey(uint8_t * key);
+static void keyTrialInit(keytrial_t * pTrial, uint8_t * bUid, uint8_t bLength, uint8_t sector_id, uint8_t key_type);
+static uint8_t * keyTrialNext(keytrial_t * pTrial, uint8_t (* keys)[6], uint32_t nbKeys);
+static void keyCacheLearn(uint8_t * bUid, uint8_t bLength, uint8_t sector_id, uint8_t key_type, uint8_t * key);
+static phStatus_t readSector(uint8_t sector_id, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t bLength,
+    uint8_t * data, uint16_t * pReadMask, uint16_t * pOtherKeyMask);
+static phStatus_t forceReadSector(uint8_t sector_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * data, uint16_t * pReadMask);
 static phStatus_t writeBlock(uint8_t block, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t * data);
-static phStatus_t forceWriteBlock(uint8_t block_id, uint8_t ** keys, uint16_t nbKeys, uint8_t * data);
+static phStatus_t forceWriteBlock(uint8_t block_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * data);
+static phStatus_t writeSectorDiff(uint8_t sector_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * image,
+    uint16_t blockMask, int verify);
+static phStatus_t readMad(uint8_t (* keys)[6], uint32_t nbKeys, uint8_t nbSector, uint16_t * aids, uint8_t * version);
+static phStatus_t readApplication(uint16_t aid, uint16_t * aids, uint8_t nbSector, uint8_t (* keys)[6], uint32_t nbKeys,
+    uint8_t * data, uint16_t size, uint16_t * length);
 
 static phStatus_t status;
 static uint8_t bHalBufferReader[0x40];
@@ -28,8 +159,32 @@ static phbalReg_R_Pi_spi_DataParams_t bal;
 static phhalHw_Rc523_DataParams_t hal;
 static phpalI14443p3a_Sw_DataParams_t palI14443p3a;
 static phpalI14443p4_Sw_DataParams_t palI14443p4;
+static phpalI14443p4a_Sw_DataParams_t palI14443p4a;
 static phpalMifare_Sw_DataParams_t palMifare;
 static phalMfc_Sw_DataParams_t alMfc;
+static phalMful_Sw_DataParams_t alMful;
+static phalTop_Sw_DataParams_t alTop;
+static phKeyStore_Sw_DataParams_t keyStore;
+static phKeyStore_Sw_KeyEntry_t keyEntries[1];
+static phKeyStore_Sw_KeyVersionPair_t keyVersionPairs[1];
+static phKeyStore_Sw_KUCEntry_t keyUsageCounters[1];
+static phCryptoSym_Sw_DataParams_t cryptoSym;
+static phCryptoRng_Sw_DataParams_t cryptoRng;
+
+/* Key number of the keystore entry holding the key being tried */
+static const uint16_t trialKeyNo = 0;
+
+/* Statistics of the differential writer */
+static uint32_t nbAuthFrames;
+static uint32_t nbReadFrames;
+static uint32_t nbWriteFrames;
+static uint16_t nbWritten;
+static uint16_t nbUnchanged;
+static uint16_t nbDenied;
+static uint16_t nbVerifyErrors;
+
+/* Too large for the stack */
+static card_dump_t dump;
 
 phStatus_t initLayers()
 {
@@ -59,11 +214,28 @@ phStatus_t initLayers()
   PH_CHECK_SUCCESS_FCT(status, phpalI14443p4_Sw_Init(&palI14443p4,
         sizeof(phpalI14443p4_Sw_DataParams_t), &hal));
 
+  PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_Sw_Init(&palI14443p4a,
+        sizeof(phpalI14443p4a_Sw_DataParams_t), &hal));
+
   PH_CHECK_SUCCESS_FCT(status, phpalMifare_Sw_Init(&palMifare,
         sizeof(phpalMifare_Sw_DataParams_t), &hal, &palI14443p4));
 
+  PH_CHECK_SUCCESS_FCT(status, phKeyStore_Sw_Init(&keyStore,
+        sizeof(phKeyStore_Sw_DataParams_t), keyEntries, 1, keyVersionPairs, 1,
+        keyUsageCounters, 1));
+
+  PH_CHECK_SUCCESS_FCT(status, phKeyStore_FormatKeyEntry(&keyStore, trialKeyNo,
+        PH_KEYSTORE_KEY_TYPE_MIFARE));
+
   PH_CHECK_SUCCESS_FCT(status, phalMfc_Sw_Init(&alMfc,
-        sizeof(phalMfc_Sw_DataParams_t), &palMifare, NULL));
+        sizeof(phalMfc_Sw_DataParams_t), &palMifare, &keyStore));
+
+  /* No Ultralight C authentication here, so no cryptography */
+  PH_CHECK_SUCCESS_FCT(status, phalMful_Sw_Init(&alMful,
+        sizeof(phalMful_Sw_DataParams_t), &palMifare, NULL, NULL, NULL));
+
+  PH_CHECK_SUCCESS_FCT(status, phalTop_Sw_Init(&alTop,
+        sizeof(phalTop_Sw_DataParams_t), &alMful, &palI14443p4));
 
   return PH_ERR_SUCCESS;
 }
@@ -80,33 +252,473 @@ phStatus_t search_card(uint8_t * pUid, uint8_t * pLength, uint8_t * pSak, uint8_
   return PH_ERR_SUCCESS;
 }
 
-phStatus_t readSector(uint8_t sector_id, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t * data) {
-  uint8_t block = sector_id << 2;
-  PH_CHECK_SUCCESS_FCT(status,
-      phhalHw_MfcAuthenticate(&hal, block, key_type, key, bUid));
-  PH_CHECK_SUCCESS_FCT(status, phalMfc_Read(&alMfc, block + 0, &data[0 * nbBlockData]));
-  PH_CHECK_SUCCESS_FCT(status, phalMfc_Read(&alMfc, block + 1, &data[1 * nbBlockData]));
-  PH_CHECK_SUCCESS_FCT(status, phalMfc_Read(&alMfc, block + 2, &data[2 * nbBlockData]));
-  PH_CHECK_SUCCESS_FCT(status, phalMfc_Read(&alMfc, block + 3, &data[3 * nbBlockData]));
+/* Number of sectors of a MIFARE Classic card, derived from its SAK.
+ * Unknown SAKs are handled like a 1K. */
+uint8_t sak2sectors(uint8_t sak) {
+  switch (sak) {
+    case 0x09: /* Mini */
+      return 5;
+    case 0x10: /* Plus 2K, security level 2 */
+    case 0x19: /* Classic 2K */
+      return 32;
+    case 0x11: /* Plus 4K, security level 2 */
+    case 0x18: /* Classic 4K */
+    case 0x38: /* SmartMX with Classic 4K */
+    case 0x98: /* Classic 4K, Infineon */
+      return PHAL_MFC_MAX_SECTORS;
+    default: /* Classic 1K, 0x08, 0x28, 0x88 */
+      return 16;
+  }
+}
+
+phStatus_t card_geometry(uint8_t * pNbSectors) {
+  uint8_t bSak[1];
+  uint8_t bUid[10];
+  uint8_t bNbCards;
+  uint8_t bLength;
+  PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  if ((bSak[0] & SAK_MFC) == 0) {
+    printf("The card is not a MIFARE Classic.\n");
+    return PH_ERR_UNSUPPORTED_COMMAND;
+  }
+  *pNbSectors = sak2sectors(bSak[0]);
   return PH_ERR_SUCCESS;
 }
 
-phStatus_t forceReadSector(uint8_t sector_id, uint8_t ** keys, uint16_t nbKeys, uint8_t * data) {
+/* Wake the card up again after a refused command put it to HALT */
+phStatus_t reactivate_card() {
   uint8_t bSak[1];
   uint8_t bUid[10];
   uint8_t bNbCards;
   uint8_t bLength;
-  uint16_t i;
+  return search_card(bUid, &bLength, bSak, &bNbCards);
+}
+
+/* GET_VERSION tells the EV1 and the NTAG apart and sets their size. The plain
+ * Ultralight and the Ultralight C do not answer it, only the latter has pages
+ * beyond the 16th. */
+phStatus_t identify_mful(card_dump_t * card) {
+  uint8_t buffer[PHAL_MFUL_READ_BLOCK_LENGTH];
+  if (phalMful_GetVersion(&alMful, card->version) == PH_ERR_SUCCESS) {
+    card->versionLength = PHAL_MFUL_VERSION_LENGTH;
+  }
+  else {
+    PH_CHECK_SUCCESS_FCT(status, reactivate_card());
+    if (phalMful_Read(&alMful, MFUL_ULC_PROBE_PAGE, buffer) == PH_ERR_SUCCESS) {
+      PH_CHECK_SUCCESS_FCT(status, phalMful_SetConfig(&alMful, PHAL_MFUL_CONFIG_NUM_PAGES, MFUL_ULC_PAGES));
+      PH_CHECK_SUCCESS_FCT(status, phalMful_SetConfig(&alMful, PHAL_MFUL_CONFIG_USER_PAGES, MFUL_ULC_USER_PAGES));
+    }
+    else {
+      PH_CHECK_SUCCESS_FCT(status, reactivate_card());
+    }
+  }
+  PH_CHECK_SUCCESS_FCT(status, phalMful_GetConfig(&alMful, PHAL_MFUL_CONFIG_NUM_PAGES, &card->nbPages));
+  return PH_ERR_SUCCESS;
+}
+
+/* RATS, then the ISO14443-4 layer takes the frame sizes and timings of the ATS */
+phStatus_t activate_isodep(card_dump_t * card) {
+  uint8_t bCidEnabled;
+  uint8_t bCid;
+  uint8_t bNadSupported;
+  uint8_t bFwi;
+  uint8_t bFsdi;
+  uint8_t bFsci;
+  PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_ActivateCard(&palI14443p4a, ISODEP_FSDI, 0x00,
+        PHPAL_I14443P4A_DATARATE_AUTO, PHPAL_I14443P4A_DATARATE_AUTO, card->ats));
+  card->atsLength = card->ats[0];
+  PH_CHECK_SUCCESS_FCT(status, phpalI14443p4a_GetProtocolParams(&palI14443p4a, &bCidEnabled,
+        &bCid, &bNadSupported, &bFwi, &bFsdi, &bFsci));
+  PH_CHECK_SUCCESS_FCT(status, phpalI14443p4_SetProtocol(&palI14443p4, bCidEnabled, bCid,
+        PH_OFF, 0, bFwi, bFsdi, bFsci));
+  return PH_ERR_SUCCESS;
+}
+
+/* Identify the card from its SAK and ATQA. Only the family found is asked
+ * more : GET_VERSION for the Ultralight family, RATS for the ISO14443-4
+ * cards, nothing for a MIFARE Classic. The Classic bits win over the
+ * ISO14443-4 one, so a SmartMX emulating a Classic is read as a Classic. */
+phStatus_t detect_card(card_dump_t * card) {
+  uint8_t bNbCards;
+  uint16_t atqa;
+  memset(card, 0, sizeof(card_dump_t));
+  PH_CHECK_SUCCESS_FCT(status, search_card(card->uid, &card->uidLength, &card->sak, &bNbCards));
+  PH_CHECK_SUCCESS_FCT(status, phpalI14443p3a_GetAtqa(&palI14443p3a, card->atqa));
+  atqa = card->atqa[0] | (card->atqa[1] << 8);
+
+  if (card->sak & SAK_MFC) {
+    card->type = CARD_MFC;
+  }
+  else if (card->sak & SAK_ISODEP) {
+    card->type = CARD_ISODEP;
+    PH_CHECK_SUCCESS_FCT(status, activate_isodep(card));
+  }
+  else if (card->sak == 0x00 && atqa == ATQA_MFUL) {
+    card->type = CARD_MFUL;
+    PH_CHECK_SUCCESS_FCT(status, identify_mful(card));
+  }
+  else {
+    card->type = CARD_UNKNOWN;
+  }
+  return PH_ERR_SUCCESS;
+}
+
+char * card_name(card_dump_t * card) {
+  switch (card->type) {
+    case CARD_MFC:
+      switch (card->sak) {
+        case 0x09: return "MIFARE Mini";
+        case 0x10: return "MIFARE Plus 2K";
+        case 0x11: return "MIFARE Plus 4K";
+        case 0x19: return "MIFARE Classic 2K";
+        case 0x18:
+        case 0x38:
+        case 0x98: return "MIFARE Classic 4K";
+        default: return "MIFARE Classic 1K";
+      }
+    case CARD_MFUL:
+      if (card->versionLength == 0)
+        return card->nbPages == MFUL_ULC_PAGES ? "MIFARE Ultralight C" : "MIFARE Ultralight";
+      if (card->version[2] == 0x03)
+        return "MIFARE Ultralight EV1";
+      switch (card->version[6]) {
+        case 0x0B: return "NTAG210";
+        case 0x0E: return "NTAG212";
+        case 0x0F: return "NTAG213";
+        case 0x11: return "NTAG215";
+        case 0x13: return "NTAG216";
+        default: return "NTAG";
+      }
+    case CARD_ISODEP:
+      if ((card->atqa[0] | (card->atqa[1] << 8)) == ATQA_DESFIRE)
+        return "MIFARE DESFire";
+      return "ISO14443-4";
+    default:
+      return "Unknown";
+  }
+}
+
+void card_group(card_dump_t * card, uint16_t nbLines) {
+  card->groupLines[card->nbGroups++] = nbLines;
+  card->nbLines += nbLines;
+}
+
+/* Each sector with the keys which open it, the unreadable blocks are left out */
+phStatus_t read_mfc(card_dump_t * card, uint8_t (* keys)[6], uint32_t nbKeys) {
+  uint8_t sector;
+  uint8_t nbSector = sak2sectors(card->sak);
+  uint8_t nbBlocks;
+  uint8_t i;
+  uint16_t readMask;
+  for (sector = 0; sector < nbSector; sector++) {
+    nbBlocks = PHAL_MFC_GET_SECTOR_BLOCKS(sector);
+    if (forceReadSector(sector, keys, nbKeys, card->data[card->nbLines], &readMask) != PH_ERR_SUCCESS)
+      readMask = 0;
+    for (i = 0; i < nbBlocks; i++) {
+      card->lineLength[card->nbLines + i] = nbBlockData;
+      card->readable[card->nbLines + i] = (readMask >> i) & 1;
+    }
+    card_group(card, nbBlocks);
+  }
+  return PH_ERR_SUCCESS;
+}
+
+/* The whole memory in FAST_READ bursts when the chip has it, 4 pages per
+ * READ otherwise. A password protects every page from AUTH0 to the end and
+ * the first refused page puts the chip to HALT : the chip is then woken up
+ * and read line by line up to the first refused line. */
+phStatus_t read_mful(card_dump_t * card) {
+  uint16_t nbPages = card->nbPages;
+  uint16_t line;
+  uint16_t nbLines;
+  uint16_t page;
+  uint16_t count;
+
+  /* The key of an Ultralight C is printed as unreadable */
+  if (card->versionLength == 0 && nbPages == MFUL_ULC_PAGES)
+    nbPages = MFUL_ULC_KEY_PAGE;
+  nbLines = (card->nbPages + 3) / 4;
+  for (line = 0; line < nbLines; line++) {
+    page = line * 4;
+    count = card->nbPages - page < 4 ? card->nbPages - page : 4;
+    card->lineLength[line] = count * PHAL_MFUL_PAGE_LENGTH;
+  }
+  card_group(card, nbLines);
+
+  if (phalMful_ReadPages(&alMful, 0, nbPages, card->data[0]) == PH_ERR_SUCCESS) {
+    for (line = 0; line * 4 < nbPages; line++)
+      card->readable[line] = 1;
+    return PH_ERR_SUCCESS;
+  }
+
+  PH_CHECK_SUCCESS_FCT(status, reactivate_card());
+  for (line = 0; line * 4 < nbPages; line++) {
+    page = line * 4;
+    count = nbPages - page < 4 ? nbPages - page : 4;
+    if (phalMful_ReadPages(&alMful, page, count, card->data[line]) != PH_ERR_SUCCESS)
+      break;
+    card->readable[line] = 1;
+  }
+  return PH_ERR_SUCCESS;
+}
+
+phStatus_t store_ndef(void * pContext, uint8_t * pData, uint16_t wOffset, uint16_t wLength) {
+  card_dump_t * card = (card_dump_t *)pContext;
+  if (wOffset + wLength > sizeof(card->data))
+    return PH_ERR_BUFFER_OVERFLOW;
+  memcpy(&card->data[0][wOffset], pData, wLength);
+  return PH_ERR_SUCCESS;
+}
+
+/* The NDEF message of the Type 4 Tag application, streamed into the lines */
+phStatus_t read_isodep(card_dump_t * card) {
+  uint16_t length;
+  uint16_t line;
+  PH_CHECK_SUCCESS_FCT(status, phalTop_SetUid(&alTop, card->uid, card->uidLength));
+  PH_CHECK_SUCCESS_FCT(status, phalTop_ReadNdefStream(&alTop, PHAL_TOP_TAG_TYPE_T4T, store_ndef,
+        card, &length));
+  for (line = 0; line * nbBlockData < length; line++) {
+    card->lineLength[line] = length - line * nbBlockData < nbBlockData ? length - line * nbBlockData : nbBlockData;
+    card->readable[line] = 1;
+  }
+  card_group(card, line);
+  return PH_ERR_SUCCESS;
+}
+
+/* Read the card detected by detect_card with the command set of its family */
+phStatus_t read_card(card_dump_t * card, uint8_t (* keys)[6], uint32_t nbKeys) {
+  switch (card->type) {
+    case CARD_MFC:
+      return read_mfc(card, keys, nbKeys);
+    case CARD_MFUL:
+      return read_mful(card);
+    case CARD_ISODEP:
+      return read_isodep(card);
+    default:
+      return PH_ERR_UNSUPPORTED_COMMAND;
+  }
+}
+
+/* Use the key as key A and key B of the trial keystore entry */
+phStatus_t loadKey(uint8_t * key) {
+  uint8_t keys[PH_KEYSTORE_KEY_TYPE_MIFARE_SIZE];
+  memcpy(&keys[0], key, PH_KEYSTORE_KEY_TYPE_MIFARE_SIZE / 2);
+  memcpy(&keys[PH_KEYSTORE_KEY_TYPE_MIFARE_SIZE / 2], key, PH_KEYSTORE_KEY_TYPE_MIFARE_SIZE / 2);
+  PH_CHECK_SUCCESS_FCT(status, phKeyStore_SetKeyAtPos(&keyStore, trialKeyNo, 0,
+        PH_KEYSTORE_KEY_TYPE_MIFARE, keys, 0));
+  /* the card is authenticated with the previous key */
+  PH_CHECK_SUCCESS_FCT(status, phalMfc_ResetAuthentication(&alMfc));
+  return PH_ERR_SUCCESS;
+}
+
+/* The cache file stays open for its lock. Several processes share the file :
+ * the updates hold it exclusively, the lookups shared. */
+static int keyCacheFd = -1;
+
+/* Map the key cache file, NULL if it is disabled or cannot be used.
+ * PI_NFC_KEYCACHE names the file, an empty value disables the cache. */
+keycache_t * keyCache() {
+  static keycache_t * cache = NULL;
+  static int opened = 0;
+  struct stat st;
+  char * path;
+  void * map;
+  int fd;
+  if (opened)
+    return cache;
+  opened = 1;
+  path = getenv("PI_NFC_KEYCACHE");
+  if (path == NULL)
+    path = KEYCACHE_DEFAULT_FILE;
+  if (path[0] == '\0')
+    return NULL;
+  fd = open(path, O_RDWR | O_CREAT, 0644);
+  if (fd < 0)
+    return NULL;
+  flock(fd, LOCK_EX);
+  if (fstat(fd, &st) != 0 || (st.st_size != sizeof(keycache_t) && ftruncate(fd, sizeof(keycache_t)) != 0)) {
+    close(fd);
+    return NULL;
+  }
+  map = mmap(NULL, sizeof(keycache_t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (map == MAP_FAILED) {
+    close(fd);
+    return NULL;
+  }
+  cache = (keycache_t *)map;
+  /* new file or another layout : start again */
+  if (cache->magic != KEYCACHE_MAGIC || cache->nbSlots != KEYCACHE_SLOTS) {
+    memset(cache, 0, sizeof(keycache_t));
+    cache->nbSlots = KEYCACHE_SLOTS;
+    cache->magic = KEYCACHE_MAGIC;
+  }
+  flock(fd, LOCK_UN);
+  keyCacheFd = fd;
+  return cache;
+}
+
+/* Slot of the card's sector. With create, a free slot is taken if the sector is unknown
+ * and the home slot is reused once the probe sequence is full. */
+keycache_slot_t * keyCacheSlot(keycache_t * cache, uint8_t * bUid, uint8_t bLength, uint8_t sector_id, int create) {
+  uint32_t hash = 2166136261U;
+  uint32_t index;
+  uint8_t i;
+  keycache_slot_t * slot;
+  for (i = 0; i < bLength; i++)
+    hash = (hash ^ bUid[i]) * 16777619U;
+  hash = (hash ^ sector_id) * 16777619U;
+  for (i = 0; i < KEYCACHE_PROBES; i++) {
+    index = (hash + i) & (KEYCACHE_SLOTS - 1);
+    slot = &cache->slots[index];
+    if (slot->uidLength == 0)
+      break;
+    if (slot->uidLength == bLength && slot->sector == sector_id && memcmp(slot->uid, bUid, bLength) == 0)
+      return slot;
+  }
+  if (!create)
+    return NULL;
+  if (i == KEYCACHE_PROBES)
+    slot = &cache->slots[hash & (KEYCACHE_SLOTS - 1)];
+  memset(slot, 0, sizeof(keycache_slot_t));
+  memcpy(slot->uid, bUid, bLength);
+  slot->uidLength = bLength;
+  slot->sector = sector_id;
+  return slot;
+}
+
+/* Count one more card opened by the key, keeping the most frequent keys.
+ * An unknown key replaces the last one and inherits its count plus one. */
+void keyCachePopular(keycache_popular_t * popular, uint8_t * key) {
+  keycache_popular_t entry;
+  uint8_t i;
+  for (i = 0; i < KEYCACHE_POPULAR - 1; i++)
+    if (popular[i].count == 0 || memcmp(popular[i].key, key, 6) == 0)
+      break;
+  if (popular[i].count == 0 || memcmp(popular[i].key, key, 6) != 0)
+    memcpy(popular[i].key, key, 6);
+  popular[i].count++;
+  for (; i > 0 && popular[i].count > popular[i - 1].count; i--) {
+    entry = popular[i - 1];
+    popular[i - 1] = popular[i];
+    popular[i] = entry;
+  }
+}
+
+/* Remember the key which opened the sector of the card */
+void keyCacheLearn(uint8_t * bUid, uint8_t bLength, uint8_t sector_id, uint8_t key_type, uint8_t * key) {
+  keycache_t * cache = keyCache();
+  keycache_slot_t * slot;
+  uint8_t type = (key_type == PHAL_MFC_KEYA) ? 0 : 1;
+  if (cache == NULL || sector_id >= PHAL_MFC_MAX_SECTORS || bLength > sizeof(slot->uid))
+    return;
+  flock(keyCacheFd, LOCK_EX);
+  slot = keyCacheSlot(cache, bUid, bLength, sector_id, 1);
+  if (!(slot->known & (1 << type)) || memcmp(slot->keys[type], key, 6) != 0) {
+    memcpy(slot->keys[type], key, 6);
+    slot->known |= 1 << type;
+    /* the statistics count cards, not taps */
+    keyCachePopular(cache->popular[sector_id][type], key);
+  }
+  flock(keyCacheFd, LOCK_UN);
+}
+
+void keyTrialAdd(keytrial_t * pTrial, uint8_t * key) {
+  uint8_t i;
+  for (i = 0; i < pTrial->nbFirst; i++)
+    if (memcmp(pTrial->first[i], key, 6) == 0)
+      return;
+  memcpy(pTrial->first[pTrial->nbFirst++], key, 6);
+}
+
+void keyTrialInit(keytrial_t * pTrial, uint8_t * bUid, uint8_t bLength, uint8_t sector_id, uint8_t key_type) {
+  keycache_t * cache = keyCache();
+  keycache_slot_t * slot;
+  uint8_t type = (key_type == PHAL_MFC_KEYA) ? 0 : 1;
+  uint8_t i;
+  pTrial->nbFirst = 0;
+  pTrial->nextFirst = 0;
+  pTrial->nextKey = 0;
+  if (cache == NULL || sector_id >= PHAL_MFC_MAX_SECTORS || bLength > sizeof(slot->uid))
+    return;
+  flock(keyCacheFd, LOCK_SH);
+  slot = keyCacheSlot(cache, bUid, bLength, sector_id, 0);
+  if (slot != NULL && (slot->known & (1 << type)))
+    keyTrialAdd(pTrial, slot->keys[type]);
+  for (i = 0; i < KEYCACHE_POPULAR && cache->popular[sector_id][type][i].count != 0; i++)
+    keyTrialAdd(pTrial, cache->popular[sector_id][type][i].key);
+  flock(keyCacheFd, LOCK_UN);
+}
+
+/* Next key to try, NULL once the dictionary is exhausted. The cached keys
+ * come first and are not tried again from the dictionary. */
+uint8_t * keyTrialNext(keytrial_t * pTrial, uint8_t (* keys)[6], uint32_t nbKeys) {
+  uint8_t i;
+  if (pTrial->nextFirst < pTrial->nbFirst)
+    return pTrial->first[pTrial->nextFirst++];
+  while (pTrial->nextKey < nbKeys) {
+    uint8_t * key = keys[pTrial->nextKey++];
+    for (i = 0; i < pTrial->nbFirst; i++)
+      if (memcmp(pTrial->first[i], key, 6) == 0)
+        break;
+    if (i == pTrial->nbFirst)
+      return key;
+  }
+  return NULL;
+}
+
+/* Read the trailer first and then only the blocks its access bits permit with this key */
+phStatus_t readSector(uint8_t sector_id, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t bLength,
+    uint8_t * data, uint16_t * pReadMask, uint16_t * pOtherKeyMask) {
+  PH_CHECK_SUCCESS_FCT(status, loadKey(key));
+  PH_CHECK_SUCCESS_FCT(status, phalMfc_ReadSectorPlanned(&alMfc, sector_id, key_type,
+        trialKeyNo, 0, bUid, bLength, data, pReadMask, pOtherKeyMask));
+  return PH_ERR_SUCCESS;
+}
+
+/* Try the keys until every block the access bits permit has been read.
+ * Once a key has been found, only the other key type is tried and only if
+ * some blocks are reserved to it. The keys which opened the sector before
+ * are tried first. */
+phStatus_t forceReadSector(uint8_t sector_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * data, uint16_t * pReadMask) {
+  uint8_t bSak[1];
+  uint8_t bUid[10];
+  uint8_t bNbCards;
+  uint8_t bLength;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  uint8_t wanted = PHAL_MFC_ACCESS_KEYA | PHAL_MFC_ACCESS_KEYB;
+  uint8_t buffer[nbSectorDataMax];
+  uint16_t readMask;
+  uint16_t otherKeyMask;
+  keytrial_t trials[2];
+  uint8_t * key;
+  uint8_t j, k;
+  *pReadMask = 0;
   PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-  for (i = 0; i < nbKeys; i++) {
-    if (readSector(sector_id, keys[i], PHAL_MFC_KEYA, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-    if (readSector(sector_id, keys[i], PHAL_MFC_KEYB, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (j = 0; j < 2; j++)
+    keyTrialInit(&trials[j], bUid, bLength, sector_id, key_types[j]);
+  while (wanted != 0) {
+    for (j = 0; j < 2 && wanted != 0; j++) {
+      if ((wanted & (1 << j)) == 0)
+        continue;
+      key = keyTrialNext(&trials[j], keys, nbKeys);
+      if (key == NULL) {
+        wanted &= ~(1 << j);
+        continue;
+      }
+      if (readSector(sector_id, key, key_types[j], bUid, bLength, buffer, &readMask, &otherKeyMask) != PH_ERR_SUCCESS) {
+        PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+        continue;
+      }
+      keyCacheLearn(bUid, bLength, sector_id, key_types[j], key);
+      for (k = 0; k < PHAL_MFC_GET_SECTOR_BLOCKS(sector_id); k++)
+        if (readMask & (1 << k))
+          memcpy(&data[k * nbBlockData], &buffer[k * nbBlockData], nbBlockData);
+      *pReadMask |= readMask;
+      /* nothing left that the other key could read */
+      wanted = ((otherKeyMask & ~*pReadMask) != 0) ? (wanted & ~(1 << j)) : 0;
+    }
   }
-  return PH_ERR_AUTH_ERROR;
+  return (*pReadMask != 0) ? PH_ERR_SUCCESS : PH_ERR_AUTH_ERROR;
 }
 
 phStatus_t readBlock(uint8_t block_id, uint8_t * key, uint8_t key_type, uint8_t * bUid, uint8_t * data) {
@@ -116,20 +728,35 @@ phStatus_t readBlock(uint8_t block_id, uint8_t * key, uint8_t key_type, uint8_t
   return PH_ERR_SUCCESS;
 }
 
-phStatus_t forceReadBlock(uint8_t block_id, uint8_t ** keys, uint16_t nbKeys, uint8_t * data) {
+phStatus_t forceReadBlock(uint8_t block_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * data) {
   uint8_t bSak[1];
   uint8_t bUid[10];
   uint8_t bNbCards;
   uint8_t bLength;
-  uint16_t i;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  uint8_t sector_id = PHAL_MFC_GET_SECTOR(block_id);
+  uint8_t wanted = 0x03;
+  keytrial_t trials[2];
+  uint8_t * key;
+  uint8_t j;
   PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-  for (i = 0; i < nbKeys; i++) {
-    if (readBlock(block_id, keys[i], PHAL_MFC_KEYA, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-    if (readBlock(block_id, keys[i], PHAL_MFC_KEYB, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (j = 0; j < 2; j++)
+    keyTrialInit(&trials[j], bUid, bLength, sector_id, key_types[j]);
+  while (wanted != 0) {
+    for (j = 0; j < 2; j++) {
+      if ((wanted & (1 << j)) == 0)
+        continue;
+      key = keyTrialNext(&trials[j], keys, nbKeys);
+      if (key == NULL) {
+        wanted &= ~(1 << j);
+        continue;
+      }
+      if (readBlock(block_id, key, key_types[j], bUid, data) == PH_ERR_SUCCESS) {
+        keyCacheLearn(bUid, bLength, sector_id, key_types[j], key);
+        return PH_ERR_SUCCESS;
+      }
+      PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+    }
   }
   return PH_ERR_AUTH_ERROR;
 }
@@ -141,125 +768,523 @@ phStatus_t writeBlock(uint8_t block, uint8_t * key, uint8_t key_type, uint8_t *
   return PH_ERR_SUCCESS;
 }
 
-phStatus_t forceWriteBlock(uint8_t block_id, uint8_t ** keys, uint16_t nbKeys, uint8_t * data) {
+phStatus_t forceWriteBlock(uint8_t block_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * data) {
   uint8_t bSak[1];
   uint8_t bUid[10];
   uint8_t bNbCards;
   uint8_t bLength;
-  uint16_t i;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  uint8_t sector_id = PHAL_MFC_GET_SECTOR(block_id);
+  uint8_t wanted = 0x03;
+  keytrial_t trials[2];
+  uint8_t * key;
+  uint8_t j;
   PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-  for (i = 0; i < nbKeys; i++) {
-    if (writeBlock(block_id, keys[i], PHAL_MFC_KEYA, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
-    if (writeBlock(block_id, keys[i], PHAL_MFC_KEYB, bUid, data) == PH_ERR_SUCCESS)
-      return PH_ERR_SUCCESS;
-    PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (j = 0; j < 2; j++)
+    keyTrialInit(&trials[j], bUid, bLength, sector_id, key_types[j]);
+  while (wanted != 0) {
+    for (j = 0; j < 2; j++) {
+      if ((wanted & (1 << j)) == 0)
+        continue;
+      key = keyTrialNext(&trials[j], keys, nbKeys);
+      if (key == NULL) {
+        wanted &= ~(1 << j);
+        continue;
+      }
+      if (writeBlock(block_id, key, key_types[j], bUid, data) == PH_ERR_SUCCESS) {
+        keyCacheLearn(bUid, bLength, sector_id, key_types[j], key);
+        return PH_ERR_SUCCESS;
+      }
+      PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+    }
   }
   return PH_ERR_AUTH_ERROR;
 }
 
-ssize_t fgetlinesnumber(char * file) {
-  FILE * fp = fopen(file, "r");
-  if (fp == NULL) {
-    return -1;
+uint8_t popcount16(uint16_t value) {
+  uint8_t count = 0;
+  for (; value != 0; value &= value - 1)
+    count++;
+  return count;
+}
+
+/* Compare the blocks of blockMask with the card and write only those which
+ * differ. The authentication of the planned sector read is reused for the
+ * writes and the verification. The sector trailer is never written. The keys
+ * which opened the sector before are tried first. */
+phStatus_t writeSectorDiff(uint8_t sector_id, uint8_t (* keys)[6], uint32_t nbKeys, uint8_t * image,
+    uint16_t blockMask, int verify) {
+  uint8_t bSak[1];
+  uint8_t bUid[10];
+  uint8_t bNbCards;
+  uint8_t bLength;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  uint8_t wanted = PHAL_MFC_ACCESS_KEYA | PHAL_MFC_ACCESS_KEYB;
+  uint8_t nbBlocks = PHAL_MFC_GET_SECTOR_BLOCKS(sector_id);
+  uint8_t firstBlock = PHAL_MFC_GET_FIRST_BLOCK(sector_id);
+  uint8_t buffer[nbSectorDataMax];
+  uint8_t verifyBuffer[nbBlockData];
+  phalMfc_AccessConditions_t access;
+  uint16_t readMask;
+  uint16_t otherKeyMask;
+  keytrial_t trials[2];
+  uint8_t * key;
+  uint8_t j, k, group;
+  int lost;
+
+  /* the manufacturer block and the sector trailer are left alone */
+  blockMask &= ~(1 << (nbBlocks - 1));
+  if (sector_id == 0)
+    blockMask &= ~1;
+  if (blockMask == 0)
+    return PH_ERR_SUCCESS;
+
+  PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (j = 0; j < 2; j++)
+    keyTrialInit(&trials[j], bUid, bLength, sector_id, key_types[j]);
+  while (wanted != 0 && blockMask != 0) {
+    for (j = 0; j < 2 && wanted != 0 && blockMask != 0; j++) {
+      if ((wanted & (1 << j)) == 0)
+        continue;
+      key = keyTrialNext(&trials[j], keys, nbKeys);
+      if (key == NULL) {
+        wanted &= ~(1 << j);
+        continue;
+      }
+      nbAuthFrames++;
+      if (readSector(sector_id, key, key_types[j], bUid, bLength, buffer, &readMask, &otherKeyMask) != PH_ERR_SUCCESS) {
+        PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+        continue;
+      }
+      keyCacheLearn(bUid, bLength, sector_id, key_types[j], key);
+      nbReadFrames += popcount16(readMask);
+      PH_CHECK_SUCCESS_FCT(status, phalMfc_DecodeAccessBits(&alMfc,
+            &buffer[(nbBlocks - 1) * nbBlockData], &access));
+
+      lost = 0;
+      for (k = 0; k < nbBlocks - 1 && !lost; k++) {
+        if ((blockMask & (1 << k)) == 0)
+          continue;
+        group = PHAL_MFC_GET_ACCESS_GROUP(sector_id, k);
+
+        if ((readMask & (1 << k)) && memcmp(&buffer[k * nbBlockData], &image[(firstBlock + k) * nbBlockData], nbBlockData) == 0) {
+          nbUnchanged++;
+          blockMask &= ~(1 << k);
+        }
+        else if (access.aDataWrite[group] & (1 << j)) {
+          nbWriteFrames += 2;
+          if (phalMfc_WriteRange(&alMfc, firstBlock + k, 1, key_types[j], trialKeyNo, 0,
+                bUid, bLength, &image[(firstBlock + k) * nbBlockData]) != PH_ERR_SUCCESS) {
+            lost = 1;
+            break;
+          }
+          nbWritten++;
+          blockMask &= ~(1 << k);
+          if (verify) {
+            nbReadFrames++;
+            if (phalMfc_ReadRange(&alMfc, firstBlock + k, 1, key_types[j], trialKeyNo, 0,
+                  bUid, bLength, verifyBuffer) != PH_ERR_SUCCESS) {
+              nbVerifyErrors++;
+              lost = 1;
+              break;
+            }
+            if (memcmp(verifyBuffer, &image[(firstBlock + k) * nbBlockData], nbBlockData) != 0)
+              nbVerifyErrors++;
+          }
+        }
+        else if (access.aDataWrite[group] == PHAL_MFC_ACCESS_NONE) {
+          nbDenied++;
+          blockMask &= ~(1 << k);
+        }
+      }
+
+      /* the card dropped the authentication */
+      if (lost) {
+        PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+        continue;
+      }
+      /* the remaining blocks are reserved to the other key */
+      wanted &= ~(1 << j);
+    }
   }
+  return (blockMask == 0) ? PH_ERR_SUCCESS : PH_ERR_AUTH_ERROR;
+}
 
-  ssize_t count = 0;
-  int c;
-  while ((c = fgetc(fp)) != EOF) {
-    if (c == '\n')
-      count++;
+/* Read the directory with the public MAD key first and then with the keys
+ * of the file. A missing or corrupted directory is not retried. */
+phStatus_t readMad(uint8_t (* keys)[6], uint32_t nbKeys, uint8_t nbSector, uint16_t * aids, uint8_t * version) {
+  uint8_t bSak[1];
+  uint8_t bUid[10];
+  uint8_t bNbCards;
+  uint8_t bLength;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  int32_t i;
+  uint8_t j;
+  PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (i = -1; i < (int32_t)nbKeys; i++) {
+    for (j = 0; j < 2; j++) {
+      PH_CHECK_SUCCESS_FCT(status, loadKey((i < 0) ? madKey : keys[i]));
+      status = phalMfc_ReadMad(&alMfc, key_types[j], trialKeyNo, 0, bUid, bLength, nbSector, aids, version);
+      if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS ||
+          (status & PH_ERR_MASK) == PHAL_MFC_ERR_NO_MAD ||
+          (status & PH_ERR_MASK) == PH_ERR_INTEGRITY_ERROR)
+        return status;
+      PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+    }
   }
-  fclose(fp);
-  return count;
+  return PH_ERR_AUTH_ERROR;
 }
 
-void free_keys(uint8_t ** keys, uint8_t nbKeys) {
-  uint8_t i;
-  for(i = 0; i < nbKeys; i++)
-    free(keys[i]);
-  free(keys);
+/* Read only the sectors of the application, with the public NDEF key first
+ * and then with the keys of the file */
+phStatus_t readApplication(uint16_t aid, uint16_t * aids, uint8_t nbSector, uint8_t (* keys)[6], uint32_t nbKeys,
+    uint8_t * data, uint16_t size, uint16_t * length) {
+  uint8_t bSak[1];
+  uint8_t bUid[10];
+  uint8_t bNbCards;
+  uint8_t bLength;
+  uint8_t key_types[2] = { PHAL_MFC_KEYA, PHAL_MFC_KEYB };
+  int32_t i;
+  uint8_t j;
+  PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+  for (i = -1; i < (int32_t)nbKeys; i++) {
+    for (j = 0; j < 2; j++) {
+      PH_CHECK_SUCCESS_FCT(status, loadKey((i < 0) ? ndefKey : keys[i]));
+      status = phalMfc_ReadApplication(&alMfc, aid, aids, nbSector, key_types[j], trialKeyNo, 0,
+          bUid, bLength, size, data, length);
+      if ((status & PH_ERR_MASK) == PH_ERR_SUCCESS || (status & PH_ERR_MASK) == PH_ERR_BUFFER_OVERFLOW)
+        return status;
+      PH_CHECK_SUCCESS_FCT(status, search_card(bUid, &bLength, bSak, &bNbCards));
+    }
+  }
+  return PH_ERR_AUTH_ERROR;
 }
 
-int file2keys(char * keys_file, uint8_t *** keys, uint8_t * nbKeys) {
-  uint8_t _nbKeys = fgetlinesnumber(keys_file);
-  if (_nbKeys <= 0)
+/* Header of a compiled dictionary, followed by the keys in the order to try them */
+static const uint8_t keydictMagic[4] = { 0x7F, 'K', 'D', '1' };
+#define KEYDICT_HEADER_SIZE 8 /* magic, number of keys little endian */
+
+void free_keys(keydict_t * dict) {
+  if (dict->map != NULL)
+    munmap(dict->map, dict->mapLength);
+  else
+    free(dict->keys);
+  dict->keys = NULL;
+  dict->nbKeys = 0;
+  dict->map = NULL;
+}
+
+int hexvalue(uint8_t c) {
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  return -1;
+}
+
+/* One key of 12 hexadecimal digits per line, the bytes may be separated by
+ * spaces. Empty lines and lines starting with # are skipped. */
+int text2keys(uint8_t * text, size_t length, keydict_t * dict) {
+  /* a key takes at least 12 characters */
+  uint8_t (* keys)[6] = malloc((length / 12 + 1) * 6);
+  uint32_t nbKeys = 0;
+  uint8_t digits = 0;
+  size_t i;
+  int value;
+  if (keys == NULL)
     return -1;
+  for (i = 0; i <= length; i++) {
+    if (i == length || text[i] == '\n') {
+      if (digits == 12)
+        nbKeys++;
+      else if (digits != 0)
+        break;
+      digits = 0;
+    }
+    else if (text[i] == '#' && digits == 0) {
+      while (i + 1 < length && text[i + 1] != '\n')
+        i++;
+    }
+    else if (text[i] != ' ' && text[i] != '\t' && text[i] != '\r') {
+      value = hexvalue(text[i]);
+      if (value < 0 || digits == 12)
+        break;
+      if (digits % 2 == 0)
+        keys[nbKeys][digits / 2] = value << 4;
+      else
+        keys[nbKeys][digits / 2] |= value;
+      digits++;
+    }
+  }
+  if (i <= length || nbKeys == 0) {
+    free(keys);
+    return -1;
+  }
+  dict->keys = keys;
+  dict->nbKeys = nbKeys;
+  dict->map = NULL;
+  return 0;
+}
 
-  uint8_t ** _keys = calloc(_nbKeys, sizeof(uint8_t *));
-  if (_keys == NULL) {
+/* Load a compiled or a text dictionary. A compiled one is used in place,
+ * the mapping is shared with the other processes using it. */
+int file2keys(char * keys_file, keydict_t * dict) {
+  struct stat st;
+  uint8_t * map;
+  uint32_t nbKeys;
+  int fd;
+  int re;
+  fd = open(keys_file, O_RDONLY);
+  if (fd < 0)
+    return -1;
+  if (fstat(fd, &st) != 0 || st.st_size == 0) {
+    close(fd);
     return -1;
   }
-  uint8_t i, j;
-  for (i = 0; i < _nbKeys; i++) {
-    _keys[i] = calloc(6, sizeof(uint8_t));
-    if (_keys[i] == NULL) {
-      for(j = 0; j <= i; j++)
-        free(_keys[j]);
-      free(_keys);
+  map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  close(fd);
+  if (map == MAP_FAILED)
+    return -1;
+
+  if (st.st_size >= KEYDICT_HEADER_SIZE && memcmp(map, keydictMagic, sizeof(keydictMagic)) == 0) {
+    nbKeys = map[4] | (map[5] << 8) | (map[6] << 16) | ((uint32_t)map[7] << 24);
+    if (nbKeys == 0 || (size_t)st.st_size != KEYDICT_HEADER_SIZE + (size_t)nbKeys * 6) {
+      munmap(map, st.st_size);
       return -1;
     }
+    dict->keys = (uint8_t (*)[6])&map[KEYDICT_HEADER_SIZE];
+    dict->nbKeys = nbKeys;
+    dict->map = map;
+    dict->mapLength = st.st_size;
+    return 0;
   }
 
-  FILE * fp = fopen(keys_file, "r");
+  re = text2keys(map, st.st_size, dict);
+  munmap(map, st.st_size);
+  return re;
+}
+
+typedef struct {
+  uint8_t key[6];
+  uint32_t count;
+  uint32_t first;
+  int file; /* last dictionary counted */
+} keycount_t;
+
+/* Most frequent keys first, then in the order they appear */
+int keycount_cmp(const void * a, const void * b) {
+  const keycount_t * ka = a;
+  const keycount_t * kb = b;
+  if (ka->count != kb->count)
+    return (ka->count > kb->count) ? -1 : 1;
+  return (ka->first < kb->first) ? -1 : (ka->first > kb->first);
+}
+
+/* Merge the dictionaries into a compiled one without duplicates, ordered by the
+ * number of dictionaries containing each key. The file is replaced atomically
+ * so that running commands keep their mapping of the previous one. */
+int cmd_compile_keys(char * dict_file, char ** keys_files, int nbFiles) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  keycount_t * entries = NULL;
+  uint32_t * table = NULL;
+  uint32_t nbEntries = 0;
+  uint32_t maxEntries = 0;
+  uint32_t tableSize = 0;
+  uint32_t hash, k;
+  uint8_t header[KEYDICT_HEADER_SIZE];
+  char * tmp_file = NULL;
+  FILE * fp;
+  int i, b;
+  int re = 1;
+
+  for (i = 0; i < nbFiles; i++) {
+    if (file2keys(keys_files[i], &dict) != 0) {
+      printf("Impossible to read keys from `%s`.\n", keys_files[i]);
+      goto end;
+    }
+    if (nbEntries + dict.nbKeys > maxEntries) {
+      /* the table stays at most half full */
+      keycount_t * grown;
+      maxEntries = nbEntries + dict.nbKeys;
+      grown = realloc(entries, maxEntries * sizeof(keycount_t));
+      free(table);
+      for (tableSize = 16; tableSize < 2 * maxEntries; tableSize *= 2);
+      table = malloc(tableSize * sizeof(uint32_t));
+      if (grown == NULL || table == NULL) {
+        entries = (grown != NULL) ? grown : entries;
+        goto end;
+      }
+      entries = grown;
+      memset(table, 0xFF, tableSize * sizeof(uint32_t));
+      for (k = 0; k < nbEntries; k++) {
+        for (hash = 2166136261U, b = 0; b < 6; b++)
+          hash = (hash ^ entries[k].key[b]) * 16777619U;
+        for (hash &= tableSize - 1; table[hash] != 0xFFFFFFFFU; hash = (hash + 1) & (tableSize - 1));
+        table[hash] = k;
+      }
+    }
+    for (k = 0; k < dict.nbKeys; k++) {
+      for (hash = 2166136261U, b = 0; b < 6; b++)
+        hash = (hash ^ dict.keys[k][b]) * 16777619U;
+      for (hash &= tableSize - 1; table[hash] != 0xFFFFFFFFU; hash = (hash + 1) & (tableSize - 1))
+        if (memcmp(entries[table[hash]].key, dict.keys[k], 6) == 0)
+          break;
+      if (table[hash] == 0xFFFFFFFFU) {
+        table[hash] = nbEntries;
+        memcpy(entries[nbEntries].key, dict.keys[k], 6);
+        entries[nbEntries].count = 0;
+        entries[nbEntries].first = nbEntries;
+        entries[nbEntries].file = -1;
+        nbEntries++;
+      }
+      /* a key repeated inside one dictionary counts once */
+      if (entries[table[hash]].file != i) {
+        entries[table[hash]].file = i;
+        entries[table[hash]].count++;
+      }
+    }
+    free_keys(&dict);
+  }
+  qsort(entries, nbEntries, sizeof(keycount_t), keycount_cmp);
+
+  tmp_file = malloc(strlen(dict_file) + 5);
+  if (tmp_file == NULL)
+    goto end;
+  sprintf(tmp_file, "%s.tmp", dict_file);
+  fp = fopen(tmp_file, "wb");
   if (fp == NULL) {
-    free_keys(_keys, _nbKeys);
-    return -1;
+    printf("Impossible to write `%s`.\n", tmp_file);
+    goto end;
   }
+  memcpy(header, keydictMagic, sizeof(keydictMagic));
+  for (b = 0; b < 4; b++)
+    header[4 + b] = (nbEntries >> (8 * b)) & 0xFF;
+  fwrite(header, 1, sizeof(header), fp);
+  for (k = 0; k < nbEntries; k++)
+    fwrite(entries[k].key, 1, 6, fp);
+  if (fclose(fp) != 0 || rename(tmp_file, dict_file) != 0) {
+    printf("Impossible to write `%s`.\n", dict_file);
+    remove(tmp_file);
+    goto end;
+  }
+  printf("%u keys\n", nbEntries);
+  re = 0;
+
+end:
+  free_keys(&dict);
+  free(entries);
+  free(table);
+  free(tmp_file);
+  return re;
+}
 
-  for(i = 0; i < _nbKeys; i++) {
-    if (fscanf(fp, "%02hhX %02hhX %02hhX %02hhX %02hhX %02hhX",
-        &_keys[i][0],
-        &_keys[i][1],
-        &_keys[i][2],
-        &_keys[i][3],
-        &_keys[i][4],
-        &_keys[i][5]) != 6) {
-      free_keys(_keys, _nbKeys);
+/* Read a card image in the format of the dump command. Blocks made of xx are
+ * left unchanged. A line may start with "<block_id>:" to continue the image at
+ * that block, so a patch list is a list of such lines. */
+int file2image(char * image_file, uint8_t * image, uint16_t * blockMasks) {
+  FILE * fp = fopen(image_file, "r");
+  if (fp == NULL)
+    return -1;
+
+  char line[128];
+  uint16_t block = 0;
+  memset(blockMasks, 0, PHAL_MFC_MAX_SECTORS * sizeof(uint16_t));
+  while (fgets(line, sizeof(line), fp) != NULL) {
+    char * pos = line;
+    char * colon = strchr(line, ':');
+    int i, n, unknown = 0;
+    if (colon != NULL) {
+      block = strtol(line, NULL, 10);
+      pos = colon + 1;
+    }
+    while (*pos == ' ' || *pos == '\t')
+      pos++;
+    if (*pos == '\n' || *pos == '\r' || *pos == '\0')
+      continue;
+    if (block >= 256) {
+      fclose(fp);
       return -1;
     }
+    for (i = 0; i < nbBlockData; i++) {
+      n = 0;
+      if (sscanf(pos, " xx%n", &n) == 0 && n > 0) {
+        unknown = 1;
+      }
+      else if (sscanf(pos, " %02hhX%n", &image[block * nbBlockData + i], &n) != 1) {
+        fclose(fp);
+        return -1;
+      }
+      pos += n;
+    }
+    if (!unknown)
+      blockMasks[PHAL_MFC_GET_SECTOR(block)] |= 1 << (block - PHAL_MFC_GET_FIRST_BLOCK(PHAL_MFC_GET_SECTOR(block)));
+    block++;
   }
 
-  *keys = _keys;
-  *nbKeys = _nbKeys;
-
   fclose(fp);
   return 0;
 }
 
-void print_block(uint8_t * data) {
+void print_bytes(uint8_t * data, uint8_t length) {
   int i;
-  for (i = 0; i < nbBlockData; i++) {
+  for (i = 0; i < length; i++) {
     printf("%02X", data[i]);
-    if (i != nbBlockData - 1)
+    if (i != length - 1)
       printf(" ");
   }
   printf("\n");
 }
 
-void print_empty_block() {
+void print_empty_bytes(uint8_t length) {
   int i;
-  for (i = 0; i < nbBlockData; i++) {
+  for (i = 0; i < length; i++) {
     printf("xx");
-    if (i != nbBlockData - 1)
+    if (i != length - 1)
       printf(" ");
   }
   printf("\n");
 }
 
-void print_sector(uint8_t * data) {
-  print_block(&data[0 * nbBlockData]);
-  print_block(&data[1 * nbBlockData]);
-  print_block(&data[2 * nbBlockData]);
-  print_block(&data[3 * nbBlockData]);
+void print_block(uint8_t * data) {
+  print_bytes(data, nbBlockData);
+}
+
+void print_empty_block() {
+  print_empty_bytes(nbBlockData);
+}
+
+void print_sector(uint8_t sector_id, uint8_t * data, uint16_t readMask) {
+  uint8_t i;
+  for (i = 0; i < PHAL_MFC_GET_SECTOR_BLOCKS(sector_id); i++) {
+    if (readMask & (1 << i))
+      print_block(&data[i * nbBlockData]);
+    else
+      print_empty_block();
+  }
+}
+
+void print_empty_sector(uint8_t sector_id) {
+  uint8_t i;
+  for (i = 0; i < PHAL_MFC_GET_SECTOR_BLOCKS(sector_id); i++)
+    print_empty_block();
 }
 
-void print_empty_sector() {
-  print_empty_block();
-  print_empty_block();
-  print_empty_block();
-  print_empty_block();
+void print_card(card_dump_t * card) {
+  uint16_t line = 0;
+  uint16_t i;
+  uint8_t group;
+  for (group = 0; group < card->nbGroups; group++) {
+    for (i = 0; i < card->groupLines[group]; i++, line++) {
+      if (card->readable[line])
+        print_bytes(card->data[line], card->lineLength[line]);
+      else
+        print_empty_bytes(card->lineLength[line]);
+    }
+    if (group != card->nbGroups - 1)
+      printf("\n");
+  }
 }
 
 int cmd_uid() {
@@ -280,91 +1305,295 @@ int cmd_uid() {
 }
 
 int cmd_dump(char * keys_file) {
-  uint8_t ** keys;
-  uint8_t nbKeys = 0;
-  if (keys_file != NULL && file2keys(keys_file, &keys, &nbKeys) != 0) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
     printf("Impossible to read keys from `%s`.", keys_file);
     return 1;
   }
 
-  uint8_t sector;
-  uint8_t buffer[nbSectorData];
-  uint8_t i;
+  int re = 0;
   PH_CHECK_SUCCESS_FCT(status, initLayers());
-  for (sector = 0; sector < nbSector; sector++) {
-    if(forceReadSector(sector, keys, nbKeys, buffer) == PH_ERR_SUCCESS)
-      print_sector(buffer);
-    else
-      print_empty_sector();
-    if (sector != nbSector - 1)
-      printf("\n");
+  PH_CHECK_SUCCESS_FCT(status, detect_card(&dump));
+  if (dump.type == CARD_UNKNOWN) {
+    printf("Unsupported card, SAK %02X and ATQA %02X %02X.\n", dump.sak, dump.atqa[1], dump.atqa[0]);
+    re = 1;
+  }
+  else if (read_card(&dump, dict.keys, dict.nbKeys) != PH_ERR_SUCCESS) {
+    printf("Impossible to read the %s dump.\n", card_name(&dump));
+    re = 1;
+  }
+  else {
+    print_card(&dump);
   }
 
   if (keys_file != NULL)
-    free_keys(keys, nbKeys);
+    free_keys(&dict);
+  return re;
+}
+
+int cmd_info() {
+  PH_CHECK_SUCCESS_FCT(status, initLayers());
+  PH_CHECK_SUCCESS_FCT(status, detect_card(&dump));
+  printf("Type    : %s\n", card_name(&dump));
+  printf("UID     : ");
+  print_bytes(dump.uid, dump.uidLength);
+  printf("ATQA    : %02X %02X\n", dump.atqa[1], dump.atqa[0]);
+  printf("SAK     : %02X\n", dump.sak);
+  if (dump.versionLength != 0) {
+    printf("Version : ");
+    print_bytes(dump.version, dump.versionLength);
+  }
+  if (dump.type == CARD_MFUL)
+    printf("Pages   : %d\n", dump.nbPages);
+  if (dump.atsLength != 0) {
+    printf("ATS     : ");
+    print_bytes(dump.ats, dump.atsLength);
+  }
   return 0;
 }
 
 int cmd_sector(uint8_t sector_id, char * keys_file) {
-  uint8_t ** keys;
-  uint8_t nbKeys = 0;
-  if (keys_file != NULL && file2keys(keys_file, &keys, &nbKeys) != 0) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
     printf("Impossible to read keys from `%s`.", keys_file);
     return 1;
   }
 
-  uint8_t buffer[nbSectorData];
+  uint8_t nbSector;
+  uint8_t buffer[nbSectorDataMax];
+  uint16_t readMask;
   PH_CHECK_SUCCESS_FCT(status, initLayers());
-  if(forceReadSector(sector_id, keys, nbKeys, buffer) == PH_ERR_SUCCESS)
-    print_sector(buffer);
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  if (sector_id >= nbSector) {
+    printf("The card has only %d sectors.\n", nbSector);
+    if (keys_file != NULL)
+      free_keys(&dict);
+    return 1;
+  }
+  if(forceReadSector(sector_id, dict.keys, dict.nbKeys, buffer, &readMask) == PH_ERR_SUCCESS)
+    print_sector(sector_id, buffer, readMask);
   else
-    print_empty_sector();
+    print_empty_sector(sector_id);
 
   if (keys_file != NULL)
-    free_keys(keys, nbKeys);
+    free_keys(&dict);
   return 0;
 }
 
 int cmd_block(uint8_t block_id, char * keys_file) {
-  uint8_t ** keys;
-  uint8_t nbKeys = 0;
-  if (keys_file != NULL && file2keys(keys_file, &keys, &nbKeys) != 0) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
     printf("Impossible to read keys from `%s`.", keys_file);
     return 1;
   }
 
+  uint8_t nbSector;
   uint8_t buffer[nbBlockData];
   PH_CHECK_SUCCESS_FCT(status, initLayers());
-  if(forceReadBlock(block_id, keys, nbKeys, buffer) == PH_ERR_SUCCESS)
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  if (PHAL_MFC_GET_SECTOR(block_id) >= nbSector) {
+    printf("The card has only %d blocks.\n",
+        PHAL_MFC_GET_FIRST_BLOCK(nbSector - 1) + PHAL_MFC_GET_SECTOR_BLOCKS(nbSector - 1));
+    if (keys_file != NULL)
+      free_keys(&dict);
+    return 1;
+  }
+  if(forceReadBlock(block_id, dict.keys, dict.nbKeys, buffer) == PH_ERR_SUCCESS)
     print_block(buffer);
   else
     print_empty_block();
 
   if (keys_file != NULL)
-    free_keys(keys, nbKeys);
+    free_keys(&dict);
   return 0;
 }
 
 int cmd_write_byte(uint8_t block_id, uint8_t position, uint8_t byte, char * keys_file) {
-  uint8_t ** keys;
-  uint8_t nbKeys = 0;
-  if (keys_file != NULL && file2keys(keys_file, &keys, &nbKeys) != 0) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
     printf("Impossible to read keys from `%s`.", keys_file);
     return 1;
   }
 
+  uint8_t nbSector;
   uint8_t buffer[nbBlockData];
   int re = 0;
   PH_CHECK_SUCCESS_FCT(status, initLayers());
-  PH_CHECK_SUCCESS_FCT(status, forceReadBlock(block_id, keys, nbKeys, buffer));
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  if (PHAL_MFC_GET_SECTOR(block_id) >= nbSector) {
+    printf("The card has only %d blocks.\n",
+        PHAL_MFC_GET_FIRST_BLOCK(nbSector - 1) + PHAL_MFC_GET_SECTOR_BLOCKS(nbSector - 1));
+    if (keys_file != NULL)
+      free_keys(&dict);
+    return 1;
+  }
+  PH_CHECK_SUCCESS_FCT(status, forceReadBlock(block_id, dict.keys, dict.nbKeys, buffer));
   buffer[position] = byte;
-  re = forceWriteBlock(block_id, keys, nbKeys, buffer);
+  re = forceWriteBlock(block_id, dict.keys, dict.nbKeys, buffer);
+
+  if (keys_file != NULL)
+    free_keys(&dict);
+  return re;
+}
+
+int cmd_write(char * image_file, char * keys_file, int verify) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  uint8_t image[256 * nbBlockData];
+  uint16_t blockMasks[PHAL_MFC_MAX_SECTORS];
+  uint8_t sector;
+  uint8_t nbSector;
+  uint32_t nbFrames;
+  uint32_t nbFullFrames;
+  int re = 0;
+
+  if (file2image(image_file, image, blockMasks) != 0) {
+    printf("Impossible to read the card image from `%s`.", image_file);
+    return 1;
+  }
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
+    printf("Impossible to read keys from `%s`.", keys_file);
+    return 1;
+  }
+
+  PH_CHECK_SUCCESS_FCT(status, initLayers());
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  for (sector = 0; sector < PHAL_MFC_MAX_SECTORS; sector++) {
+    if (blockMasks[sector] == 0)
+      continue;
+    if (sector >= nbSector || writeSectorDiff(sector, dict.keys, dict.nbKeys, image, blockMasks[sector], verify) != PH_ERR_SUCCESS) {
+      printf("Sector %d could not be written completely.\n", sector);
+      re = 1;
+    }
+  }
+
+  /* a full rewrite needs the same authentications and writes every block */
+  nbFrames = nbAuthFrames + nbReadFrames + nbWriteFrames;
+  nbFullFrames = nbAuthFrames + 2 * (nbWritten + nbUnchanged);
+  printf("written: %d, unchanged: %d, denied: %d", nbWritten, nbUnchanged, nbDenied);
+  if (verify)
+    printf(", verify errors: %d", nbVerifyErrors);
+  printf("\nframes: %u, full rewrite: %u, saved: %d\n", nbFrames, nbFullFrames, (int)(nbFullFrames - nbFrames));
+
+  if (keys_file != NULL)
+    free_keys(&dict);
+  return (re != 0 || nbVerifyErrors != 0) ? 1 : 0;
+}
+
+int cmd_mad(char * keys_file) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  uint8_t nbSector;
+  uint16_t aids[PHAL_MFC_MAX_SECTORS];
+  uint8_t version;
+  uint8_t i;
+  int re = 0;
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
+    printf("Impossible to read keys from `%s`.", keys_file);
+    return 1;
+  }
+
+  PH_CHECK_SUCCESS_FCT(status, initLayers());
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  if (readMad(dict.keys, dict.nbKeys, nbSector, aids, &version) == PH_ERR_SUCCESS) {
+    printf("MAD v%d\n", version);
+    for (i = 0; i < nbSector; i++)
+      printf("%2d: %04X\n", i, aids[i]);
+  }
+  else {
+    printf("No readable MIFARE Application Directory.\n");
+    re = 1;
+  }
+
+  if (keys_file != NULL)
+    free_keys(&dict);
+  return re;
+}
+
+int cmd_app(uint16_t aid, char * keys_file) {
+  keydict_t dict = { NULL, 0, NULL, 0 };
+  uint8_t nbSector;
+  uint16_t aids[PHAL_MFC_MAX_SECTORS];
+  uint8_t version;
+  uint8_t data[nbCardDataMax];
+  uint16_t length;
+  uint16_t i;
+  int re = 0;
+  if (keys_file != NULL && file2keys(keys_file, &dict) != 0) {
+    printf("Impossible to read keys from `%s`.", keys_file);
+    return 1;
+  }
+
+  PH_CHECK_SUCCESS_FCT(status, initLayers());
+  PH_CHECK_SUCCESS_FCT(status, card_geometry(&nbSector));
+  if (readMad(dict.keys, dict.nbKeys, nbSector, aids, &version) != PH_ERR_SUCCESS) {
+    printf("No readable MIFARE Application Directory.\n");
+    re = 1;
+  }
+  else if (readApplication(aid, aids, nbSector, dict.keys, dict.nbKeys, data, sizeof(data), &length) != PH_ERR_SUCCESS) {
+    printf("Impossible to read the application %04X.\n", aid);
+    re = 1;
+  }
+  else {
+    for (i = 0; i < length; i += nbBlockData)
+      print_block(&data[i]);
+  }
 
   if (keys_file != NULL)
-    free_keys(keys, nbKeys);
+    free_keys(&dict);
   return re;
 }
 
+/* Host side of one MIFARE Ultralight C authentication : ek(RndB) is
+ * decrypted, ek(RndA || RndB') encrypted and ek(RndA') decrypted, with
+ * 2K3DES in CBC mode, like phalMful_UlcAuthenticate does. */
+phStatus_t ulcAuthCrypto(uint8_t * ekRndB, uint8_t * ekRndA) {
+  uint8_t iv[PH_CRYPTOSYM_DES_BLOCK_SIZE] = { 0 };
+  uint8_t rndB[PH_CRYPTOSYM_DES_BLOCK_SIZE];
+  uint8_t frame[2 * PH_CRYPTOSYM_DES_BLOCK_SIZE];
+
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_LoadKeyDirect(&cryptoSym, ulcKey, PH_CRYPTOSYM_KEY_TYPE_2K3DES));
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_LoadIv(&cryptoSym, iv, sizeof(iv)));
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_Decrypt(&cryptoSym, PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        ekRndB, sizeof(rndB), rndB));
+  PH_CHECK_SUCCESS_FCT(status, phCryptoRng_Rnd(&cryptoRng, PH_CRYPTOSYM_DES_BLOCK_SIZE, frame));
+  memcpy(&frame[PH_CRYPTOSYM_DES_BLOCK_SIZE], &rndB[1], PH_CRYPTOSYM_DES_BLOCK_SIZE - 1);
+  frame[sizeof(frame) - 1] = rndB[0];
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_Encrypt(&cryptoSym, PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        frame, sizeof(frame), frame));
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_Decrypt(&cryptoSym, PH_CRYPTOSYM_CIPHER_MODE_CBC,
+        ekRndA, sizeof(rndB), rndB));
+
+  return PH_ERR_SUCCESS;
+}
+
+int cmd_bench(uint32_t count) {
+  uint8_t ekRndB[PH_CRYPTOSYM_DES_BLOCK_SIZE] = { 0x57, 0x7A, 0x1B, 0xC2, 0x9D, 0x04, 0xE8, 0x31 };
+  uint8_t ekRndA[PH_CRYPTOSYM_DES_BLOCK_SIZE] = { 0xA0, 0x3F, 0x66, 0x12, 0xD5, 0x8B, 0x4E, 0xC9 };
+  struct timespec start, end;
+  double seconds;
+  uint16_t constantTime;
+  uint32_t i;
+
+  PH_CHECK_SUCCESS_FCT(status, phCryptoSym_Sw_Init(&cryptoSym,
+        sizeof(phCryptoSym_Sw_DataParams_t), NULL));
+  PH_CHECK_SUCCESS_FCT(status, phCryptoRng_Sw_Init(&cryptoRng,
+        sizeof(phCryptoRng_Sw_DataParams_t)));
+
+  for (constantTime = PH_OFF; constantTime <= PH_ON; constantTime++) {
+    PH_CHECK_SUCCESS_FCT(status, phCryptoSym_SetConfig(&cryptoSym,
+          PH_CRYPTOSYM_CONFIG_CONSTANT_TIME, constantTime));
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (i = 0; i < count; i++)
+      PH_CHECK_SUCCESS_FCT(status, ulcAuthCrypto(ekRndB, ekRndA));
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    seconds = (end.tv_sec - start.tv_sec) + (end.tv_nsec - start.tv_nsec) / 1e9;
+    printf("%-13s : %u authentications in %.3f s, %.0f auth/s\n",
+        constantTime == PH_ON ? "constant time" : "table", count, seconds, count / seconds);
+  }
+
+  return 0;
+}
+
 int main(int argc, char ** argv)
 {
   char * usage = "Usage : \n\
@@ -376,15 +1605,26 @@ The program check if there is a detected tag and print the uid on the \n\
 standard output. The format of the uid is like XX XX XX XX where XX are \n\
 hexadecimal. The number of XX block depends of the size of the tag's uid. \n\
 \n\
+./a.out info \n\
+Print the type of the detected tag, found from its SAK and ATQA, then from \n\
+GET_VERSION for the Ultralight family and from the ATS for the ISO14443-4 \n\
+tags, with the data it was found from. \n\
+\n\
 ./a.out dump [<keys_file>] \n\
 The program check if there is a detected tag and print the dump of the \n\
 card on the standard output. If the <keys_file> argument is present, the \n\
 program use it to decode the tag. Each line of the file have to contain \n\
-one key. One key is an haxedecimal number of 12 characters. Each keys are \n\
+one key. One key is an haxedecimal number of 12 characters, its bytes may \n\
+be separated by spaces. Empty lines and lines starting with # are ignored. \n\
+The file may also be a dictionary compiled with \"compile-keys\". Each keys are \n\
 tried one after each other on each sectors of the tag. The ouput is \n\
 grouped by sector in paragraph. Each sector's block are on one line and \n\
 each bytes are separated with a space. If one sector is not readable, the \n\
-bytes are replaced by xx. See the exemple below : \n\
+bytes are replaced by xx, blocks which the access conditions do not permit \n\
+to read with the found keys are replaced by xx as well. The number of \n\
+sectors depends on the card : 5 for a MIFARE Mini, 16 for a 1K, 32 for a 2K \n\
+and 40 for a 4K. The sectors 32 to 39 of a 4K contain 16 blocks instead of \n\
+4. See the exemple below : \n\
 \n\
 Exemple with two sectors. One full of 0xFF and one unreadable. \n\
 FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF FF \n\
@@ -397,24 +1637,80 @@ xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx \n\
 xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx \n\
 xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx xx \n\
 \n\
+The commands of the tag's type are used. A MIFARE Ultralight, Ultralight C, \n\
+Ultralight EV1 or NTAG is printed as one paragraph of 4 pages per line, read \n\
+with FAST_READ when the tag has it. The pages a password protects and the key \n\
+of an Ultralight C are replaced by xx. For an ISO14443-4 tag, the NDEF message \n\
+of its NFC Forum Type 4 Tag application is printed 16 bytes per line. The \n\
+other commands reading or writing sectors and blocks refuse the tags which \n\
+are not a MIFARE Classic. \n\
+\n\
 ./a.out sector <sector_id> [<keys_file>] \n\
 Same as the \"dump\" command but only for the sector <sector_id>. \n\
-The id of the first sector is 0. And the last is the 15th sector. \n\
+The id of the first sector is 0. And the last is the 15th sector for a 1K \n\
+and the 39th sector for a 4K. \n\
 \n\
 ./a.out block <block_id> [<keys_file>] \n\
 Same as the \"dump\" command but only for the block <block_id>. \n\
-The id of the first block is 0. And the last is the 63rd block . \n\
+The id of the first block is 0. And the last is the 63rd block for a 1K \n\
+and the 255th block for a 4K. \n\
 \n\
 ./a.out write-byte <block_id> <byte_pos> 0xXX [<keys_file>] \n\
 Write the byte 0xXX at the block <block_id> at the position <byte_pos> using the \n\
 keys inside the <keys_file> file (if given). The blocks' id and the position \n\
 begin at 0. The byte 0xXX have to be written into hexadecimal. A value without 0x \n\
 behind is a valid value but it's still considered as a hexadecimal value. \n\
+\n\
+./a.out write <image_file> [<keys_file>] [verify] \n\
+Write the card image <image_file> using the keys inside the <keys_file> file \n\
+(if given). The image has the format of the output of the \"dump\" command, \n\
+blocks made of xx are not written. A line may begin with <block_id>: to \n\
+continue the image at that block, so a list of such lines is a patch list. \n\
+Each sector is read first and only the blocks which differ are written with \n\
+the same authentication. The manufacturer block and the sector trailers are \n\
+never written. With \"verify\" each written block is read back. The number of \n\
+written and unchanged blocks and of the frames saved compared to a full \n\
+rewrite are printed on the standard output. \n\
+\n\
+./a.out mad [<keys_file>] \n\
+Print the MIFARE Application Directory of the card : the MAD version and the \n\
+application id of each sector in hexadecimal. The public MAD key is tried \n\
+first and then the keys inside the <keys_file> file (if given). \n\
+\n\
+./a.out app <aid> [<keys_file>] \n\
+Print the data blocks of the sectors which the MIFARE Application Directory \n\
+assigns to the application <aid>, without reading the other sectors. The \n\
+<aid> is hexadecimal, function cluster code first, or \"ndef\" for E103. The \n\
+public NDEF key is tried first and then the keys inside the <keys_file> file. \n\
+\n\
+./a.out bench [<count>] \n\
+Measure the cryptography of <count> (default 10000) MIFARE Ultralight C \n\
+authentications without a card : key loading, random number and the three \n\
+2K3DES CBC operations of the reader. It is measured once with the table \n\
+lookups and once in constant time, the number of authentications per second \n\
+is printed on the standard output. \n\
+\n\
+./a.out compile-keys <dict_file> <keys_file> [<keys_file> ...] \n\
+Merge the <keys_file> into the compiled dictionary <dict_file>. Each key is \n\
+kept once, the keys found in the most <keys_file> come first and the others \n\
+keep their order. A compiled dictionary is mapped instead of parsed, so it \n\
+loads at once whatever its size and is shared by the commands using it. \n\
+\n\
+Key cache \n\
+The keys which opened a sector are remembered per card uid in the file \n\
+pi-nfc.keycache of the current directory, or in the file named by the \n\
+PI_NFC_KEYCACHE environment variable ; an empty value disables it. The \n\
+commands reading a MIFARE Classic try the key remembered for the card \n\
+first, then the keys which opened the same sector on the most cards and \n\
+only then the <keys_file> in its order. \n\
 ";
 
   if (argc == 2 && strcmp(argv[1], "uid") == 0) {
     return cmd_uid();
   }
+  else if (argc == 2 && strcmp(argv[1], "info") == 0) {
+    return cmd_info();
+  }
   else if ((argc == 2 || argc == 3) && strcmp(argv[1], "dump") == 0) {
     if (argc == 3)
       return cmd_dump(argv[2]);
@@ -423,7 +1719,7 @@ behind is a valid value but it's still considered as a hexadecimal value. \n\
   else if ((argc == 3 || argc == 4) && strcmp(argv[1], "sector") == 0) {
     char * end;
     long int id = strtol(argv[2], &end, 10);
-    if (!(*end == '\0' && *argv[2] != '\0')) {
+    if (!(*end == '\0' && *argv[2] != '\0') || id < 0 || id > 0xFF) {
       printf("The second argument must be a number representing the sector's id\n");
       return 1;
     }
@@ -434,7 +1730,7 @@ behind is a valid value but it's still considered as a hexadecimal value. \n\
   else if ((argc == 3 || argc == 4) && strcmp(argv[1], "block") == 0) {
     char * end;
     long int id = strtol(argv[2], &end, 10);
-    if (!(*end == '\0' && *argv[2] != '\0')) {
+    if (!(*end == '\0' && *argv[2] != '\0') || id < 0 || id > 0xFF) {
       printf("The second argument must be a number representing the block's id\n");
       return 1;
     }
@@ -445,17 +1741,18 @@ behind is a valid value but it's still considered as a hexadecimal value. \n\
   else if ((argc == 5 || argc == 6) && strcmp(argv[1], "write-byte") == 0) {
     char * end;
     long int block_id = strtol(argv[2], &end, 10);
-    if (!(*end == '\0' && *argv[2] != '\0')) {
+    if (!(*end == '\0' && *argv[2] != '\0') || block_id < 0 || block_id > 0xFF) {
       printf("The second argument must be a number representing the block's id\n");
       return 1;
     }
     long int position = strtol(argv[3], &end, 10);
-    if (!(*end == '\0' && *argv[3] != '\0')) {
-      printf("The third argument must be a number representing the position of the byte\n");
+    if (!(*end == '\0' && *argv[3] != '\0') || position < 0 || position >= nbBlockData) {
+      printf("The third argument must be a number between 0 and %d representing the position of the byte\n",
+          nbBlockData - 1);
       return 1;
     }
-    uint8_t byte = strtol(argv[4], &end, 16);
-    if (!(*end == '\0' && *argv[4] != '\0')) {
+    long int byte = strtol(argv[4], &end, 16);
+    if (!(*end == '\0' && *argv[4] != '\0') || byte < 0 || byte > 0xFF) {
       printf("The forth argument must be a number representing the byte to write\n");
       return 1;
     }
@@ -463,6 +1760,47 @@ behind is a valid value but it's still considered as a hexadecimal value. \n\
       return cmd_write_byte(block_id, position, byte, argv[5]);
     return cmd_write_byte(block_id, position, byte, NULL);
   }
+  else if ((argc >= 3 && argc <= 5) && strcmp(argv[1], "write") == 0) {
+    int verify = strcmp(argv[argc - 1], "verify") == 0;
+    if (argc - verify == 4)
+      return cmd_write(argv[2], argv[3], verify);
+    if (argc - verify == 3)
+      return cmd_write(argv[2], NULL, verify);
+  }
+  else if ((argc == 2 || argc == 3) && strcmp(argv[1], "mad") == 0) {
+    if (argc == 3)
+      return cmd_mad(argv[2]);
+    return cmd_mad(NULL);
+  }
+  else if ((argc == 3 || argc == 4) && strcmp(argv[1], "app") == 0) {
+    char * end;
+    long int aid = PHAL_MFC_MAD_AID_NDEF;
+    if (strcmp(argv[2], "ndef") != 0) {
+      aid = strtol(argv[2], &end, 16);
+      if (!(*end == '\0' && *argv[2] != '\0') || aid > 0xFFFF) {
+        printf("The second argument must be a hexadecimal application id or \"ndef\"\n");
+        return 1;
+      }
+    }
+    if (argc == 4)
+      return cmd_app(aid, argv[3]);
+    return cmd_app(aid, NULL);
+  }
+  else if ((argc == 2 || argc == 3) && strcmp(argv[1], "bench") == 0) {
+    char * end;
+    long int count = 10000;
+    if (argc == 3) {
+      count = strtol(argv[2], &end, 10);
+      if (!(*end == '\0' && *argv[2] != '\0') || count <= 0) {
+        printf("The second argument must be a positive number of authentications\n");
+        return 1;
+      }
+    }
+    return cmd_bench(count);
+  }
+  else if (argc >= 4 && strcmp(argv[1], "compile-keys") == 0) {
+    return cmd_compile_keys(argv[2], &argv[3], argc - 3);
+  }
 
   printf("%s", usage);
   return -1;
@@ -0,0 +1,456 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Test of the indexed Software KeyStore against the Software KeyStore, and of its concurrent use.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include <ph_Status.h>
+#include <phKeyStore.h>
+
+#define TEST_NUM_KEYS       8U
+#define TEST_NUM_VERSIONS   3U
+#define TEST_NUM_KUC        2U
+#define TEST_INDEX_SIZE     32U
+#define TEST_NUM_OPERATIONS 20000U
+#define TEST_NUM_THREADS    4U
+#define TEST_KUC_LIMIT      200000U
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static phKeyStore_Sw_DataParams_t       sSw;
+static phKeyStore_Sw_KeyEntry_t         aSwKeys[TEST_NUM_KEYS];
+static phKeyStore_Sw_KeyVersionPair_t   aSwPairs[TEST_NUM_KEYS * TEST_NUM_VERSIONS];
+static phKeyStore_Sw_KUCEntry_t         aSwKucs[TEST_NUM_KUC];
+
+static phKeyStore_Idx_DataParams_t      sIdx;
+static phKeyStore_Idx_KeyEntry_t        aIdxKeys[TEST_NUM_KEYS];
+static phKeyStore_Idx_KeyVersionPair_t  aIdxPairs[TEST_NUM_KEYS * TEST_NUM_VERSIONS];
+static phKeyStore_Idx_KUCEntry_t        aIdxKucs[TEST_NUM_KUC];
+static uint16_t                         aIndex[TEST_INDEX_SIZE];
+
+static uint32_t dwRandom = 1;
+static uint32_t dwDone;
+
+static uint16_t Test_Random(uint16_t wRange)
+{
+    dwRandom = dwRandom * 1103515245U + 12345U;
+    return (uint16_t)((dwRandom >> 16) % wRange);
+}
+
+/* Home slot of a key version, the hash used by the component */
+static uint16_t Test_HomeSlot(uint16_t wKeyNo, uint16_t wVersion, uint16_t wIndexSize)
+{
+    uint32_t dwHash = (((uint32_t)wKeyNo << 16) | wVersion) * 0x9E3779B1U;
+    return (uint16_t)((dwHash >> 16) & (wIndexSize - 1));
+}
+
+static void Test_InitStores(uint16_t wNoOfKeys, uint16_t wNoOfVersions, uint16_t wIndexSize)
+{
+    (void)phKeyStore_Sw_Init(&sSw, sizeof(sSw), aSwKeys, wNoOfKeys, aSwPairs, wNoOfVersions, aSwKucs, TEST_NUM_KUC);
+    (void)phKeyStore_Idx_Init(&sIdx, sizeof(sIdx), aIdxKeys, wNoOfKeys, aIdxPairs, wNoOfVersions, aIdxKucs, TEST_NUM_KUC, aIndex, wIndexSize);
+}
+
+/* Every key version readable from one store has to be readable with the same key from the other one */
+static int Test_CompareStores(void)
+{
+    uint8_t aSwKey[32];
+    uint8_t aIdxKey[32];
+    uint16_t aSwVersions[TEST_NUM_VERSIONS];
+    uint16_t aIdxVersions[TEST_NUM_VERSIONS];
+    uint16_t wSwLength;
+    uint16_t wIdxLength;
+    uint16_t wSwType;
+    uint16_t wIdxType;
+    uint16_t wKeyNo;
+    uint16_t wVersion;
+    phStatus_t wSwStatus;
+    phStatus_t wIdxStatus;
+
+    for (wKeyNo = 0; wKeyNo < TEST_NUM_KEYS; ++wKeyNo)
+    {
+        CHECK(phKeyStore_GetKeyEntry(&sSw, wKeyNo, sizeof(aSwVersions), aSwVersions, &wSwLength, &wSwType) ==
+            phKeyStore_GetKeyEntry(&sIdx, wKeyNo, sizeof(aIdxVersions), aIdxVersions, &wIdxLength, &wIdxType));
+        CHECK((wSwLength == wIdxLength) && (wSwType == wIdxType));
+        CHECK(memcmp(aSwVersions, aIdxVersions, sizeof(aSwVersions)) == 0);
+
+        for (wVersion = 0; wVersion < 5; ++wVersion)
+        {
+            memset(aSwKey, 0x00, sizeof(aSwKey));
+            memset(aIdxKey, 0x00, sizeof(aIdxKey));
+            wSwStatus = phKeyStore_GetKey(&sSw, wKeyNo, wVersion, sizeof(aSwKey), aSwKey, &wSwType);
+            wIdxStatus = phKeyStore_GetKey(&sIdx, wKeyNo, wVersion, sizeof(aIdxKey), aIdxKey, &wIdxType);
+            CHECK(wSwStatus == wIdxStatus);
+            if ((wSwStatus & PH_ERR_MASK) == PH_ERR_SUCCESS)
+            {
+                CHECK(wSwType == wIdxType);
+                CHECK(memcmp(aSwKey, aIdxKey, sizeof(aSwKey)) == 0);
+            }
+        }
+    }
+
+    return 0;
+}
+
+/* Random operations give the same results on both stores */
+static int Test_RandomOperations(void)
+{
+    static const uint16_t aTypes[] = {PH_KEYSTORE_KEY_TYPE_MIFARE, PH_KEYSTORE_KEY_TYPE_DES, PH_KEYSTORE_KEY_TYPE_AES128, 0x20};
+    uint8_t aKeys[TEST_NUM_VERSIONS * 32];
+    uint16_t aVersions[TEST_NUM_VERSIONS];
+    uint32_t dwSwLimit;
+    uint32_t dwSwValue;
+    uint32_t dwIdxLimit;
+    uint32_t dwIdxValue;
+    uint32_t i;
+    uint16_t j;
+    uint16_t wKeyNo;
+    uint16_t wType;
+    uint16_t wNoOfKeys;
+    uint16_t wValue;
+
+    Test_InitStores(TEST_NUM_KEYS, TEST_NUM_VERSIONS, TEST_INDEX_SIZE);
+    CHECK(Test_CompareStores() == 0);
+
+    for (i = 0; i < TEST_NUM_OPERATIONS; ++i)
+    {
+        /* one key number beyond the store and one invalid key type */
+        wKeyNo = Test_Random(TEST_NUM_KEYS + 1);
+        wType = aTypes[Test_Random(sizeof(aTypes) / sizeof(aTypes[0]))];
+        for (j = 0; j < sizeof(aKeys); ++j)
+        {
+            aKeys[j] = (uint8_t)Test_Random(0x100);
+        }
+        for (j = 0; j < TEST_NUM_VERSIONS; ++j)
+        {
+            aVersions[j] = Test_Random(5);
+        }
+
+        switch (Test_Random(7))
+        {
+        case 0:
+            CHECK(phKeyStore_FormatKeyEntry(&sSw, wKeyNo, wType) == phKeyStore_FormatKeyEntry(&sIdx, wKeyNo, wType));
+            break;
+
+        case 1:
+        case 2:
+            wValue = Test_Random(5);
+            CHECK(phKeyStore_SetKey(&sSw, wKeyNo, wValue, wType, aKeys, aVersions[0]) ==
+                phKeyStore_SetKey(&sIdx, wKeyNo, wValue, wType, aKeys, aVersions[0]));
+            break;
+
+        case 3:
+        case 4:
+            wValue = Test_Random(TEST_NUM_VERSIONS + 1);
+            CHECK(phKeyStore_SetKeyAtPos(&sSw, wKeyNo, wValue, wType, aKeys, aVersions[0]) ==
+                phKeyStore_SetKeyAtPos(&sIdx, wKeyNo, wValue, wType, aKeys, aVersions[0]));
+            break;
+
+        case 5:
+            wNoOfKeys = Test_Random(TEST_NUM_VERSIONS + 1);
+            wValue = Test_Random(TEST_NUM_KUC + 1);
+            CHECK(phKeyStore_SetFullKeyEntry(&sSw, wNoOfKeys, wKeyNo, wValue, wType, aKeys, aVersions) ==
+                phKeyStore_SetFullKeyEntry(&sIdx, wNoOfKeys, wKeyNo, wValue, wType, aKeys, aVersions));
+            break;
+
+        default:
+            wValue = Test_Random(TEST_NUM_KUC + 1);
+            if (Test_Random(2) == 0)
+            {
+                CHECK(phKeyStore_SetKUC(&sSw, wKeyNo, wValue) == phKeyStore_SetKUC(&sIdx, wKeyNo, wValue));
+            }
+            else
+            {
+                dwSwLimit = Test_Random(200);
+                CHECK(phKeyStore_ChangeKUC(&sSw, wValue, dwSwLimit) == phKeyStore_ChangeKUC(&sIdx, wValue, dwSwLimit));
+            }
+            break;
+        }
+
+        CHECK(Test_CompareStores() == 0);
+        for (j = 0; j < TEST_NUM_KUC; ++j)
+        {
+            CHECK(phKeyStore_GetKUC(&sSw, j, &dwSwLimit, &dwSwValue) == phKeyStore_GetKUC(&sIdx, j, &dwIdxLimit, &dwIdxValue));
+            CHECK((dwSwLimit == dwIdxLimit) && (dwSwValue == dwIdxValue));
+        }
+    }
+
+    return 0;
+}
+
+/* Deleting from a cluster which wraps around the end of a small index keeps every other key reachable */
+static int Test_WrapAroundDeletion(void)
+{
+    enum { NUM_KEYS = 7, INDEX_SIZE = 8 };
+    uint8_t aKey[PH_KEYSTORE_KEY_TYPE_AES128_SIZE];
+    uint16_t aVersions[NUM_KEYS];
+    uint16_t wType;
+    uint16_t wKeyNo;
+    uint16_t wVersion;
+    uint16_t wRound;
+    uint16_t wOther;
+    uint8_t bWrapped = 0;
+
+    memset(aKey, 0x00, sizeof(aKey));
+
+    for (wRound = 0; wRound < 200; ++wRound)
+    {
+        Test_InitStores(NUM_KEYS, 1, INDEX_SIZE);
+
+        /* all keys hash to the last two slots, the cluster fills the index from there on */
+        for (wKeyNo = 0; wKeyNo < NUM_KEYS; ++wKeyNo)
+        {
+            CHECK(phKeyStore_FormatKeyEntry(&sIdx, wKeyNo, PH_KEYSTORE_KEY_TYPE_AES128) == PH_ERR_SUCCESS);
+            do
+            {
+                aVersions[wKeyNo] = (uint16_t)(1 + Test_Random(0x1000));
+            }
+            while (Test_HomeSlot(wKeyNo, aVersions[wKeyNo], INDEX_SIZE) < INDEX_SIZE - 2);
+            aKey[0] = (uint8_t)wKeyNo;
+            CHECK(phKeyStore_SetKeyAtPos(&sIdx, wKeyNo, 0, PH_KEYSTORE_KEY_TYPE_AES128, aKey, aVersions[wKeyNo]) == PH_ERR_SUCCESS);
+        }
+        for (wKeyNo = 0; wKeyNo < INDEX_SIZE - 2; ++wKeyNo)
+        {
+            bWrapped |= (uint8_t)(sIdx.pIndex[wKeyNo] != PH_KEYSTORE_IDX_INDEX_EMPTY);
+        }
+
+        /* move the keys to a version hashing anywhere in random order */
+        for (wOther = 0; wOther < NUM_KEYS; ++wOther)
+        {
+            wKeyNo = Test_Random(NUM_KEYS);
+            do
+            {
+                wVersion = (uint16_t)(0x2000 + Test_Random(0x1000));
+            }
+            while (wVersion == aVersions[wKeyNo]);
+            aKey[0] = (uint8_t)(wKeyNo | 0x80);
+            CHECK(phKeyStore_SetKey(&sIdx, wKeyNo, aVersions[wKeyNo], PH_KEYSTORE_KEY_TYPE_AES128, aKey, wVersion) == PH_ERR_SUCCESS);
+            CHECK((phKeyStore_GetKey(&sIdx, wKeyNo, aVersions[wKeyNo], sizeof(aKey), aKey, &wType) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+            aVersions[wKeyNo] = wVersion;
+
+            for (wKeyNo = 0; wKeyNo < NUM_KEYS; ++wKeyNo)
+            {
+                CHECK(phKeyStore_GetKey(&sIdx, wKeyNo, aVersions[wKeyNo], sizeof(aKey), aKey, &wType) == PH_ERR_SUCCESS);
+                CHECK((aKey[0] & 0x7F) == wKeyNo);
+            }
+        }
+    }
+    CHECK(bWrapped != 0);
+
+    return 0;
+}
+
+/* Faulty files import nothing */
+static int Test_ImportKeys(void)
+{
+    static const uint8_t aValid[] = {
+        0x7F, 'K', 'S', '1',
+        0x01, 0x00, 0x02, 0x00, PH_KEYSTORE_KEY_TYPE_DES, 0x00, 0xFF, 0xFF,
+        0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18,
+        0x03, 0x00, 0x05, 0x00, PH_KEYSTORE_KEY_TYPE_MIFARE, 0x00, 0x01, 0x00,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0xA1, 0xA2, 0xA3, 0xA4, 0xA5};
+    uint8_t aFile[sizeof(aValid)];
+    uint8_t aKey[32];
+    uint16_t wNoOfKeys;
+    uint16_t wType;
+    uint32_t dwLength;
+
+    Test_InitStores(TEST_NUM_KEYS, TEST_NUM_VERSIONS, TEST_INDEX_SIZE);
+
+    /* truncated within the header, a record and a key */
+    for (dwLength = 0; dwLength < sizeof(aValid); ++dwLength)
+    {
+        if ((dwLength == 4) || (dwLength == 20))
+        {
+            continue;
+        }
+        memcpy(aFile, aValid, sizeof(aValid));
+        CHECK((phKeyStore_Idx_ImportKeys(&sIdx, aFile, dwLength, &wNoOfKeys) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+        CHECK(wNoOfKeys == 0);
+    }
+
+    /* bad header, unknown key type, key number and key usage counter out of range */
+    memcpy(aFile, aValid, sizeof(aValid));
+    aFile[3] = '2';
+    CHECK((phKeyStore_Idx_ImportKeys(&sIdx, aFile, sizeof(aFile), &wNoOfKeys) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+    memcpy(aFile, aValid, sizeof(aValid));
+    aFile[24] = 0x20;
+    CHECK((phKeyStore_Idx_ImportKeys(&sIdx, aFile, sizeof(aFile), &wNoOfKeys) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+    memcpy(aFile, aValid, sizeof(aValid));
+    aFile[20] = TEST_NUM_KEYS;
+    CHECK((phKeyStore_Idx_ImportKeys(&sIdx, aFile, sizeof(aFile), &wNoOfKeys) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+    memcpy(aFile, aValid, sizeof(aValid));
+    aFile[26] = TEST_NUM_KUC;
+    CHECK((phKeyStore_Idx_ImportKeys(&sIdx, aFile, sizeof(aFile), &wNoOfKeys) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+
+    /* the valid first record was not imported either */
+    CHECK((phKeyStore_GetKey(&sIdx, 1, 2, sizeof(aKey), aKey, &wType) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+    CHECK(sIdx.dwSequence == 0);
+
+    memcpy(aFile, aValid, sizeof(aValid));
+    CHECK(phKeyStore_Idx_ImportKeys(&sIdx, aFile, sizeof(aFile), &wNoOfKeys) == PH_ERR_SUCCESS);
+    CHECK(wNoOfKeys == 2);
+    CHECK(phKeyStore_GetKey(&sIdx, 1, 2, sizeof(aKey), aKey, &wType) == PH_ERR_SUCCESS);
+    CHECK((wType == PH_KEYSTORE_KEY_TYPE_DES) && (memcmp(aKey, &aValid[12], 8) == 0));
+    CHECK(phKeyStore_GetKey(&sIdx, 3, 5, sizeof(aKey), aKey, &wType) == PH_ERR_SUCCESS);
+    CHECK((wType == PH_KEYSTORE_KEY_TYPE_MIFARE) && (memcmp(aKey, &aValid[28], 12) == 0));
+    CHECK((sIdx.dwSequence & 1) == 0);
+
+    return 0;
+}
+
+static void * Test_KucThread(void * pCount)
+{
+    uint8_t aKey[32];
+    uint16_t wType;
+
+    while (phKeyStore_GetKey(&sIdx, 0, 1, sizeof(aKey), aKey, &wType) == PH_ERR_SUCCESS)
+    {
+        ++(*(uint32_t *)pCount);
+    }
+
+    return NULL;
+}
+
+/* Threads sharing a key usage counter stop exactly at its limit */
+static int Test_KucLimit(void)
+{
+    pthread_t aThreads[TEST_NUM_THREADS];
+    uint32_t aCounts[TEST_NUM_THREADS];
+    uint8_t aKey[PH_KEYSTORE_KEY_TYPE_AES128_SIZE];
+    uint32_t dwLimit;
+    uint32_t dwValue;
+    uint32_t dwTotal = 0;
+    uint16_t i;
+
+    Test_InitStores(TEST_NUM_KEYS, TEST_NUM_VERSIONS, TEST_INDEX_SIZE);
+    memset(aKey, 0x42, sizeof(aKey));
+    CHECK(phKeyStore_FormatKeyEntry(&sIdx, 0, PH_KEYSTORE_KEY_TYPE_AES128) == PH_ERR_SUCCESS);
+    CHECK(phKeyStore_SetKeyAtPos(&sIdx, 0, 0, PH_KEYSTORE_KEY_TYPE_AES128, aKey, 1) == PH_ERR_SUCCESS);
+    CHECK(phKeyStore_SetKUC(&sIdx, 0, 1) == PH_ERR_SUCCESS);
+    CHECK(phKeyStore_ChangeKUC(&sIdx, 1, TEST_KUC_LIMIT) == PH_ERR_SUCCESS);
+
+    for (i = 0; i < TEST_NUM_THREADS; ++i)
+    {
+        aCounts[i] = 0;
+        CHECK(pthread_create(&aThreads[i], NULL, Test_KucThread, &aCounts[i]) == 0);
+    }
+    for (i = 0; i < TEST_NUM_THREADS; ++i)
+    {
+        CHECK(pthread_join(aThreads[i], NULL) == 0);
+        dwTotal += aCounts[i];
+    }
+
+    CHECK(dwTotal == TEST_KUC_LIMIT);
+    CHECK(phKeyStore_GetKUC(&sIdx, 1, &dwLimit, &dwValue) == PH_ERR_SUCCESS);
+    CHECK(dwValue == TEST_KUC_LIMIT);
+
+    return 0;
+}
+
+static void * Test_ReaderThread(void * pErrors)
+{
+    uint8_t aKey[32];
+    uint16_t wType;
+    uint16_t i;
+
+    while (__atomic_load_n(&dwDone, __ATOMIC_ACQUIRE) == 0)
+    {
+        if (phKeyStore_GetKey(&sIdx, 0, 1, sizeof(aKey), aKey, &wType) != PH_ERR_SUCCESS)
+        {
+            ++(*(uint32_t *)pErrors);
+            continue;
+        }
+        for (i = 1; i < PH_KEYSTORE_KEY_TYPE_AES128_SIZE; ++i)
+        {
+            if (aKey[i] != aKey[0])
+            {
+                ++(*(uint32_t *)pErrors);
+                break;
+            }
+        }
+    }
+
+    return NULL;
+}
+
+/* Readers never see a torn key or miss one a writer replaces */
+static int Test_ConcurrentReaders(void)
+{
+    pthread_t aThreads[TEST_NUM_THREADS];
+    uint32_t aErrors[TEST_NUM_THREADS];
+    uint8_t aKey[PH_KEYSTORE_KEY_TYPE_AES128_SIZE];
+    uint32_t i;
+
+    Test_InitStores(TEST_NUM_KEYS, TEST_NUM_VERSIONS, TEST_INDEX_SIZE);
+    memset(aKey, 0x00, sizeof(aKey));
+    CHECK(phKeyStore_FormatKeyEntry(&sIdx, 0, PH_KEYSTORE_KEY_TYPE_AES128) == PH_ERR_SUCCESS);
+    CHECK(phKeyStore_SetKeyAtPos(&sIdx, 0, 0, PH_KEYSTORE_KEY_TYPE_AES128, aKey, 1) == PH_ERR_SUCCESS);
+
+    dwDone = 0;
+    for (i = 0; i < TEST_NUM_THREADS; ++i)
+    {
+        aErrors[i] = 0;
+        CHECK(pthread_create(&aThreads[i], NULL, Test_ReaderThread, &aErrors[i]) == 0);
+    }
+    for (i = 0; i < TEST_NUM_OPERATIONS * 10; ++i)
+    {
+        memset(aKey, (uint8_t)i, sizeof(aKey));
+        CHECK(phKeyStore_SetKey(&sIdx, 0, 1, PH_KEYSTORE_KEY_TYPE_AES128, aKey, 1) == PH_ERR_SUCCESS);
+    }
+    __atomic_store_n(&dwDone, 1, __ATOMIC_RELEASE);
+    for (i = 0; i < TEST_NUM_THREADS; ++i)
+    {
+        CHECK(pthread_join(aThreads[i], NULL) == 0);
+        CHECK(aErrors[i] == 0);
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_RandomOperations();
+    failed |= Test_WrapAroundDeletion();
+    failed |= Test_ImportKeys();
+    failed |= Test_KucLimit();
+    failed |= Test_ConcurrentReaders();
+
+    if (failed == 0)
+    {
+        printf("phKeyStore Idx: all tests passed\n");
+    }
+
+    return failed;
+}
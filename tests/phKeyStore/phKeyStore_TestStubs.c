@@ -0,0 +1,44 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* HAL functions linked by the Rc663 KeyStore, which the Software KeyStores never reach.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+
+phStatus_t phhalHw_WriteRegister(void * pDataParams, uint8_t bAddress, uint8_t bValue)
+{
+    (void)pDataParams; (void)bAddress; (void)bValue;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_HAL);
+}
+
+phStatus_t phhalHw_ReadRegister(void * pDataParams, uint8_t bAddress, uint8_t * pValue)
+{
+    (void)pDataParams; (void)bAddress; (void)pValue;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_HAL);
+}
+
+phStatus_t phhalHw_Wait(void * pDataParams, uint8_t bUnit, uint16_t wTimeout)
+{
+    (void)pDataParams; (void)bUnit; (void)wTimeout;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_HAL);
+}
@@ -0,0 +1,376 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Test of the MIFARE(R) DESFire frame chaining against an in-process card.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ph_Status.h>
+#include <phpalMifare.h>
+#include <phpalI14443p4.h>
+#include <phalMfdf.h>
+
+#define TEST_FILE_SIZE      1024U
+#define TEST_CARD_CHUNK     59U     /* data bytes the card sends per frame */
+#define TEST_MAX_FRAMES     128U
+#define TEST_GUARD          0x5AU
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static uint8_t  aFile[TEST_FILE_SIZE];
+static uint8_t  aTx[512];
+static uint16_t wTxLength;
+static uint8_t  aResponse[TEST_CARD_CHUNK + 2];
+
+static uint8_t  bPending;           /* command continued by the additional frame command */
+static uint32_t dwPosition;         /* next byte of the file to send or write */
+static uint32_t dwEnd;              /* end of the current read or write */
+static uint8_t  bBadAfFrame;        /* an additional frame command was not sent the way the mode asks for */
+
+static uint16_t wFsi;
+static uint16_t wCid;
+static uint16_t aFrameLengths[TEST_MAX_FRAMES];    /* INF length of each frame the reader sent */
+static uint16_t wNumFrames;
+
+static phalMfdf_Sw_DataParams_t sMfdf;
+static uint8_t                  aPal[4];
+static uint8_t                  aPalP4[4];
+
+static uint32_t Test_Uint24(const uint8_t * pData)
+{
+    return (uint32_t)pData[0] | ((uint32_t)pData[1] << 8) | ((uint32_t)pData[2] << 16);
+}
+
+/* Sends the next part of the file being read */
+static uint16_t Test_SendChunk(uint8_t bWrapped, uint16_t wLimit)
+{
+    uint16_t wLength = (uint16_t)(((dwEnd - dwPosition) < wLimit) ? (dwEnd - dwPosition) : wLimit);
+    uint8_t bStatus;
+
+    dwPosition += wLength;
+    bStatus = (dwPosition < dwEnd) ? 0xAF : 0x00;
+    bPending = (bStatus == 0xAF) ? 0xBD : 0x00;
+
+    if (bWrapped)
+    {
+        memcpy(aResponse, &aFile[dwPosition - wLength], wLength);
+        aResponse[wLength] = 0x91;
+        aResponse[wLength + 1] = bStatus;
+        return (uint16_t)(wLength + 2);
+    }
+    aResponse[0] = bStatus;
+    memcpy(&aResponse[1], &aFile[dwPosition - wLength], wLength);
+    return (uint16_t)(wLength + 1);
+}
+
+/* Takes the next part of the file being written */
+static uint8_t Test_TakeChunk(const uint8_t * pData, uint16_t wLength)
+{
+    if ((dwPosition + wLength) > dwEnd)
+    {
+        bPending = 0;
+        return 0x7E;
+    }
+    memcpy(&aFile[dwPosition], pData, wLength);
+    dwPosition += wLength;
+    bPending = (dwPosition < dwEnd) ? 0x3D : 0x00;
+
+    return (bPending != 0) ? 0xAF : 0x00;
+}
+
+/* The card answers ReadData, WriteData and additional frames; the DESFire AL reaches it through this layer */
+phStatus_t phpalMifare_ExchangeL4(
+                                  void * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pTxBuffer,
+                                  uint16_t wTxLength_,
+                                  uint8_t ** ppRxBuffer,
+                                  uint16_t * pRxLength
+                                  )
+{
+    uint8_t bWrapped;
+    uint8_t bCmd;
+    uint8_t * pData;
+    uint16_t wDataLength;
+    uint8_t bStatus = 0x00;
+    uint16_t wLength;
+
+    (void)pDataParams;
+    *ppRxBuffer = aResponse;
+    *pRxLength = 0;
+
+    if ((wOption == PH_EXCHANGE_DEFAULT) || (wOption == PH_EXCHANGE_BUFFER_FIRST))
+    {
+        wTxLength = 0;
+    }
+    if ((wTxLength + wTxLength_) > sizeof(aTx))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_PAL_MIFARE);
+    }
+    memcpy(&aTx[wTxLength], pTxBuffer, wTxLength_);
+    wTxLength = (uint16_t)(wTxLength + wTxLength_);
+    if ((wOption == PH_EXCHANGE_BUFFER_FIRST) || (wOption == PH_EXCHANGE_BUFFER_CONT))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+    }
+
+    /* PCB, CID and CRC around the INF field */
+    if (wNumFrames < TEST_MAX_FRAMES)
+    {
+        aFrameLengths[wNumFrames] = wTxLength;
+    }
+    ++wNumFrames;
+
+    bWrapped = (uint8_t)(aTx[0] == 0x90);
+    if (bWrapped)
+    {
+        bCmd = aTx[1];
+        pData = &aTx[5];
+        wDataLength = (wTxLength > 5) ? aTx[4] : 0;
+        if ((wTxLength != ((wDataLength != 0) ? (6 + wDataLength) : 5)) || (aTx[wTxLength - 1] != 0x00))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+        }
+    }
+    else
+    {
+        bCmd = aTx[0];
+        pData = &aTx[1];
+        wDataLength = (uint16_t)(wTxLength - 1);
+    }
+    if ((bCmd == 0xAF) && (bPending == 0xBD) && (wDataLength != 0))
+    {
+        bBadAfFrame = 1;
+    }
+
+    switch (bCmd)
+    {
+    case 0xBD:
+        dwPosition = Test_Uint24(&pData[1]);
+        dwEnd = (Test_Uint24(&pData[4]) != 0) ? (dwPosition + Test_Uint24(&pData[4])) : TEST_FILE_SIZE;
+        *pRxLength = Test_SendChunk(bWrapped, TEST_CARD_CHUNK);
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+
+    case 0x3D:
+        dwPosition = Test_Uint24(&pData[1]);
+        dwEnd = dwPosition + Test_Uint24(&pData[4]);
+        bStatus = Test_TakeChunk(&pData[7], (uint16_t)(wDataLength - 7));
+        break;
+
+    case 0xAF:
+        if (bPending == 0xBD)
+        {
+            *pRxLength = Test_SendChunk(bWrapped, TEST_CARD_CHUNK);
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+        }
+        bStatus = (bPending == 0x3D) ? Test_TakeChunk(pData, wDataLength) : 0x1C;
+        break;
+
+    default:
+        bStatus = 0x1C;
+        break;
+    }
+
+    wLength = 0;
+    if (bWrapped)
+    {
+        aResponse[wLength++] = 0x91;
+    }
+    aResponse[wLength++] = bStatus;
+    *pRxLength = wLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+}
+
+phStatus_t phpalI14443p4_GetConfig(
+                                   void * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t * pValue
+                                   )
+{
+    (void)pDataParams;
+
+    switch (wConfig)
+    {
+    case PHPAL_I14443P4_CONFIG_FSI:
+        *pValue = wFsi;
+        break;
+    case PHPAL_I14443P4_CONFIG_CID:
+        *pValue = wCid;
+        break;
+    case PHPAL_I14443P4_CONFIG_NAD:
+        *pValue = 0;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_PAL_ISO14443P4);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+}
+
+static void Test_Init(uint8_t bWrapped, uint8_t bFsci, uint16_t wCidConfig)
+{
+    uint16_t wIndex;
+
+    for (wIndex = 0; wIndex < sizeof(aFile); ++wIndex)
+    {
+        aFile[wIndex] = (uint8_t)(wIndex * 13);
+    }
+    bPending = 0;
+    bBadAfFrame = 0;
+    wNumFrames = 0;
+    wFsi = (uint16_t)(0x0800 | bFsci);
+    wCid = wCidConfig;
+
+    (void)phalMfdf_Sw_Init(&sMfdf, sizeof(sMfdf), aPal, aPalP4, NULL, NULL, NULL);
+    (void)phalMfdf_SetConfig(&sMfdf, PHAL_MFDF_CONFIG_WRAPPED_MODE, bWrapped);
+}
+
+/* Each frame of the card goes to its place in the caller's buffer */
+static int Test_ReadMultiFrame(void)
+{
+    uint8_t aBuffer[600 + 16];
+    uint16_t wRxLength;
+    uint16_t wFrames;
+
+    Test_Init(PH_OFF, 8, 0);
+    memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+
+    CHECK(phalMfdf_ReadData(&sMfdf, 1, 100, 600, aBuffer, 600, &wRxLength) == PH_ERR_SUCCESS);
+    CHECK(wRxLength == 600);
+    CHECK(memcmp(aBuffer, &aFile[100], 600) == 0);
+    CHECK(aBuffer[600] == TEST_GUARD);
+    CHECK(phalMfdf_GetConfig(&sMfdf, PHAL_MFDF_CONFIG_FRAMES, &wFrames) == PH_ERR_SUCCESS);
+    CHECK(wFrames == (600 + TEST_CARD_CHUNK - 1) / TEST_CARD_CHUNK);
+    CHECK(bBadAfFrame == 0);
+
+    return 0;
+}
+
+/* A card sending more than the buffer holds must not write beyond it */
+static int Test_ReadOverflow(void)
+{
+    uint8_t aBuffer[100 + 16];
+    uint16_t wRxLength;
+    uint16_t wIndex;
+
+    Test_Init(PH_OFF, 8, 0);
+    memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+
+    /* length '0' reads up to the end of the file */
+    CHECK((phalMfdf_ReadData(&sMfdf, 1, 0, 0, aBuffer, 100, &wRxLength) & PH_ERR_MASK) == PH_ERR_BUFFER_OVERFLOW);
+    for (wIndex = 100; wIndex < sizeof(aBuffer); ++wIndex)
+    {
+        CHECK(aBuffer[wIndex] == TEST_GUARD);
+    }
+
+    return 0;
+}
+
+/* Wrapped answers end with 91 AF until the last frame; additional frames carry no data */
+static int Test_ReadWrapped(void)
+{
+    uint8_t aBuffer[300];
+    uint16_t wRxLength;
+
+    Test_Init(PH_ON, 8, 0);
+
+    CHECK(phalMfdf_ReadData(&sMfdf, 1, 10, 300, aBuffer, sizeof(aBuffer), &wRxLength) == PH_ERR_SUCCESS);
+    CHECK(wRxLength == 300);
+    CHECK(memcmp(aBuffer, &aFile[10], 300) == 0);
+    CHECK(wNumFrames == (300 + TEST_CARD_CHUNK - 1) / TEST_CARD_CHUNK);
+    CHECK(aFrameLengths[1] == 5);
+    CHECK(bBadAfFrame == 0);
+
+    return 0;
+}
+
+/* WriteData fills every frame up to the frame size of the card */
+static int Test_WriteFrameSizes(void)
+{
+    /* wrapped, FSCI, CID, INF bytes of a frame, frames for 600 bytes */
+    static const uint16_t aCases[5][5] = {
+        {PH_OFF, 0, 0x0000,  13,  51},
+        {PH_OFF, 8, 0x0000, 253,   3},
+        {PH_ON,  0, 0x0000,  13,  87},
+        {PH_ON,  8, 0x0000, 253,   3},
+        {PH_ON,  0, 0x0100,  12, 101}  /* the wrapped header alone exceeds the frame */
+    };
+    uint8_t aData[600];
+    uint16_t wIndex;
+    uint16_t wFrames;
+    uint16_t wHeaderOnly;
+    uint8_t bCase;
+
+    for (wIndex = 0; wIndex < sizeof(aData); ++wIndex)
+    {
+        aData[wIndex] = (uint8_t)(0xA5 ^ wIndex);
+    }
+
+    for (bCase = 0; bCase < 5; ++bCase)
+    {
+        Test_Init((uint8_t)aCases[bCase][0], (uint8_t)aCases[bCase][1], aCases[bCase][2]);
+
+        CHECK(phalMfdf_WriteData(&sMfdf, 1, 200, aData, sizeof(aData)) == PH_ERR_SUCCESS);
+        CHECK(memcmp(&aFile[200], aData, sizeof(aData)) == 0);
+        CHECK(phalMfdf_GetConfig(&sMfdf, PHAL_MFDF_CONFIG_FRAMES, &wFrames) == PH_ERR_SUCCESS);
+        CHECK(wFrames == aCases[bCase][4]);
+        CHECK(wNumFrames == aCases[bCase][4]);
+
+        /* the first frame carries at least the command header */
+        wHeaderOnly = (aCases[bCase][0] == PH_ON) ? 13 : 8;
+        CHECK(aFrameLengths[0] == ((aCases[bCase][3] > wHeaderOnly) ? aCases[bCase][3] : wHeaderOnly));
+        for (wIndex = 1; wIndex < (wNumFrames - 1); ++wIndex)
+        {
+            CHECK(aFrameLengths[wIndex] == aCases[bCase][3]);
+        }
+        CHECK(aFrameLengths[wNumFrames - 1] <= aCases[bCase][3]);
+    }
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_ReadMultiFrame();
+    failed |= Test_ReadOverflow();
+    failed |= Test_ReadWrapped();
+    failed |= Test_WriteFrameSizes();
+
+    if (failed == 0)
+    {
+        printf("phalMfdf: all tests passed\n");
+    }
+
+    return failed;
+}
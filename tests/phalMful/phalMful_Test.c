@@ -0,0 +1,333 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Test of the MIFARE(R) Ultralight page reads and writes against an in-process tag.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ph_Status.h>
+#include <phpalMifare.h>
+#include <phalMful.h>
+
+#define TEST_NUM_PAGES      231U    /* NTAG216 */
+#define TEST_MAX_COMMANDS   64U
+#define TEST_GUARD          0x5AU
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static uint8_t  aMemory[TEST_NUM_PAGES * 4];
+static uint8_t  aResponse[TEST_NUM_PAGES * 4];
+static uint16_t wMaxRxLength;                       /* RX buffer of the HAL */
+static uint8_t  aCommands[TEST_MAX_COMMANDS][3];    /* command code and page arguments the tag received */
+static uint16_t wNumCommands;
+static uint8_t  aTimeouts[TEST_NUM_PAGES];          /* writes of a page left unanswered before it is written */
+static uint8_t  aNaks[TEST_NUM_PAGES];              /* pages whose write the tag refuses */
+
+static phalMful_Sw_DataParams_t sMful;
+static uint8_t                  aPal[4];
+
+/* The tag answers GET_VERSION, READ, FAST_READ and WRITE; the MIFARE Ultralight AL reaches it through this layer */
+phStatus_t phpalMifare_ExchangeL3(
+                                  void * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pTxBuffer,
+                                  uint16_t wTxLength,
+                                  uint8_t ** ppRxBuffer,
+                                  uint16_t * pRxLength
+                                  )
+{
+    static const uint8_t aVersion[8] = {0x00, 0x04, 0x04, 0x02, 0x01, 0x00, 0x13, 0x03};
+    uint16_t wIndex;
+
+    (void)pDataParams;
+    (void)wOption;
+    *ppRxBuffer = aResponse;
+    *pRxLength = 0;
+
+    if (wNumCommands < TEST_MAX_COMMANDS)
+    {
+        memset(aCommands[wNumCommands], 0x00, sizeof(aCommands[0]));
+        memcpy(aCommands[wNumCommands], pTxBuffer, (wTxLength < 3) ? wTxLength : 3);
+    }
+    ++wNumCommands;
+
+    switch (pTxBuffer[0])
+    {
+    case 0x60:
+        memcpy(aResponse, aVersion, sizeof(aVersion));
+        *pRxLength = sizeof(aVersion);
+        break;
+
+    case 0x30:
+        /* the four pages roll over to page 0 at the end of the memory */
+        for (wIndex = 0; wIndex < 16; ++wIndex)
+        {
+            aResponse[wIndex] = aMemory[(pTxBuffer[1] * 4U + wIndex) % sizeof(aMemory)];
+        }
+        *pRxLength = 16;
+        break;
+
+    case 0x3A:
+        if ((pTxBuffer[2] < pTxBuffer[1]) || (pTxBuffer[2] >= TEST_NUM_PAGES))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+        }
+        *pRxLength = (uint16_t)((pTxBuffer[2] - pTxBuffer[1] + 1) * 4);
+        if (*pRxLength > wMaxRxLength)
+        {
+            *pRxLength = 0;
+            return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_PAL_MIFARE);
+        }
+        memcpy(aResponse, &aMemory[pTxBuffer[1] * 4], *pRxLength);
+        break;
+
+    case 0xA2:
+        if ((wTxLength != 6) || (pTxBuffer[1] >= TEST_NUM_PAGES))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+        }
+        if (aNaks[pTxBuffer[1]] != 0)
+        {
+            return PH_ADD_COMPCODE(PHPAL_MIFARE_ERR_NAK0, PH_COMP_PAL_MIFARE);
+        }
+        if (aTimeouts[pTxBuffer[1]] != 0)
+        {
+            --aTimeouts[pTxBuffer[1]];
+            return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_PAL_MIFARE);
+        }
+        memcpy(&aMemory[pTxBuffer[1] * 4], &pTxBuffer[2], 4);
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+}
+
+/* Fills the tag memory and identifies the chip, which turns FAST_READ on */
+static void Test_Init(void)
+{
+    uint8_t aVersion[8];
+    uint16_t wIndex;
+
+    for (wIndex = 0; wIndex < sizeof(aMemory); ++wIndex)
+    {
+        aMemory[wIndex] = (uint8_t)(wIndex * 7 + (wIndex >> 8));
+    }
+    wMaxRxLength = 64;
+    memset(aTimeouts, 0x00, sizeof(aTimeouts));
+    memset(aNaks, 0x00, sizeof(aNaks));
+
+    (void)phalMful_Sw_Init(&sMful, sizeof(sMful), aPal, NULL, NULL, NULL);
+    (void)phalMful_GetVersion(&sMful, aVersion);
+    wNumCommands = 0;
+}
+
+/* FAST_READ commands never exceed the configured number of pages */
+static int Test_FastReadSplit(void)
+{
+    static const uint8_t aLimits[3] = {PHAL_MFUL_DEFAULT_FAST_READ_PAGES, 7, 1};
+    uint8_t aBuffer[40 * 4 + 16];
+    uint16_t wIndex;
+    uint16_t wPage;
+    uint8_t bLimit;
+
+    for (bLimit = 0; bLimit < 3; ++bLimit)
+    {
+        Test_Init();
+        wMaxRxLength = (uint16_t)(aLimits[bLimit] * 4);
+        CHECK(phalMful_SetConfig(&sMful, PHAL_MFUL_CONFIG_MAX_FAST_READ_PAGES, aLimits[bLimit]) == PH_ERR_SUCCESS);
+        memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+
+        CHECK(phalMful_ReadPages(&sMful, 4, 40, aBuffer) == PH_ERR_SUCCESS);
+        CHECK(memcmp(aBuffer, &aMemory[4 * 4], 40 * 4) == 0);
+        CHECK(aBuffer[40 * 4] == TEST_GUARD);
+
+        /* full commands back to back, the remainder in the last one */
+        CHECK(wNumCommands == (40 + aLimits[bLimit] - 1) / aLimits[bLimit]);
+        wPage = 4;
+        for (wIndex = 0; wIndex < wNumCommands; ++wIndex)
+        {
+            CHECK(aCommands[wIndex][0] == 0x3A);
+            CHECK(aCommands[wIndex][1] == wPage);
+            wPage = (uint16_t)(wPage + aLimits[bLimit]);
+            CHECK(aCommands[wIndex][2] == (((wPage > 44) ? 44 : wPage) - 1));
+        }
+    }
+
+    return 0;
+}
+
+/* READ returns four pages; those beyond the requested ones must not reach the buffer */
+static int Test_ReadDropsSurplus(void)
+{
+    uint8_t aBuffer[6 * 4 + 16];
+    uint16_t wIndex;
+
+    Test_Init();
+    CHECK(phalMful_SetConfig(&sMful, PHAL_MFUL_CONFIG_FAST_READ, PH_OFF) == PH_ERR_SUCCESS);
+    memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+
+    CHECK(phalMful_ReadPages(&sMful, 10, 6, aBuffer) == PH_ERR_SUCCESS);
+    CHECK(memcmp(aBuffer, &aMemory[10 * 4], 6 * 4) == 0);
+    for (wIndex = 6 * 4; wIndex < sizeof(aBuffer); ++wIndex)
+    {
+        CHECK(aBuffer[wIndex] == TEST_GUARD);
+    }
+    CHECK(wNumCommands == 2);
+    CHECK((aCommands[0][0] == 0x30) && (aCommands[0][1] == 10));
+    CHECK((aCommands[1][0] == 0x30) && (aCommands[1][1] == 14));
+
+    /* the last pages of the memory, where READ rolls over */
+    memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+    CHECK(phalMful_ReadPages(&sMful, TEST_NUM_PAGES - 2, 2, aBuffer) == PH_ERR_SUCCESS);
+    CHECK(memcmp(aBuffer, &aMemory[(TEST_NUM_PAGES - 2) * 4], 2 * 4) == 0);
+    CHECK(aBuffer[2 * 4] == TEST_GUARD);
+
+    /* nor may a range beyond the memory be read */
+    CHECK((phalMful_ReadPages(&sMful, TEST_NUM_PAGES - 2, 3, aBuffer) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+    CHECK((phalMful_ReadPages(&sMful, 10, 0, aBuffer) & PH_ERR_MASK) == PH_ERR_INVALID_PARAMETER);
+
+    return 0;
+}
+
+/* Pages already holding their data are not written */
+static int Test_WriteSkipsUnchanged(void)
+{
+    uint8_t aData[5 * 4];
+    uint8_t aReference[5 * 4];
+    uint8_t aStatus[5];
+    uint16_t wFrames;
+
+    Test_Init();
+    memcpy(aReference, &aMemory[20 * 4], sizeof(aReference));
+    memcpy(aData, aReference, sizeof(aData));
+    aData[0] ^= 0xFF;
+    aData[2 * 4 + 3] ^= 0xFF;
+    aData[4 * 4 + 1] ^= 0xFF;
+
+    CHECK(phalMful_WritePages(&sMful, 20, 5, aData, aReference, aStatus, &wFrames) == PH_ERR_SUCCESS);
+    CHECK(memcmp(&aMemory[20 * 4], aData, sizeof(aData)) == 0);
+    CHECK(wFrames == 3);
+    CHECK(wNumCommands == 3);
+    CHECK((aCommands[0][1] == 20) && (aCommands[1][1] == 22) && (aCommands[2][1] == 24));
+    CHECK(aStatus[0] == PHAL_MFUL_PAGE_WRITTEN);
+    CHECK(aStatus[1] == PHAL_MFUL_PAGE_UNCHANGED);
+    CHECK(aStatus[2] == PHAL_MFUL_PAGE_WRITTEN);
+    CHECK(aStatus[3] == PHAL_MFUL_PAGE_UNCHANGED);
+    CHECK(aStatus[4] == PHAL_MFUL_PAGE_WRITTEN);
+
+    /* without reference every page is written */
+    wNumCommands = 0;
+    CHECK(phalMful_WritePages(&sMful, 20, 5, aData, NULL, aStatus, &wFrames) == PH_ERR_SUCCESS);
+    CHECK(wFrames == 5);
+    CHECK(wNumCommands == 5);
+
+    return 0;
+}
+
+/* A write without answer is repeated up to the configured retries, then the remaining pages are left alone */
+static int Test_WriteRetriesTimeout(void)
+{
+    uint8_t aData[4 * 4];
+    uint8_t aStatus[4];
+    uint16_t wFrames;
+
+    Test_Init();
+    memset(aData, 0xC3, sizeof(aData));
+    CHECK(phalMful_SetConfig(&sMful, PHAL_MFUL_CONFIG_WRITE_RETRIES, 2) == PH_ERR_SUCCESS);
+
+    /* two timeouts are covered by two retries */
+    aTimeouts[31] = 2;
+    CHECK(phalMful_WritePages(&sMful, 30, 4, aData, NULL, aStatus, &wFrames) == PH_ERR_SUCCESS);
+    CHECK(wFrames == 6);
+    CHECK(memcmp(&aMemory[30 * 4], aData, sizeof(aData)) == 0);
+    CHECK((aStatus[0] == PHAL_MFUL_PAGE_WRITTEN) && (aStatus[1] == PHAL_MFUL_PAGE_WRITTEN));
+    CHECK((aStatus[2] == PHAL_MFUL_PAGE_WRITTEN) && (aStatus[3] == PHAL_MFUL_PAGE_WRITTEN));
+
+    /* three are not */
+    memset(aData, 0x3C, sizeof(aData));
+    aTimeouts[31] = 3;
+    wNumCommands = 0;
+    CHECK((phalMful_WritePages(&sMful, 30, 4, aData, NULL, aStatus, &wFrames) & PH_ERR_MASK) == PH_ERR_IO_TIMEOUT);
+    CHECK(wFrames == 4);
+    CHECK(wNumCommands == 4);
+    CHECK(aStatus[0] == PHAL_MFUL_PAGE_WRITTEN);
+    CHECK(aStatus[1] == PHAL_MFUL_PAGE_FAILED);
+    CHECK((aStatus[2] == PHAL_MFUL_PAGE_NOT_WRITTEN) && (aStatus[3] == PHAL_MFUL_PAGE_NOT_WRITTEN));
+    CHECK(aMemory[32 * 4] == 0xC3);
+
+    return 0;
+}
+
+/* A NAK is final; the page is not retried and the following pages are not written */
+static int Test_WriteNak(void)
+{
+    uint8_t aData[4 * 4];
+    uint8_t aStatus[4];
+    uint8_t aUntouched[2 * 4];
+    uint16_t wFrames;
+
+    Test_Init();
+    memset(aData, 0x96, sizeof(aData));
+    memcpy(aUntouched, &aMemory[42 * 4], sizeof(aUntouched));
+    CHECK(phalMful_SetConfig(&sMful, PHAL_MFUL_CONFIG_WRITE_RETRIES, 3) == PH_ERR_SUCCESS);
+
+    aNaks[41] = 1;
+    CHECK((phalMful_WritePages(&sMful, 40, 4, aData, NULL, aStatus, &wFrames) & PH_ERR_MASK) == PHPAL_MIFARE_ERR_NAK0);
+    CHECK(wFrames == 2);
+    CHECK(wNumCommands == 2);
+    CHECK(aStatus[0] == PHAL_MFUL_PAGE_WRITTEN);
+    CHECK(aStatus[1] == PHAL_MFUL_PAGE_FAILED);
+    CHECK((aStatus[2] == PHAL_MFUL_PAGE_NOT_WRITTEN) && (aStatus[3] == PHAL_MFUL_PAGE_NOT_WRITTEN));
+    CHECK(memcmp(&aMemory[42 * 4], aUntouched, sizeof(aUntouched)) == 0);
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_FastReadSplit();
+    failed |= Test_ReadDropsSurplus();
+    failed |= Test_WriteSkipsUnchanged();
+    failed |= Test_WriteRetriesTimeout();
+    failed |= Test_WriteNak();
+
+    if (failed == 0)
+    {
+        printf("phalMful: all tests passed\n");
+    }
+
+    return failed;
+}
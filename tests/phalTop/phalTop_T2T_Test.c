@@ -0,0 +1,220 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Test of the Type 2 Tag NDEF read against an in-process tag, including hostile TLVs.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ph_Status.h>
+#include <phalMful.h>
+#include <phalTop.h>
+
+#define TEST_NUM_PAGES      231U    /* NTAG216 */
+#define TEST_BUFFER_SIZE    1024U
+#define TEST_GUARD          0x5AU
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static uint8_t aMemory[TEST_NUM_PAGES * 4];
+static uint8_t aResponse[TEST_NUM_PAGES * 4];
+
+static phalMful_Sw_DataParams_t sMful;
+static phalTop_Sw_DataParams_t  sTop;
+static uint8_t                  aPal[4];
+
+/* The tag answers GET_VERSION, READ and FAST_READ; the MIFARE Ultralight AL reaches it through this layer */
+phStatus_t phpalMifare_ExchangeL3(
+                                  void * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pTxBuffer,
+                                  uint16_t wTxLength,
+                                  uint8_t ** ppRxBuffer,
+                                  uint16_t * pRxLength
+                                  )
+{
+    static const uint8_t aVersion[8] = {0x00, 0x04, 0x04, 0x02, 0x01, 0x00, 0x13, 0x03};
+    uint16_t wIndex;
+
+    (void)pDataParams;
+    (void)wOption;
+    (void)wTxLength;
+    *ppRxBuffer = aResponse;
+
+    switch (pTxBuffer[0])
+    {
+    case 0x60:
+        memcpy(aResponse, aVersion, sizeof(aVersion));
+        *pRxLength = sizeof(aVersion);
+        break;
+
+    case 0x30:
+        for (wIndex = 0; wIndex < 16; ++wIndex)
+        {
+            aResponse[wIndex] = aMemory[(pTxBuffer[1] * 4U + wIndex) % sizeof(aMemory)];
+        }
+        *pRxLength = 16;
+        break;
+
+    case 0x3A:
+        if ((pTxBuffer[2] < pTxBuffer[1]) || (pTxBuffer[2] >= TEST_NUM_PAGES))
+        {
+            return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+        }
+        *pRxLength = (uint16_t)((pTxBuffer[2] - pTxBuffer[1] + 1) * 4);
+        memcpy(aResponse, &aMemory[pTxBuffer[1] * 4], *pRxLength);
+        break;
+
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_PROTOCOL_ERROR, PH_COMP_PAL_MIFARE);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_MIFARE);
+}
+
+/* The ISO14443-4 PAL is never reached by a Type 2 Tag read */
+phStatus_t phpalI14443p4_Exchange(void * pDataParams, uint16_t wOption, uint8_t * pTxBuffer, uint16_t wTxLength, uint8_t ** ppRxBuffer, uint16_t * pRxLength)
+{
+    (void)pDataParams; (void)wOption; (void)pTxBuffer; (void)wTxLength; (void)ppRxBuffer; (void)pRxLength;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_PAL_ISO14443P4);
+}
+
+phStatus_t phpalI14443p4_GetConfig(void * pDataParams, uint16_t wConfig, uint16_t * pValue)
+{
+    (void)pDataParams; (void)wConfig; (void)pValue;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_PAL_ISO14443P4);
+}
+
+/* Formats the tag and places the given TLVs at the start of the data area */
+static void Test_Format(const uint8_t * pTlvs, uint16_t wLength)
+{
+    static const uint8_t aCc[4] = {0xE1, 0x10, 0x6D, 0x00};
+    uint8_t aVersion[8];
+
+    memset(aMemory, 0x00, sizeof(aMemory));
+    memcpy(&aMemory[12], aCc, sizeof(aCc));
+    memcpy(&aMemory[16], pTlvs, wLength);
+
+    (void)phalMful_Sw_Init(&sMful, sizeof(sMful), aPal, NULL, NULL, NULL);
+    (void)phalTop_Sw_Init(&sTop, sizeof(sTop), &sMful, NULL);
+    (void)phalMful_GetVersion(&sMful, aVersion);
+}
+
+/* Reads the NDEF message into a buffer with a guard area behind it */
+static phStatus_t Test_Read(uint8_t ** ppNdef, uint16_t * pNdefLength, uint8_t * pGuardIntact)
+{
+    static uint8_t aBuffer[TEST_BUFFER_SIZE + 64];
+    phStatus_t status;
+    uint16_t wIndex;
+
+    memset(aBuffer, TEST_GUARD, sizeof(aBuffer));
+    *pNdefLength = 0;
+
+    status = phalTop_ReadNdef(&sTop, PHAL_TOP_TAG_TYPE_T2T, aBuffer, TEST_BUFFER_SIZE, ppNdef, pNdefLength);
+
+    *pGuardIntact = 1;
+    for (wIndex = TEST_BUFFER_SIZE; wIndex < sizeof(aBuffer); ++wIndex)
+    {
+        if (aBuffer[wIndex] != TEST_GUARD)
+        {
+            *pGuardIntact = 0;
+        }
+    }
+
+    return status;
+}
+
+static int Test_Message(void)
+{
+    static const uint8_t aTlvs[] = {0x03, 0x04, 0xD1, 0x01, 0x00, 0x55, 0xFE};
+    uint8_t * pNdef;
+    uint16_t wLength;
+    uint8_t bGuard;
+
+    Test_Format(aTlvs, sizeof(aTlvs));
+    CHECK((Test_Read(&pNdef, &wLength, &bGuard) & PH_ERR_MASK) == PH_ERR_SUCCESS);
+    CHECK(bGuard != 0);
+    CHECK(wLength == 4);
+    CHECK(memcmp(pNdef, &aTlvs[2], 4) == 0);
+
+    return 0;
+}
+
+/* The three byte length of the NDEF Message TLV must not wrap the end of the message */
+static int Test_HostileNdefLength(void)
+{
+    static const uint8_t aTlvs[] = {0x03, 0xFF, 0xFF, 0xFE};
+    uint8_t * pNdef;
+    uint16_t wLength;
+    uint8_t bGuard;
+
+    Test_Format(aTlvs, sizeof(aTlvs));
+    CHECK((Test_Read(&pNdef, &wLength, &bGuard) & PH_ERR_MASK) == PHAL_TOP_ERR_INVALID_TLV);
+    CHECK(bGuard != 0);
+    CHECK(wLength == 0);
+
+    return 0;
+}
+
+/* Skipping a proprietary TLV must not wrap back to its start */
+static int Test_HostileSkipLength(void)
+{
+    static const uint8_t aWrap[] = {0xFD, 0xFF, 0xFF, 0xFC};
+    static const uint8_t aBeyond[] = {0xFD, 0xFF, 0x04, 0x00, 0x03, 0x00};
+    uint8_t * pNdef;
+    uint16_t wLength;
+    uint8_t bGuard;
+
+    Test_Format(aWrap, sizeof(aWrap));
+    CHECK((Test_Read(&pNdef, &wLength, &bGuard) & PH_ERR_MASK) == PHAL_TOP_ERR_INVALID_TLV);
+    CHECK(bGuard != 0);
+
+    Test_Format(aBeyond, sizeof(aBeyond));
+    CHECK((Test_Read(&pNdef, &wLength, &bGuard) & PH_ERR_MASK) == PHAL_TOP_ERR_INVALID_TLV);
+    CHECK(bGuard != 0);
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_Message();
+    failed |= Test_HostileNdefLength();
+    failed |= Test_HostileSkipLength();
+
+    if (failed == 0)
+    {
+        printf("phalTop T2T: all tests passed\n");
+    }
+
+    return failed;
+}
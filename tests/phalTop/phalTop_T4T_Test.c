@@ -0,0 +1,392 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Test of the Type 4 Tag NDEF read against an in-process tag.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ph_Status.h>
+#include <phpalI14443p4.h>
+#include <phalTop.h>
+
+#define TEST_NDEF_FILE_ID   0xE104U
+#define TEST_NDEF_FILE_SIZE 0x0800U
+#define TEST_BUFFER_SIZE    0x0800U
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static uint8_t  aCcFile[PHAL_TOP_T4T_CC_LENGTH];
+static uint8_t  aNdefFile[TEST_NDEF_FILE_SIZE];
+static uint8_t  aResponse[TEST_NDEF_FILE_SIZE + 2];
+
+static uint8_t  bMappingVersion;    /* 0x20 answers the name of mapping 2.0 only, 0x10 that of 1.0 only */
+static uint16_t wNdefFileId;        /* NDEF file the tag holds, may differ from its Capability Container */
+static uint16_t wFsi;
+static uint16_t wCid;
+static uint16_t wNad;
+
+static uint16_t wSelected;
+static uint16_t wCcReads;           /* SELECT and READ BINARY commands to the Capability Container */
+static uint16_t wMaxLe;             /* Largest Le of READ BINARY commands to the NDEF file */
+static uint16_t wOversizedFrames;   /* Responses which do not fit into one I-block */
+
+static phalTop_Sw_DataParams_t  sTop;
+static uint8_t                  aPal[4];
+
+static void Test_Answer(uint16_t wLength, uint8_t bSw1, uint8_t bSw2, uint16_t * pRxLength)
+{
+    static const uint16_t aFsTable[9] = {16, 24, 32, 40, 48, 64, 96, 128, 256};
+    uint16_t wFrameLength;
+
+    aResponse[wLength] = bSw1;
+    aResponse[wLength + 1] = bSw2;
+    *pRxLength = (uint16_t)(wLength + 2);
+
+    /* PCB, CID, NAD, INF and CRC */
+    wFrameLength = (uint16_t)(1 + ((wCid & 0xFF00) ? 1 : 0) + ((wNad & 0xFF00) ? 1 : 0) + *pRxLength + 2);
+    if (wFrameLength > aFsTable[wFsi >> 8])
+    {
+        ++wOversizedFrames;
+    }
+}
+
+/* The tag answers SELECT and READ BINARY; the Tag Operation AL reaches it through this layer */
+phStatus_t phpalI14443p4_Exchange(
+                                  void * pDataParams,
+                                  uint16_t wOption,
+                                  uint8_t * pTxBuffer,
+                                  uint16_t wTxLength,
+                                  uint8_t ** ppRxBuffer,
+                                  uint16_t * pRxLength
+                                  )
+{
+    static const uint8_t aNameV2[8] = {0x07, 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x01};
+    static const uint8_t aNameV1[8] = {0x07, 0xD2, 0x76, 0x00, 0x00, 0x85, 0x01, 0x00};
+    uint16_t wFileId;
+    uint16_t wOffset;
+    uint16_t wLength;
+    uint16_t wFileSize;
+    uint8_t * pFile;
+
+    (void)pDataParams;
+    (void)wOption;
+    *ppRxBuffer = aResponse;
+
+    if ((wTxLength >= 5) && (pTxBuffer[1] == 0xA4) && (pTxBuffer[2] == 0x04))
+    {
+        wSelected = 0;
+        if (((bMappingVersion == 0x20) && (wTxLength == 13) && (memcmp(&pTxBuffer[4], aNameV2, 8) == 0) && (pTxBuffer[12] == 0x00)) ||
+            ((bMappingVersion == 0x10) && (wTxLength == 12) && (memcmp(&pTxBuffer[4], aNameV1, 8) == 0)))
+        {
+            Test_Answer(0, 0x90, 0x00, pRxLength);
+        }
+        else
+        {
+            Test_Answer(0, 0x6A, 0x82, pRxLength);
+        }
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+    }
+
+    if ((wTxLength == 7) && (pTxBuffer[1] == 0xA4) && (pTxBuffer[2] == 0x00))
+    {
+        wFileId = (uint16_t)((pTxBuffer[5] << 8) | pTxBuffer[6]);
+        wSelected = 0;
+        if (pTxBuffer[3] != ((bMappingVersion == 0x20) ? 0x0C : 0x00))
+        {
+            Test_Answer(0, 0x6A, 0x86, pRxLength);
+        }
+        else if ((wFileId == PHAL_TOP_T4T_CC_FILE_ID) || (wFileId == wNdefFileId))
+        {
+            wSelected = wFileId;
+            wCcReads = (uint16_t)(wCcReads + ((wFileId == PHAL_TOP_T4T_CC_FILE_ID) ? 1 : 0));
+            Test_Answer(0, 0x90, 0x00, pRxLength);
+        }
+        else
+        {
+            Test_Answer(0, 0x6A, 0x82, pRxLength);
+        }
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+    }
+
+    if ((wTxLength == 5) && (pTxBuffer[1] == 0xB0) && (wSelected != 0))
+    {
+        pFile = (wSelected == PHAL_TOP_T4T_CC_FILE_ID) ? aCcFile : aNdefFile;
+        wFileSize = (wSelected == PHAL_TOP_T4T_CC_FILE_ID) ? sizeof(aCcFile) : sizeof(aNdefFile);
+        if (wSelected == PHAL_TOP_T4T_CC_FILE_ID)
+        {
+            ++wCcReads;
+        }
+        else if (pTxBuffer[4] > wMaxLe)
+        {
+            wMaxLe = pTxBuffer[4];
+        }
+
+        wOffset = (uint16_t)((pTxBuffer[2] << 8) | pTxBuffer[3]);
+        if (wOffset >= wFileSize)
+        {
+            Test_Answer(0, 0x6B, 0x00, pRxLength);
+            return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+        }
+        wLength = (pTxBuffer[4] == 0) ? 256 : pTxBuffer[4];
+        if (wLength > (wFileSize - wOffset))
+        {
+            wLength = (uint16_t)(wFileSize - wOffset);
+        }
+        memcpy(aResponse, &pFile[wOffset], wLength);
+        Test_Answer(wLength, 0x90, 0x00, pRxLength);
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+    }
+
+    Test_Answer(0, 0x6D, 0x00, pRxLength);
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+}
+
+phStatus_t phpalI14443p4_GetConfig(
+                                   void * pDataParams,
+                                   uint16_t wConfig,
+                                   uint16_t * pValue
+                                   )
+{
+    (void)pDataParams;
+
+    switch (wConfig)
+    {
+    case PHPAL_I14443P4_CONFIG_FSI:
+        *pValue = wFsi;
+        break;
+    case PHPAL_I14443P4_CONFIG_CID:
+        *pValue = wCid;
+        break;
+    case PHPAL_I14443P4_CONFIG_NAD:
+        *pValue = wNad;
+        break;
+    default:
+        return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_PARAMETER, PH_COMP_PAL_ISO14443P4);
+    }
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_ISO14443P4);
+}
+
+/* The MIFARE PAL is never reached by a Type 4 Tag read */
+phStatus_t phpalMifare_ExchangeL3(void * pDataParams, uint16_t wOption, uint8_t * pTxBuffer, uint16_t wTxLength, uint8_t ** ppRxBuffer, uint16_t * pRxLength)
+{
+    (void)pDataParams; (void)wOption; (void)pTxBuffer; (void)wTxLength; (void)ppRxBuffer; (void)pRxLength;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_PAL_MIFARE);
+}
+
+/* Formats the tag with a Capability Container giving MLe and the maximum NDEF size, and a message of the given length */
+static void Test_Format(uint8_t bVersion, uint16_t wMLe, uint16_t wMaxNdefSize, uint16_t wNlen)
+{
+    uint16_t wIndex;
+
+    aCcFile[0] = 0x00;
+    aCcFile[1] = PHAL_TOP_T4T_CC_LENGTH;
+    aCcFile[2] = bVersion;
+    aCcFile[3] = (uint8_t)(wMLe >> 8);
+    aCcFile[4] = (uint8_t)wMLe;
+    aCcFile[5] = 0x00;
+    aCcFile[6] = 0xFF;
+    aCcFile[7] = 0x04;
+    aCcFile[8] = 0x06;
+    aCcFile[9] = (uint8_t)(TEST_NDEF_FILE_ID >> 8);
+    aCcFile[10] = (uint8_t)TEST_NDEF_FILE_ID;
+    aCcFile[11] = (uint8_t)(wMaxNdefSize >> 8);
+    aCcFile[12] = (uint8_t)wMaxNdefSize;
+    aCcFile[13] = 0x00;
+    aCcFile[14] = 0x00;
+
+    aNdefFile[0] = (uint8_t)(wNlen >> 8);
+    aNdefFile[1] = (uint8_t)wNlen;
+    for (wIndex = 2; wIndex < sizeof(aNdefFile); ++wIndex)
+    {
+        aNdefFile[wIndex] = (uint8_t)(wIndex * 7);
+    }
+
+    bMappingVersion = bVersion & 0xF0;
+    wNdefFileId = TEST_NDEF_FILE_ID;
+    wFsi = 0x0808;
+    wCid = 0;
+    wNad = 0;
+
+    (void)phalTop_Sw_Init(&sTop, sizeof(sTop), NULL, aPal);
+}
+
+static phStatus_t Test_Read(uint16_t * pNdefLength)
+{
+    static uint8_t aBuffer[TEST_BUFFER_SIZE];
+    uint8_t * pNdef;
+    phStatus_t status;
+
+    wCcReads = 0;
+    wMaxLe = 0;
+    wOversizedFrames = 0;
+    *pNdefLength = 0;
+
+    status = phalTop_ReadNdef(&sTop, PHAL_TOP_TAG_TYPE_T4T, aBuffer, sizeof(aBuffer), &pNdef, pNdefLength);
+    if (((status & PH_ERR_MASK) == PH_ERR_SUCCESS) && (memcmp(pNdef, &aNdefFile[PHAL_TOP_T4T_NLEN_LENGTH], *pNdefLength) != 0))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_INTERNAL_ERROR, PH_COMP_AL_TOP);
+    }
+
+    return status;
+}
+
+/* READ BINARY fills one I-block of 256 bytes, less a byte each for CID and NAD */
+static int Test_ReadLength(void)
+{
+    static const uint16_t aCids[3] = {0x0000, 0x0105, 0x0105};
+    static const uint16_t aNads[3] = {0x0000, 0x0000, 0x0102};
+    uint16_t wNdefLength;
+    uint16_t wValue;
+    uint8_t bIndex;
+
+    for (bIndex = 0; bIndex < 3; ++bIndex)
+    {
+        Test_Format(0x20, 0xFFFF, TEST_NDEF_FILE_SIZE, 1000);
+        wCid = aCids[bIndex];
+        wNad = aNads[bIndex];
+
+        CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+        CHECK(wNdefLength == 1000);
+        CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_READ_LENGTH, &wValue) == PH_ERR_SUCCESS);
+        CHECK(wValue == 251 - bIndex);
+        CHECK(wMaxLe == 251 - bIndex);
+        CHECK(wOversizedFrames == 0);
+    }
+
+    /* a smaller MLe limits the read length */
+    Test_Format(0x20, 0x0040, TEST_NDEF_FILE_SIZE, 1000);
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wMaxLe == 0x40);
+
+    return 0;
+}
+
+/* NLEN must not exceed the NDEF file given by the Capability Container */
+static int Test_NlenBeyondCc(void)
+{
+    uint16_t wNdefLength;
+
+    Test_Format(0x20, 0xFFFF, 0x0100, 0x00FF);
+    CHECK((Test_Read(&wNdefLength) & PH_ERR_MASK) == PH_ERR_LENGTH_ERROR);
+
+    Test_Format(0x20, 0xFFFF, 0x0100, 0x00FE);
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wNdefLength == 0x00FE);
+
+    return 0;
+}
+
+/* A tag of mapping version 1.0 does not know the name of version 2.0 */
+static int Test_MappingFallback(void)
+{
+    uint16_t wNdefLength;
+    uint16_t wValue;
+
+    Test_Format(0x10, 0xFFFF, TEST_NDEF_FILE_SIZE, 300);
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wNdefLength == 300);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_VERSION, &wValue) == PH_ERR_SUCCESS);
+    CHECK(wValue == 0x10);
+
+    /* a tag knowing neither name is not formatted */
+    Test_Format(0x10, 0xFFFF, TEST_NDEF_FILE_SIZE, 300);
+    bMappingVersion = 0;
+    CHECK((Test_Read(&wNdefLength) & PH_ERR_MASK) == PHAL_TOP_ERR_NOT_FORMATTED);
+
+    return 0;
+}
+
+/* The Capability Container of a known tag is not read again until its NDEF file disappears */
+static int Test_CcCache(void)
+{
+    uint8_t aUid[7] = {0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66};
+    uint16_t wNdefLength;
+    uint16_t wValue;
+    uint16_t wCommands;
+
+    Test_Format(0x20, 0xFFFF, TEST_NDEF_FILE_SIZE, 20);
+    CHECK(phalTop_SetUid(&sTop, aUid, sizeof(aUid)) == PH_ERR_SUCCESS);
+
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wCcReads == 2);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_CC_CACHED, &wValue) == PH_ERR_SUCCESS);
+    CHECK(wValue == PH_OFF);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_COMMANDS, &wCommands) == PH_ERR_SUCCESS);
+
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wNdefLength == 20);
+    CHECK(wCcReads == 0);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_CC_CACHED, &wValue) == PH_ERR_SUCCESS);
+    CHECK(wValue == PH_ON);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_COMMANDS, &wValue) == PH_ERR_SUCCESS);
+    CHECK(wValue == wCommands - 2);
+
+    /* another tag is not served from the cache */
+    aUid[6] = 0x67;
+    CHECK(phalTop_SetUid(&sTop, aUid, sizeof(aUid)) == PH_ERR_SUCCESS);
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wCcReads == 2);
+    aUid[6] = 0x66;
+    CHECK(phalTop_SetUid(&sTop, aUid, sizeof(aUid)) == PH_ERR_SUCCESS);
+
+    /* formatted anew with another NDEF file */
+    wNdefFileId = 0xE105;
+    aCcFile[9] = 0xE1;
+    aCcFile[10] = 0x05;
+    CHECK((Test_Read(&wNdefLength) & PH_ERR_MASK) == PHAL_TOP_ERR_ISO7816);
+    CHECK(wCcReads == 0);
+
+    CHECK(Test_Read(&wNdefLength) == PH_ERR_SUCCESS);
+    CHECK(wNdefLength == 20);
+    CHECK(wCcReads == 2);
+    CHECK(phalTop_GetConfig(&sTop, PHAL_TOP_CONFIG_CC_CACHED, &wValue) == PH_ERR_SUCCESS);
+    CHECK(wValue == PH_OFF);
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_ReadLength();
+    failed |= Test_NlenBeyondCc();
+    failed |= Test_MappingFallback();
+    failed |= Test_CcCache();
+
+    if (failed == 0)
+    {
+        printf("phalTop T4T: all tests passed\n");
+    }
+
+    return failed;
+}
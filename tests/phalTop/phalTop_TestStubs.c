@@ -0,0 +1,62 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* Layers linked by the MIFARE Ultralight AL, which neither page access nor an NDEF read reaches.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <ph_Status.h>
+
+phStatus_t phKeyStore_GetKey(void * pDataParams, uint16_t wKeyNo, uint16_t wKeyVersion, uint8_t bKeyBufSize, uint8_t * pKey, uint16_t * pKeyType)
+{
+    (void)pDataParams; (void)wKeyNo; (void)wKeyVersion; (void)bKeyBufSize; (void)pKey; (void)pKeyType;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_KEYSTORE);
+}
+
+phStatus_t phCryptoSym_LoadKeyDirect(void * pDataParams, uint8_t * pKey, uint16_t wKeyType)
+{
+    (void)pDataParams; (void)pKey; (void)wKeyType;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_LoadIv(void * pDataParams, uint8_t * pIV, uint8_t bIVLength)
+{
+    (void)pDataParams; (void)pIV; (void)bIVLength;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Decrypt(void * pDataParams, uint16_t wOption, uint8_t * pEncryptedBuffer, uint16_t wBufferLength, uint8_t * pPlainBuffer)
+{
+    (void)pDataParams; (void)wOption; (void)pEncryptedBuffer; (void)wBufferLength; (void)pPlainBuffer;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoSym_Encrypt(void * pDataParams, uint16_t wOption, uint8_t * pPlainBuffer, uint16_t wBufferLength, uint8_t * pEncryptedBuffer)
+{
+    (void)pDataParams; (void)wOption; (void)pPlainBuffer; (void)wBufferLength; (void)pEncryptedBuffer;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTOSYM);
+}
+
+phStatus_t phCryptoRng_Rnd(void * pDataParams, uint16_t wNoOfRndBytes, uint8_t * pRnd)
+{
+    (void)pDataParams; (void)wNoOfRndBytes; (void)pRnd;
+    return PH_ADD_COMPCODE(PH_ERR_UNSUPPORTED_COMMAND, PH_COMP_CRYPTORNG);
+}
@@ -0,0 +1,306 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* End to end test of the LLCP Link Layer Component against the in-process peer.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <ph_Status.h>
+#include <phlnLlcp.h>
+#include "phlnLlcp_TestPeer.h"
+
+#define TEST_NUM_LINKS      2U
+#define TEST_FRAME_SIZE     512U
+#define TEST_RX_SIZE        606U
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+#define CHECK_STATUS(call, expected)                                    \
+    do                                                                  \
+    {                                                                   \
+        phStatus_t statusCheck = (call);                                \
+        if ((statusCheck & PH_ERR_MASK) != (expected))                  \
+        {                                                               \
+            printf("%s:%d: %s returned 0x%04X\n", __FILE__, __LINE__, #call, statusCheck); \
+            return 1;                                                   \
+        }                                                               \
+    } while (0)
+
+static uint8_t aServiceName[] = "urn:nfc:sn:pi-nfc-test";
+
+static phlnLlcp_TestPeer_t       sPeer;
+static phlnLlcp_Sw_DataParams_t  sLlcp;
+static phlnLlcp_Sw_Link_t        aLinks[TEST_NUM_LINKS];
+static uint8_t                   aFrameBuffer[TEST_FRAME_SIZE];
+static uint8_t                   aRxBuffer[TEST_NUM_LINKS][TEST_RX_SIZE];
+
+static void Test_Pattern(uint8_t * pData, uint16_t wLength, uint8_t bSeed)
+{
+    uint16_t wIndex;
+
+    for (wIndex = 0; wIndex < wLength; ++wIndex)
+    {
+        pData[wIndex] = (uint8_t)(bSeed + wIndex * 7U);
+    }
+}
+
+static int Test_Activate(void)
+{
+    uint8_t aGi[PHLN_LLCP_MAX_GI_LENGTH];
+    uint8_t bGiLength;
+    uint8_t aAtrRes[64];
+    uint8_t bAtrResLength;
+    uint16_t wValue;
+
+    phlnLlcp_TestPeer_Init(&sPeer, aServiceName, (uint8_t)(sizeof(aServiceName) - 1), 2, PHLN_LLCP_MIU_DEFAULT, 512);
+
+    CHECK_STATUS(phlnLlcp_Sw_Init(&sLlcp, sizeof(sLlcp), &sPeer, aLinks, TEST_NUM_LINKS, aFrameBuffer, sizeof(aFrameBuffer)), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_GetGeneralBytes(&sLlcp, aGi, &bGiLength), PH_ERR_SUCCESS);
+
+    phlnLlcp_TestPeer_GetAtrRes(&sPeer, aGi, bGiLength, aAtrRes, &bAtrResLength);
+    CHECK(sPeer.wRemoteLinkMiu == TEST_FRAME_SIZE - 3);
+
+    CHECK_STATUS(phlnLlcp_Activate(&sLlcp, aAtrRes, bAtrResLength), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_GetConfig(&sLlcp, PHLN_LLCP_CONFIG_REMOTE_MIU, &wValue), PH_ERR_SUCCESS);
+    CHECK(wValue == 512);
+    CHECK_STATUS(phlnLlcp_GetConfig(&sLlcp, PHLN_LLCP_CONFIG_VERSION, &wValue), PH_ERR_SUCCESS);
+    CHECK(wValue == 0x11);
+
+    return 0;
+}
+
+/* CONNECT answered by CC, by DM and DISC in both directions */
+static int Test_ConnectDisconnect(void)
+{
+    uint8_t aUnknown[] = "urn:nfc:sn:unknown";
+    uint8_t aData[16];
+    uint16_t wLength;
+    uint16_t wValue;
+    uint8_t bLink;
+
+    CHECK(Test_Activate() == 0);
+
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, 0, aUnknown, (uint8_t)(sizeof(aUnknown) - 1), 1, aRxBuffer[0], TEST_RX_SIZE, &bLink), PHLN_LLCP_ERR_REJECTED);
+    CHECK(bLink == PHLN_LLCP_NO_LINK);
+    CHECK_STATUS(phlnLlcp_SetConfig(&sLlcp, PHLN_LLCP_CONFIG_LINK, 0), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_GetConfig(&sLlcp, PHLN_LLCP_CONFIG_REASON, &wValue), PH_ERR_SUCCESS);
+    CHECK(wValue == 0x02);
+
+    /* By name through the service discovery SAP, the CC carries the SAP of the service */
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, 0, aServiceName, (uint8_t)(sizeof(aServiceName) - 1), 1, aRxBuffer[0], TEST_RX_SIZE, &bLink), PH_ERR_SUCCESS);
+    CHECK(bLink == 0);
+    CHECK(sPeer.aConnections[0].bConnected != 0);
+    CHECK(sPeer.aConnections[0].bRemoteSap == aLinks[0].bLocalSap);
+    CHECK(sPeer.aConnections[0].bRemoteRw == 1);
+    CHECK(aLinks[0].bRemoteSap == PHLN_LLCP_TESTPEER_SAP_SERVICE);
+
+    CHECK_STATUS(phlnLlcp_Disconnect(&sLlcp, bLink), PH_ERR_SUCCESS);
+    CHECK(sPeer.aConnections[0].bConnected == 0);
+
+    /* By SAP; the target closes the data link */
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, PHLN_LLCP_TESTPEER_SAP_SERVICE, NULL, 0, 1, aRxBuffer[0], TEST_RX_SIZE, &bLink), PH_ERR_SUCCESS);
+    phlnLlcp_TestPeer_Disconnect(&sPeer, 0);
+    CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLink, aData, sizeof(aData), &wLength), PHLN_LLCP_ERR_DISCONNECTED);
+    CHECK_STATUS(phlnLlcp_GetConfig(&sLlcp, PHLN_LLCP_CONFIG_REASON, &wValue), PH_ERR_SUCCESS);
+    CHECK(wValue == 0x00);
+
+    /* The DM answering the DISC goes out with the next frame */
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.aConnections[0].bConnected == 0);
+    CHECK(sPeer.aConnections[0].bReason == 0x00);
+
+    CHECK_STATUS(phlnLlcp_Deactivate(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.bActive == 0);
+    CHECK(sPeer.wErrors == 0);
+
+    return 0;
+}
+
+/* Sending stops at the receive window of the target and resumes with its RR */
+static int Test_WindowTx(void)
+{
+    uint8_t aData[600];
+    uint8_t bLink;
+
+    CHECK(Test_Activate() == 0);
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, 0, aServiceName, (uint8_t)(sizeof(aServiceName) - 1), 1, aRxBuffer[0], TEST_RX_SIZE, &bLink), PH_ERR_SUCCESS);
+
+    Test_Pattern(aData, sizeof(aData), 0x11);
+    CHECK_STATUS(phlnLlcp_Send(&sLlcp, bLink, aData, sizeof(aData)), PH_ERR_SUCCESS);
+
+    /* Two I PDUs of the MIU of the target fill its window */
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.wIPdusLastFrame == 2);
+    CHECK(sPeer.wAgfIn == 1);
+    CHECK(sPeer.aConnections[0].wRxLength == 2 * PHLN_LLCP_MIU_DEFAULT);
+
+    /* Nothing may be sent until the RR arrives */
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.wIPdusLastFrame == 0);
+
+    CHECK_STATUS(phlnLlcp_Flush(&sLlcp, bLink), PH_ERR_SUCCESS);
+    CHECK(sPeer.aConnections[0].wRxLength == sizeof(aData));
+    CHECK(memcmp(sPeer.aConnections[0].aRxData, aData, sizeof(aData)) == 0);
+    CHECK(sPeer.bMaxUnacked == 2);
+    CHECK(sPeer.wErrors == 0);
+
+    return 0;
+}
+
+/* Receiving is acknowledged only once the application took the data */
+static int Test_WindowRx(void)
+{
+    uint8_t aData[1000];
+    uint8_t aReceived[1000];
+    uint16_t wReceived = 0;
+    uint16_t wLength;
+    uint16_t wFrames;
+    uint8_t bLink;
+
+    CHECK(Test_Activate() == 0);
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, 0, aServiceName, (uint8_t)(sizeof(aServiceName) - 1), 3, aRxBuffer[0], TEST_RX_SIZE, &bLink), PH_ERR_SUCCESS);
+
+    /* MIU of the receive slots announced with the CONNECT */
+    CHECK(sPeer.aConnections[0].bRemoteRw == 3);
+    CHECK(sPeer.aConnections[0].wRemoteMiu == (TEST_RX_SIZE / 3) - 2);
+
+    Test_Pattern(aData, sizeof(aData), 0x5A);
+    phlnLlcp_TestPeer_Send(&sPeer, 0, aData, sizeof(aData));
+
+    CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLink, &aReceived[wReceived], (uint16_t)(sizeof(aReceived) - wReceived), &wLength), PH_ERR_SUCCESS);
+    wReceived = wReceived + wLength;
+    CHECK(wLength == (TEST_RX_SIZE / 3) - 2);
+
+    /* The frame of the target carried two I PDUs, the second one is taken without exchange */
+    CHECK(sPeer.wAgfOut == 1);
+    wFrames = sPeer.wFrames;
+    CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLink, &aReceived[wReceived], (uint16_t)(sizeof(aReceived) - wReceived), &wLength), PH_ERR_SUCCESS);
+    wReceived = wReceived + wLength;
+    CHECK(sPeer.wFrames == wFrames);
+
+    while (wReceived < sizeof(aData))
+    {
+        CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLink, &aReceived[wReceived], (uint16_t)(sizeof(aReceived) - wReceived), &wLength), PH_ERR_SUCCESS);
+        wReceived = wReceived + wLength;
+    }
+    CHECK(wReceived == sizeof(aData));
+    CHECK(memcmp(aReceived, aData, sizeof(aData)) == 0);
+
+    /* The last information units are acknowledged by the next frame */
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.aConnections[0].bVsa == sPeer.aConnections[0].bVs);
+    CHECK(sPeer.wErrors == 0);
+
+    return 0;
+}
+
+/* Two data links share one frame in both directions */
+static int Test_Aggregation(void)
+{
+    uint8_t aTxA[50];
+    uint8_t aTxB[60];
+    uint8_t aPeerA[30];
+    uint8_t aPeerB[40];
+    uint8_t aData[256];
+    uint16_t wLength;
+    uint16_t wFrames;
+    uint8_t bLinkA;
+    uint8_t bLinkB;
+
+    CHECK(Test_Activate() == 0);
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, 0, aServiceName, (uint8_t)(sizeof(aServiceName) - 1), 2, aRxBuffer[0], TEST_RX_SIZE, &bLinkA), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_Connect(&sLlcp, PHLN_LLCP_TESTPEER_SAP_SERVICE, NULL, 0, 2, aRxBuffer[1], TEST_RX_SIZE, &bLinkB), PH_ERR_SUCCESS);
+    CHECK(bLinkA != bLinkB);
+
+    Test_Pattern(aTxA, sizeof(aTxA), 0x01);
+    Test_Pattern(aTxB, sizeof(aTxB), 0x80);
+    CHECK_STATUS(phlnLlcp_Send(&sLlcp, bLinkA, aTxA, sizeof(aTxA)), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_Send(&sLlcp, bLinkB, aTxB, sizeof(aTxB)), PH_ERR_SUCCESS);
+
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.wAgfIn == 1);
+    CHECK(sPeer.wIPdusLastFrame == 2);
+    CHECK(sPeer.aConnections[0].wRxLength == sizeof(aTxA));
+    CHECK(memcmp(sPeer.aConnections[0].aRxData, aTxA, sizeof(aTxA)) == 0);
+    CHECK(sPeer.aConnections[1].wRxLength == sizeof(aTxB));
+    CHECK(memcmp(sPeer.aConnections[1].aRxData, aTxB, sizeof(aTxB)) == 0);
+
+    Test_Pattern(aPeerA, sizeof(aPeerA), 0x33);
+    Test_Pattern(aPeerB, sizeof(aPeerB), 0x44);
+    phlnLlcp_TestPeer_Send(&sPeer, 0, aPeerA, sizeof(aPeerA));
+    phlnLlcp_TestPeer_Send(&sPeer, 1, aPeerB, sizeof(aPeerB));
+
+    CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLinkA, aData, sizeof(aData), &wLength), PH_ERR_SUCCESS);
+    CHECK(wLength == sizeof(aPeerA));
+    CHECK(memcmp(aData, aPeerA, sizeof(aPeerA)) == 0);
+    CHECK(sPeer.wAgfOut == 1);
+
+    wFrames = sPeer.wFrames;
+    CHECK_STATUS(phlnLlcp_Receive(&sLlcp, bLinkB, aData, sizeof(aData), &wLength), PH_ERR_SUCCESS);
+    CHECK(sPeer.wFrames == wFrames);
+    CHECK(wLength == sizeof(aPeerB));
+    CHECK(memcmp(aData, aPeerB, sizeof(aPeerB)) == 0);
+
+    /* The target closes both data links within one frame, both DISC PDUs are answered */
+    CHECK_STATUS(phlnLlcp_Flush(&sLlcp, bLinkA), PH_ERR_SUCCESS);
+    CHECK_STATUS(phlnLlcp_Flush(&sLlcp, bLinkB), PH_ERR_SUCCESS);
+    phlnLlcp_TestPeer_Disconnect(&sPeer, 0);
+    phlnLlcp_TestPeer_Disconnect(&sPeer, 1);
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.wAgfOut == 2);
+    wFrames = sPeer.wAgfIn;
+    CHECK_STATUS(phlnLlcp_Transceive(&sLlcp), PH_ERR_SUCCESS);
+    CHECK(sPeer.wAgfIn == wFrames + 1);
+    CHECK(sPeer.aConnections[0].bReason == 0x00);
+    CHECK(sPeer.aConnections[1].bReason == 0x00);
+    CHECK(sPeer.aConnections[0].bConnected == 0);
+    CHECK(sPeer.aConnections[1].bConnected == 0);
+    CHECK(sPeer.wErrors == 0);
+
+    return 0;
+}
+
+int main(void)
+{
+    int failed = 0;
+
+    failed |= Test_ConnectDisconnect();
+    failed |= Test_WindowTx();
+    failed |= Test_WindowRx();
+    failed |= Test_Aggregation();
+
+    if (failed == 0)
+    {
+        printf("phlnLlcp: all tests passed\n");
+    }
+
+    return failed;
+}
@@ -0,0 +1,616 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* In-process LLCP target used to test the LLCP Link Layer Component.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#include <string.h>
+#include <ph_Status.h>
+#include <phpalI18092mPI.h>
+#include "phlnLlcp_TestPeer.h"
+
+/* The PDU encoding is written out here again, so the peer does not share mistakes with the component */
+#define TESTPEER_PTYPE_SYMM     0x00U
+#define TESTPEER_PTYPE_AGF      0x02U
+#define TESTPEER_PTYPE_CONNECT  0x04U
+#define TESTPEER_PTYPE_DISC     0x05U
+#define TESTPEER_PTYPE_CC       0x06U
+#define TESTPEER_PTYPE_DM       0x07U
+#define TESTPEER_PTYPE_I        0x0CU
+#define TESTPEER_PTYPE_RR       0x0DU
+#define TESTPEER_PTYPE_RNR      0x0EU
+
+#define TESTPEER_PARAM_VERSION  0x01U
+#define TESTPEER_PARAM_MIUX     0x02U
+#define TESTPEER_PARAM_WKS      0x03U
+#define TESTPEER_PARAM_RW       0x05U
+#define TESTPEER_PARAM_SN       0x06U
+
+#define TESTPEER_SAP_SDP        0x01U
+#define TESTPEER_MIU_DEFAULT    128U
+#define TESTPEER_FRAME_SIZE     (2U + 2175U)
+
+#define TESTPEER_DM_DISC        0x00U
+#define TESTPEER_DM_NO_SERVICE  0x02U
+#define TESTPEER_DM_REJECTED    0x03U
+
+#define TESTPEER_DSAP(pPdu)     ((uint8_t)((pPdu)[0] >> 2))
+#define TESTPEER_PTYPE(pPdu)    ((uint8_t)((((pPdu)[0] & 0x03U) << 2) | ((pPdu)[1] >> 6)))
+#define TESTPEER_SSAP(pPdu)     ((uint8_t)((pPdu)[1] & 0x3FU))
+
+static const uint8_t aTestPeer_Magic[3] = {0x46, 0x66, 0x6D};
+
+static uint8_t * phlnLlcp_TestPeer_AppendPdu(
+    uint8_t * pFrame,
+    uint16_t * pFramePos,
+    uint16_t wFrameLimit,
+    uint8_t bDsap,
+    uint8_t bPtype,
+    uint8_t bSsap,
+    uint16_t wPayloadLength
+    )
+{
+    uint8_t * pPdu;
+    uint16_t  wPduLength = 2 + wPayloadLength;
+
+    if ((*pFramePos + 2 + wPduLength) > wFrameLimit)
+    {
+        return NULL;
+    }
+
+    pPdu = &pFrame[*pFramePos];
+    pPdu[0] = (uint8_t)(wPduLength >> 8);
+    pPdu[1] = (uint8_t)(wPduLength);
+    pPdu[2] = (uint8_t)((bDsap << 2) | (bPtype >> 2));
+    pPdu[3] = (uint8_t)(((bPtype & 0x03U) << 6) | bSsap);
+
+    *pFramePos = *pFramePos + 2 + wPduLength;
+
+    return &pPdu[4];
+}
+
+static void phlnLlcp_TestPeer_QueueControl(
+    phlnLlcp_TestPeer_t * pPeer,
+    uint8_t bDsap,
+    uint8_t bPtype,
+    uint8_t bSsap,
+    const uint8_t * pPayload,
+    uint16_t wPayloadLength
+    )
+{
+    uint8_t * pData;
+
+    pData = phlnLlcp_TestPeer_AppendPdu(pPeer->aControl, &pPeer->wControlLength,
+        PHLN_LLCP_TESTPEER_CONTROL_SIZE, bDsap, bPtype, bSsap, wPayloadLength);
+    if (pData == NULL)
+    {
+        ++pPeer->wErrors;
+        return;
+    }
+
+    memcpy(pData, pPayload, wPayloadLength);
+}
+
+static phlnLlcp_TestPeer_Connection_t * phlnLlcp_TestPeer_Find(
+    phlnLlcp_TestPeer_t * pPeer,
+    uint8_t bLocalSap,
+    uint8_t bRemoteSap
+    )
+{
+    phlnLlcp_TestPeer_Connection_t * pConnection;
+    uint8_t bIndex;
+
+    for (bIndex = 0; bIndex < PHLN_LLCP_TESTPEER_MAX_CONNECTIONS; ++bIndex)
+    {
+        pConnection = &pPeer->aConnections[bIndex];
+        if ((pConnection->bConnected != 0) &&
+            (pConnection->bLocalSap == bLocalSap) &&
+            (pConnection->bRemoteSap == bRemoteSap))
+        {
+            return pConnection;
+        }
+    }
+
+    return NULL;
+}
+
+/* N(R) may only acknowledge I PDUs which have been sent */
+static void phlnLlcp_TestPeer_Acknowledge(
+    phlnLlcp_TestPeer_t * pPeer,
+    phlnLlcp_TestPeer_Connection_t * pConnection,
+    uint8_t bNr
+    )
+{
+    if (((bNr - pConnection->bVsa) & 0x0FU) > ((pConnection->bVs - pConnection->bVsa) & 0x0FU))
+    {
+        ++pPeer->wErrors;
+        return;
+    }
+
+    pConnection->bVsa = bNr;
+}
+
+static void phlnLlcp_TestPeer_Connect(
+    phlnLlcp_TestPeer_t * pPeer,
+    uint8_t * pPdu,
+    uint16_t wPduLength
+    )
+{
+    phlnLlcp_TestPeer_Connection_t * pConnection = NULL;
+    uint8_t  bDsap = TESTPEER_DSAP(pPdu);
+    uint8_t  bSsap = TESTPEER_SSAP(pPdu);
+    uint8_t  bRw = 1;
+    uint16_t wMiu = TESTPEER_MIU_DEFAULT;
+    uint8_t  bNameMatches = 0;
+    uint8_t  aParams[7];
+    uint8_t  bReason;
+    uint16_t wPos = 2;
+    uint8_t  bIndex;
+
+    while ((wPos + 2) <= wPduLength)
+    {
+        if ((wPos + 2 + pPdu[wPos + 1]) > wPduLength)
+        {
+            ++pPeer->wErrors;
+            return;
+        }
+
+        switch (pPdu[wPos])
+        {
+        case TESTPEER_PARAM_MIUX:
+            wMiu = (uint16_t)(TESTPEER_MIU_DEFAULT + ((((uint16_t)pPdu[wPos + 2] << 8) | pPdu[wPos + 3]) & 0x07FFU));
+            break;
+
+        case TESTPEER_PARAM_RW:
+            bRw = pPdu[wPos + 2] & 0x0FU;
+            break;
+
+        case TESTPEER_PARAM_SN:
+            bNameMatches = (uint8_t)((pPdu[wPos + 1] == pPeer->bServiceNameLength) &&
+                (memcmp(&pPdu[wPos + 2], pPeer->pServiceName, pPeer->bServiceNameLength) == 0));
+            break;
+
+        default:
+            break;
+        }
+
+        wPos = (uint16_t)(wPos + 2 + pPdu[wPos + 1]);
+    }
+    if (wPos != wPduLength)
+    {
+        ++pPeer->wErrors;
+    }
+
+    if (((bDsap == TESTPEER_SAP_SDP) && (bNameMatches != 0)) ||
+        (bDsap == PHLN_LLCP_TESTPEER_SAP_SERVICE))
+    {
+        for (bIndex = 0; bIndex < PHLN_LLCP_TESTPEER_MAX_CONNECTIONS; ++bIndex)
+        {
+            if (pPeer->aConnections[bIndex].bConnected == 0)
+            {
+                pConnection = &pPeer->aConnections[bIndex];
+                break;
+            }
+        }
+        bReason = TESTPEER_DM_REJECTED;
+    }
+    else
+    {
+        bReason = TESTPEER_DM_NO_SERVICE;
+    }
+
+    if (pConnection == NULL)
+    {
+        phlnLlcp_TestPeer_QueueControl(pPeer, bSsap, TESTPEER_PTYPE_DM, bDsap, &bReason, 1);
+        return;
+    }
+
+    memset(pConnection, 0x00, sizeof(phlnLlcp_TestPeer_Connection_t));
+    pConnection->bConnected = 1;
+    pConnection->bLocalSap  = (uint8_t)(PHLN_LLCP_TESTPEER_SAP_SERVICE + bIndex);
+    pConnection->bRemoteSap = bSsap;
+    pConnection->bRemoteRw  = bRw;
+    pConnection->wRemoteMiu = wMiu;
+    pConnection->bReason    = 0xFF;
+
+    aParams[0] = TESTPEER_PARAM_MIUX;
+    aParams[1] = 2;
+    aParams[2] = (uint8_t)((pPeer->wMiu - TESTPEER_MIU_DEFAULT) >> 8);
+    aParams[3] = (uint8_t)(pPeer->wMiu - TESTPEER_MIU_DEFAULT);
+    aParams[4] = TESTPEER_PARAM_RW;
+    aParams[5] = 1;
+    aParams[6] = pPeer->bRw;
+    phlnLlcp_TestPeer_QueueControl(pPeer, bSsap, TESTPEER_PTYPE_CC, pConnection->bLocalSap, aParams, sizeof(aParams));
+}
+
+static void phlnLlcp_TestPeer_HandlePdu(
+    phlnLlcp_TestPeer_t * pPeer,
+    uint8_t * pPdu,
+    uint16_t wPduLength
+    )
+{
+    phlnLlcp_TestPeer_Connection_t * pConnection;
+    uint8_t  bDsap = TESTPEER_DSAP(pPdu);
+    uint8_t  bPtype = TESTPEER_PTYPE(pPdu);
+    uint8_t  bSsap = TESTPEER_SSAP(pPdu);
+    uint8_t  bReason;
+    uint16_t wLength;
+
+    switch (bPtype)
+    {
+    case TESTPEER_PTYPE_SYMM:
+        break;
+
+    case TESTPEER_PTYPE_CONNECT:
+        phlnLlcp_TestPeer_Connect(pPeer, pPdu, wPduLength);
+        break;
+
+    case TESTPEER_PTYPE_DISC:
+        if ((bDsap == 0) && (bSsap == 0))
+        {
+            pPeer->bActive = 0;
+            memset(pPeer->aConnections, 0x00, sizeof(pPeer->aConnections));
+            break;
+        }
+
+        pConnection = phlnLlcp_TestPeer_Find(pPeer, bDsap, bSsap);
+        if (pConnection == NULL)
+        {
+            ++pPeer->wErrors;
+            break;
+        }
+        pConnection->bConnected = 0;
+
+        bReason = TESTPEER_DM_DISC;
+        phlnLlcp_TestPeer_QueueControl(pPeer, bSsap, TESTPEER_PTYPE_DM, bDsap, &bReason, 1);
+        break;
+
+    case TESTPEER_PTYPE_DM:
+        pConnection = phlnLlcp_TestPeer_Find(pPeer, bDsap, bSsap);
+        if ((pConnection == NULL) || (wPduLength != 3))
+        {
+            ++pPeer->wErrors;
+            break;
+        }
+        pConnection->bConnected = 0;
+        pConnection->bReason = pPdu[2];
+        break;
+
+    case TESTPEER_PTYPE_I:
+    case TESTPEER_PTYPE_RR:
+    case TESTPEER_PTYPE_RNR:
+        pConnection = phlnLlcp_TestPeer_Find(pPeer, bDsap, bSsap);
+        if ((pConnection == NULL) || (wPduLength < 3))
+        {
+            ++pPeer->wErrors;
+            break;
+        }
+
+        phlnLlcp_TestPeer_Acknowledge(pPeer, pConnection, pPdu[2] & 0x0FU);
+
+        if (bPtype != TESTPEER_PTYPE_I)
+        {
+            pConnection->bRemoteBusy = (uint8_t)(bPtype == TESTPEER_PTYPE_RNR);
+            break;
+        }
+
+        /* In sequence, within the receive window of the peer and within its MIU */
+        wLength = wPduLength - 3;
+        if (((pPdu[2] >> 4) != pConnection->bVr) ||
+            (((pConnection->bVr - pConnection->bVra) & 0x0FU) >= pPeer->bRw) ||
+            (wLength > pPeer->wMiu) ||
+            ((pConnection->wRxLength + wLength) > PHLN_LLCP_TESTPEER_RX_SIZE))
+        {
+            ++pPeer->wErrors;
+            break;
+        }
+
+        memcpy(&pConnection->aRxData[pConnection->wRxLength], &pPdu[3], wLength);
+        pConnection->wRxLength = pConnection->wRxLength + wLength;
+        pConnection->bVr = (pConnection->bVr + 1) & 0x0FU;
+        pConnection->bReceived = 1;
+        ++pPeer->wIPdusLastFrame;
+
+        if (((pConnection->bVr - pConnection->bVra) & 0x0FU) > pPeer->bMaxUnacked)
+        {
+            pPeer->bMaxUnacked = (pConnection->bVr - pConnection->bVra) & 0x0FU;
+        }
+        break;
+
+    default:
+        ++pPeer->wErrors;
+        break;
+    }
+}
+
+static uint16_t phlnLlcp_TestPeer_BuildFrame(
+    phlnLlcp_TestPeer_t * pPeer,
+    uint8_t * pFrame,
+    uint16_t wFrameLimit
+    )
+{
+    phlnLlcp_TestPeer_Connection_t * pConnection;
+    uint8_t * pPayload;
+    uint16_t  wFramePos = 2;
+    uint16_t  wLength;
+    uint16_t  wPos;
+    uint8_t   bNumPdus = 0;
+    uint8_t   bIndex;
+
+    for (wPos = 0; wPos < pPeer->wControlLength; wPos = (uint16_t)(wPos + 2 + ((pPeer->aControl[wPos] << 8) | pPeer->aControl[wPos + 1])))
+    {
+        ++bNumPdus;
+    }
+    memcpy(&pFrame[wFramePos], pPeer->aControl, pPeer->wControlLength);
+    wFramePos = wFramePos + pPeer->wControlLength;
+    pPeer->wControlLength = 0;
+
+    for (bIndex = 0; bIndex < PHLN_LLCP_TESTPEER_MAX_CONNECTIONS; ++bIndex)
+    {
+        pConnection = &pPeer->aConnections[bIndex];
+        if (pConnection->bConnected == 0)
+        {
+            continue;
+        }
+
+        if (pConnection->bDiscPending != 0)
+        {
+            (void)phlnLlcp_TestPeer_AppendPdu(pFrame, &wFramePos, wFrameLimit,
+                pConnection->bRemoteSap, TESTPEER_PTYPE_DISC, pConnection->bLocalSap, 0);
+            pConnection->bDiscPending = 0;
+            ++bNumPdus;
+            continue;
+        }
+
+        while ((pConnection->wTxLength != 0) &&
+            (pConnection->bRemoteBusy == 0) &&
+            (((pConnection->bVs - pConnection->bVsa) & 0x0FU) < pConnection->bRemoteRw) &&
+            ((wFramePos + 2 + 3) < wFrameLimit))
+        {
+            wLength = wFrameLimit - (wFramePos + 2 + 3);
+            if (wLength > pConnection->wRemoteMiu)
+            {
+                wLength = pConnection->wRemoteMiu;
+            }
+            if (wLength > pConnection->wTxLength)
+            {
+                wLength = pConnection->wTxLength;
+            }
+
+            pPayload = phlnLlcp_TestPeer_AppendPdu(pFrame, &wFramePos, wFrameLimit,
+                pConnection->bRemoteSap, TESTPEER_PTYPE_I, pConnection->bLocalSap, 1 + wLength);
+            pPayload[0] = (uint8_t)((pConnection->bVs << 4) | pConnection->bVr);
+            memcpy(&pPayload[1], pConnection->pTxData, wLength);
+
+            pConnection->pTxData += wLength;
+            pConnection->wTxLength = pConnection->wTxLength - wLength;
+            pConnection->bVs = (pConnection->bVs + 1) & 0x0FU;
+            pConnection->bVra = pConnection->bVr;
+            ++bNumPdus;
+        }
+
+        /* Acknowledge only once the initiator sent a frame without I PDU on the data link,
+        * so it has to stop at the receive window of the peer */
+        if ((pConnection->bVr != pConnection->bVra) && (pConnection->bReceived == 0))
+        {
+            pPayload = phlnLlcp_TestPeer_AppendPdu(pFrame, &wFramePos, wFrameLimit,
+                pConnection->bRemoteSap, TESTPEER_PTYPE_RR, pConnection->bLocalSap, 1);
+            if (pPayload != NULL)
+            {
+                pPayload[0] = pConnection->bVr;
+                pConnection->bVra = pConnection->bVr;
+                ++bNumPdus;
+            }
+        }
+        pConnection->bReceived = 0;
+    }
+
+    if (bNumPdus == 0)
+    {
+        pFrame[0] = 0x00;
+        pFrame[1] = 0x00;
+        return 2;
+    }
+
+    if (bNumPdus == 1)
+    {
+        memmove(pFrame, &pFrame[4], (size_t)(wFramePos - 4));
+        return wFramePos - 4;
+    }
+
+    ++pPeer->wAgfOut;
+    pFrame[0] = (uint8_t)(TESTPEER_PTYPE_AGF >> 2);
+    pFrame[1] = (uint8_t)((TESTPEER_PTYPE_AGF & 0x03U) << 6);
+    return wFramePos;
+}
+
+void phlnLlcp_TestPeer_Init(
+                            phlnLlcp_TestPeer_t * pPeer,
+                            const uint8_t * pServiceName,
+                            uint8_t bServiceNameLength,
+                            uint8_t bRw,
+                            uint16_t wMiu,
+                            uint16_t wLinkMiu
+                            )
+{
+    memset(pPeer, 0x00, sizeof(phlnLlcp_TestPeer_t));
+    pPeer->pServiceName         = pServiceName;
+    pPeer->bServiceNameLength   = bServiceNameLength;
+    pPeer->bRw                  = bRw;
+    pPeer->wMiu                 = wMiu;
+    pPeer->wLinkMiu             = wLinkMiu;
+    pPeer->wRemoteLinkMiu       = TESTPEER_MIU_DEFAULT;
+}
+
+void phlnLlcp_TestPeer_GetAtrRes(
+                                 phlnLlcp_TestPeer_t * pPeer,
+                                 uint8_t * pGi,
+                                 uint8_t bGiLength,
+                                 uint8_t * pAtrRes,
+                                 uint8_t * pAtrResLength
+                                 )
+{
+    uint8_t bPos;
+    uint8_t bIndex;
+
+    pPeer->wRemoteLinkMiu = TESTPEER_MIU_DEFAULT;
+    if ((bGiLength < 3) || (memcmp(pGi, aTestPeer_Magic, 3) != 0))
+    {
+        ++pPeer->wErrors;
+    }
+    for (bPos = 3; (bPos + 2) <= bGiLength; bPos = (uint8_t)(bPos + 2 + pGi[bPos + 1]))
+    {
+        if ((pGi[bPos] == TESTPEER_PARAM_MIUX) && (pGi[bPos + 1] == 2))
+        {
+            pPeer->wRemoteLinkMiu = (uint16_t)(TESTPEER_MIU_DEFAULT + ((((uint16_t)pGi[bPos + 2] << 8) | pGi[bPos + 3]) & 0x07FFU));
+        }
+    }
+
+    /* Command, NFCID3, DID, BS, BR, TO and PP with general bytes present */
+    bPos = 0;
+    pAtrRes[bPos++] = 0xD5;
+    pAtrRes[bPos++] = 0x01;
+    for (bIndex = 0; bIndex < 10; ++bIndex)
+    {
+        pAtrRes[bPos++] = (uint8_t)(0xA0 + bIndex);
+    }
+    pAtrRes[bPos++] = 0x00;
+    pAtrRes[bPos++] = 0x00;
+    pAtrRes[bPos++] = 0x00;
+    pAtrRes[bPos++] = 0x0E;
+    pAtrRes[bPos++] = 0x32;
+
+    memcpy(&pAtrRes[bPos], aTestPeer_Magic, 3);
+    bPos = bPos + 3;
+    pAtrRes[bPos++] = TESTPEER_PARAM_VERSION;
+    pAtrRes[bPos++] = 1;
+    pAtrRes[bPos++] = 0x11;
+    pAtrRes[bPos++] = TESTPEER_PARAM_MIUX;
+    pAtrRes[bPos++] = 2;
+    pAtrRes[bPos++] = (uint8_t)((pPeer->wLinkMiu - TESTPEER_MIU_DEFAULT) >> 8);
+    pAtrRes[bPos++] = (uint8_t)(pPeer->wLinkMiu - TESTPEER_MIU_DEFAULT);
+    pAtrRes[bPos++] = TESTPEER_PARAM_WKS;
+    pAtrRes[bPos++] = 2;
+    pAtrRes[bPos++] = 0x00;
+    pAtrRes[bPos++] = 0x03;
+    *pAtrResLength = bPos;
+
+    pPeer->bActive = 1;
+    pPeer->wControlLength = 0;
+    memset(pPeer->aConnections, 0x00, sizeof(pPeer->aConnections));
+}
+
+void phlnLlcp_TestPeer_Send(
+                            phlnLlcp_TestPeer_t * pPeer,
+                            uint8_t bConnection,
+                            const uint8_t * pData,
+                            uint16_t wDataLength
+                            )
+{
+    pPeer->aConnections[bConnection].pTxData    = pData;
+    pPeer->aConnections[bConnection].wTxLength  = wDataLength;
+}
+
+void phlnLlcp_TestPeer_Disconnect(
+                                  phlnLlcp_TestPeer_t * pPeer,
+                                  uint8_t bConnection
+                                  )
+{
+    pPeer->aConnections[bConnection].bDiscPending = 1;
+}
+
+phStatus_t phpalI18092mPI_BulkExchange(
+                                       void * pDataParams,
+                                       uint8_t * pTxBuffer,
+                                       uint16_t wTxLength,
+                                       uint8_t * pRxBuffer,
+                                       uint16_t wRxBufferSize,
+                                       uint16_t * pRxLength,
+                                       phpalI18092mPI_BulkStats_t * pStats
+                                       )
+{
+    phlnLlcp_TestPeer_t * pPeer = (phlnLlcp_TestPeer_t *)pDataParams;
+    uint8_t  aFrame[TESTPEER_FRAME_SIZE];
+    uint16_t wFrameLimit;
+    uint16_t wFrameLength;
+    uint16_t wPos;
+    uint16_t wPduLength;
+
+    (void)pStats;
+    *pRxLength = 0;
+
+    if ((pPeer->bActive == 0) || (wTxLength < 2))
+    {
+        return PH_ADD_COMPCODE(PH_ERR_IO_TIMEOUT, PH_COMP_PAL_I18092MPI);
+    }
+
+    ++pPeer->wFrames;
+    pPeer->wIPdusLastFrame = 0;
+
+    /* The receive and transmit buffers may be the same, so the whole frame is read first */
+    if (wTxLength > (2 + pPeer->wLinkMiu))
+    {
+        ++pPeer->wErrors;
+    }
+    if (TESTPEER_PTYPE(pTxBuffer) == TESTPEER_PTYPE_AGF)
+    {
+        ++pPeer->wAgfIn;
+        for (wPos = 2; (wPos + 2) <= wTxLength; wPos = wPos + wPduLength)
+        {
+            wPduLength = (uint16_t)(((uint16_t)pTxBuffer[wPos] << 8) | pTxBuffer[wPos + 1]);
+            wPos = wPos + 2;
+            if ((wPduLength < 2) || ((wPos + wPduLength) > wTxLength))
+            {
+                ++pPeer->wErrors;
+                break;
+            }
+            phlnLlcp_TestPeer_HandlePdu(pPeer, &pTxBuffer[wPos], wPduLength);
+        }
+    }
+    else
+    {
+        phlnLlcp_TestPeer_HandlePdu(pPeer, pTxBuffer, wTxLength);
+    }
+
+    /* Deactivation is not answered */
+    if (pPeer->bActive == 0)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
+    }
+
+    wFrameLimit = 2 + pPeer->wRemoteLinkMiu;
+    if (wFrameLimit > sizeof(aFrame))
+    {
+        wFrameLimit = sizeof(aFrame);
+    }
+    wFrameLength = phlnLlcp_TestPeer_BuildFrame(pPeer, aFrame, wFrameLimit);
+
+    if (wFrameLength > wRxBufferSize)
+    {
+        return PH_ADD_COMPCODE(PH_ERR_BUFFER_OVERFLOW, PH_COMP_PAL_I18092MPI);
+    }
+
+    memcpy(pRxBuffer, aFrame, wFrameLength);
+    *pRxLength = wFrameLength;
+
+    return PH_ADD_COMPCODE(PH_ERR_SUCCESS, PH_COMP_PAL_I18092MPI);
+}
@@ -0,0 +1,132 @@
+/*
+*         Copyright (c), NXP Semiconductors Gratkorn / Austria
+*
+*                     (C)NXP Semiconductors
+*       All rights are reserved. Reproduction in whole or in part is
+*      prohibited without the written consent of the copyright owner.
+*  NXP reserves the right to make changes without notice at any time.
+* NXP makes no warranty, expressed, implied or statutory, including but
+* not limited to any implied warranty of merchantability or fitness for any
+*particular purpose, or that the use will not infringe any third party patent,
+* copyright or trademark. NXP must not be liable for any loss or damage
+*                          arising from its use.
+*/
+
+/** \file
+* In-process LLCP target used to test the LLCP Link Layer Component.
+* $Author$
+* $Revision$
+* $Date$
+*
+* History:
+*  Generated 19. October 2026
+*
+*/
+
+#ifndef PHLNLLCP_TESTPEER_H
+#define PHLNLLCP_TESTPEER_H
+
+#include <ph_Status.h>
+
+/**
+* The peer replaces #phpalI18092mPI_BulkExchange at link time; the LLCP component
+* has to be initialised with a pointer to a #phlnLlcp_TestPeer_t as ISO18092 layer.
+* It offers a single connection-oriented service, reachable by name through the
+* service discovery SAP or directly at #PHLN_LLCP_TESTPEER_SAP_SERVICE, and
+* records every violation of the LLCP rules by the initiator in \c wErrors.
+*/
+
+#define PHLN_LLCP_TESTPEER_MAX_CONNECTIONS  4U      /**< Number of simultaneous data links. */
+#define PHLN_LLCP_TESTPEER_SAP_SERVICE      0x10U   /**< SAP of the first data link of the service. */
+#define PHLN_LLCP_TESTPEER_RX_SIZE          2048U   /**< Data a data link can receive in total. */
+#define PHLN_LLCP_TESTPEER_CONTROL_SIZE     64U     /**< Space for waiting CC and DM PDUs. */
+
+/**
+* \brief Data link of the peer.
+*/
+typedef struct
+{
+    uint8_t bConnected;                 /**< Unequal '0' if the data link is established. */
+    uint8_t bLocalSap;                  /**< SAP of the peer. */
+    uint8_t bRemoteSap;                 /**< SAP of the initiator. */
+    uint8_t bRemoteRw;                  /**< Receive window of the initiator. */
+    uint16_t wRemoteMiu;                /**< MIU of the initiator. */
+    uint8_t bRemoteBusy;                /**< Unequal '0' if the initiator sent RNR. */
+    uint8_t bVs;                        /**< Send state variable V(S). */
+    uint8_t bVsa;                       /**< Send acknowledgement state variable V(SA). */
+    uint8_t bVr;                        /**< Receive state variable V(R). */
+    uint8_t bVra;                       /**< Receive acknowledgement state variable V(RA). */
+    uint8_t bReceived;                  /**< Unequal '0' if the current frame carried an I PDU. */
+    uint8_t bDiscPending;               /**< Unequal '0' if a DISC PDU is waiting to be sent. */
+    uint8_t bReason;                    /**< Reason of the last DM PDU received; 0xFF if none. */
+    const uint8_t * pTxData;            /**< Data which has not been sent yet. */
+    uint16_t wTxLength;                 /**< Number of bytes which have not been sent yet. */
+    uint8_t aRxData[PHLN_LLCP_TESTPEER_RX_SIZE];   /**< Data received on the data link. */
+    uint16_t wRxLength;                 /**< Number of bytes received on the data link. */
+} phlnLlcp_TestPeer_Connection_t;
+
+/**
+* \brief State of the peer.
+*/
+typedef struct
+{
+    const uint8_t * pServiceName;       /**< Name of the offered service. */
+    uint8_t bServiceNameLength;         /**< Length of the service name. */
+    uint8_t bRw;                        /**< Receive window offered per data link. */
+    uint16_t wMiu;                      /**< MIU offered per data link. */
+    uint16_t wLinkMiu;                  /**< Link MIU of the peer. */
+    uint16_t wRemoteLinkMiu;            /**< Link MIU of the initiator. */
+    uint8_t bActive;                    /**< Unequal '0' if the LLCP link is activated. */
+    phlnLlcp_TestPeer_Connection_t aConnections[PHLN_LLCP_TESTPEER_MAX_CONNECTIONS];   /**< Data links. */
+    uint8_t aControl[PHLN_LLCP_TESTPEER_CONTROL_SIZE];     /**< Waiting CC and DM PDUs, each preceded by its length. */
+    uint16_t wControlLength;            /**< Number of bytes in \c aControl. */
+    uint16_t wFrames;                   /**< Number of frames exchanged. */
+    uint16_t wAgfIn;                    /**< Number of AGF PDUs received. */
+    uint16_t wAgfOut;                   /**< Number of AGF PDUs sent. */
+    uint16_t wIPdusLastFrame;           /**< Number of I PDUs within the last frame received. */
+    uint8_t bMaxUnacked;                /**< Largest number of unacknowledged I PDUs received on a data link. */
+    uint16_t wErrors;                   /**< Number of protocol violations of the initiator. */
+} phlnLlcp_TestPeer_t;
+
+/**
+* \brief Initialise the peer.
+*/
+void phlnLlcp_TestPeer_Init(
+                            phlnLlcp_TestPeer_t * pPeer,        /**< [In] Peer. */
+                            const uint8_t * pServiceName,       /**< [In] Name of the offered service. */
+                            uint8_t bServiceNameLength,         /**< [In] Length of the service name. */
+                            uint8_t bRw,                        /**< [In] Receive window per data link; 1-15 */
+                            uint16_t wMiu,                      /**< [In] MIU per data link; 128-2175 */
+                            uint16_t wLinkMiu                   /**< [In] Link MIU; 128-2175 */
+                            );
+
+/**
+* \brief Answer an ATR_REQ carrying the given general bytes, which activates the LLCP link.
+*/
+void phlnLlcp_TestPeer_GetAtrRes(
+                                 phlnLlcp_TestPeer_t * pPeer,   /**< [In] Peer. */
+                                 uint8_t * pGi,                 /**< [In] General bytes of the ATR_REQ. */
+                                 uint8_t bGiLength,             /**< [In] Length of the general bytes. */
+                                 uint8_t * pAtrRes,             /**< [Out] ATR_RES; uint8_t[64]. */
+                                 uint8_t * pAtrResLength        /**< [Out] Length of the ATR_RES. */
+                                 );
+
+/**
+* \brief Queue data to be sent on a data link; the buffer has to stay available.
+*/
+void phlnLlcp_TestPeer_Send(
+                            phlnLlcp_TestPeer_t * pPeer,        /**< [In] Peer. */
+                            uint8_t bConnection,                /**< [In] Index of the data link. */
+                            const uint8_t * pData,              /**< [In] Data to send. */
+                            uint16_t wDataLength                /**< [In] Length of the data. */
+                            );
+
+/**
+* \brief Close a data link from the side of the peer.
+*/
+void phlnLlcp_TestPeer_Disconnect(
+                                  phlnLlcp_TestPeer_t * pPeer,  /**< [In] Peer. */
+                                  uint8_t bConnection           /**< [In] Index of the data link. */
+                                  );
+
+#endif /* PHLNLLCP_TESTPEER_H */